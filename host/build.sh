@@ -0,0 +1,70 @@
+#!/usr/bin/env bash
+#
+# Host (Linux) build: bir sketch'i kütüphanelerle birlikte host HAL'e karşı derler.
+#
+# Kullanım:
+#   host/build.sh <sketch_dir> [nicemcu|bw16kit] [-- run args...]
+#
+# Çıktı: _host_build/<board>/<sketch>/<sketch>
+# "--" sonrası argümanlar verilirse derlenen binary çalıştırılır.
+#
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+if [[ $# -lt 1 ]]; then
+    echo "usage: $0 <sketch_dir> [nicemcu|bw16kit] [-- run args...]" >&2
+    exit 2
+fi
+
+SKETCH_DIR="$(cd "$1" && pwd)"
+shift
+
+BOARD="nicemcu"
+if [[ $# -gt 0 && "$1" != "--" ]]; then
+    BOARD="$1"
+    shift
+fi
+
+case "$BOARD" in
+    nicemcu) BOARD_FLAG="-DBOARD_NICEMCU" ;;
+    bw16kit) BOARD_FLAG="-DBOARD_BW16KIT" ;;
+    *) echo "unknown board: $BOARD" >&2; exit 2 ;;
+esac
+
+NAME="$(basename "$SKETCH_DIR")"
+OUT="$ROOT/_host_build/$BOARD/$NAME"
+mkdir -p "$OUT"
+
+# .ino -> .cpp (Arduino builder gibi Arduino.h'i önce ekle)
+INO="$SKETCH_DIR/$NAME.ino"
+if [[ ! -f "$INO" ]]; then
+    echo "sketch not found: $INO" >&2
+    exit 2
+fi
+printf '#include <Arduino.h>\n#include "%s"\n' "$INO" > "$OUT/sketch.cpp"
+
+INCLUDES=( -I"$ROOT/host/include" -I"$SKETCH_DIR" )
+SOURCES=( "$OUT/sketch.cpp" )
+for lib in "$ROOT"/libraries/*/src; do
+    INCLUDES+=( -I"$lib" )
+done
+while IFS= read -r -d '' src; do
+    SOURCES+=( "$src" )
+done < <(find "$ROOT/host/src" "$ROOT"/libraries/*/src "$SKETCH_DIR" -name '*.cpp' -print0 | sort -z)
+
+CXX="${CXX:-g++}"
+CXXFLAGS="${CXXFLAGS:--O2 -g}"
+
+# shellcheck disable=SC2086
+"$CXX" -std=c++17 $CXXFLAGS -Wall -Wextra -Wno-unused-parameter \
+    -DRTL8720_HOST -DARDUINO=10819 $BOARD_FLAG \
+    "${INCLUDES[@]}" "${SOURCES[@]}" \
+    -o "$OUT/$NAME" -lm -lpthread -lssl -lcrypto
+
+echo "[host] built $OUT/$NAME" >&2
+
+if [[ $# -gt 0 && "$1" == "--" ]]; then
+    shift
+    exec "$OUT/$NAME" "$@"
+fi
@@ -0,0 +1,89 @@
+/**
+ * @file Arduino.h
+ * @brief Host (Linux) stand-in for the AmebaD Arduino core
+ *
+ * Kütüphanelerin kullandığı Arduino yüzeyinin userspace implementasyonu:
+ * - Serial / Serial1  : stdio ve PTY
+ * - digitalWrite      : pin-state log
+ * - analogRead        : scripted waveform
+ * - millis / delay    : sanal saat
+ *
+ * Senaryo kontrolü için bkz: HostSim.h
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include "WString.h"
+#include "Print.h"
+#include "IPAddress.h"
+#include "HardwareSerial.h"
+
+#define ARDUINO_HOST_CORE       1
+
+// ============================================================================
+// Pin API
+// ============================================================================
+#define LOW                     0x0
+#define HIGH                    0x1
+
+#define INPUT                   0x00
+#define OUTPUT                  0x01
+#define INPUT_PULLUP            0x02
+#define INPUT_PULLDOWN          0x03
+#define OUTPUT_OPENDRAIN        0x04
+
+#define CHANGE                  0x02
+#define FALLING                 0x03
+#define RISING                  0x04
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint32_t pin, uint32_t mode);
+void digitalWrite(uint32_t pin, uint32_t value);
+int digitalRead(uint32_t pin);
+int analogRead(uint32_t pin);
+void analogWrite(uint32_t pin, uint32_t value);
+void analogReadResolution(int bits);
+
+void attachInterrupt(uint32_t pin, void (*callback)(void), uint32_t mode);
+void detachInterrupt(uint32_t pin);
+
+// Tek çekirdek simülasyonu - kesme maskeleme gerekmiyor
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// ============================================================================
+// Time API (sanal saat)
+// ============================================================================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ============================================================================
+// Math / Random
+// ============================================================================
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// ============================================================================
+// Sketch entry points
+// ============================================================================
+void setup();
+void loop();
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,69 @@
+/**
+ * @file HardwareSerial.h
+ * @brief Host stand-in for the AmebaD UART classes
+ *
+ * - Serial  (LOG_UART) : stdin/stdout (pipe)
+ * - Serial1 (LP_UART)  : pseudo-terminal; slave yolu begin() sırasında
+ *                        stderr'e yazılır (HOST_SERIAL1=stdio ile stdout'a bağlanır)
+ */
+
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Print.h"
+
+class HardwareSerial : public Stream {
+public:
+    enum class Backend {
+        Stdio,      // stdin/stdout
+        Pty         // posix_openpt master
+    };
+
+    HardwareSerial(const char* name, Backend backend);
+
+    void begin(unsigned long baud);
+    void end();
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    operator bool() const { return _open; }
+
+    /**
+     * @brief PTY slave yolu (Pty backend değilse boş string)
+     */
+    const char* devicePath() const { return _devicePath; }
+
+    /**
+     * @brief Toplam gönderilen/alınan byte sayısı (benchmark için)
+     */
+    size_t bytesWritten() const { return _bytesWritten; }
+    size_t bytesRead() const { return _bytesRead; }
+
+private:
+    const char* _name;
+    Backend _backend;
+    bool _open;
+    int _readFd;
+    int _writeFd;
+    int _peeked;
+    unsigned long _baud;
+    size_t _bytesWritten;
+    size_t _bytesRead;
+    char _devicePath[64];
+
+    int fetch();
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+#endif // HOST_HARDWARE_SERIAL_H
@@ -0,0 +1,482 @@
+/**
+ * @file HostSim.h
+ * @brief Scenario control for the host simulation HAL
+ *
+ * Sketch veya benchmark kodunun host üzerinde donanım davranışını
+ * senaryolaştırması için kullanılır. Cihaz build'inde bu header yoktur;
+ * kullanan kod `#if defined(RTL8720_HOST)` ile korunmalıdır.
+ */
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <vector>
+
+namespace hostsim {
+
+// ============================================================================
+// Virtual clock / discrete-event scheduler
+// ============================================================================
+
+/**
+ * @brief Sanal saat (mikrosaniye)
+ */
+uint64_t nowMicros();
+
+/**
+ * @brief Sanal saati ileri al
+ *
+ * Aradaki zamanlanmış event'ler sırayla (zaman, sonra kayıt sırası) ve kendi
+ * zamanlarında çalıştırılır. delay(), millis() ve WiFi scan bu fonksiyonu
+ * kullanır; saat hiçbir zaman gerçek zamanı beklemez.
+ */
+void advanceMicros(uint64_t us);
+
+/**
+ * @brief millis()/micros() çağrısı başına sanal saat maliyeti
+ *
+ * Busy-wait döngülerinin (ör. `while (millis() - start < timeout)`)
+ * host'ta sonlanabilmesi için her zaman sorgusu saati bu kadar ilerletir.
+ * @param us Mikrosaniye (default: 1)
+ */
+void setClockQueryCost(uint32_t us);
+
+typedef uint32_t EventId;
+typedef std::function<void()> EventCallback;
+
+/**
+ * @brief Mutlak sanal zamanda çalışacak event
+ * @param name Instrumentation için isim (statik ömürlü string)
+ * @return Event id (0: geçersiz)
+ */
+EventId scheduleAt(uint64_t timeUs, EventCallback callback, const char* name = "event");
+
+/**
+ * @brief Şu andan delayUs sonra çalışacak event
+ */
+EventId scheduleAfter(uint64_t delayUs, EventCallback callback, const char* name = "event");
+
+/**
+ * @brief periodUs aralıkla tekrarlanan event (cancel() ile durdurulur)
+ */
+EventId scheduleEvery(uint64_t periodUs, EventCallback callback, const char* name = "periodic");
+
+/**
+ * @brief Bekleyen event'i iptal et
+ * @return false: event yok veya zaten çalıştı
+ */
+bool cancel(EventId id);
+
+/**
+ * @brief Bekleyen event sayısı
+ */
+size_t pendingEvents();
+
+/**
+ * @brief Pine kare dalga uygula (driveInput ile, ISR'ları tetikler)
+ * @param frequencyHz 0 ise pin sabit kalır
+ * @return Periyodik event id (cancel() ile durdurulur)
+ */
+EventId driveSquareWave(uint8_t pin, float frequencyHz);
+
+// ============================================================================
+// Instrumentation
+// ============================================================================
+
+enum class TraceKind {
+    Event,          // scheduleAt/After/Every callback
+    Interrupt,      // attachInterrupt callback (driveInput)
+    Delay           // delay() / delayMicroseconds()
+};
+
+/**
+ * @brief Tek bir simülasyon adımının kaydı
+ */
+struct Trace {
+    TraceKind kind;
+    const char* name;       // Event adı, "isr" veya "delay"
+    EventId id;             // Sadece Event için
+    uint64_t timeUs;        // Başlangıç sanal zamanı
+    uint64_t virtualUs;     // Delay: atlanan sanal süre
+    uint64_t hostNs;        // Callback'in host'ta harcadığı süre
+};
+
+typedef void (*TraceHook)(const Trace& trace, void* user);
+
+/**
+ * @brief Her event/ISR/delay sonrası çağrılacak hook (nullptr: kapat)
+ */
+void setTraceHook(TraceHook hook, void* user = nullptr);
+
+/**
+ * @brief Simülasyon sayaçları
+ */
+struct SimStats {
+    uint64_t eventsFired;
+    uint64_t interruptsFired;
+    uint64_t delayCalls;
+    uint64_t delayedUs;         // delay() ile atlanan toplam sanal süre
+    uint64_t callbackNs;        // Event + ISR callback'lerinde harcanan host süresi
+};
+
+const SimStats& simStats();
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+struct PinEvent {
+    uint64_t timeUs;
+    uint8_t pin;
+    uint8_t value;
+};
+
+/**
+ * @brief digitalWrite() geçmişi (sadece seviye değişimleri)
+ */
+const std::vector<PinEvent>& pinLog();
+void clearPinLog();
+
+/**
+ * @brief Pin log'unu dosyaya da yaz (CSV: time_us,pin,value)
+ * @param path nullptr ise dosya kapatılır
+ */
+bool setPinLogFile(const char* path);
+
+/**
+ * @brief Pinin son yazılan/sürülen seviyesi
+ */
+uint8_t pinLevel(uint8_t pin);
+
+/**
+ * @brief Giriş pinini dışarıdan sür (attachInterrupt callback'lerini tetikler)
+ */
+void driveInput(uint8_t pin, uint8_t level);
+
+// ============================================================================
+// ADC
+// ============================================================================
+
+enum class Waveform {
+    Constant,
+    Sine,
+    Square,
+    Triangle,
+    Sawtooth,
+    Noise
+};
+
+/**
+ * @brief analogRead() için scripted dalga formu
+ *
+ * Değer: offset + amplitude * shape(t / periodMs), 0-4095 aralığına kırpılır.
+ */
+struct AdcScript {
+    Waveform shape;
+    float offset;
+    float amplitude;
+    uint32_t periodMs;
+};
+
+void setAdcWaveform(uint8_t pin, const AdcScript& script);
+
+/**
+ * @brief analogRead() için özel kaynak (waveform'u geçersiz kılar)
+ */
+void setAdcSource(uint8_t pin, int (*source)(uint8_t pin, uint64_t timeUs));
+
+// ============================================================================
+// WiFi
+// ============================================================================
+
+/**
+ * @brief Taramada görünecek erişim noktası
+ */
+struct ScriptedNetwork {
+    const char* ssid;
+    uint8_t bssid[6];
+    int32_t rssi;
+    uint8_t channel;
+    uint8_t encryption;     // WiFiModule::encryptionTypeToString kodları
+};
+
+void wifiAddNetwork(const ScriptedNetwork& network);
+void wifiClearNetworks();
+
+/**
+ * @brief Aynı BSSID'li ağı güncelle (RSSI / kanal değişimi), yoksa ekle
+ */
+void wifiUpdateNetwork(const ScriptedNetwork& network);
+
+/**
+ * @brief BSSID'li ağı kaldır (AP kapandı)
+ * @return false: böyle bir ağ yok
+ */
+bool wifiRemoveNetwork(const uint8_t bssid[6]);
+
+/**
+ * @brief scanNetworks() çağrısının sanal süresi
+ */
+void wifiSetScanDuration(uint32_t ms);
+
+/**
+ * @brief associateMs'in SSID aramasına (tüm kanallar) harcanan kısmı
+ *
+ * wifi_set_pscan_chan ile doğru kanal + wifi_connect_bssid ile doğru BSSID
+ * verilirse bu süre tek kanal taramasına (~60 ms) iner. Default: 1000 ms.
+ */
+void wifiSetFullScanMs(uint32_t ms);
+
+/**
+ * @brief Bir SSID için bağlantı senaryosu
+ *
+ * WiFi.begin() hemen döner; WiFi.status() associateMs sonra WL_CONNECTED,
+ * localIP() ise associateMs + dhcpMs sonra atanmış olur.
+ */
+struct ConnectScript {
+    uint32_t associateMs;
+    uint32_t dhcpMs;
+    bool succeed;
+    uint8_t ip[4];
+};
+
+void wifiSetConnectScript(const char* ssid, const ConnectScript& script);
+
+/**
+ * @brief Mevcut bağlantıyı düşür (AP kaybı simülasyonu)
+ * @param outageMs Bu süre boyunca yeni bağlantı denemeleri başarısız olur
+ *                 (AP reboot / kapsama dışı). 0: hemen yeniden bağlanılabilir
+ */
+void wifiDropLink(uint32_t outageMs = 0);
+
+/**
+ * @brief WiFi.begin() çağrı sayısı
+ */
+uint32_t wifiBeginCount();
+
+/**
+ * @brief wifi_enable/disable_powersave ve wifi_set_lps_dtim ile ayarlanan durum
+ */
+bool wifiPowerSaveEnabled();
+uint8_t wifiLpsDtim();
+
+/**
+ * @brief Bağlı AP'ye frame gönder (sketch'in socket yazmasının yerine)
+ *
+ * Airtime = bytes * 8 / 24 Mbps + 100 us (DIFS, backoff, ACK); frame'ler
+ * sırayla kuyruğa girer. AP 2.4 GHz kanalındaysa bu süre boyunca ortam
+ * meşguldür: denk gelen BLE advertising event'leri duyulmaz
+ * (bleScanCollisionCount).
+ * @return false: IP yok veya TX kuyruğu dolu (2 ms'den fazla bekleyen airtime)
+ */
+bool wifiTransmit(uint32_t bytes);
+uint64_t wifiTxBytes();
+uint64_t wifiTxAirtimeUs();
+
+// ============================================================================
+// UDP loopback (lwip/udp.h, lwip/pbuf.h)
+// ============================================================================
+
+/**
+ * @brief udp_sendto ile gönderilen en eski datagram'ı al (alıcı tarafı)
+ *
+ * Kuyruk 64 datagram tutar; dolarsa en eski üzerine yazılır
+ * (udpLoopbackOverwritten).
+ * @param port Hedef port (nullptr olabilir)
+ * @return Datagram uzunluğu (0: kuyruk boş, max'tan uzunsa kırpılır)
+ */
+size_t udpLoopbackPop(uint8_t* out, size_t max, uint16_t* port = nullptr);
+uint32_t udpLoopbackCount();
+uint64_t udpLoopbackBytes();
+uint32_t udpLoopbackOverwritten();
+
+/**
+ * @brief Pool'da kullanımda olan pbuf sayısı (sızıntı kontrolü)
+ */
+uint8_t pbufInUse();
+
+// ============================================================================
+// Flash (flash_api.h)
+// ============================================================================
+
+/**
+ * @brief Tüm flash'ı sil (0xFF) ve sayaçları sıfırla
+ */
+void flashReset();
+
+/**
+ * @brief Sector erase / stream write çağrı sayısı (aşınma ölçümü)
+ */
+uint32_t flashEraseCount();
+uint32_t flashWriteCount();
+
+// ============================================================================
+// Clock (ameba_soc.h)
+// ============================================================================
+
+/**
+ * @brief CPU_ClkSet ile seçilen KM4 clock'u (Hz, default 200 MHz)
+ */
+uint32_t cpuClockHz();
+
+// ============================================================================
+// BLE (gap_adv.h)
+// ============================================================================
+
+/**
+ * @brief le_adv_start / le_adv_stop ile belirlenen advertising durumu
+ */
+bool bleAdvertising();
+
+/**
+ * @brief Controller'daki advertising data
+ * @param out En az 31 byte (nullptr: sadece uzunluk)
+ * @return Data uzunluğu
+ */
+uint8_t bleAdvData(uint8_t* out);
+
+/**
+ * @brief GAP_PARAM_ADV_EVENT_TYPE (GAP_ADTYPE_ADV_*)
+ */
+uint8_t bleAdvEventType();
+
+/**
+ * @brief GAP_PARAM_ADV_INTERVAL_MIN (us)
+ */
+uint32_t bleAdvIntervalUs();
+
+/**
+ * @brief le_adv_start çağrı sayısı / advertising sürerken le_adv_update_param sayısı
+ *
+ * Payload rotation'ın advertising'i yeniden başlatmadığını doğrulamak için.
+ */
+uint32_t bleAdvStartCount();
+uint32_t bleAdvUpdateCount();
+
+// ============================================================================
+// BLE scan (gap_scan.h)
+// ============================================================================
+
+/**
+ * @brief Taramada görünecek advertiser
+ *
+ * Tarama sürerken her intervalMs (+0-10 ms advDelay) bir rapor üretilir;
+ * scan window / interval oranında raporlar kaçırılır, RSSI +-4 dB oynar.
+ * Active modda scanRspLen > 0 ise taranabilir PDU'ların ardından scan
+ * response raporu da gelir.
+ */
+struct ScriptedBleDevice {
+    uint8_t addr[6];            // LSB first
+    uint8_t addrType;           // GAP_REMOTE_ADDR_LE_*
+    uint8_t advType;            // GAP_ADV_EVT_TYPE_*
+    int8_t rssi;
+    uint16_t intervalMs;
+    uint8_t dataLen;
+    uint8_t data[31];
+    uint8_t scanRspLen;
+    uint8_t scanRsp[31];
+};
+
+void bleAddDevice(const ScriptedBleDevice& device);
+
+/**
+ * @brief Adresli advertiser'ı kaldır (kapsama dışı / pil bitti)
+ * @return false: böyle bir cihaz yok
+ */
+bool bleRemoveDevice(const uint8_t addr[6]);
+void bleClearDevices();
+
+bool bleScanning();
+
+/**
+ * @brief le_register_app_cb'ye verilen rapor sayısı (scan response dahil)
+ */
+uint32_t bleScanReportCount();
+
+/**
+ * @brief Scan window'una düştüğü halde WiFi TX ile çakıştığı için
+ *        duyulmayan advertising event sayısı
+ */
+uint32_t bleScanCollisionCount();
+
+// ============================================================================
+// BLE connection / GATT server (gap_conn_le.h, profile_server.h)
+// ============================================================================
+
+/**
+ * @brief Bize bağlanan scripted central (ör. telefon)
+ *
+ * Link sonuçları peer'in yetenekleriyle sınırlanır: MTU = min(mtu,
+ * gap_config_max_mtu_size), DLE = min(le_set_data_len, maxTxOctets), 2M PHY
+ * sadece supports2M ise. Her connection event'inde interval'e (ve
+ * maxPacketsPerEvent'e) sığan notification'lar iletilir; PDU süreleri
+ * PHY ve LL payload uzunluğundan hesaplanır.
+ */
+struct BlePeerScript {
+    uint16_t mtu;
+    uint16_t maxTxOctets;           // 27: DLE yok, 251: tam DLE
+    bool supports2M;
+    uint32_t intervalUs;            // Connection interval (7500-4000000)
+    uint8_t maxPacketsPerEvent;     // 0: interval dolana kadar
+    uint32_t subscribeAfterMs;      // Bağlantıdan sonra CCCD'ye notify yazılır
+};
+
+/**
+ * @return false: bağlanılabilir advertising yok veya zaten bağlı
+ */
+bool blePeerConnect(const BlePeerScript& peer);
+
+/**
+ * @brief Peer bağlantıyı keser (remote terminated)
+ */
+void blePeerDisconnect();
+bool blePeerConnected();
+
+/**
+ * @brief Peer'e ulaşan en eski notification'ı al (en fazla 1024 saklanır)
+ * @param out En az 244 byte
+ * @return false: bekleyen notification yok
+ */
+bool blePeerPopNotification(uint8_t* out, uint16_t* length);
+
+/**
+ * @brief Peer yazılabilir ilk characteristic'e write command gönderir
+ */
+bool blePeerWrite(const uint8_t* data, uint16_t length);
+
+uint32_t blePeerNotificationCount();
+uint64_t blePeerNotificationBytes();
+
+/**
+ * @brief Controller TX buffer sayısı (GAP_PARAM_LE_REMAIN_CREDITS, default 10)
+ */
+void bleSetTxCredits(uint8_t credits);
+
+// ============================================================================
+// Heap
+// ============================================================================
+
+/**
+ * @brief Başlangıçtan beri operator new çağrı sayısı / toplam byte
+ *
+ * String dahil tüm C++ allocation'ları sayılır; iki okuma arasındaki fark
+ * bir kod yolunun heap kullanımını verir.
+ */
+uint64_t heapAllocCount();
+uint64_t heapAllocBytes();
+
+// ============================================================================
+// Run control
+// ============================================================================
+
+/**
+ * @brief loop() döngüsünü sonlandır (main() çıkış yapar)
+ */
+void requestStop(int exitCode = 0);
+
+} // namespace hostsim
+
+#endif // HOST_SIM_H
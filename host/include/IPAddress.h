@@ -0,0 +1,42 @@
+/**
+ * @file IPAddress.h
+ * @brief Host stand-in for the Arduino IPAddress class
+ */
+
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include <string.h>
+#include "Print.h"
+
+class IPAddress : public Printable {
+public:
+    IPAddress() { memset(_octets, 0, sizeof(_octets)); }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+        _octets[0] = a; _octets[1] = b; _octets[2] = c; _octets[3] = d;
+    }
+    explicit IPAddress(uint32_t address) { memcpy(_octets, &address, sizeof(_octets)); }
+    explicit IPAddress(const uint8_t* address) { memcpy(_octets, address, sizeof(_octets)); }
+
+    operator uint32_t() const {
+        uint32_t address;
+        memcpy(&address, _octets, sizeof(address));
+        return address;
+    }
+
+    uint8_t operator[](int index) const { return _octets[index]; }
+    uint8_t& operator[](int index) { return _octets[index]; }
+
+    bool operator==(const IPAddress& rhs) const { return memcmp(_octets, rhs._octets, 4) == 0; }
+    bool operator!=(const IPAddress& rhs) const { return !(*this == rhs); }
+
+    bool fromString(const char* address);
+
+    size_t printTo(Print& p) const override;
+
+private:
+    uint8_t _octets[4];
+};
+
+#endif // HOST_IPADDRESS_H
@@ -0,0 +1,60 @@
+/**
+ * @file WString.h
+ * @brief Host stand-in for the Arduino String class
+ *
+ * Sadece kütüphanelerin kullandığı alt küme: kopyalama, birleştirme,
+ * sayıdan string üretme ve c_str() erişimi.
+ */
+
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class String {
+public:
+    String() = default;
+    String(const char* cstr) : _str(cstr ? cstr : "") {}
+    String(const std::string& str) : _str(str) {}
+    explicit String(char c) : _str(1, c) {}
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(double value, unsigned char decimals = 2);
+
+    unsigned int length() const { return static_cast<unsigned int>(_str.size()); }
+    const char* c_str() const { return _str.c_str(); }
+    bool reserve(unsigned int size) { _str.reserve(size); return true; }
+
+    char charAt(unsigned int index) const { return index < _str.size() ? _str[index] : '\0'; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    String& operator+=(const String& rhs) { _str += rhs._str; return *this; }
+    String& operator+=(const char* rhs) { if (rhs) _str += rhs; return *this; }
+    String& operator+=(char c) { _str += c; return *this; }
+
+    bool operator==(const String& rhs) const { return _str == rhs._str; }
+    bool operator==(const char* rhs) const { return _str == (rhs ? rhs : ""); }
+    bool operator!=(const String& rhs) const { return !(*this == rhs); }
+    bool operator!=(const char* rhs) const { return !(*this == rhs); }
+
+    bool equals(const String& rhs) const { return *this == rhs; }
+    bool startsWith(const String& prefix) const { return _str.compare(0, prefix._str.size(), prefix._str) == 0; }
+    int indexOf(char c) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    void trim();
+    long toInt() const;
+
+    friend String operator+(const String& lhs, const String& rhs) { return String(lhs._str + rhs._str); }
+    friend String operator+(const String& lhs, const char* rhs) { return String(lhs._str + (rhs ? rhs : "")); }
+    friend String operator+(const char* lhs, const String& rhs) { return String((lhs ? lhs : "") + rhs._str); }
+
+private:
+    std::string _str;
+};
+
+#endif // HOST_WSTRING_H
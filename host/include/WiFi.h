@@ -0,0 +1,72 @@
+/**
+ * @file WiFi.h
+ * @brief Host stand-in for the AmebaD WiFiClass
+ *
+ * Tarama ve bağlantı sonuçları HostSim.h üzerinden senaryolaştırılır.
+ * İmza ve dönüş tipleri AmebaD SDK WiFi.h ile aynıdır.
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+// wl_definitions.h
+#define WL_SSID_MAX_LENGTH      32
+#define WL_WPA_KEY_MAX_LENGTH   63
+#define WL_MAC_ADDR_LENGTH      6
+#define WL_NETWORKS_LIST_MAXNUM 50
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+} wl_status_t;
+
+class WiFiClass {
+public:
+    WiFiClass();
+
+    // Connection
+    int begin(char* ssid);
+    int begin(char* ssid, const char* passphrase);
+    int disconnect();
+    uint8_t status();
+
+    int apbegin(char* ssid, char* channel);
+    int apbegin(char* ssid, char* password, char* channel);
+    int enableConcurrent();
+    int disablePowerSave();
+
+    void config(IPAddress localIp);
+    void config(IPAddress localIp, IPAddress dnsServer, IPAddress gateway, IPAddress subnet);
+
+    // Connected network info
+    char* SSID();
+    uint8_t* BSSID(uint8_t* bssid);
+    int32_t RSSI();
+    uint8_t encryptionType();
+    IPAddress localIP();
+    IPAddress subnetMask();
+    IPAddress gatewayIP();
+    uint8_t* macAddress(uint8_t* mac);
+
+    // Scan
+    int8_t scanNetworks();
+    char* SSID(uint8_t networkItem);
+    int32_t RSSI(uint8_t networkItem);
+    uint8_t encryptionType(uint8_t networkItem);
+    uint32_t encryptionTypeEx(uint8_t networkItem);
+
+private:
+    char _ssidBuf[WL_SSID_MAX_LENGTH + 1];
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
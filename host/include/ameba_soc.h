@@ -0,0 +1,35 @@
+/**
+ * @file ameba_soc.h
+ * @brief Host stand-in for the AmebaD SoC header subset (KM4 CPU clock)
+ *
+ * Sadece kütüphanelerin kullandığı CPU_ClkSet / CPU_ClkGet. Seçilen clock
+ * hostsim::cpuClockHz() ile okunabilir; sanal saat hızını etkilemez.
+ */
+
+#ifndef HOST_AMEBA_SOC_H
+#define HOST_AMEBA_SOC_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CLK_KM4_200M            0
+#define CLK_KM4_100M            1
+#define CLK_KM4_50M             2
+#define CLK_KM4_25M             3
+#define CLK_KM4_XTAL            4
+
+void CPU_ClkSet(uint8_t CpuType);
+
+/**
+ * @return Güncel KM4 clock (Hz)
+ */
+uint32_t CPU_ClkGet(uint8_t Is_FPGA);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_AMEBA_SOC_H
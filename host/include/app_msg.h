@@ -0,0 +1,31 @@
+/**
+ * @file app_msg.h
+ * @brief Host stand-in for the AmebaD BT application IO message
+ */
+
+#ifndef HOST_APP_MSG_H
+#define HOST_APP_MSG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EVENT_IO_TO_APP             0x01
+#define IO_MSG_TYPE_BT_STATUS       0x00
+
+typedef struct {
+    uint16_t type;
+    uint16_t subtype;
+    union {
+        uint32_t param;
+        void* buf;
+    } u;
+} T_IO_MSG;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_APP_MSG_H
@@ -0,0 +1,34 @@
+/**
+ * @file flash_api.h
+ * @brief Host stand-in for the AmebaD mbed flash HAL
+ *
+ * 2 MB NOR flash emülasyonu: silinmiş byte 0xFF, yazma sadece bit temizler.
+ * HOST_FLASH=<dosya> ile içerik çalıştırmalar arasında korunur (brownout /
+ * reboot simülasyonu). Erase ve program işlemleri sanal saati ilerletir.
+ */
+
+#ifndef HOST_FLASH_API_H
+#define HOST_FLASH_API_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLASH_SECTOR_SIZE       0x1000
+#define HOST_FLASH_SIZE         0x200000
+
+typedef struct flash_s {
+    int unused;
+} flash_t;
+
+void flash_erase_sector(flash_t* obj, uint32_t address);
+int flash_stream_read(flash_t* obj, uint32_t address, uint32_t len, uint8_t* data);
+int flash_stream_write(flash_t* obj, uint32_t address, uint32_t len, uint8_t* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_FLASH_API_H
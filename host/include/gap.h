@@ -0,0 +1,36 @@
+/**
+ * @file gap.h
+ * @brief Host stand-in for the AmebaD common GAP parameter API subset
+ */
+
+#ifndef HOST_GAP_H
+#define HOST_GAP_H
+
+#include <stdint.h>
+#include "gap_adv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GAP_PARAM_DEVICE_NAME = 0x20,
+    GAP_PARAM_SLAVE_INIT_GATT_MTU_REQ = 0x21d,
+    GAP_PARAM_LE_REMAIN_CREDITS = 0x229
+} T_GAP_LE_PARAM_TYPE;
+
+#define GAP_DEVICE_NAME_LEN         40
+
+T_GAP_CAUSE le_set_gap_param(T_GAP_LE_PARAM_TYPE param, uint8_t len, void* p_value);
+
+/**
+ * GAP_PARAM_LE_REMAIN_CREDITS: controller'daki boş notification / write
+ * command buffer sayısı (uint8_t)
+ */
+T_GAP_CAUSE le_get_gap_param(T_GAP_LE_PARAM_TYPE param, void* p_value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_H
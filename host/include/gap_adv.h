@@ -0,0 +1,78 @@
+/**
+ * @file gap_adv.h
+ * @brief Host stand-in for the AmebaD BLE GAP advertising API subset
+ *
+ * Sadece kütüphanelerin kullandığı le_adv_* fonksiyonları. Controller'a
+ * yazılan data / aralık / start-stop sayaçları hostsim::bleAdv* ile
+ * okunabilir; radyo yoktur, stack her zaman hazırdır.
+ */
+
+#ifndef HOST_GAP_ADV_H
+#define HOST_GAP_ADV_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GAP_CAUSE_SUCCESS = 0x00,
+    GAP_CAUSE_ALREADY_IN_REQ = 0x01,
+    GAP_CAUSE_INVALID_STATE = 0x02,
+    GAP_CAUSE_INVALID_PARAM = 0x03,
+    GAP_CAUSE_NON_CONN = 0x04,
+    GAP_CAUSE_NOT_FIND_IRK = 0x05,
+    GAP_CAUSE_ERROR_CREDITS = 0x06,
+    GAP_CAUSE_SEND_REQ_FAILED = 0x07,
+    GAP_CAUSE_NO_RESOURCE = 0x08,
+    GAP_CAUSE_INVALID_PDU_SIZE = 0x09,
+    GAP_CAUSE_NOT_FIND = 0x0a,
+    GAP_CAUSE_CONN_LIMIT = 0x0b,
+    GAP_CAUSE_NO_BOND = 0x0c,
+    GAP_CAUSE_ERROR_UNKNOWN = 0xFF
+} T_GAP_CAUSE;
+
+typedef enum {
+    GAP_PARAM_ADV_LOCAL_ADDR_TYPE = 0x260,
+    GAP_PARAM_ADV_DATA = 0x261,
+    GAP_PARAM_SCAN_RSP_DATA = 0x262,
+    GAP_PARAM_ADV_EVENT_TYPE = 0x263,
+    GAP_PARAM_ADV_DIRECT_ADDR_TYPE = 0x264,
+    GAP_PARAM_ADV_DIRECT_ADDR = 0x265,
+    GAP_PARAM_ADV_CHANNEL_MAP = 0x266,
+    GAP_PARAM_ADV_FILTER_POLICY = 0x267,
+    GAP_PARAM_ADV_INTERVAL_MIN = 0x268,
+    GAP_PARAM_ADV_INTERVAL_MAX = 0x269
+} T_LE_ADV_PARAM_TYPE;
+
+// Advertising PDU tipi (GAP_PARAM_ADV_EVENT_TYPE)
+#define GAP_ADTYPE_ADV_IND              0x00
+#define GAP_ADTYPE_ADV_HDC_DIRECT_IND   0x01
+#define GAP_ADTYPE_ADV_SCAN_IND         0x02
+#define GAP_ADTYPE_ADV_NONCONN_IND      0x03
+#define GAP_ADTYPE_ADV_LDC_DIRECT_IND   0x04
+
+#define GAP_ADVCHAN_37                  0x01
+#define GAP_ADVCHAN_38                  0x02
+#define GAP_ADVCHAN_39                  0x04
+#define GAP_ADVCHAN_ALL                 (GAP_ADVCHAN_37 | GAP_ADVCHAN_38 | GAP_ADVCHAN_39)
+
+#define GAP_MAX_ADV_LEN                 31
+
+T_GAP_CAUSE le_adv_set_param(T_LE_ADV_PARAM_TYPE param, uint8_t len, void* p_value);
+T_GAP_CAUSE le_adv_get_param(T_LE_ADV_PARAM_TYPE param, void* p_value);
+
+T_GAP_CAUSE le_adv_start(void);
+T_GAP_CAUSE le_adv_stop(void);
+
+/**
+ * @brief set_param ile değişen data / aralığı advertising'i durdurmadan uygula
+ */
+T_GAP_CAUSE le_adv_update_param(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_ADV_H
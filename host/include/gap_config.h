@@ -0,0 +1,24 @@
+/**
+ * @file gap_config.h
+ * @brief Host stand-in for the AmebaD GAP build-time configuration subset
+ */
+
+#ifndef HOST_GAP_CONFIG_H
+#define HOST_GAP_CONFIG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Stack'in kabul edeceği en büyük ATT MTU (stack başlamadan önce; default 23)
+ */
+void gap_config_max_mtu_size(uint16_t att_max_mtu_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_CONFIG_H
@@ -0,0 +1,91 @@
+/**
+ * @file gap_conn_le.h
+ * @brief Host stand-in for the AmebaD LE connection API subset
+ *
+ * Bağlantıyı hostsim::blePeerConnect ile kurulan scripted central yönetir;
+ * DLE / PHY istekleri peer'in yetenekleriyle sınırlanıp le_register_app_cb
+ * callback'ine GAP_MSG_LE_DATA_LEN_CHANGE_INFO / GAP_MSG_LE_PHY_UPDATE_INFO
+ * olarak döner.
+ */
+
+#ifndef HOST_GAP_CONN_LE_H
+#define HOST_GAP_CONN_LE_H
+
+#include <stdint.h>
+#include "gap_adv.h"
+#include "gap_scan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GAP_PARAM_CONN_INTERVAL = 0x271,
+    GAP_PARAM_CONN_LATENCY = 0x272,
+    GAP_PARAM_CONN_TIMEOUT = 0x273,
+    GAP_PARAM_CONN_MTU_SIZE = 0x274
+} T_LE_CONN_PARAM_TYPE;
+
+typedef enum {
+    GAP_PHYS_1M = 1,
+    GAP_PHYS_2M = 2,
+    GAP_PHYS_CODED = 3
+} T_GAP_PHYS_TYPE;
+
+#define GAP_PHYS_PREFER_1M_BIT              0x01
+#define GAP_PHYS_PREFER_2M_BIT              0x02
+#define GAP_PHYS_PREFER_CODED_BIT           0x04
+
+#define GAP_PHYS_CONN_INIT_1M_BIT           0x01
+#define GAP_PHYS_CONN_INIT_2M_BIT           0x02
+
+#define GAP_PHYS_OPTIONS_CODING_PREFER_NO   0
+
+typedef enum {
+    GAP_LOCAL_ADDR_LE_PUBLIC = 0,
+    GAP_LOCAL_ADDR_LE_RANDOM = 1
+} T_GAP_LOCAL_ADDR_TYPE;
+
+// le_register_app_cb callback tipleri (gap_le.h'deki GAP_MSG_LE_SCAN_INFO ile aynı uzay)
+#define GAP_MSG_LE_DATA_LEN_CHANGE_INFO     0x0e
+#define GAP_MSG_LE_PHY_UPDATE_INFO          0x10
+
+typedef struct {
+    uint8_t conn_id;
+    uint16_t max_tx_octets;
+    uint16_t max_tx_time;
+    uint16_t max_rx_octets;
+    uint16_t max_rx_time;
+} T_LE_DATA_LEN_CHANGE_INFO;
+
+typedef struct {
+    uint8_t conn_id;
+    uint16_t cause;
+    T_GAP_PHYS_TYPE tx_phy;
+    T_GAP_PHYS_TYPE rx_phy;
+} T_LE_PHY_UPDATE_INFO;
+
+/**
+ * GAP_PARAM_CONN_INTERVAL: 1.25 ms birim (uint16_t),
+ * GAP_PARAM_CONN_MTU_SIZE: ATT MTU (uint16_t)
+ */
+T_GAP_CAUSE le_get_conn_param(T_LE_CONN_PARAM_TYPE param, void* p_value, uint8_t conn_id);
+
+/**
+ * @param tx_octets 27-251, tx_time 328-2120 us
+ */
+T_GAP_CAUSE le_set_data_len(uint8_t conn_id, uint16_t tx_octets, uint16_t tx_time);
+
+T_GAP_CAUSE le_set_phy(uint8_t conn_id, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys,
+                       uint16_t phy_options);
+
+T_GAP_CAUSE le_connect(uint8_t init_phys, uint8_t* remote_bd, T_GAP_REMOTE_ADDR_TYPE remote_bd_type,
+                       T_GAP_LOCAL_ADDR_TYPE local_bd_type, uint16_t scan_timeout);
+
+T_GAP_CAUSE le_disconnect(uint8_t conn_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_CONN_LE_H
@@ -0,0 +1,41 @@
+/**
+ * @file gap_le.h
+ * @brief Host stand-in for the AmebaD LE GAP callback registration
+ *
+ * Uygulama callback'i (le_register_app_cb) host'ta scheduler context'inden
+ * çağrılır; cihazdaki GAP task'ının yerini tutar.
+ */
+
+#ifndef HOST_GAP_LE_H
+#define HOST_GAP_LE_H
+
+#include <stdint.h>
+#include "gap_adv.h"
+#include "gap_scan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    APP_RESULT_SUCCESS = 0,
+    APP_RESULT_PENDING = 1,
+    APP_RESULT_REJECT = 0x0C
+} T_APP_RESULT;
+
+// le_register_app_cb callback tipleri (subset)
+#define GAP_MSG_LE_SCAN_INFO        0x09
+
+typedef union {
+    T_LE_SCAN_INFO* p_le_scan_info;
+} T_LE_CB_DATA;
+
+typedef T_APP_RESULT (*P_FUN_LE_APP_CB)(uint8_t cb_type, void* p_cb_data);
+
+void le_register_app_cb(P_FUN_LE_APP_CB app_callback);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_LE_H
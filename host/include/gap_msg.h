@@ -0,0 +1,85 @@
+/**
+ * @file gap_msg.h
+ * @brief Host stand-in for the AmebaD GAP IO message subset
+ *
+ * Cihazda bu mesajlar gap_start_bt_stack'e verilen IO kuyruğundan uygulama
+ * task'ı tarafından okunur. Host'ta task yoktur: gap_host_set_io_handler ile
+ * kaydedilen fonksiyon scheduler context'inden doğrudan çağrılır.
+ */
+
+#ifndef HOST_GAP_MSG_H
+#define HOST_GAP_MSG_H
+
+#include <stdint.h>
+#include "app_msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GAP_MSG_LE_DEV_STATE_CHANGE     0x01
+#define GAP_MSG_LE_CONN_STATE_CHANGE    0x02
+#define GAP_MSG_LE_CONN_PARAM_UPDATE    0x03
+#define GAP_MSG_LE_CONN_MTU_INFO        0x04
+
+#define GAP_INIT_STATE_INIT             0
+#define GAP_INIT_STATE_STACK_READY      1
+
+#define GAP_ADV_STATE_IDLE              0
+#define GAP_ADV_STATE_ADVERTISING       2
+
+#define GAP_SCAN_STATE_IDLE             0
+#define GAP_SCAN_STATE_START            1
+#define GAP_SCAN_STATE_SCANNING         2
+#define GAP_SCAN_STATE_STOP             3
+
+typedef enum {
+    GAP_CONN_STATE_DISCONNECTED = 0,
+    GAP_CONN_STATE_CONNECTING = 1,
+    GAP_CONN_STATE_CONNECTED = 2,
+    GAP_CONN_STATE_DISCONNECTING = 3
+} T_GAP_CONN_STATE;
+
+typedef struct {
+    uint8_t gap_init_state : 1;
+    uint8_t gap_adv_state : 2;
+    uint8_t gap_scan_state : 2;
+    uint8_t gap_conn_state : 1;
+} T_GAP_DEV_STATE;
+
+typedef struct {
+    T_GAP_DEV_STATE new_state;
+    uint16_t cause;
+} T_GAP_DEV_STATE_CHANGE;
+
+typedef struct {
+    uint8_t conn_id;
+    uint8_t new_state;
+    uint16_t disc_cause;
+} T_GAP_CONN_STATE_CHANGE;
+
+typedef struct {
+    uint8_t conn_id;
+    uint16_t mtu_size;
+} T_GAP_CONN_MTU_INFO;
+
+typedef union {
+    T_GAP_DEV_STATE_CHANGE gap_dev_state_change;
+    T_GAP_CONN_STATE_CHANGE gap_conn_state_change;
+    T_GAP_CONN_MTU_INFO gap_conn_mtu_info;
+} T_LE_GAP_MSG_DATA;
+
+typedef struct {
+    T_LE_GAP_MSG_DATA msg_data;
+} T_LE_GAP_MSG;
+
+/**
+ * @brief Host'a özel: IO mesajlarını alacak fonksiyon (uygulama task'ının yerine)
+ */
+void gap_host_set_io_handler(void (*handler)(T_IO_MSG* msg));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_MSG_H
@@ -0,0 +1,67 @@
+/**
+ * @file gap_scan.h
+ * @brief Host stand-in for the AmebaD BLE GAP scan API subset
+ *
+ * le_scan_start() sonrası hostsim::bleAddDevice ile tanımlanan cihazların
+ * advertising raporları sanal saatte, kendi aralıklarıyla (+0-10 ms advDelay)
+ * GAP_MSG_LE_SCAN_INFO olarak le_register_app_cb callback'ine verilir.
+ */
+
+#ifndef HOST_GAP_SCAN_H
+#define HOST_GAP_SCAN_H
+
+#include <stdint.h>
+#include "gap_adv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GAP_PARAM_SCAN_LOCAL_ADDR_TYPE = 0x240,
+    GAP_PARAM_SCAN_MODE = 0x241,
+    GAP_PARAM_SCAN_INTERVAL = 0x242,
+    GAP_PARAM_SCAN_WINDOW = 0x243,
+    GAP_PARAM_SCAN_FILTER_POLICY = 0x244,
+    GAP_PARAM_SCAN_FILTER_DUPLICATES = 0x245
+} T_LE_SCAN_PARAM_TYPE;
+
+typedef enum {
+    GAP_SCAN_MODE_PASSIVE = 0,
+    GAP_SCAN_MODE_ACTIVE = 1
+} T_GAP_SCAN_MODE;
+
+#define GAP_SCAN_FILTER_DUPLICATE_DISABLE   0
+#define GAP_SCAN_FILTER_DUPLICATE_ENABLE    1
+
+typedef enum {
+    GAP_ADV_EVT_TYPE_UNDIRECTED = 0,
+    GAP_ADV_EVT_TYPE_DIRECTED = 1,
+    GAP_ADV_EVT_TYPE_SCANNABLE = 2,
+    GAP_ADV_EVT_TYPE_NON_CONNECTABLE = 3,
+    GAP_ADV_EVT_TYPE_SCAN_RSP = 4
+} T_GAP_ADV_EVT_TYPE;
+
+typedef enum {
+    GAP_REMOTE_ADDR_LE_PUBLIC = 0,
+    GAP_REMOTE_ADDR_LE_RANDOM = 1
+} T_GAP_REMOTE_ADDR_TYPE;
+
+typedef struct {
+    uint8_t bd_addr[6];
+    T_GAP_REMOTE_ADDR_TYPE remote_addr_type;
+    T_GAP_ADV_EVT_TYPE adv_type;
+    int8_t rssi;
+    uint8_t data_len;
+    uint8_t data[GAP_MAX_ADV_LEN];
+} T_LE_SCAN_INFO;
+
+T_GAP_CAUSE le_scan_set_param(T_LE_SCAN_PARAM_TYPE param, uint8_t len, void* p_value);
+T_GAP_CAUSE le_scan_start(void);
+T_GAP_CAUSE le_scan_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_GAP_SCAN_H
@@ -0,0 +1,19 @@
+/**
+ * @file arch.h
+ * @brief Host stand-in for lwIP 2.0 arch.h integer types
+ */
+
+#ifndef HOST_LWIP_ARCH_H
+#define HOST_LWIP_ARCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t     u8_t;
+typedef int8_t      s8_t;
+typedef uint16_t    u16_t;
+typedef int16_t     s16_t;
+typedef uint32_t    u32_t;
+typedef int32_t     s32_t;
+
+#endif // HOST_LWIP_ARCH_H
@@ -0,0 +1,36 @@
+/**
+ * @file ip_addr.h
+ * @brief Host stand-in for lwIP 2.0 ip_addr.h (IPv4 only, LWIP_IPV6 0)
+ */
+
+#ifndef HOST_LWIP_IP_ADDR_H
+#define HOST_LWIP_IP_ADDR_H
+
+#include "lwip/arch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Network byte order (little-endian host: ilk oktet en düşük byte)
+typedef struct ip4_addr {
+    u32_t addr;
+} ip4_addr_t;
+
+typedef ip4_addr_t ip_addr_t;
+
+#define IP4_ADDR(ipaddr, a, b, c, d) \
+    (ipaddr)->addr = ((u32_t)((d) & 0xff) << 24) | ((u32_t)((c) & 0xff) << 16) | \
+                     ((u32_t)((b) & 0xff) << 8) | (u32_t)((a) & 0xff)
+#define IP_ADDR4(ipaddr, a, b, c, d)    IP4_ADDR(ipaddr, a, b, c, d)
+
+#define ip4_addr1(ipaddr)   ((u8_t)((ipaddr)->addr & 0xff))
+#define ip4_addr2(ipaddr)   ((u8_t)(((ipaddr)->addr >> 8) & 0xff))
+#define ip4_addr3(ipaddr)   ((u8_t)(((ipaddr)->addr >> 16) & 0xff))
+#define ip4_addr4(ipaddr)   ((u8_t)(((ipaddr)->addr >> 24) & 0xff))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_IP_ADDR_H
@@ -0,0 +1,21 @@
+/**
+ * @file netdb.h
+ * @brief Host stand-in for lwIP netdb.h (blocking DNS, system resolver)
+ */
+
+#ifndef HOST_LWIP_NETDB_H
+#define HOST_LWIP_NETDB_H
+
+#include <netdb.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct hostent* lwip_gethostbyname(const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_NETDB_H
@@ -0,0 +1,62 @@
+/**
+ * @file pbuf.h
+ * @brief Host stand-in for the lwIP 2.0 pbuf subset
+ *
+ * pbuf struct'ları cihazdaki gibi sabit bir pool'dan (MEMP_NUM_PBUF) gelir,
+ * heap kullanılmaz. PBUF_RAM payload'u da aynı slot'ta tutulur.
+ */
+
+#ifndef HOST_LWIP_PBUF_H
+#define HOST_LWIP_PBUF_H
+
+#include "lwip/arch.h"
+#include "lwip/err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEMP_NUM_PBUF       16
+#define PBUF_RAM_MAX        1536
+
+typedef enum {
+    PBUF_TRANSPORT,
+    PBUF_IP,
+    PBUF_LINK,
+    PBUF_RAW_TX,
+    PBUF_RAW
+} pbuf_layer;
+
+typedef enum {
+    PBUF_RAM,       // Payload pbuf ile birlikte ayrılır
+    PBUF_ROM,       // Payload sabit bellekte, hiç değişmez
+    PBUF_REF,       // Payload uygulamanın belleğinde (zero-copy)
+    PBUF_POOL
+} pbuf_type;
+
+struct pbuf {
+    struct pbuf* next;
+    void* payload;
+    u16_t tot_len;
+    u16_t len;
+    u8_t type;
+    u8_t flags;
+    u16_t ref;
+};
+
+/**
+ * @return NULL: pool boş veya PBUF_RAM için length > PBUF_RAM_MAX
+ *         (PBUF_REF / PBUF_ROM: payload NULL, çağıran atar)
+ */
+struct pbuf* pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type);
+
+/**
+ * @return Serbest bırakılan pbuf sayısı
+ */
+u8_t pbuf_free(struct pbuf* p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_PBUF_H
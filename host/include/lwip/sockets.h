@@ -0,0 +1,49 @@
+/**
+ * @file sockets.h
+ * @brief Host stand-in for the lwIP BSD socket API (lwip_* names)
+ *
+ * Host'ta lwip_* fonksiyonları gerçek POSIX socket'lerine gider: kütüphane
+ * localhost'taki bir broker / sunucu / istemciyle test edilebilir. Sabitler
+ * ve struct'lar (sockaddr_in, fd_set, O_NONBLOCK, errno) sistemden gelir.
+ *
+ * Simüle WiFi'nin IP'si yokken connect EHOSTUNREACH, send / recv
+ * ECONNABORTED ile başarısız olur (AP kesintisi senaryoları). Zaman sanal,
+ * socket I/O gerçektir: localhost gecikmesi sanal saatte görünmez.
+ */
+
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int lwip_socket(int domain, int type, int protocol);
+int lwip_bind(int s, const struct sockaddr* name, socklen_t namelen);
+int lwip_listen(int s, int backlog);
+int lwip_accept(int s, struct sockaddr* addr, socklen_t* addrlen);
+int lwip_connect(int s, const struct sockaddr* name, socklen_t namelen);
+int lwip_shutdown(int s, int how);
+int lwip_close(int s);
+ssize_t lwip_send(int s, const void* dataptr, size_t size, int flags);
+ssize_t lwip_recv(int s, void* mem, size_t len, int flags);
+int lwip_select(int maxfdp1, fd_set* readset, fd_set* writeset, fd_set* exceptset,
+                struct timeval* timeout);
+int lwip_fcntl(int s, int cmd, int val);
+int lwip_setsockopt(int s, int level, int optname, const void* optval, socklen_t optlen);
+int lwip_getsockopt(int s, int level, int optname, void* optval, socklen_t* optlen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_SOCKETS_H
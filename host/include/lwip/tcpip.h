@@ -0,0 +1,32 @@
+/**
+ * @file tcpip.h
+ * @brief Host stand-in for the lwIP 2.0 tcpip_callback subset
+ *
+ * Cihazda raw API çağrıları tcpip thread'inde yapılmalıdır; callback mbox'a
+ * konur ve o thread'de çalışır. Host'ta callback sanal saatte
+ * TCPIP_HOST_LATENCY_US sonra scheduler context'inden çağrılır.
+ */
+
+#ifndef HOST_LWIP_TCPIP_H
+#define HOST_LWIP_TCPIP_H
+
+#include "lwip/arch.h"
+#include "lwip/err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TCPIP_HOST_LATENCY_US   30
+
+typedef void (*tcpip_callback_fn)(void* ctx);
+
+err_t tcpip_callback_with_block(tcpip_callback_fn function, void* ctx, u8_t block);
+
+#define tcpip_callback(f, ctx)  tcpip_callback_with_block(f, ctx, 1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_TCPIP_H
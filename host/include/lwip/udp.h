@@ -0,0 +1,41 @@
+/**
+ * @file udp.h
+ * @brief Host stand-in for the lwIP 2.0 raw UDP API subset
+ *
+ * Gönderilen datagram'lar host loopback kuyruğuna kopyalanır
+ * (hostsim::udpLoopbackPop) ve IP + UDP header'ıyla birlikte WiFi TX
+ * airtime modeline yazılır (hostsim::wifiTransmit).
+ */
+
+#ifndef HOST_LWIP_UDP_H
+#define HOST_LWIP_UDP_H
+
+#include "lwip/arch.h"
+#include "lwip/err.h"
+#include "lwip/ip_addr.h"
+#include "lwip/pbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEMP_NUM_UDP_PCB    8
+#define UDP_HLEN            8
+#define IP_HLEN             20
+
+struct udp_pcb;
+
+struct udp_pcb* udp_new(void);
+void udp_remove(struct udp_pcb* pcb);
+
+/**
+ * @return ERR_OK, ERR_RTE (IP yok), ERR_MEM (sürücü TX kuyruğu dolu),
+ *         ERR_VAL (datagram MTU'dan büyük)
+ */
+err_t udp_sendto(struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* dst_ip, u16_t dst_port);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_LWIP_UDP_H
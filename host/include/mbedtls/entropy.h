@@ -0,0 +1,27 @@
+/**
+ * @file entropy.h
+ * @brief Host stand-in for the mbedTLS entropy pool (OpenSSL RAND_bytes)
+ */
+
+#ifndef HOST_MBEDTLS_ENTROPY_H
+#define HOST_MBEDTLS_ENTROPY_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mbedtls_entropy_context {
+    int unused;
+} mbedtls_entropy_context;
+
+void mbedtls_entropy_init(mbedtls_entropy_context* ctx);
+void mbedtls_entropy_free(mbedtls_entropy_context* ctx);
+int mbedtls_entropy_func(void* data, unsigned char* output, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MBEDTLS_ENTROPY_H
@@ -0,0 +1,21 @@
+/**
+ * @file error.h
+ * @brief Host stand-in for mbedtls_strerror
+ */
+
+#ifndef HOST_MBEDTLS_ERROR_H
+#define HOST_MBEDTLS_ERROR_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void mbedtls_strerror(int errnum, char* buffer, size_t buflen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MBEDTLS_ERROR_H
@@ -0,0 +1,13 @@
+/**
+ * @file net_sockets.h
+ * @brief Host stand-in for the mbedTLS network error codes
+ */
+
+#ifndef HOST_MBEDTLS_NET_SOCKETS_H
+#define HOST_MBEDTLS_NET_SOCKETS_H
+
+#define MBEDTLS_ERR_NET_RECV_FAILED         -0x004C
+#define MBEDTLS_ERR_NET_SEND_FAILED         -0x004E
+#define MBEDTLS_ERR_NET_CONN_RESET          -0x0050
+
+#endif // HOST_MBEDTLS_NET_SOCKETS_H
@@ -0,0 +1,37 @@
+/**
+ * @file sha256.h
+ * @brief Host stand-in for the mbedTLS SHA-256 API (OpenSSL EVP)
+ */
+
+#ifndef HOST_MBEDTLS_SHA256_H
+#define HOST_MBEDTLS_SHA256_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mbedtls_sha256_context {
+    void* host;         // EVP_MD_CTX
+    int is224;
+} mbedtls_sha256_context;
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx);
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx);
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* ctx, int is224);
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen);
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* ctx, unsigned char output[32]);
+int mbedtls_sha256_ret(const unsigned char* input, size_t ilen, unsigned char output[32], int is224);
+
+// 2.7 öncesi (void) isimler
+void mbedtls_sha256_starts(mbedtls_sha256_context* ctx, int is224);
+void mbedtls_sha256_update(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen);
+void mbedtls_sha256_finish(mbedtls_sha256_context* ctx, unsigned char output[32]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MBEDTLS_SHA256_H
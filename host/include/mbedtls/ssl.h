@@ -0,0 +1,130 @@
+/**
+ * @file ssl.h
+ * @brief Host stand-in for the mbedTLS 2.x SSL/TLS client API
+ *
+ * Host'ta mbedtls_ssl_* çağrıları OpenSSL'e gider (MbedTls.cpp): kütüphane
+ * localhost'taki gerçek bir TLS sunucusuyla test edilebilir. Kayıt katmanı
+ * mbedtls_ssl_set_bio ile verilen send / recv callback'lerinden geçer,
+ * WANT_READ / WANT_WRITE davranışı mbedTLS ile aynıdır.
+ *
+ * mbedTLS 2.x istemcisi gibi en fazla TLS 1.2 konuşulur. Oturum (session ID
+ * veya ticket) mbedtls_ssl_get_session / set_session ile taşınır,
+ * mbedtls_ssl_session_save / load ile byte dizisine çevrilir (host'ta
+ * OpenSSL DER formatı; device formatıyla uyumlu değildir).
+ *
+ * Sadece istemci tarafı ve stream transport desteklenir.
+ */
+
+#ifndef HOST_MBEDTLS_SSL_H
+#define HOST_MBEDTLS_SSL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "version.h"
+#include "x509_crt.h"
+
+#define MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE     -0x7080
+#define MBEDTLS_ERR_SSL_BAD_INPUT_DATA          -0x7100
+#define MBEDTLS_ERR_SSL_CONN_EOF                -0x7280
+#define MBEDTLS_ERR_SSL_FATAL_ALERT_MESSAGE     -0x7780
+#define MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY       -0x7880
+#define MBEDTLS_ERR_SSL_ALLOC_FAILED            -0x7F00
+#define MBEDTLS_ERR_SSL_TIMEOUT                 -0x6800
+#define MBEDTLS_ERR_SSL_WANT_WRITE              -0x6880
+#define MBEDTLS_ERR_SSL_WANT_READ               -0x6900
+#define MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL        -0x6A00
+#define MBEDTLS_ERR_SSL_INTERNAL_ERROR          -0x6C00
+
+#define MBEDTLS_SSL_IS_CLIENT                   0
+#define MBEDTLS_SSL_TRANSPORT_STREAM            0
+#define MBEDTLS_SSL_PRESET_DEFAULT              0
+
+#define MBEDTLS_SSL_VERIFY_NONE                 0
+#define MBEDTLS_SSL_VERIFY_OPTIONAL             1
+#define MBEDTLS_SSL_VERIFY_REQUIRED             2
+
+#define MBEDTLS_SSL_SESSION_TICKETS_DISABLED    0
+#define MBEDTLS_SSL_SESSION_TICKETS_ENABLED     1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int mbedtls_ssl_send_t(void* ctx, const unsigned char* buf, size_t len);
+typedef int mbedtls_ssl_recv_t(void* ctx, unsigned char* buf, size_t len);
+typedef int mbedtls_ssl_recv_timeout_t(void* ctx, unsigned char* buf, size_t len, uint32_t timeout);
+
+/**
+ * @brief Pazarlık edilen oturum (mbedTLS'teki public alanlar)
+ */
+typedef struct mbedtls_ssl_session {
+    int ciphersuite;
+    size_t id_len;
+    unsigned char id[32];
+    unsigned char master[48];
+    uint32_t verify_result;
+    void* host;                 // SSL_SESSION*
+} mbedtls_ssl_session;
+
+typedef struct mbedtls_ssl_config {
+    int endpoint;
+    int authmode;
+    int session_tickets;
+    mbedtls_x509_crt* ca_chain;
+    int (*f_rng)(void*, unsigned char*, size_t);
+    void* p_rng;
+    void* host;                 // SSL_CTX* (ilk mbedtls_ssl_setup'ta kurulur)
+} mbedtls_ssl_config;
+
+typedef struct mbedtls_ssl_context {
+    const mbedtls_ssl_config* conf;
+    mbedtls_ssl_send_t* f_send;
+    mbedtls_ssl_recv_t* f_recv;
+    void* p_bio;
+    char* hostname;
+    int bio_error;              // Callback'in son hata kodu
+    void* host;                 // SSL*
+} mbedtls_ssl_context;
+
+void mbedtls_ssl_config_init(mbedtls_ssl_config* conf);
+void mbedtls_ssl_config_free(mbedtls_ssl_config* conf);
+int mbedtls_ssl_config_defaults(mbedtls_ssl_config* conf, int endpoint, int transport, int preset);
+void mbedtls_ssl_conf_authmode(mbedtls_ssl_config* conf, int authmode);
+void mbedtls_ssl_conf_ca_chain(mbedtls_ssl_config* conf, mbedtls_x509_crt* ca_chain, void* ca_crl);
+void mbedtls_ssl_conf_rng(mbedtls_ssl_config* conf, int (*f_rng)(void*, unsigned char*, size_t), void* p_rng);
+void mbedtls_ssl_conf_session_tickets(mbedtls_ssl_config* conf, int use_tickets);
+
+void mbedtls_ssl_init(mbedtls_ssl_context* ssl);
+void mbedtls_ssl_free(mbedtls_ssl_context* ssl);
+int mbedtls_ssl_setup(mbedtls_ssl_context* ssl, const mbedtls_ssl_config* conf);
+int mbedtls_ssl_session_reset(mbedtls_ssl_context* ssl);
+int mbedtls_ssl_set_hostname(mbedtls_ssl_context* ssl, const char* hostname);
+void mbedtls_ssl_set_bio(mbedtls_ssl_context* ssl, void* p_bio, mbedtls_ssl_send_t* f_send,
+                         mbedtls_ssl_recv_t* f_recv, mbedtls_ssl_recv_timeout_t* f_recv_timeout);
+
+int mbedtls_ssl_handshake(mbedtls_ssl_context* ssl);
+int mbedtls_ssl_read(mbedtls_ssl_context* ssl, unsigned char* buf, size_t len);
+int mbedtls_ssl_write(mbedtls_ssl_context* ssl, const unsigned char* buf, size_t len);
+int mbedtls_ssl_close_notify(mbedtls_ssl_context* ssl);
+
+uint32_t mbedtls_ssl_get_verify_result(const mbedtls_ssl_context* ssl);
+const char* mbedtls_ssl_get_ciphersuite(const mbedtls_ssl_context* ssl);
+const char* mbedtls_ssl_get_version(const mbedtls_ssl_context* ssl);
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session* session);
+void mbedtls_ssl_session_free(mbedtls_ssl_session* session);
+int mbedtls_ssl_get_session(const mbedtls_ssl_context* ssl, mbedtls_ssl_session* session);
+int mbedtls_ssl_set_session(mbedtls_ssl_context* ssl, const mbedtls_ssl_session* session);
+
+/**
+ * @param olen Yazılan (BUFFER_TOO_SMALL ise gereken) byte
+ */
+int mbedtls_ssl_session_save(const mbedtls_ssl_session* session, unsigned char* buf, size_t buf_len,
+                             size_t* olen);
+int mbedtls_ssl_session_load(mbedtls_ssl_session* session, const unsigned char* buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MBEDTLS_SSL_H
@@ -0,0 +1,19 @@
+/**
+ * @file version.h
+ * @brief Host stand-in for the mbedTLS version macros
+ *
+ * Host mbedTLS API'si OpenSSL üzerinde çalışır (MbedTls.cpp); sürüm
+ * AmebaD SDK'sındaki 2.x serisinin session_save / load içeren haliyle aynı
+ * tutulur.
+ */
+
+#ifndef HOST_MBEDTLS_VERSION_H
+#define HOST_MBEDTLS_VERSION_H
+
+#define MBEDTLS_VERSION_MAJOR       2
+#define MBEDTLS_VERSION_MINOR       28
+#define MBEDTLS_VERSION_PATCH       3
+#define MBEDTLS_VERSION_NUMBER      0x021C0300
+#define MBEDTLS_VERSION_STRING      "2.28.3"
+
+#endif // HOST_MBEDTLS_VERSION_H
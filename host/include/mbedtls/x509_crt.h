@@ -0,0 +1,46 @@
+/**
+ * @file x509_crt.h
+ * @brief Host stand-in for the mbedTLS X.509 certificate chain
+ *
+ * PEM sertifikalar OpenSSL X509 nesnelerine çözülür; CA zinciri olarak
+ * mbedtls_ssl_conf_ca_chain ile verilir.
+ */
+
+#ifndef HOST_MBEDTLS_X509_CRT_H
+#define HOST_MBEDTLS_X509_CRT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_ERR_X509_CERT_VERIFY_FAILED     -0x2700
+#define MBEDTLS_ERR_X509_INVALID_FORMAT         -0x2180
+
+#define MBEDTLS_X509_BADCERT_EXPIRED            0x01
+#define MBEDTLS_X509_BADCERT_CN_MISMATCH        0x04
+#define MBEDTLS_X509_BADCERT_NOT_TRUSTED        0x08
+
+#define HOST_MBEDTLS_MAX_CERTS                  8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mbedtls_x509_crt {
+    void* certs[HOST_MBEDTLS_MAX_CERTS];    // X509*
+    int count;
+} mbedtls_x509_crt;
+
+void mbedtls_x509_crt_init(mbedtls_x509_crt* crt);
+void mbedtls_x509_crt_free(mbedtls_x509_crt* crt);
+
+/**
+ * @param buflen PEM için sondaki '\0' dahil
+ * @return 0, >0: çözülemeyen sertifika sayısı, <0: hata
+ */
+int mbedtls_x509_crt_parse(mbedtls_x509_crt* chain, const unsigned char* buf, size_t buflen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_MBEDTLS_X509_CRT_H
@@ -0,0 +1,131 @@
+/**
+ * @file profile_server.h
+ * @brief Host stand-in for the AmebaD GATT server profile API subset
+ *
+ * server_add_service ile verilen attribute tablosundaki ilk CCCD scripted
+ * peer tarafından yazılır (notification açılır); server_send_data ile
+ * gönderilen notification'lar connection event'lerinde link kapasitesine
+ * göre iletilir ve credit'ler PROFILE_EVT_SEND_DATA_COMPLETE ile geri verilir.
+ */
+
+#ifndef HOST_PROFILE_SERVER_H
+#define HOST_PROFILE_SERVER_H
+
+#include <stdint.h>
+#include "gap_le.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint8_t T_SERVER_ID;
+
+#define SERVICE_PROFILE_GENERAL_ID          0xFF
+
+// Attribute flags
+#define ATTRIB_FLAG_VOID                    0x0000
+#define ATTRIB_FLAG_UUID_128BIT             0x0001
+#define ATTRIB_FLAG_VALUE_INCL              0x0002
+#define ATTRIB_FLAG_VALUE_APPL              0x0004
+#define ATTRIB_FLAG_CCCD_APPL               0x0010
+#define ATTRIB_FLAG_LE                      0x0800
+
+// Permissions
+#define GATT_PERM_NONE                      0x00
+#define GATT_PERM_READ                      0x01
+#define GATT_PERM_WRITE                     0x10
+
+// UUID'ler ve characteristic property'leri
+#define GATT_UUID_PRIMARY_SERVICE           0x2800
+#define GATT_UUID_CHARACTERISTIC            0x2803
+#define GATT_UUID_CHAR_CLIENT_CONFIG        0x2902
+
+#define GATT_CHAR_PROP_WRITE_NO_RSP         0x04
+#define GATT_CHAR_PROP_WRITE                0x08
+#define GATT_CHAR_PROP_NOTIFY               0x10
+
+#define GATT_CLIENT_CHAR_CONFIG_DEFAULT     0x0000
+#define GATT_CLIENT_CHAR_CONFIG_NOTIFY      0x0001
+
+#define UUID_128BIT_SIZE                    16
+#define LO_WORD(x)                          ((uint8_t)((x) & 0xFF))
+#define HI_WORD(x)                          ((uint8_t)(((x) >> 8) & 0xFF))
+
+typedef struct {
+    uint16_t flags;
+    uint8_t type_value[2 + 14];
+    uint16_t value_len;
+    void* p_value_context;
+    uint32_t permissions;
+} T_ATTRIB_APPL;
+
+typedef enum {
+    GATT_PDU_TYPE_ANY = 0,
+    GATT_PDU_TYPE_NOTIFICATION = 1,
+    GATT_PDU_TYPE_INDICATION = 2
+} T_GATT_PDU_TYPE;
+
+typedef enum {
+    WRITE_REQUEST = 0,
+    WRITE_WITHOUT_RESPONSE = 1
+} T_WRITE_TYPE;
+
+typedef void (*P_FUN_WRITE_IND_POST_PROC)(uint8_t conn_id, T_SERVER_ID service_id,
+                                          uint16_t attrib_index, uint16_t length,
+                                          uint8_t* p_value);
+
+typedef T_APP_RESULT (*P_FUN_GATT_READ_ATTR_CB)(uint8_t conn_id, T_SERVER_ID service_id,
+                                                uint16_t attrib_index, uint16_t offset,
+                                                uint16_t* p_length, uint8_t** pp_value);
+typedef T_APP_RESULT (*P_FUN_GATT_WRITE_ATTR_CB)(uint8_t conn_id, T_SERVER_ID service_id,
+                                                 uint16_t attrib_index, T_WRITE_TYPE write_type,
+                                                 uint16_t length, uint8_t* p_value,
+                                                 P_FUN_WRITE_IND_POST_PROC* p_write_ind_post_proc);
+typedef void (*P_FUN_GATT_CCCD_UPDATE_CB)(uint8_t conn_id, T_SERVER_ID service_id,
+                                          uint16_t attrib_index, uint16_t ccc_bits);
+
+typedef struct {
+    P_FUN_GATT_READ_ATTR_CB read_attr_cb;
+    P_FUN_GATT_WRITE_ATTR_CB write_attr_cb;
+    P_FUN_GATT_CCCD_UPDATE_CB cccd_update_cb;
+} T_FUN_GATT_SERVICE_CBS;
+
+typedef enum {
+    PROFILE_EVT_SRV_REG_COMPLETE = 0,
+    PROFILE_EVT_SEND_DATA_COMPLETE = 1
+} T_SERVER_CB_TYPE;
+
+typedef struct {
+    uint16_t credits;           // İşlem sonrası boş buffer sayısı
+    uint8_t conn_id;
+    T_SERVER_ID service_id;
+    uint16_t attrib_idx;
+    uint16_t cause;
+} T_SEND_DATA_RESULT;
+
+typedef struct {
+    T_SERVER_CB_TYPE eventId;
+    union {
+        uint16_t service_reg_result;
+        T_SEND_DATA_RESULT send_data_result;
+    } event_data;
+} T_SERVER_APP_CB_DATA;
+
+typedef T_APP_RESULT (*P_FUN_SERVER_GENERAL_CB)(T_SERVER_ID service_id, void* p_para);
+
+void server_init(uint8_t service_num);
+void server_register_app_cb(P_FUN_SERVER_GENERAL_CB p_fun_cb);
+bool server_add_service(T_SERVER_ID* p_out_service_id, uint8_t* p_database, uint16_t length,
+                        const T_FUN_GATT_SERVICE_CBS srv_cbs);
+
+/**
+ * @return false: bağlantı yok, CCCD kapalı, data_len > MTU - 3 veya credit yok
+ */
+bool server_send_data(uint8_t conn_id, T_SERVER_ID service_id, uint16_t attrib_index,
+                      uint8_t* p_data, uint16_t data_len, T_GATT_PDU_TYPE type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_PROFILE_SERVER_H
@@ -0,0 +1,157 @@
+/**
+ * @file wifi_conf.h
+ * @brief Host stand-in for the AmebaD wifi_conf / wifi_structures API subset
+ *
+ * Sadece kütüphanelerin kullandığı fonksiyonlar: partial scan kanal listesi,
+ * callback'li scan, BSSID ile bağlantı, aktif bağlantı ayarları ve LPS. Davranış WiFi.h host
+ * implementasyonu ile aynı senaryoyu (HostSim.h) paylaşır.
+ */
+
+#ifndef HOST_WIFI_CONF_H
+#define HOST_WIFI_CONF_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WLAN0_NAME              "wlan0"
+
+#define RTW_SUCCESS             0
+#define RTW_ERROR               (-1)
+
+#define PSCAN_ENABLE            0x01
+#define PSCAN_FAST_SURVEY       0x02
+#define PSCAN_SIMPLE_CONFIG     0x04
+
+#define RTW_MAX_PSK_LEN         64
+
+// wifi_constants.h security bitleri
+#define WEP_ENABLED             0x0001
+#define TKIP_ENABLED            0x0002
+#define AES_ENABLED             0x0004
+#define SHARED_ENABLED          0x00008000
+#define WPA_SECURITY            0x00200000
+#define WPA2_SECURITY           0x00400000
+#define WPA3_SECURITY           0x00800000
+#define ENTERPRISE_ENABLED      0x02000000
+
+typedef enum {
+    RTW_SECURITY_OPEN               = 0,
+    RTW_SECURITY_WEP_PSK            = WEP_ENABLED,
+    RTW_SECURITY_WPA_TKIP_PSK       = (WPA_SECURITY | TKIP_ENABLED),
+    RTW_SECURITY_WPA2_AES_PSK       = (WPA2_SECURITY | AES_ENABLED),
+    RTW_SECURITY_WPA_WPA2_MIXED_PSK = (WPA_SECURITY | WPA2_SECURITY | AES_ENABLED | TKIP_ENABLED),
+    RTW_SECURITY_WPA2_ENTERPRISE    = (ENTERPRISE_ENABLED | WPA2_SECURITY | AES_ENABLED),
+    RTW_SECURITY_WPA3_AES_PSK       = (WPA3_SECURITY | AES_ENABLED),
+    RTW_SECURITY_UNKNOWN            = -1
+} rtw_security_t;
+
+typedef enum {
+    RTW_MODE_NONE = 0,
+    RTW_MODE_STA,
+    RTW_MODE_AP,
+    RTW_MODE_STA_AP
+} rtw_mode_t;
+
+typedef enum {
+    RTW_FALSE = 0,
+    RTW_TRUE = 1
+} rtw_bool_t;
+
+typedef int rtw_result_t;
+
+typedef enum {
+    RTW_BSS_TYPE_INFRASTRUCTURE = 0,
+    RTW_BSS_TYPE_ADHOC = 1,
+    RTW_BSS_TYPE_ANY = 2,
+    RTW_BSS_TYPE_UNKNOWN = -1
+} rtw_bss_type_t;
+
+typedef enum {
+    RTW_WPS_TYPE_DEFAULT = 0
+} rtw_wps_type_t;
+
+typedef enum {
+    RTW_802_11_BAND_5GHZ = 0,
+    RTW_802_11_BAND_2_4GHZ = 1
+} rtw_802_11_band_t;
+
+typedef struct rtw_ssid {
+    unsigned char len;
+    unsigned char val[33];
+} rtw_ssid_t;
+
+typedef struct rtw_mac {
+    unsigned char octet[6];
+} rtw_mac_t;
+
+typedef struct rtw_scan_result {
+    rtw_ssid_t SSID;
+    rtw_mac_t BSSID;
+    signed short signal_strength;
+    rtw_bss_type_t bss_type;
+    rtw_security_t security;
+    rtw_wps_type_t wps_type;
+    unsigned int channel;
+    rtw_802_11_band_t band;
+} rtw_scan_result_t;
+
+typedef struct rtw_scan_handler_result {
+    rtw_scan_result_t ap_details;
+    rtw_bool_t scan_complete;
+    void* user_data;
+} rtw_scan_handler_result_t;
+
+typedef rtw_result_t (*rtw_scan_result_handler_t)(rtw_scan_handler_result_t* malloced_scan_result);
+
+typedef struct rtw_wifi_setting {
+    rtw_mode_t mode;
+    unsigned char ssid[33];
+    unsigned char channel;
+    rtw_security_t security_type;
+    unsigned char password[RTW_MAX_PSK_LEN + 1];
+    unsigned char key_idx;
+} rtw_wifi_setting_t;
+
+/**
+ * @brief Bir sonraki bağlantı/scan için taranacak kanalları sınırla
+ */
+int wifi_set_pscan_chan(uint8_t* channel_list, uint8_t* pscan_config, uint8_t length);
+
+/**
+ * @brief Tarama başlat (hemen döner)
+ *
+ * Her AP için results_handler, en son scan_complete=RTW_TRUE ile bir kez daha
+ * çağrılır. Host'ta kayıtlar kanal kanal sanal saat ilerledikçe gelir.
+ * @return RTW_ERROR: önceki tarama sürüyor
+ */
+int wifi_scan_networks(rtw_scan_result_handler_t results_handler, void* user_data);
+
+/**
+ * @brief Bilinen BSSID'ye bağlan (host'ta bloklamaz, WiFi.status() ilerler)
+ */
+int wifi_connect_bssid(unsigned char bssid[6], char* ssid, rtw_security_t security_type,
+                       char* password, int bssid_len, int ssid_len, int password_len,
+                       int key_id, void* semaphore);
+
+int wifi_get_setting(const char* ifname, rtw_wifi_setting_t* setting);
+
+/**
+ * @brief Legacy power save (LPS): radyo beacon'lar arasında uyur
+ */
+int wifi_enable_powersave(void);
+int wifi_disable_powersave(void);
+
+/**
+ * @brief LPS'te uyanılacak DTIM aralığı (1: her DTIM beacon'ı)
+ */
+int wifi_set_lps_dtim(unsigned char dtim);
+int wifi_get_lps_dtim(unsigned char* dtim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_WIFI_CONF_H
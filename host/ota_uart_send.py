@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+Host OTA UART sender
+
+OtaUartSource çerçeve protokolüyle (OtaUartSource.h) bir imajı host
+sketch'inin Serial1 PTY'sine (veya gerçek bir seri porta) gönderir:
+Start (boyut + SHA-256), ardından Ack beklenerek Data çerçeveleri, en son
+cihazın doğrulama sonucu (Result). Nak gelirse cihazın istediği offset'ten
+devam edilir.
+
+Kullanım:
+    host/ota_uart_send.py /dev/pts/3 firmware.bin
+    host/ota_uart_send.py /dev/pts/3 --generate 262144        # imzalı test imajı
+    host/ota_uart_send.py /dev/pts/3 --generate 65536 --corrupt-every 10
+"""
+
+import argparse
+import hashlib
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+SOF = 0xA5
+SIGNATURE = b"81958711"
+ERRORS = ["None", "Bad size", "Bad image", "Flash", "Hash mismatch", "Timeout", "Source", "Aborted",
+          "Restart pending", "No writer task"]
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE"""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def frame(ftype, payload):
+    body = bytes([ord(ftype)]) + struct.pack("<H", len(payload)) + payload
+    return bytes([SOF]) + body + struct.pack("<H", crc16(body))
+
+
+def generate(size):
+    """İmza + sözde rastgele kod + 0xFF dolgu (ota_update sketch'indekiyle aynı)"""
+    image = bytearray(SIGNATURE)
+    x = 0x12345678
+    for i in range(len(SIGNATURE), size):
+        x = (x * 1664525 + 1013904223) & 0xFFFFFFFF
+        image.append((x >> 24) if i < size * 3 // 4 else 0xFF)
+    return bytes(image)
+
+
+class Link:
+    def __init__(self, path, baud):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        if baud:
+            attrs = termios.tcgetattr(self.fd)
+            speed = getattr(termios, "B%d" % baud, None)
+            if speed is not None:
+                attrs[4] = attrs[5] = speed
+                termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        self.rx = b""
+
+    def send(self, data):
+        view = memoryview(data)
+        while view:
+            n = os.write(self.fd, view)
+            view = view[n:]
+
+    def receive(self, timeout):
+        """Bir çerçeve oku: (type, payload) veya zaman aşımında None"""
+        deadline = time.monotonic() + timeout
+        while True:
+            start = self.rx.find(bytes([SOF]))
+            if start < 0:
+                self.rx = b""
+            elif len(self.rx) - start >= 4:
+                self.rx = self.rx[start:]
+                length = struct.unpack_from("<H", self.rx, 2)[0]
+                if len(self.rx) >= 6 + length:
+                    body = self.rx[1:4 + length]
+                    crc = struct.unpack_from("<H", self.rx, 4 + length)[0]
+                    self.rx = self.rx[6 + length:]
+                    if crc == crc16(body):
+                        return chr(body[0]), body[3:]
+                    continue
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            ready, _, _ = select.select([self.fd], [], [], left)
+            if ready:
+                self.rx += os.read(self.fd, 4096)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Send an OTA image over the OtaUartSource frame protocol")
+    parser.add_argument("device", help="serial device / PTY path printed by the host sketch")
+    parser.add_argument("image", nargs="?", help="image file (first 8 bytes must be the OTA signature)")
+    parser.add_argument("--generate", type=int, metavar="SIZE", help="send a generated test image instead")
+    parser.add_argument("--chunk", type=int, default=1024, help="data bytes per frame (<= OTA_UART_CHUNK_SIZE)")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--timeout", type=float, default=2.0, help="ack timeout (s)")
+    parser.add_argument("--corrupt-every", type=int, default=0, metavar="N",
+                        help="flip a CRC byte in every Nth data frame (retransmission test)")
+    args = parser.parse_args()
+
+    if args.generate:
+        image = generate(args.generate)
+    elif args.image:
+        with open(args.image, "rb") as f:
+            image = f.read()
+    else:
+        parser.error("image file or --generate required")
+
+    link = Link(args.device, args.baud)
+    digest = hashlib.sha256(image).digest()
+    print("[ota] %d bytes, sha256 %s" % (len(image), digest.hex()), flush=True)
+
+    start = time.monotonic()
+    retries = 0
+    sent = 0
+
+    # Start
+    while True:
+        link.send(frame("S", struct.pack("<I", len(image)) + digest))
+        reply = link.receive(args.timeout)
+        if reply and reply[0] == "A":
+            break
+        if reply and reply[0] == "N":
+            error = reply[1][0]
+            print("[ota] start rejected: %s" % (ERRORS[error] if error < len(ERRORS) else error))
+            return 1
+        retries += 1
+        if retries > 5:
+            print("[ota] no answer from device")
+            return 1
+
+    offset = 0
+    while offset < len(image):
+        chunk = image[offset:offset + args.chunk]
+        data = frame("D", struct.pack("<I", offset) + chunk)
+        sent += 1
+        if args.corrupt_every and sent % args.corrupt_every == 0:
+            data = data[:-1] + bytes([data[-1] ^ 0xFF])
+        link.send(data)
+
+        reply = link.receive(args.timeout)
+        if reply is None:
+            retries += 1
+            if retries > 50:
+                print("[ota] device stopped answering at offset %d" % offset)
+                return 1
+            continue
+        ftype, payload = reply
+        if ftype == "A":
+            offset = struct.unpack_from("<I", payload)[0]
+        elif ftype == "N":
+            retries += 1
+            offset = struct.unpack_from("<I", payload, 1)[0]
+        elif ftype == "F":
+            print("[ota] device finished early: %s" % ERRORS[payload[0]])
+            return 1
+
+    transfer = time.monotonic() - start
+    result = None
+    while result is None:
+        reply = link.receive(10.0)
+        if reply is None:
+            print("[ota] no result from device")
+            return 1
+        if reply[0] == "F":
+            result = reply[1][0]
+
+    total = time.monotonic() - start
+    print("[ota] %s: %d bytes, %d frames, %d retries, transfer %.2f s, total %.2f s, %.1f KB/s" % (
+        "ok" if result == 0 else ERRORS[result] if result < len(ERRORS) else "error", len(image), sent,
+        retries, transfer, total, len(image) / 1024 / total), flush=True)
+    return 0 if result == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,182 @@
+/**
+ * @file Arduino.cpp
+ * @brief Host core: GPIO log, scripted ADC, random
+ *
+ * Sanal saat ve time API için bkz: Scheduler.cpp
+ */
+
+#include <Arduino.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <math.h>
+#include <stdio.h>
+
+namespace {
+
+constexpr uint8_t kMaxPins = 32;
+
+struct PinState {
+    uint8_t mode = INPUT;
+    uint8_t level = LOW;
+    bool written = false;
+    void (*isr)(void) = nullptr;
+    uint32_t isrMode = CHANGE;
+    int (*adcSource)(uint8_t, uint64_t) = nullptr;
+    bool hasWaveform = false;
+    hostsim::AdcScript waveform = {};
+};
+
+PinState g_pins[kMaxPins];
+std::vector<hostsim::PinEvent> g_pinLog;
+FILE* g_pinLogFile = nullptr;
+uint32_t g_randomState = 1;
+
+} // namespace
+
+namespace hostsim {
+
+const std::vector<PinEvent>& pinLog() { return g_pinLog; }
+
+void clearPinLog() { g_pinLog.clear(); }
+
+bool setPinLogFile(const char* path) {
+    if (g_pinLogFile != nullptr) {
+        fclose(g_pinLogFile);
+        g_pinLogFile = nullptr;
+    }
+    if (path == nullptr) return true;
+    g_pinLogFile = fopen(path, "w");
+    if (g_pinLogFile == nullptr) return false;
+    fprintf(g_pinLogFile, "time_us,pin,value\n");
+    return true;
+}
+
+uint8_t pinLevel(uint8_t pin) {
+    return pin < kMaxPins ? g_pins[pin].level : LOW;
+}
+
+void driveInput(uint8_t pin, uint8_t level) {
+    if (pin >= kMaxPins) return;
+    PinState& p = g_pins[pin];
+    uint8_t previous = p.level;
+    p.level = level ? HIGH : LOW;
+    if (p.isr == nullptr || previous == p.level) return;
+
+    bool rising = p.level == HIGH;
+    if (p.isrMode == CHANGE ||
+        (p.isrMode == RISING && rising) ||
+        (p.isrMode == FALLING && !rising)) {
+        internal::runInterrupt(p.isr);
+    }
+}
+
+void setAdcWaveform(uint8_t pin, const AdcScript& script) {
+    if (pin >= kMaxPins) return;
+    g_pins[pin].waveform = script;
+    g_pins[pin].hasWaveform = true;
+}
+
+void setAdcSource(uint8_t pin, int (*source)(uint8_t pin, uint64_t timeUs)) {
+    if (pin >= kMaxPins) return;
+    g_pins[pin].adcSource = source;
+}
+
+} // namespace hostsim
+
+// ============================================================================
+// Pin API
+// ============================================================================
+
+void pinMode(uint32_t pin, uint32_t mode) {
+    if (pin >= kMaxPins) return;
+    g_pins[pin].mode = static_cast<uint8_t>(mode);
+    if (mode == INPUT_PULLUP) g_pins[pin].level = HIGH;
+}
+
+void digitalWrite(uint32_t pin, uint32_t value) {
+    if (pin >= kMaxPins) return;
+    uint8_t level = value ? HIGH : LOW;
+    // Log sadece seviye değişimlerini tutar (busy loop'ta sınırsız büyümesin)
+    if (g_pins[pin].written && g_pins[pin].level == level) return;
+    g_pins[pin].written = true;
+    g_pins[pin].level = level;
+
+    hostsim::PinEvent event = { hostsim::nowMicros(), static_cast<uint8_t>(pin), level };
+    g_pinLog.push_back(event);
+    if (g_pinLogFile != nullptr) {
+        fprintf(g_pinLogFile, "%llu,%u,%u\n",
+                static_cast<unsigned long long>(event.timeUs), event.pin, event.value);
+    }
+}
+
+int digitalRead(uint32_t pin) {
+    return pin < kMaxPins ? g_pins[pin].level : LOW;
+}
+
+int analogRead(uint32_t pin) {
+    if (pin >= kMaxPins) return 0;
+    PinState& p = g_pins[pin];
+    if (p.adcSource != nullptr) return p.adcSource(static_cast<uint8_t>(pin), hostsim::nowMicros());
+    if (!p.hasWaveform) return 0;
+
+    const hostsim::AdcScript& w = p.waveform;
+    double phase = 0.0;
+    if (w.periodMs > 0) {
+        uint64_t periodUs = static_cast<uint64_t>(w.periodMs) * 1000;
+        phase = static_cast<double>(hostsim::nowMicros() % periodUs) / periodUs;
+    }
+
+    double shape = 0.0;
+    switch (w.shape) {
+        case hostsim::Waveform::Constant: shape = 0.0; break;
+        case hostsim::Waveform::Sine:     shape = sin(2.0 * M_PI * phase); break;
+        case hostsim::Waveform::Square:   shape = phase < 0.5 ? 1.0 : -1.0; break;
+        case hostsim::Waveform::Triangle: shape = phase < 0.5 ? 4.0 * phase - 1.0 : 3.0 - 4.0 * phase; break;
+        case hostsim::Waveform::Sawtooth: shape = 2.0 * phase - 1.0; break;
+        case hostsim::Waveform::Noise:    shape = (random(0, 2001) - 1000) / 1000.0; break;
+    }
+
+    double value = w.offset + w.amplitude * shape;
+    if (value < 0.0) value = 0.0;
+    if (value > 4095.0) value = 4095.0;
+    return static_cast<int>(value);
+}
+
+void analogWrite(uint32_t pin, uint32_t value) {
+    digitalWrite(pin, value > 127 ? HIGH : LOW);
+}
+
+void analogReadResolution(int bits) {
+    (void)bits;
+}
+
+void attachInterrupt(uint32_t pin, void (*callback)(void), uint32_t mode) {
+    if (pin >= kMaxPins) return;
+    g_pins[pin].isr = callback;
+    g_pins[pin].isrMode = mode;
+}
+
+void detachInterrupt(uint32_t pin) {
+    if (pin >= kMaxPins) return;
+    g_pins[pin].isr = nullptr;
+}
+
+// ============================================================================
+// Random (deterministik LCG - tekrarlanabilir simülasyon için)
+// ============================================================================
+
+void randomSeed(unsigned long seed) {
+    g_randomState = seed ? static_cast<uint32_t>(seed) : 1;
+}
+
+long random(long max) {
+    if (max <= 0) return 0;
+    g_randomState = g_randomState * 1664525u + 1013904223u;
+    return static_cast<long>((g_randomState >> 8) % static_cast<uint32_t>(max));
+}
+
+long random(long min, long max) {
+    if (min >= max) return min;
+    return min + random(max - min);
+}
@@ -0,0 +1,341 @@
+/**
+ * @file Ble.cpp
+ * @brief BLE GAP advertising / scan stand-in for the host build
+ */
+
+#include <gap_le.h>
+#include <gap_msg.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <string.h>
+#include <vector>
+
+namespace {
+
+struct AdvState {
+    bool advertising = false;
+    uint8_t data[GAP_MAX_ADV_LEN] = {0};
+    uint8_t dataLen = 0;
+    uint8_t scanRsp[GAP_MAX_ADV_LEN] = {0};
+    uint8_t scanRspLen = 0;
+    uint8_t eventType = GAP_ADTYPE_ADV_IND;
+    uint8_t channelMap = GAP_ADVCHAN_ALL;
+    uint16_t intervalMin = 0x20;    // SDK default: 20 ms
+    uint16_t intervalMax = 0x20;
+    uint32_t starts = 0;
+    uint32_t updates = 0;
+};
+
+AdvState g_adv;
+
+// Scan tick'i: rapor zamanları bu çözünürlükte yuvarlanır
+const uint64_t kScanTickUs = 5000;
+
+// le_scan_stop() -> controller taramayı bırakıp GAP_SCAN_STATE_IDLE bildirene kadar (HCI round trip)
+const uint64_t kScanStopUs = 2000;
+
+struct ScanDevice {
+    hostsim::ScriptedBleDevice script;
+    uint64_t nextUs;
+    bool reported;              // Controller duplicate filtresi için
+};
+
+struct ScanState {
+    P_FUN_LE_APP_CB callback = nullptr;
+    std::vector<ScanDevice> devices;
+    bool scanning = false;
+    bool stopping = false;      // le_scan_stop() verildi, idle bildirimi bekleniyor
+    bool active = false;
+    bool filterDuplicates = false;
+    uint16_t interval = 0x10;   // SDK default: 10 ms
+    uint16_t window = 0x10;
+    hostsim::EventId tick = 0;
+    uint32_t seed = 0x2545F491;
+    uint32_t reports = 0;
+    uint32_t collisions = 0;
+    uint64_t startUs = 0;       // Window fazı: ilk window le_scan_start'ta açılır
+};
+
+ScanState g_scan;
+
+uint32_t nextRandom() {
+    g_scan.seed = g_scan.seed * 1664525 + 1013904223;
+    return g_scan.seed >> 8;
+}
+
+void deliver(const hostsim::ScriptedBleDevice& device, bool scanRsp) {
+    T_LE_SCAN_INFO info;
+    memcpy(info.bd_addr, device.addr, sizeof(info.bd_addr));
+    info.remote_addr_type = static_cast<T_GAP_REMOTE_ADDR_TYPE>(device.addrType);
+    info.adv_type = scanRsp ? GAP_ADV_EVT_TYPE_SCAN_RSP
+                            : static_cast<T_GAP_ADV_EVT_TYPE>(device.advType);
+    int rssi = device.rssi + static_cast<int>(nextRandom() % 9) - 4;
+    info.rssi = static_cast<int8_t>(rssi < -127 ? -127 : rssi);
+    info.data_len = scanRsp ? device.scanRspLen : device.dataLen;
+    memcpy(info.data, scanRsp ? device.scanRsp : device.data, info.data_len);
+
+    g_scan.reports++;
+    T_LE_CB_DATA cbData;
+    cbData.p_le_scan_info = &info;
+    g_scan.callback(GAP_MSG_LE_SCAN_INFO, &cbData);
+}
+
+void scanTick() {
+    uint64_t now = hostsim::nowMicros();
+
+    for (size_t i = 0; i < g_scan.devices.size(); i++) {
+        ScanDevice& d = g_scan.devices[i];
+        if (d.nextUs > now) continue;
+        uint64_t eventUs = d.nextUs;
+        d.nextUs = now + static_cast<uint64_t>(d.script.intervalMs) * 1000 + nextRandom() % 10000;
+
+        // Scan window dışında kalan advertising event'i duyulmaz
+        uint64_t intervalUs = static_cast<uint64_t>(g_scan.interval) * 625;
+        uint64_t windowUs = static_cast<uint64_t>(g_scan.window) * 625;
+        if (eventUs < g_scan.startUs || (eventUs - g_scan.startUs) % intervalUs >= windowUs) continue;
+        // Aynı RF yolunda WiFi TX sürüyordu
+        if (hostsim::internal::wifiMediumBusy(eventUs)) {
+            g_scan.collisions++;
+            continue;
+        }
+        if (g_scan.filterDuplicates && d.reported) continue;
+        d.reported = true;
+        if (g_scan.callback == nullptr) continue;
+
+        deliver(d.script, false);
+        bool scannable = d.script.advType == GAP_ADV_EVT_TYPE_UNDIRECTED ||
+                         d.script.advType == GAP_ADV_EVT_TYPE_SCANNABLE;
+        if (g_scan.active && scannable && d.script.scanRspLen > 0) {
+            deliver(d.script, true);
+        }
+    }
+}
+
+} // namespace
+
+namespace hostsim {
+
+bool bleAdvertising() {
+    return g_adv.advertising;
+}
+
+uint8_t bleAdvData(uint8_t* out) {
+    if (out != nullptr) memcpy(out, g_adv.data, g_adv.dataLen);
+    return g_adv.dataLen;
+}
+
+uint8_t bleAdvEventType() {
+    return g_adv.eventType;
+}
+
+uint32_t bleAdvIntervalUs() {
+    return static_cast<uint32_t>(g_adv.intervalMin) * 625;
+}
+
+uint32_t bleAdvStartCount() {
+    return g_adv.starts;
+}
+
+uint32_t bleAdvUpdateCount() {
+    return g_adv.updates;
+}
+
+void bleAddDevice(const ScriptedBleDevice& device) {
+    ScanDevice d;
+    d.script = device;
+    if (d.script.intervalMs < 20) d.script.intervalMs = 20;
+    if (d.script.dataLen > GAP_MAX_ADV_LEN) d.script.dataLen = GAP_MAX_ADV_LEN;
+    if (d.script.scanRspLen > GAP_MAX_ADV_LEN) d.script.scanRspLen = GAP_MAX_ADV_LEN;
+    // Advertiser'lar birbirinden bağımsız fazda başlar
+    d.nextUs = nowMicros() + nextRandom() % (static_cast<uint32_t>(d.script.intervalMs) * 1000);
+    d.reported = false;
+    g_scan.devices.push_back(d);
+}
+
+bool bleRemoveDevice(const uint8_t addr[6]) {
+    for (size_t i = 0; i < g_scan.devices.size(); i++) {
+        if (memcmp(g_scan.devices[i].script.addr, addr, 6) == 0) {
+            g_scan.devices.erase(g_scan.devices.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void bleClearDevices() {
+    g_scan.devices.clear();
+}
+
+bool bleScanning() {
+    return g_scan.scanning;
+}
+
+uint32_t bleScanReportCount() {
+    return g_scan.reports;
+}
+
+uint32_t bleScanCollisionCount() {
+    return g_scan.collisions;
+}
+
+namespace internal {
+
+bool bleAppCallback(uint8_t type, void* data) {
+    if (g_scan.callback == nullptr) return false;
+    g_scan.callback(type, data);
+    return true;
+}
+
+bool bleConnectableAdvertising() {
+    return g_adv.advertising && g_adv.eventType == GAP_ADTYPE_ADV_IND;
+}
+
+void bleStopAdvertisingOnConnect() {
+    g_adv.advertising = false;
+}
+
+bool bleDeviceKnown(const uint8_t addr[6]) {
+    for (size_t i = 0; i < g_scan.devices.size(); i++) {
+        if (memcmp(g_scan.devices[i].script.addr, addr, 6) == 0) return true;
+    }
+    return false;
+}
+
+} // namespace internal
+
+} // namespace hostsim
+
+T_GAP_CAUSE le_adv_set_param(T_LE_ADV_PARAM_TYPE param, uint8_t len, void* p_value) {
+    if (p_value == nullptr) return GAP_CAUSE_INVALID_PARAM;
+
+    switch (param) {
+        case GAP_PARAM_ADV_DATA:
+            if (len > GAP_MAX_ADV_LEN) return GAP_CAUSE_INVALID_PDU_SIZE;
+            memcpy(g_adv.data, p_value, len);
+            g_adv.dataLen = len;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_SCAN_RSP_DATA:
+            if (len > GAP_MAX_ADV_LEN) return GAP_CAUSE_INVALID_PDU_SIZE;
+            memcpy(g_adv.scanRsp, p_value, len);
+            g_adv.scanRspLen = len;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_ADV_EVENT_TYPE:
+            g_adv.eventType = *static_cast<uint8_t*>(p_value);
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_ADV_CHANNEL_MAP:
+            g_adv.channelMap = *static_cast<uint8_t*>(p_value);
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_ADV_INTERVAL_MIN:
+        case GAP_PARAM_ADV_INTERVAL_MAX: {
+            uint16_t units = *static_cast<uint16_t*>(p_value);
+            // Spec: 0x0020 (20 ms) - 0x4000 (10.24 s)
+            if (units < 0x20 || units > 0x4000) return GAP_CAUSE_INVALID_PARAM;
+            (param == GAP_PARAM_ADV_INTERVAL_MIN ? g_adv.intervalMin : g_adv.intervalMax) = units;
+            return GAP_CAUSE_SUCCESS;
+        }
+        default:
+            return GAP_CAUSE_SUCCESS;
+    }
+}
+
+T_GAP_CAUSE le_adv_get_param(T_LE_ADV_PARAM_TYPE param, void* p_value) {
+    if (p_value == nullptr) return GAP_CAUSE_INVALID_PARAM;
+
+    switch (param) {
+        case GAP_PARAM_ADV_EVENT_TYPE:
+            *static_cast<uint8_t*>(p_value) = g_adv.eventType;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_ADV_INTERVAL_MIN:
+            *static_cast<uint16_t*>(p_value) = g_adv.intervalMin;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_ADV_INTERVAL_MAX:
+            *static_cast<uint16_t*>(p_value) = g_adv.intervalMax;
+            return GAP_CAUSE_SUCCESS;
+        default:
+            return GAP_CAUSE_INVALID_PARAM;
+    }
+}
+
+T_GAP_CAUSE le_adv_start(void) {
+    if (g_adv.advertising) return GAP_CAUSE_INVALID_STATE;
+    g_adv.advertising = true;
+    g_adv.starts++;
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_adv_stop(void) {
+    if (!g_adv.advertising) return GAP_CAUSE_INVALID_STATE;
+    g_adv.advertising = false;
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_adv_update_param(void) {
+    if (!g_adv.advertising) return GAP_CAUSE_INVALID_STATE;
+    g_adv.updates++;
+    return GAP_CAUSE_SUCCESS;
+}
+
+void le_register_app_cb(P_FUN_LE_APP_CB app_callback) {
+    g_scan.callback = app_callback;
+}
+
+T_GAP_CAUSE le_scan_set_param(T_LE_SCAN_PARAM_TYPE param, uint8_t len, void* p_value) {
+    (void)len;
+    if (p_value == nullptr) return GAP_CAUSE_INVALID_PARAM;
+
+    switch (param) {
+        case GAP_PARAM_SCAN_MODE:
+            g_scan.active = *static_cast<uint8_t*>(p_value) == GAP_SCAN_MODE_ACTIVE;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_SCAN_INTERVAL:
+        case GAP_PARAM_SCAN_WINDOW: {
+            uint16_t units = *static_cast<uint16_t*>(p_value);
+            // Spec: 0x0004 (2.5 ms) - 0x4000 (10.24 s)
+            if (units < 0x04 || units > 0x4000) return GAP_CAUSE_INVALID_PARAM;
+            (param == GAP_PARAM_SCAN_INTERVAL ? g_scan.interval : g_scan.window) = units;
+            return GAP_CAUSE_SUCCESS;
+        }
+        case GAP_PARAM_SCAN_FILTER_DUPLICATES:
+            g_scan.filterDuplicates = *static_cast<uint8_t*>(p_value) == GAP_SCAN_FILTER_DUPLICATE_ENABLE;
+            return GAP_CAUSE_SUCCESS;
+        default:
+            return GAP_CAUSE_SUCCESS;
+    }
+}
+
+T_GAP_CAUSE le_scan_start(void) {
+    // Cihazdaki gibi: durdurma tamamlanmadan yeni tarama reddedilir
+    if (g_scan.scanning || g_scan.stopping) return GAP_CAUSE_INVALID_STATE;
+    if (g_scan.window > g_scan.interval) return GAP_CAUSE_INVALID_PARAM;
+
+    // Tarama dışındayken biriken event'ler tek tick'te yığılmasın
+    uint64_t now = hostsim::nowMicros();
+    for (size_t i = 0; i < g_scan.devices.size(); i++) {
+        ScanDevice& d = g_scan.devices[i];
+        d.reported = false;
+        if (d.nextUs < now) {
+            d.nextUs = now + nextRandom() % (static_cast<uint32_t>(d.script.intervalMs) * 1000);
+        }
+    }
+    g_scan.scanning = true;
+    g_scan.startUs = now;
+    g_scan.tick = hostsim::scheduleEvery(kScanTickUs, scanTick, "ble_scan");
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_scan_stop(void) {
+    if (!g_scan.scanning) return GAP_CAUSE_INVALID_STATE;
+    hostsim::cancel(g_scan.tick);
+    g_scan.tick = 0;
+    g_scan.scanning = false;
+
+    // Durdurma asenkron tamamlanır: GAP_MSG_LE_DEV_STATE_CHANGE (scan idle)
+    g_scan.stopping = true;
+    hostsim::scheduleAfter(kScanStopUs, [] {
+        g_scan.stopping = false;
+        hostsim::internal::bleDevStateChanged(g_adv.advertising ? GAP_ADV_STATE_ADVERTISING : GAP_ADV_STATE_IDLE,
+                                              GAP_SCAN_STATE_IDLE);
+    }, "ble_scan_stop");
+    return GAP_CAUSE_SUCCESS;
+}
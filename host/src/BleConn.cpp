@@ -0,0 +1,458 @@
+/**
+ * @file BleConn.cpp
+ * @brief BLE connection / GATT server stand-in for the host build
+ */
+
+#include <gap.h>
+#include <gap_config.h>
+#include <gap_conn_le.h>
+#include <gap_msg.h>
+#include <profile_server.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <string.h>
+#include <deque>
+#include <vector>
+
+namespace {
+
+// LL data PDU overhead (preamble + access address + header + CRC) ve T_IFS
+const uint32_t kLlOverhead1M = 10;
+const uint32_t kLlOverhead2M = 11;
+const uint32_t kTifsUs = 150;
+const uint32_t kL2capHeader = 4;
+const uint32_t kAttHeader = 3;
+const size_t kMaxReceived = 1024;
+
+// HCI disconnect reason (stack cause = 0x100 | reason)
+const uint16_t kCauseRemoteTerminated = 0x113;
+const uint16_t kCauseLocalTerminated = 0x116;
+
+struct Service {
+    T_ATTRIB_APPL* table = nullptr;
+    uint16_t count = 0;
+    T_FUN_GATT_SERVICE_CBS cbs = {nullptr, nullptr, nullptr};
+};
+
+struct ConnState {
+    void (*ioHandler)(T_IO_MSG* msg) = nullptr;
+    P_FUN_SERVER_GENERAL_CB serverCallback = nullptr;
+    std::vector<Service> services;
+    uint16_t maxMtu = 23;
+
+    bool connected = false;
+    uint32_t generation = 0;        // Bağlantı koptuktan sonra gelen zamanlanmış event'ler atlanır
+    hostsim::BlePeerScript peer = {};
+    uint16_t mtu = 23;
+    uint16_t txOctets = 27;
+    uint8_t phy = 1;
+    bool notify = false;
+    uint8_t creditsMax = 10;
+    uint8_t credits = 10;
+    hostsim::EventId eventTimer = 0;
+
+    std::deque<std::vector<uint8_t>> controller;    // Gönderilmeyi bekleyen notification'lar
+    std::deque<std::vector<uint8_t>> received;      // Peer'e ulaşanlar
+    uint32_t notifications = 0;
+    uint64_t bytes = 0;
+};
+
+ConnState g_conn;
+
+uint32_t pduUs(uint32_t payload, uint8_t phy) {
+    return phy == 2 ? (payload + kLlOverhead2M) * 4 : (payload + kLlOverhead1M) * 8;
+}
+
+void postIo(uint16_t subtype, const T_LE_GAP_MSG& gapMsg) {
+    if (g_conn.ioHandler == nullptr) return;
+    T_IO_MSG msg;
+    msg.type = IO_MSG_TYPE_BT_STATUS;
+    msg.subtype = subtype;
+    static_assert(sizeof(T_LE_GAP_MSG) <= sizeof(msg.u.param), "GAP msg must fit IO param");
+    msg.u.param = 0;
+    memcpy(&msg.u.param, &gapMsg, sizeof(gapMsg));
+    g_conn.ioHandler(&msg);
+}
+
+void postDevState(uint8_t advState, uint8_t scanState) {
+    T_LE_GAP_MSG gapMsg;
+    memset(&gapMsg, 0, sizeof(gapMsg));
+    T_GAP_DEV_STATE& state = gapMsg.msg_data.gap_dev_state_change.new_state;
+    state.gap_init_state = GAP_INIT_STATE_STACK_READY;
+    state.gap_adv_state = advState;
+    state.gap_scan_state = scanState;
+    postIo(GAP_MSG_LE_DEV_STATE_CHANGE, gapMsg);
+}
+
+void postConnState(uint8_t state, uint16_t cause) {
+    T_LE_GAP_MSG gapMsg;
+    memset(&gapMsg, 0, sizeof(gapMsg));
+    gapMsg.msg_data.gap_conn_state_change.conn_id = 0;
+    gapMsg.msg_data.gap_conn_state_change.new_state = state;
+    gapMsg.msg_data.gap_conn_state_change.disc_cause = cause;
+    postIo(GAP_MSG_LE_CONN_STATE_CHANGE, gapMsg);
+}
+
+/**
+ * @brief Bağlantı hâlâ aynıysa interval sayısı kadar sonra çalıştır
+ */
+void afterIntervals(uint32_t intervals, std::function<void()> fn, const char* name) {
+    uint32_t generation = g_conn.generation;
+    hostsim::scheduleAfter(static_cast<uint64_t>(g_conn.peer.intervalUs) * intervals, [generation, fn] {
+        if (g_conn.connected && g_conn.generation == generation) fn();
+    }, name);
+}
+
+// İlk CCCD'li attribute ve yazılabilir ilk uygulama değeri
+bool findAttribute(bool cccd, T_SERVER_ID& serviceId, uint16_t& index) {
+    for (size_t s = 0; s < g_conn.services.size(); s++) {
+        const Service& service = g_conn.services[s];
+        for (uint16_t i = 0; i < service.count; i++) {
+            const T_ATTRIB_APPL& a = service.table[i];
+            bool match;
+            if (cccd) {
+                match = (a.flags & ATTRIB_FLAG_UUID_128BIT) == 0 &&
+                        a.type_value[0] == LO_WORD(GATT_UUID_CHAR_CLIENT_CONFIG) &&
+                        a.type_value[1] == HI_WORD(GATT_UUID_CHAR_CLIENT_CONFIG);
+            } else {
+                match = (a.flags & ATTRIB_FLAG_VALUE_APPL) != 0 &&
+                        (a.permissions & GATT_PERM_WRITE) != 0;
+            }
+            if (match) {
+                serviceId = static_cast<T_SERVER_ID>(s);
+                index = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void connectionEvent() {
+    uint32_t budgetUs = g_conn.peer.intervalUs;
+    uint32_t packets = 0;
+    uint32_t delivered = 0;
+
+    while (!g_conn.controller.empty()) {
+        const std::vector<uint8_t>& value = g_conn.controller.front();
+
+        // ATT (opcode + handle + value) + L2CAP header, txOctets'lik LL paketleri
+        uint32_t remaining = static_cast<uint32_t>(value.size()) + kAttHeader + kL2capHeader;
+        uint32_t timeUs = 0;
+        uint32_t fragments = 0;
+        while (remaining > 0) {
+            uint32_t len = remaining > g_conn.txOctets ? g_conn.txOctets : remaining;
+            timeUs += pduUs(len, g_conn.phy) + kTifsUs + pduUs(0, g_conn.phy) + kTifsUs;
+            remaining -= len;
+            fragments++;
+        }
+        if (timeUs > budgetUs) break;
+        if (g_conn.peer.maxPacketsPerEvent > 0 &&
+            packets + fragments > g_conn.peer.maxPacketsPerEvent) {
+            break;
+        }
+
+        budgetUs -= timeUs;
+        packets += fragments;
+        g_conn.notifications++;
+        g_conn.bytes += value.size();
+        if (g_conn.received.size() >= kMaxReceived) g_conn.received.pop_front();
+        g_conn.received.push_back(value);
+        g_conn.controller.pop_front();
+        g_conn.credits++;
+        delivered++;
+    }
+
+    if (delivered > 0 && g_conn.serverCallback != nullptr) {
+        T_SERVER_APP_CB_DATA data;
+        memset(&data, 0, sizeof(data));
+        data.eventId = PROFILE_EVT_SEND_DATA_COMPLETE;
+        data.event_data.send_data_result.credits = g_conn.credits;
+        g_conn.serverCallback(SERVICE_PROFILE_GENERAL_ID, &data);
+    }
+}
+
+void startConnection(const hostsim::BlePeerScript& peer) {
+    g_conn.connected = true;
+    g_conn.generation++;
+    g_conn.peer = peer;
+    if (g_conn.peer.intervalUs < 7500) g_conn.peer.intervalUs = 7500;
+    g_conn.mtu = 23;
+    g_conn.txOctets = 27;
+    g_conn.phy = 1;
+    g_conn.notify = false;
+    g_conn.credits = g_conn.creditsMax;
+    g_conn.controller.clear();
+
+    postConnState(GAP_CONN_STATE_CONNECTED, 0);
+    g_conn.eventTimer = hostsim::scheduleEvery(g_conn.peer.intervalUs, connectionEvent, "ble_conn_event");
+
+    // MTU exchange: iki tarafın en küçüğü
+    afterIntervals(2, [] {
+        uint16_t mtu = g_conn.peer.mtu < g_conn.maxMtu ? g_conn.peer.mtu : g_conn.maxMtu;
+        g_conn.mtu = mtu < 23 ? 23 : mtu;
+        T_LE_GAP_MSG gapMsg;
+        memset(&gapMsg, 0, sizeof(gapMsg));
+        gapMsg.msg_data.gap_conn_mtu_info.conn_id = 0;
+        gapMsg.msg_data.gap_conn_mtu_info.mtu_size = g_conn.mtu;
+        postIo(GAP_MSG_LE_CONN_MTU_INFO, gapMsg);
+    }, "ble_mtu_exchange");
+
+    if (peer.subscribeAfterMs > 0) {
+        uint32_t generation = g_conn.generation;
+        hostsim::scheduleAfter(static_cast<uint64_t>(peer.subscribeAfterMs) * 1000, [generation] {
+            if (!g_conn.connected || g_conn.generation != generation) return;
+            T_SERVER_ID serviceId;
+            uint16_t index;
+            if (!findAttribute(true, serviceId, index)) return;
+            g_conn.notify = true;
+            P_FUN_GATT_CCCD_UPDATE_CB cb = g_conn.services[serviceId].cbs.cccd_update_cb;
+            if (cb != nullptr) cb(0, serviceId, index, GATT_CLIENT_CHAR_CONFIG_NOTIFY);
+        }, "ble_subscribe");
+    }
+}
+
+void endConnection(uint16_t cause) {
+    if (!g_conn.connected) return;
+    g_conn.connected = false;
+    g_conn.generation++;
+    hostsim::cancel(g_conn.eventTimer);
+    g_conn.eventTimer = 0;
+    g_conn.controller.clear();
+    g_conn.credits = g_conn.creditsMax;
+    g_conn.notify = false;
+    postConnState(GAP_CONN_STATE_DISCONNECTED, cause);
+}
+
+} // namespace
+
+namespace hostsim {
+
+bool blePeerConnect(const BlePeerScript& peer) {
+    if (g_conn.connected || !internal::bleConnectableAdvertising()) return false;
+    internal::bleStopAdvertisingOnConnect();
+    startConnection(peer);
+    return true;
+}
+
+void blePeerDisconnect() {
+    endConnection(kCauseRemoteTerminated);
+}
+
+bool blePeerConnected() {
+    return g_conn.connected;
+}
+
+bool blePeerPopNotification(uint8_t* out, uint16_t* length) {
+    if (g_conn.received.empty()) return false;
+    const std::vector<uint8_t>& value = g_conn.received.front();
+    memcpy(out, value.data(), value.size());
+    *length = static_cast<uint16_t>(value.size());
+    g_conn.received.pop_front();
+    return true;
+}
+
+bool blePeerWrite(const uint8_t* data, uint16_t length) {
+    T_SERVER_ID serviceId;
+    uint16_t index;
+    if (!g_conn.connected || length > g_conn.mtu - kAttHeader ||
+        !findAttribute(false, serviceId, index)) {
+        return false;
+    }
+    P_FUN_GATT_WRITE_ATTR_CB cb = g_conn.services[serviceId].cbs.write_attr_cb;
+    if (cb == nullptr) return false;
+
+    std::vector<uint8_t> value(data, data + length);
+    P_FUN_WRITE_IND_POST_PROC postProc = nullptr;
+    cb(0, serviceId, index, WRITE_WITHOUT_RESPONSE, length, value.data(), &postProc);
+    return true;
+}
+
+uint32_t blePeerNotificationCount() {
+    return g_conn.notifications;
+}
+
+uint64_t blePeerNotificationBytes() {
+    return g_conn.bytes;
+}
+
+void bleSetTxCredits(uint8_t credits) {
+    g_conn.creditsMax = credits > 0 ? credits : 1;
+    if (!g_conn.connected) g_conn.credits = g_conn.creditsMax;
+}
+
+namespace internal {
+
+void bleDevStateChanged(uint8_t advState, uint8_t scanState) {
+    postDevState(advState, scanState);
+}
+
+} // namespace internal
+
+} // namespace hostsim
+
+// ============================================================================
+// gap.h / gap_config.h / gap_msg.h
+// ============================================================================
+
+T_GAP_CAUSE le_set_gap_param(T_GAP_LE_PARAM_TYPE param, uint8_t len, void* p_value) {
+    (void)param;
+    (void)len;
+    return p_value == nullptr ? GAP_CAUSE_INVALID_PARAM : GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_get_gap_param(T_GAP_LE_PARAM_TYPE param, void* p_value) {
+    if (p_value == nullptr) return GAP_CAUSE_INVALID_PARAM;
+    if (param != GAP_PARAM_LE_REMAIN_CREDITS) return GAP_CAUSE_INVALID_PARAM;
+    *static_cast<uint8_t*>(p_value) = g_conn.credits;
+    return GAP_CAUSE_SUCCESS;
+}
+
+void gap_config_max_mtu_size(uint16_t att_max_mtu_size) {
+    g_conn.maxMtu = att_max_mtu_size < 23 ? 23 : att_max_mtu_size;
+}
+
+void gap_host_set_io_handler(void (*handler)(T_IO_MSG* msg)) {
+    g_conn.ioHandler = handler;
+}
+
+// ============================================================================
+// gap_conn_le.h
+// ============================================================================
+
+T_GAP_CAUSE le_get_conn_param(T_LE_CONN_PARAM_TYPE param, void* p_value, uint8_t conn_id) {
+    if (p_value == nullptr || conn_id != 0 || !g_conn.connected) return GAP_CAUSE_INVALID_PARAM;
+
+    switch (param) {
+        case GAP_PARAM_CONN_INTERVAL:
+            *static_cast<uint16_t*>(p_value) = static_cast<uint16_t>(g_conn.peer.intervalUs / 1250);
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_CONN_MTU_SIZE:
+            *static_cast<uint16_t*>(p_value) = g_conn.mtu;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_CONN_LATENCY:
+            *static_cast<uint16_t*>(p_value) = 0;
+            return GAP_CAUSE_SUCCESS;
+        case GAP_PARAM_CONN_TIMEOUT:
+            *static_cast<uint16_t*>(p_value) = 400;     // 4 s (10 ms birim)
+            return GAP_CAUSE_SUCCESS;
+        default:
+            return GAP_CAUSE_INVALID_PARAM;
+    }
+}
+
+T_GAP_CAUSE le_set_data_len(uint8_t conn_id, uint16_t tx_octets, uint16_t tx_time) {
+    (void)tx_time;
+    if (conn_id != 0 || !g_conn.connected) return GAP_CAUSE_INVALID_STATE;
+    if (tx_octets < 27 || tx_octets > 251) return GAP_CAUSE_INVALID_PARAM;
+
+    uint16_t octets = tx_octets < g_conn.peer.maxTxOctets ? tx_octets : g_conn.peer.maxTxOctets;
+    if (octets < 27) octets = 27;
+    afterIntervals(2, [octets] {
+        g_conn.txOctets = octets;
+        T_LE_DATA_LEN_CHANGE_INFO info;
+        info.conn_id = 0;
+        info.max_tx_octets = octets;
+        info.max_tx_time = static_cast<uint16_t>(pduUs(octets, 1));
+        info.max_rx_octets = octets;
+        info.max_rx_time = info.max_tx_time;
+        hostsim::internal::bleAppCallback(GAP_MSG_LE_DATA_LEN_CHANGE_INFO, &info);
+    }, "ble_data_len");
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_set_phy(uint8_t conn_id, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys,
+                       uint16_t phy_options) {
+    (void)all_phys;
+    (void)rx_phys;
+    (void)phy_options;
+    if (conn_id != 0 || !g_conn.connected) return GAP_CAUSE_INVALID_STATE;
+
+    uint8_t phy = (tx_phys & GAP_PHYS_PREFER_2M_BIT) && g_conn.peer.supports2M ? 2 : 1;
+    afterIntervals(3, [phy] {
+        g_conn.phy = phy;
+        T_LE_PHY_UPDATE_INFO info;
+        info.conn_id = 0;
+        info.cause = 0;
+        info.tx_phy = phy == 2 ? GAP_PHYS_2M : GAP_PHYS_1M;
+        info.rx_phy = info.tx_phy;
+        hostsim::internal::bleAppCallback(GAP_MSG_LE_PHY_UPDATE_INFO, &info);
+    }, "ble_phy_update");
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_connect(uint8_t init_phys, uint8_t* remote_bd, T_GAP_REMOTE_ADDR_TYPE remote_bd_type,
+                       T_GAP_LOCAL_ADDR_TYPE local_bd_type, uint16_t scan_timeout) {
+    (void)init_phys;
+    (void)remote_bd_type;
+    (void)local_bd_type;
+    (void)scan_timeout;
+    if (g_conn.connected) return GAP_CAUSE_INVALID_STATE;
+    if (remote_bd == nullptr || !hostsim::internal::bleDeviceKnown(remote_bd)) {
+        return GAP_CAUSE_NOT_FIND;
+    }
+
+    // Scripted advertiser'a bağlan: modern telefon / gateway yetenekleri
+    hostsim::BlePeerScript peer = {247, 251, true, 30000, 0, 0};
+    hostsim::scheduleAfter(30000, [peer] {
+        if (!g_conn.connected) startConnection(peer);
+    }, "ble_connect");
+    return GAP_CAUSE_SUCCESS;
+}
+
+T_GAP_CAUSE le_disconnect(uint8_t conn_id) {
+    if (conn_id != 0 || !g_conn.connected) return GAP_CAUSE_INVALID_STATE;
+    endConnection(kCauseLocalTerminated);
+    return GAP_CAUSE_SUCCESS;
+}
+
+// ============================================================================
+// profile_server.h
+// ============================================================================
+
+void server_init(uint8_t service_num) {
+    g_conn.services.clear();
+    g_conn.services.reserve(service_num);
+}
+
+void server_register_app_cb(P_FUN_SERVER_GENERAL_CB p_fun_cb) {
+    g_conn.serverCallback = p_fun_cb;
+}
+
+bool server_add_service(T_SERVER_ID* p_out_service_id, uint8_t* p_database, uint16_t length,
+                        const T_FUN_GATT_SERVICE_CBS srv_cbs) {
+    if (p_out_service_id == nullptr || p_database == nullptr || length < sizeof(T_ATTRIB_APPL)) {
+        return false;
+    }
+    Service service;
+    service.table = reinterpret_cast<T_ATTRIB_APPL*>(p_database);
+    service.count = static_cast<uint16_t>(length / sizeof(T_ATTRIB_APPL));
+    service.cbs = srv_cbs;
+    *p_out_service_id = static_cast<T_SERVER_ID>(g_conn.services.size());
+    g_conn.services.push_back(service);
+
+    if (g_conn.serverCallback != nullptr) {
+        T_SERVER_APP_CB_DATA data;
+        memset(&data, 0, sizeof(data));
+        data.eventId = PROFILE_EVT_SRV_REG_COMPLETE;
+        g_conn.serverCallback(SERVICE_PROFILE_GENERAL_ID, &data);
+    }
+    return true;
+}
+
+bool server_send_data(uint8_t conn_id, T_SERVER_ID service_id, uint16_t attrib_index,
+                      uint8_t* p_data, uint16_t data_len, T_GATT_PDU_TYPE type) {
+    if (conn_id != 0 || !g_conn.connected || !g_conn.notify) return false;
+    if (service_id >= g_conn.services.size() || attrib_index >= g_conn.services[service_id].count) {
+        return false;
+    }
+    if (type != GATT_PDU_TYPE_NOTIFICATION || p_data == nullptr ||
+        data_len > g_conn.mtu - kAttHeader || g_conn.credits == 0) {
+        return false;
+    }
+
+    g_conn.credits--;
+    g_conn.controller.emplace_back(p_data, p_data + data_len);
+    return true;
+}
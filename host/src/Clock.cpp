@@ -0,0 +1,37 @@
+/**
+ * @file Clock.cpp
+ * @brief KM4 CPU clock stand-in for the host build
+ */
+
+#include <ameba_soc.h>
+#include "HostSim.h"
+
+namespace {
+
+uint32_t g_cpuHz = 200000000UL;
+
+} // namespace
+
+namespace hostsim {
+
+uint32_t cpuClockHz() {
+    return g_cpuHz;
+}
+
+} // namespace hostsim
+
+void CPU_ClkSet(uint8_t CpuType) {
+    switch (CpuType) {
+        case CLK_KM4_200M: g_cpuHz = 200000000UL; break;
+        case CLK_KM4_100M: g_cpuHz = 100000000UL; break;
+        case CLK_KM4_50M:  g_cpuHz = 50000000UL; break;
+        case CLK_KM4_25M:  g_cpuHz = 25000000UL; break;
+        case CLK_KM4_XTAL: g_cpuHz = 40000000UL; break;
+        default: break;
+    }
+}
+
+uint32_t CPU_ClkGet(uint8_t Is_FPGA) {
+    (void)Is_FPGA;
+    return g_cpuHz;
+}
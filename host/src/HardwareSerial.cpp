@@ -0,0 +1,145 @@
+/**
+ * @file HardwareSerial.cpp
+ * @brief Host UART backends (stdio pipe / pseudo-terminal)
+ */
+
+#include "HardwareSerial.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+HardwareSerial Serial("Serial", HardwareSerial::Backend::Stdio);
+HardwareSerial Serial1("Serial1", HardwareSerial::Backend::Pty);
+
+HardwareSerial::HardwareSerial(const char* name, Backend backend)
+    : _name(name)
+    , _backend(backend)
+    , _open(false)
+    , _readFd(-1)
+    , _writeFd(-1)
+    , _peeked(-1)
+    , _baud(0)
+    , _bytesWritten(0)
+    , _bytesRead(0)
+{
+    _devicePath[0] = '\0';
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+    _baud = baud;
+    if (_open) return;
+
+    // HOST_SERIAL1=stdio|null ile PTY yerine başka backend seçilebilir
+    if (_backend == Backend::Pty) {
+        const char* mode = getenv("HOST_SERIAL1");
+        if (mode != nullptr && strcmp(mode, "stdio") == 0) {
+            _backend = Backend::Stdio;
+        } else if (mode != nullptr && strcmp(mode, "null") == 0) {
+            _open = true;
+            return;
+        }
+    }
+
+    if (_backend == Backend::Stdio) {
+        _readFd = STDIN_FILENO;
+        _writeFd = STDOUT_FILENO;
+        _open = true;
+        return;
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        fprintf(stderr, "[host] %s: PTY açılamadı (%s)\n", _name, strerror(errno));
+        if (master >= 0) close(master);
+        return;
+    }
+
+    const char* slaveName = ptsname(master);
+    snprintf(_devicePath, sizeof(_devicePath), "%s", slaveName ? slaveName : "");
+
+    // Slave tarafını raw moda al ve açık tut (istemci yokken EIO almamak için)
+    int slave = open(_devicePath, O_RDWR | O_NOCTTY);
+    if (slave >= 0) {
+        struct termios tio;
+        if (tcgetattr(slave, &tio) == 0) {
+            cfmakeraw(&tio);
+            tcsetattr(slave, TCSANOW, &tio);
+        }
+    }
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+    _readFd = master;
+    _writeFd = master;
+    _open = true;
+    fprintf(stderr, "[host] %s -> %s (%lu baud)\n", _name, _devicePath, baud);
+}
+
+void HardwareSerial::end() {
+    if (_backend == Backend::Pty && _readFd >= 0) {
+        close(_readFd);
+    }
+    _readFd = -1;
+    _writeFd = -1;
+    _open = false;
+}
+
+int HardwareSerial::fetch() {
+    if (_peeked >= 0) return _peeked;
+    if (_readFd < 0) return -1;
+
+    struct pollfd pfd = { _readFd, POLLIN, 0 };
+    if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & POLLIN)) return -1;
+
+    uint8_t c;
+    if (::read(_readFd, &c, 1) != 1) return -1;
+    _peeked = c;
+    return _peeked;
+}
+
+int HardwareSerial::available() {
+    return fetch() >= 0 ? 1 : 0;
+}
+
+int HardwareSerial::read() {
+    int c = fetch();
+    if (c >= 0) {
+        _peeked = -1;
+        _bytesRead++;
+    }
+    return c;
+}
+
+int HardwareSerial::peek() {
+    return fetch();
+}
+
+void HardwareSerial::flush() {
+    if (_writeFd == STDOUT_FILENO) fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (!_open) return 0;
+    _bytesWritten += size;
+    if (_writeFd < 0) return size;  // null backend
+
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = ::write(_writeFd, buffer + done, size - done);
+        if (n <= 0) {
+            // PTY'de okuyan yoksa buffer dolabilir (EAGAIN) - kalan veriyi düşür
+            break;
+        }
+        done += static_cast<size_t>(n);
+    }
+    return size;
+}
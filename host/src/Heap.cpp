@@ -0,0 +1,43 @@
+/**
+ * @file Heap.cpp
+ * @brief Global operator new/delete with allocation counters
+ */
+
+#include "HostSim.h"
+
+#include <new>
+#include <stdlib.h>
+
+namespace {
+
+uint64_t g_allocCount = 0;
+uint64_t g_allocBytes = 0;
+
+void* countedAlloc(size_t size) {
+    g_allocCount++;
+    g_allocBytes += size;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+namespace hostsim {
+
+uint64_t heapAllocCount() {
+    return g_allocCount;
+}
+
+uint64_t heapAllocBytes() {
+    return g_allocBytes;
+}
+
+} // namespace hostsim
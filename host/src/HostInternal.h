@@ -0,0 +1,66 @@
+/**
+ * @file HostInternal.h
+ * @brief Shared helpers between host HAL translation units (not for sketches)
+ */
+
+#ifndef HOST_INTERNAL_H
+#define HOST_INTERNAL_H
+
+#include <stdint.h>
+
+namespace hostsim {
+namespace internal {
+
+/**
+ * @brief ISR'ı çalıştır, SimStats ve trace hook'u güncelle
+ */
+void runInterrupt(void (*isr)(void));
+
+// WiFi.cpp -> Ble.cpp
+
+/**
+ * @brief 2.4 GHz ortamı bu anda WiFi TX ile meşgul mü (wifiTransmit)
+ */
+bool wifiMediumBusy(uint64_t timeUs);
+
+// WiFi.cpp -> Lwip.cpp
+
+/**
+ * @brief Bağlı ve DHCP tamamlandı (udp_sendto ERR_RTE ayrımı için)
+ */
+bool wifiHasIp();
+
+// Ble.cpp -> BleConn.cpp
+
+/**
+ * @brief le_register_app_cb callback'ine ilet
+ * @return false: callback kayıtlı değil
+ */
+bool bleAppCallback(uint8_t type, void* data);
+
+/**
+ * @brief Bağlanılabilir (ADV_IND) advertising sürüyor mu
+ */
+bool bleConnectableAdvertising();
+
+/**
+ * @brief Bağlantı kuruldu: controller advertising'i kendiliğinden bırakır
+ */
+void bleStopAdvertisingOnConnect();
+
+/**
+ * @brief Adres bleAddDevice ile tanımlı bir advertiser'a mı ait
+ */
+bool bleDeviceKnown(const uint8_t addr[6]);
+
+// Ble.cpp -> BleConn.cpp (IO handler)
+
+/**
+ * @brief GAP_MSG_LE_DEV_STATE_CHANGE gönder (GAP_ADV_STATE_* / GAP_SCAN_STATE_*)
+ */
+void bleDevStateChanged(uint8_t advState, uint8_t scanState);
+
+} // namespace internal
+} // namespace hostsim
+
+#endif // HOST_INTERNAL_H
@@ -0,0 +1,39 @@
+/**
+ * @file IPAddress.cpp
+ * @brief Host IPAddress implementation
+ */
+
+#include "IPAddress.h"
+
+bool IPAddress::fromString(const char* address) {
+    uint16_t acc = 0;
+    uint8_t dots = 0;
+    bool digit = false;
+    uint8_t octets[4];
+    for (const char* c = address; *c != '\0'; c++) {
+        if (*c >= '0' && *c <= '9') {
+            acc = acc * 10 + (*c - '0');
+            if (acc > 255) return false;
+            digit = true;
+        } else if (*c == '.' && digit && dots < 3) {
+            octets[dots++] = static_cast<uint8_t>(acc);
+            acc = 0;
+            digit = false;
+        } else {
+            return false;
+        }
+    }
+    if (dots != 3 || !digit) return false;
+    octets[3] = static_cast<uint8_t>(acc);
+    memcpy(_octets, octets, sizeof(_octets));
+    return true;
+}
+
+size_t IPAddress::printTo(Print& p) const {
+    size_t n = 0;
+    for (int i = 0; i < 4; i++) {
+        n += p.print(_octets[i], DEC);
+        if (i < 3) n += p.print('.');
+    }
+    return n;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file Lwip.cpp
+ * @brief Host lwIP subset: pbuf pool, raw UDP loopback, tcpip_callback
+ */
+
+#include <lwip/pbuf.h>
+#include <lwip/udp.h>
+#include <lwip/tcpip.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <string.h>
+
+namespace {
+
+constexpr uint16_t kMtu = 1500;
+constexpr size_t kLoopbackDepth = 64;
+
+struct PbufSlot {
+    struct pbuf p;
+    bool used;
+    uint8_t ram[PBUF_RAM_MAX];
+};
+
+struct LoopbackDatagram {
+    uint16_t port;
+    uint16_t length;
+    uint8_t data[kMtu - IP_HLEN - UDP_HLEN];
+};
+
+PbufSlot g_pbufs[MEMP_NUM_PBUF];
+
+// Alıcı taraf: sabit ring, taşarsa en eski datagram düşer
+LoopbackDatagram g_loopback[kLoopbackDepth];
+size_t g_loopHead = 0;
+size_t g_loopCount = 0;
+uint32_t g_udpDatagrams = 0;
+uint64_t g_udpBytes = 0;
+uint32_t g_udpOverwritten = 0;
+
+} // namespace
+
+struct udp_pcb {
+    bool used;
+};
+
+namespace {
+udp_pcb g_pcbs[MEMP_NUM_UDP_PCB];
+}
+
+// ============================================================================
+// pbuf
+// ============================================================================
+
+extern "C" struct pbuf* pbuf_alloc(pbuf_layer layer, u16_t length, pbuf_type type) {
+    (void)layer;
+    if (type == PBUF_RAM && length > PBUF_RAM_MAX) return nullptr;
+
+    for (PbufSlot& slot : g_pbufs) {
+        if (slot.used) continue;
+        slot.used = true;
+        memset(&slot.p, 0, sizeof(slot.p));
+        slot.p.tot_len = length;
+        slot.p.len = length;
+        slot.p.type = static_cast<u8_t>(type);
+        slot.p.ref = 1;
+        slot.p.payload = (type == PBUF_RAM || type == PBUF_POOL) ? slot.ram : nullptr;
+        return &slot.p;
+    }
+    return nullptr;
+}
+
+extern "C" u8_t pbuf_free(struct pbuf* p) {
+    u8_t freed = 0;
+    while (p != nullptr) {
+        if (--p->ref > 0) break;
+        struct pbuf* next = p->next;
+        for (PbufSlot& slot : g_pbufs) {
+            if (&slot.p == p) slot.used = false;
+        }
+        freed++;
+        p = next;
+    }
+    return freed;
+}
+
+// ============================================================================
+// UDP
+// ============================================================================
+
+extern "C" struct udp_pcb* udp_new(void) {
+    for (udp_pcb& pcb : g_pcbs) {
+        if (pcb.used) continue;
+        pcb.used = true;
+        return &pcb;
+    }
+    return nullptr;
+}
+
+extern "C" void udp_remove(struct udp_pcb* pcb) {
+    if (pcb != nullptr) pcb->used = false;
+}
+
+extern "C" err_t udp_sendto(struct udp_pcb* pcb, struct pbuf* p, const ip_addr_t* dst_ip, u16_t dst_port) {
+    if (pcb == nullptr || p == nullptr || dst_ip == nullptr) return ERR_ARG;
+    if (p->tot_len + IP_HLEN + UDP_HLEN > kMtu) return ERR_VAL;
+    if (!hostsim::internal::wifiHasIp()) return ERR_RTE;
+    if (!hostsim::wifiTransmit(p->tot_len + IP_HLEN + UDP_HLEN)) return ERR_MEM;
+
+    // Sürücü gibi zinciri kopyala: dönüşten sonra PBUF_REF payload'u serbest
+    size_t index = (g_loopHead + g_loopCount) % kLoopbackDepth;
+    if (g_loopCount == kLoopbackDepth) {
+        g_loopHead = (g_loopHead + 1) % kLoopbackDepth;
+        g_udpOverwritten++;
+    } else {
+        g_loopCount++;
+    }
+    LoopbackDatagram& d = g_loopback[index];
+    d.port = dst_port;
+    d.length = 0;
+    for (const struct pbuf* q = p; q != nullptr && d.length < p->tot_len; q = q->next) {
+        memcpy(&d.data[d.length], q->payload, q->len);
+        d.length += q->len;
+    }
+
+    g_udpDatagrams++;
+    g_udpBytes += p->tot_len;
+    return ERR_OK;
+}
+
+// ============================================================================
+// tcpip thread
+// ============================================================================
+
+extern "C" err_t tcpip_callback_with_block(tcpip_callback_fn function, void* ctx, u8_t block) {
+    (void)block;
+    if (function == nullptr) return ERR_ARG;
+    hostsim::scheduleAfter(TCPIP_HOST_LATENCY_US, [function, ctx] { function(ctx); }, "tcpip");
+    return ERR_OK;
+}
+
+namespace hostsim {
+
+size_t udpLoopbackPop(uint8_t* out, size_t max, uint16_t* port) {
+    if (g_loopCount == 0) return 0;
+    const LoopbackDatagram& d = g_loopback[g_loopHead];
+    g_loopHead = (g_loopHead + 1) % kLoopbackDepth;
+    g_loopCount--;
+
+    size_t len = d.length < max ? d.length : max;
+    memcpy(out, d.data, len);
+    if (port != nullptr) *port = d.port;
+    return len;
+}
+
+uint32_t udpLoopbackCount() {
+    return g_udpDatagrams;
+}
+
+uint64_t udpLoopbackBytes() {
+    return g_udpBytes;
+}
+
+uint32_t udpLoopbackOverwritten() {
+    return g_udpOverwritten;
+}
+
+uint8_t pbufInUse() {
+    uint8_t used = 0;
+    for (const PbufSlot& slot : g_pbufs) {
+        if (slot.used) used++;
+    }
+    return used;
+}
+
+} // namespace hostsim
@@ -0,0 +1,522 @@
+/**
+ * @file MbedTls.cpp
+ * @brief Host mbedTLS client and SHA-256 API on OpenSSL
+ *
+ * SSL nesnesinin altında özel bir BIO vardır: okuma / yazma mbedtls_ssl_set_bio
+ * callback'lerine gider, MBEDTLS_ERR_SSL_WANT_READ / WANT_WRITE BIO retry
+ * bayrağına, OpenSSL'in SSL_ERROR_WANT_* sonuçları tekrar mbedTLS kodlarına
+ * çevrilir.
+ */
+
+#include "mbedtls/ssl.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/x509_crt.h"
+#include "mbedtls/error.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/sha256.h"
+
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/rand.h>
+#include <openssl/x509.h>
+#include <openssl/pem.h>
+#include <openssl/evp.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+BIO_METHOD* g_bioMethod = nullptr;
+
+SSL* sslOf(const mbedtls_ssl_context* ssl) {
+    return static_cast<SSL*>(ssl->host);
+}
+
+int bioWrite(BIO* bio, const char* data, int len) {
+    mbedtls_ssl_context* ssl = static_cast<mbedtls_ssl_context*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+    if (ssl->f_send == nullptr) return -1;
+
+    int ret = ssl->f_send(ssl->p_bio, reinterpret_cast<const unsigned char*>(data), static_cast<size_t>(len));
+    if (ret >= 0) return ret;
+    if (ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        BIO_set_retry_write(bio);
+        return -1;
+    }
+    ssl->bio_error = ret;
+    return -1;
+}
+
+int bioRead(BIO* bio, char* data, int len) {
+    mbedtls_ssl_context* ssl = static_cast<mbedtls_ssl_context*>(BIO_get_data(bio));
+    BIO_clear_retry_flags(bio);
+    if (ssl->f_recv == nullptr) return -1;
+
+    int ret = ssl->f_recv(ssl->p_bio, reinterpret_cast<unsigned char*>(data), static_cast<size_t>(len));
+    if (ret >= 0) return ret;
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ) {
+        BIO_set_retry_read(bio);
+        return -1;
+    }
+    ssl->bio_error = ret;
+    return -1;
+}
+
+long bioCtrl(BIO* bio, int cmd, long num, void* ptr) {
+    (void)bio;
+    (void)num;
+    (void)ptr;
+    return cmd == BIO_CTRL_FLUSH ? 1 : 0;
+}
+
+int bioCreate(BIO* bio) {
+    BIO_set_init(bio, 1);
+    return 1;
+}
+
+BIO_METHOD* bioMethod() {
+    if (g_bioMethod == nullptr) {
+        g_bioMethod = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "mbedtls_bio");
+        BIO_meth_set_write(g_bioMethod, bioWrite);
+        BIO_meth_set_read(g_bioMethod, bioRead);
+        BIO_meth_set_ctrl(g_bioMethod, bioCtrl);
+        BIO_meth_set_create(g_bioMethod, bioCreate);
+    }
+    return g_bioMethod;
+}
+
+SSL_CTX* buildContext(const mbedtls_ssl_config* conf) {
+    SSL_CTX* ctx = SSL_CTX_new(TLS_client_method());
+    if (ctx == nullptr) return nullptr;
+
+    // mbedTLS 2.x istemcisi TLS 1.3 konuşmaz
+    SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+    SSL_CTX_set_max_proto_version(ctx, TLS1_2_VERSION);
+    if (conf->session_tickets == MBEDTLS_SSL_SESSION_TICKETS_DISABLED) {
+        SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+    }
+    // Oturumlar uygulama tarafında tutulur (get_session / set_session)
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+
+    if (conf->ca_chain != nullptr) {
+        X509_STORE* store = SSL_CTX_get_cert_store(ctx);
+        for (int i = 0; i < conf->ca_chain->count; i++) {
+            X509_STORE_add_cert(store, static_cast<X509*>(conf->ca_chain->certs[i]));
+        }
+    }
+    // OPTIONAL: doğrula ama handshake'i kesme (sonuç get_verify_result'ta)
+    SSL_CTX_set_verify(ctx, conf->authmode == MBEDTLS_SSL_VERIFY_REQUIRED ? SSL_VERIFY_PEER : SSL_VERIFY_NONE,
+                       nullptr);
+    return ctx;
+}
+
+bool newSsl(mbedtls_ssl_context* ssl) {
+    SSL* s = SSL_new(static_cast<SSL_CTX*>(ssl->conf->host));
+    if (s == nullptr) return false;
+
+    BIO* bio = BIO_new(bioMethod());
+    BIO_set_data(bio, ssl);
+    SSL_set_bio(s, bio, bio);
+    SSL_set_connect_state(s);
+    if (ssl->hostname != nullptr) {
+        SSL_set_tlsext_host_name(s, ssl->hostname);
+        if (ssl->conf->authmode != MBEDTLS_SSL_VERIFY_NONE) SSL_set1_host(s, ssl->hostname);
+    }
+    ssl->host = s;
+    ssl->bio_error = 0;
+    return true;
+}
+
+/**
+ * @brief OpenSSL sonucunu mbedTLS dönüş koduna çevir
+ */
+int translate(mbedtls_ssl_context* ssl, int ret) {
+    if (ret > 0) return ret;
+    int err = SSL_get_error(sslOf(ssl), ret);
+    ERR_clear_error();
+    switch (err) {
+        case SSL_ERROR_WANT_READ:   return MBEDTLS_ERR_SSL_WANT_READ;
+        case SSL_ERROR_WANT_WRITE:  return MBEDTLS_ERR_SSL_WANT_WRITE;
+        case SSL_ERROR_ZERO_RETURN: return MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY;
+        default:
+            break;
+    }
+    if (ssl->bio_error != 0) return ssl->bio_error;
+    if (SSL_get_verify_result(sslOf(ssl)) != X509_V_OK &&
+        ssl->conf->authmode == MBEDTLS_SSL_VERIFY_REQUIRED) {
+        return MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+    }
+    if (err == SSL_ERROR_SYSCALL) return MBEDTLS_ERR_SSL_CONN_EOF;
+    return MBEDTLS_ERR_SSL_FATAL_ALERT_MESSAGE;
+}
+
+void fillSession(mbedtls_ssl_session* session, SSL_SESSION* sess) {
+    if (session->host != nullptr) SSL_SESSION_free(static_cast<SSL_SESSION*>(session->host));
+    session->host = sess;
+
+    unsigned int idLen = 0;
+    const unsigned char* id = SSL_SESSION_get_id(sess, &idLen);
+    if (idLen > sizeof(session->id)) idLen = sizeof(session->id);
+    memcpy(session->id, id, idLen);
+    session->id_len = idLen;
+
+    memset(session->master, 0, sizeof(session->master));
+    SSL_SESSION_get_master_key(sess, session->master, sizeof(session->master));
+
+    const SSL_CIPHER* cipher = SSL_SESSION_get0_cipher(sess);
+    session->ciphersuite = cipher != nullptr ? SSL_CIPHER_get_protocol_id(cipher) : 0;
+}
+
+} // namespace
+
+// ============================================================================
+// Entropy / DRBG
+// ============================================================================
+
+void mbedtls_entropy_init(mbedtls_entropy_context* ctx) {
+    ctx->unused = 0;
+}
+
+void mbedtls_entropy_free(mbedtls_entropy_context* ctx) {
+    (void)ctx;
+}
+
+int mbedtls_entropy_func(void* data, unsigned char* output, size_t len) {
+    (void)data;
+    return RAND_bytes(output, static_cast<int>(len)) == 1 ? 0 : -0x003C;
+}
+
+void mbedtls_ctr_drbg_init(mbedtls_ctr_drbg_context* ctx) {
+    ctx->seeded = 0;
+}
+
+void mbedtls_ctr_drbg_free(mbedtls_ctr_drbg_context* ctx) {
+    ctx->seeded = 0;
+}
+
+int mbedtls_ctr_drbg_seed(mbedtls_ctr_drbg_context* ctx,
+                          int (*f_entropy)(void*, unsigned char*, size_t), void* p_entropy,
+                          const unsigned char* custom, size_t len) {
+    (void)custom;
+    (void)len;
+    unsigned char seed[32];
+    int ret = f_entropy(p_entropy, seed, sizeof(seed));
+    if (ret != 0) return ret;
+    RAND_seed(seed, sizeof(seed));
+    ctx->seeded = 1;
+    return 0;
+}
+
+int mbedtls_ctr_drbg_random(void* p_rng, unsigned char* output, size_t output_len) {
+    (void)p_rng;
+    return RAND_bytes(output, static_cast<int>(output_len)) == 1 ? 0 : -0x0034;
+}
+
+// ============================================================================
+// X.509
+// ============================================================================
+
+void mbedtls_x509_crt_init(mbedtls_x509_crt* crt) {
+    memset(crt, 0, sizeof(*crt));
+}
+
+void mbedtls_x509_crt_free(mbedtls_x509_crt* crt) {
+    for (int i = 0; i < crt->count; i++) X509_free(static_cast<X509*>(crt->certs[i]));
+    memset(crt, 0, sizeof(*crt));
+}
+
+int mbedtls_x509_crt_parse(mbedtls_x509_crt* chain, const unsigned char* buf, size_t buflen) {
+    if (buf == nullptr || buflen == 0) return MBEDTLS_ERR_X509_INVALID_FORMAT;
+    // PEM uzunluğu '\0' dahil verilir
+    size_t len = buf[buflen - 1] == '\0' ? buflen - 1 : buflen;
+
+    BIO* bio = BIO_new_mem_buf(buf, static_cast<int>(len));
+    int parsed = 0;
+    X509* cert;
+    while (chain->count < HOST_MBEDTLS_MAX_CERTS &&
+           (cert = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr)) != nullptr) {
+        chain->certs[chain->count++] = cert;
+        parsed++;
+    }
+    BIO_free(bio);
+    ERR_clear_error();
+    return parsed > 0 ? 0 : MBEDTLS_ERR_X509_INVALID_FORMAT;
+}
+
+// ============================================================================
+// Config
+// ============================================================================
+
+void mbedtls_ssl_config_init(mbedtls_ssl_config* conf) {
+    memset(conf, 0, sizeof(*conf));
+}
+
+void mbedtls_ssl_config_free(mbedtls_ssl_config* conf) {
+    if (conf->host != nullptr) SSL_CTX_free(static_cast<SSL_CTX*>(conf->host));
+    memset(conf, 0, sizeof(*conf));
+}
+
+int mbedtls_ssl_config_defaults(mbedtls_ssl_config* conf, int endpoint, int transport, int preset) {
+    (void)preset;
+    if (endpoint != MBEDTLS_SSL_IS_CLIENT || transport != MBEDTLS_SSL_TRANSPORT_STREAM) {
+        return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+    }
+    conf->endpoint = endpoint;
+    conf->authmode = MBEDTLS_SSL_VERIFY_REQUIRED;
+    conf->session_tickets = MBEDTLS_SSL_SESSION_TICKETS_ENABLED;
+    return 0;
+}
+
+void mbedtls_ssl_conf_authmode(mbedtls_ssl_config* conf, int authmode) {
+    conf->authmode = authmode;
+}
+
+void mbedtls_ssl_conf_ca_chain(mbedtls_ssl_config* conf, mbedtls_x509_crt* ca_chain, void* ca_crl) {
+    (void)ca_crl;
+    conf->ca_chain = ca_chain;
+}
+
+void mbedtls_ssl_conf_rng(mbedtls_ssl_config* conf, int (*f_rng)(void*, unsigned char*, size_t), void* p_rng) {
+    conf->f_rng = f_rng;
+    conf->p_rng = p_rng;
+}
+
+void mbedtls_ssl_conf_session_tickets(mbedtls_ssl_config* conf, int use_tickets) {
+    conf->session_tickets = use_tickets;
+}
+
+// ============================================================================
+// Context
+// ============================================================================
+
+void mbedtls_ssl_init(mbedtls_ssl_context* ssl) {
+    memset(ssl, 0, sizeof(*ssl));
+}
+
+void mbedtls_ssl_free(mbedtls_ssl_context* ssl) {
+    if (ssl->host != nullptr) SSL_free(sslOf(ssl));
+    free(ssl->hostname);
+    memset(ssl, 0, sizeof(*ssl));
+}
+
+int mbedtls_ssl_setup(mbedtls_ssl_context* ssl, const mbedtls_ssl_config* conf) {
+    if (conf->f_rng == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    if (conf->host == nullptr) {
+        // mbedTLS'te de config setup'tan sonra değiştirilmez
+        const_cast<mbedtls_ssl_config*>(conf)->host = buildContext(conf);
+        if (conf->host == nullptr) return MBEDTLS_ERR_SSL_ALLOC_FAILED;
+    }
+    ssl->conf = conf;
+    return newSsl(ssl) ? 0 : MBEDTLS_ERR_SSL_ALLOC_FAILED;
+}
+
+int mbedtls_ssl_session_reset(mbedtls_ssl_context* ssl) {
+    if (ssl->conf == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    if (ssl->host != nullptr) SSL_free(sslOf(ssl));
+    ssl->host = nullptr;
+    return newSsl(ssl) ? 0 : MBEDTLS_ERR_SSL_ALLOC_FAILED;
+}
+
+int mbedtls_ssl_set_hostname(mbedtls_ssl_context* ssl, const char* hostname) {
+    free(ssl->hostname);
+    ssl->hostname = hostname != nullptr ? strdup(hostname) : nullptr;
+    if (ssl->host != nullptr && hostname != nullptr) {
+        SSL_set_tlsext_host_name(sslOf(ssl), hostname);
+        if (ssl->conf->authmode != MBEDTLS_SSL_VERIFY_NONE) SSL_set1_host(sslOf(ssl), hostname);
+    }
+    return 0;
+}
+
+void mbedtls_ssl_set_bio(mbedtls_ssl_context* ssl, void* p_bio, mbedtls_ssl_send_t* f_send,
+                         mbedtls_ssl_recv_t* f_recv, mbedtls_ssl_recv_timeout_t* f_recv_timeout) {
+    (void)f_recv_timeout;
+    ssl->p_bio = p_bio;
+    ssl->f_send = f_send;
+    ssl->f_recv = f_recv;
+}
+
+int mbedtls_ssl_handshake(mbedtls_ssl_context* ssl) {
+    if (ssl->host == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    ssl->bio_error = 0;
+    int ret = SSL_do_handshake(sslOf(ssl));
+    return ret == 1 ? 0 : translate(ssl, ret);
+}
+
+int mbedtls_ssl_read(mbedtls_ssl_context* ssl, unsigned char* buf, size_t len) {
+    if (ssl->host == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    ssl->bio_error = 0;
+    int ret = SSL_read(sslOf(ssl), buf, static_cast<int>(len));
+    return translate(ssl, ret);
+}
+
+int mbedtls_ssl_write(mbedtls_ssl_context* ssl, const unsigned char* buf, size_t len) {
+    if (ssl->host == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    if (len == 0) return 0;
+    ssl->bio_error = 0;
+    int ret = SSL_write(sslOf(ssl), buf, static_cast<int>(len));
+    return translate(ssl, ret);
+}
+
+int mbedtls_ssl_close_notify(mbedtls_ssl_context* ssl) {
+    if (ssl->host == nullptr) return 0;
+    ssl->bio_error = 0;
+    int ret = SSL_shutdown(sslOf(ssl));
+    if (ret >= 0) return 0;
+    return translate(ssl, ret);
+}
+
+uint32_t mbedtls_ssl_get_verify_result(const mbedtls_ssl_context* ssl) {
+    if (ssl->host == nullptr) return 0xFFFFFFFF;
+    long result = SSL_get_verify_result(sslOf(ssl));
+    if (result == X509_V_OK) return 0;
+    if (result == X509_V_ERR_CERT_HAS_EXPIRED) return MBEDTLS_X509_BADCERT_EXPIRED;
+    if (result == X509_V_ERR_HOSTNAME_MISMATCH) return MBEDTLS_X509_BADCERT_CN_MISMATCH;
+    return MBEDTLS_X509_BADCERT_NOT_TRUSTED;
+}
+
+const char* mbedtls_ssl_get_ciphersuite(const mbedtls_ssl_context* ssl) {
+    return ssl->host != nullptr ? SSL_get_cipher_name(sslOf(ssl)) : "unknown";
+}
+
+const char* mbedtls_ssl_get_version(const mbedtls_ssl_context* ssl) {
+    return ssl->host != nullptr ? SSL_get_version(sslOf(ssl)) : "unknown";
+}
+
+// ============================================================================
+// Session
+// ============================================================================
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session* session) {
+    memset(session, 0, sizeof(*session));
+}
+
+void mbedtls_ssl_session_free(mbedtls_ssl_session* session) {
+    if (session->host != nullptr) SSL_SESSION_free(static_cast<SSL_SESSION*>(session->host));
+    memset(session, 0, sizeof(*session));
+}
+
+int mbedtls_ssl_get_session(const mbedtls_ssl_context* ssl, mbedtls_ssl_session* session) {
+    if (ssl->host == nullptr || session == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    SSL_SESSION* sess = SSL_get1_session(sslOf(ssl));
+    if (sess == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    fillSession(session, sess);
+    session->verify_result = mbedtls_ssl_get_verify_result(ssl);
+    return 0;
+}
+
+int mbedtls_ssl_set_session(mbedtls_ssl_context* ssl, const mbedtls_ssl_session* session) {
+    if (ssl->host == nullptr || session == nullptr || session->host == nullptr) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    if (SSL_set_session(sslOf(ssl), static_cast<SSL_SESSION*>(session->host)) != 1) {
+        ERR_clear_error();
+        return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+    return 0;
+}
+
+int mbedtls_ssl_session_save(const mbedtls_ssl_session* session, unsigned char* buf, size_t buf_len,
+                             size_t* olen) {
+    if (session->host == nullptr) return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    SSL_SESSION* sess = static_cast<SSL_SESSION*>(session->host);
+    int need = i2d_SSL_SESSION(sess, nullptr);
+    if (need <= 0) return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    *olen = static_cast<size_t>(need);
+    if (buf == nullptr || buf_len < static_cast<size_t>(need)) return MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL;
+    unsigned char* p = buf;
+    i2d_SSL_SESSION(sess, &p);
+    return 0;
+}
+
+int mbedtls_ssl_session_load(mbedtls_ssl_session* session, const unsigned char* buf, size_t len) {
+    const unsigned char* p = buf;
+    SSL_SESSION* sess = d2i_SSL_SESSION(nullptr, &p, static_cast<long>(len));
+    if (sess == nullptr) {
+        ERR_clear_error();
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    fillSession(session, sess);
+    return 0;
+}
+
+// ============================================================================
+// Error
+// ============================================================================
+
+void mbedtls_strerror(int errnum, char* buffer, size_t buflen) {
+    const char* text;
+    switch (errnum) {
+        case MBEDTLS_ERR_SSL_WANT_READ:             text = "SSL - want read"; break;
+        case MBEDTLS_ERR_SSL_WANT_WRITE:            text = "SSL - want write"; break;
+        case MBEDTLS_ERR_SSL_CONN_EOF:              text = "SSL - connection EOF"; break;
+        case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:     text = "SSL - peer close notify"; break;
+        case MBEDTLS_ERR_SSL_FATAL_ALERT_MESSAGE:   text = "SSL - fatal alert"; break;
+        case MBEDTLS_ERR_SSL_BAD_INPUT_DATA:        text = "SSL - bad input data"; break;
+        case MBEDTLS_ERR_SSL_ALLOC_FAILED:          text = "SSL - allocation failed"; break;
+        case MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL:      text = "SSL - buffer too small"; break;
+        case MBEDTLS_ERR_X509_CERT_VERIFY_FAILED:   text = "X509 - certificate verification failed"; break;
+        case MBEDTLS_ERR_NET_CONN_RESET:            text = "NET - connection reset"; break;
+        case MBEDTLS_ERR_NET_SEND_FAILED:           text = "NET - send failed"; break;
+        case MBEDTLS_ERR_NET_RECV_FAILED:           text = "NET - recv failed"; break;
+        default:                                    text = nullptr; break;
+    }
+    if (text != nullptr) snprintf(buffer, buflen, "%s", text);
+    else snprintf(buffer, buflen, "UNKNOWN ERROR CODE (%04X)", errnum < 0 ? -errnum : errnum);
+}
+
+// ============================================================================
+// SHA-256
+// ============================================================================
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx) {
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx) {
+    if (ctx == nullptr) return;
+    EVP_MD_CTX_free(static_cast<EVP_MD_CTX*>(ctx->host));
+    ctx->host = nullptr;
+}
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context* ctx, int is224) {
+    if (ctx->host == nullptr) ctx->host = EVP_MD_CTX_new();
+    if (ctx->host == nullptr) return -1;
+    ctx->is224 = is224;
+    return EVP_DigestInit_ex(static_cast<EVP_MD_CTX*>(ctx->host), is224 ? EVP_sha224() : EVP_sha256(),
+                             nullptr) == 1 ? 0 : -1;
+}
+
+int mbedtls_sha256_update_ret(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen) {
+    if (ctx->host == nullptr) return -1;
+    return EVP_DigestUpdate(static_cast<EVP_MD_CTX*>(ctx->host), input, ilen) == 1 ? 0 : -1;
+}
+
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context* ctx, unsigned char output[32]) {
+    if (ctx->host == nullptr) return -1;
+    return EVP_DigestFinal_ex(static_cast<EVP_MD_CTX*>(ctx->host), output, nullptr) == 1 ? 0 : -1;
+}
+
+int mbedtls_sha256_ret(const unsigned char* input, size_t ilen, unsigned char output[32], int is224) {
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    int ret = mbedtls_sha256_starts_ret(&ctx, is224);
+    if (ret == 0) ret = mbedtls_sha256_update_ret(&ctx, input, ilen);
+    if (ret == 0) ret = mbedtls_sha256_finish_ret(&ctx, output);
+    mbedtls_sha256_free(&ctx);
+    return ret;
+}
+
+void mbedtls_sha256_starts(mbedtls_sha256_context* ctx, int is224) {
+    mbedtls_sha256_starts_ret(ctx, is224);
+}
+
+void mbedtls_sha256_update(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen) {
+    mbedtls_sha256_update_ret(ctx, input, ilen);
+}
+
+void mbedtls_sha256_finish(mbedtls_sha256_context* ctx, unsigned char output[32]) {
+    mbedtls_sha256_finish_ret(ctx, output);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file Print.cpp
+ * @brief Host Print / Stream implementation
+ */
+
+#include "Print.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++) == 0) break;
+        n++;
+    }
+    return n;
+}
+
+size_t Print::write(const char* str) {
+    if (str == nullptr) return 0;
+    return write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+}
+
+size_t Print::print(const char* str) { return write(str); }
+size_t Print::print(const String& str) { return write(str.c_str()); }
+size_t Print::print(char c) { return write(static_cast<uint8_t>(c)); }
+size_t Print::print(unsigned char value, int base) { return printUnsigned(value, base); }
+size_t Print::print(unsigned int value, int base) { return printUnsigned(value, base); }
+size_t Print::print(unsigned long value, int base) { return printUnsigned(value, base); }
+size_t Print::print(unsigned long long value, int base) { return printUnsigned(value, base); }
+size_t Print::print(int value, int base) { return print(static_cast<long long>(value), base); }
+size_t Print::print(long value, int base) { return print(static_cast<long long>(value), base); }
+
+size_t Print::print(long long value, int base) {
+    if (base == DEC && value < 0) {
+        size_t n = print('-');
+        return n + printUnsigned(static_cast<unsigned long long>(-(value + 1)) + 1, base);
+    }
+    return printUnsigned(static_cast<unsigned long long>(value), base);
+}
+
+size_t Print::print(double value, int digits) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", digits, value);
+    return write(buf);
+}
+
+size_t Print::print(const Printable& value) { return value.printTo(*this); }
+
+size_t Print::println() { return write("\r\n"); }
+
+size_t Print::printf(const char* format, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return write(buf);
+}
+
+size_t Print::printUnsigned(unsigned long long value, int base) {
+    if (base < 2) base = DEC;
+    char buf[8 * sizeof(value) + 1];
+    char* p = &buf[sizeof(buf) - 1];
+    *p = '\0';
+    do {
+        *--p = "0123456789ABCDEF"[value % base];
+        value /= base;
+    } while (value != 0);
+    return write(p);
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    unsigned long start = millis();
+    while (count < length && millis() - start < _timeout) {
+        int c = read();
+        if (c < 0) continue;
+        buffer[count++] = static_cast<char>(c);
+    }
+    return count;
+}
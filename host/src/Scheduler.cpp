@@ -0,0 +1,219 @@
+/**
+ * @file Scheduler.cpp
+ * @brief Virtual clock, discrete-event scheduler and Arduino time API
+ *
+ * Sanal saat sadece advanceTo() ile ilerler. Hedef zamana kadar bekleyen
+ * event'ler (zaman, kayıt sırası) düzeninde ve kendi zamanlarında çalıştırılır;
+ * böylece delay(10000) anında döner ama aradaki timer/ISR davranışı korunur.
+ * Aynı senaryo her çalıştırmada aynı sırayı üretir.
+ */
+
+#include <Arduino.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+
+namespace {
+
+struct Entry {
+    uint64_t timeUs;
+    uint64_t sequence;      // Aynı zamanlı event'ler için FIFO
+    hostsim::EventId id;
+    uint64_t periodUs;      // 0: tek seferlik
+    const char* name;
+    hostsim::EventCallback callback;
+};
+
+// std::*_heap max-heap kurar; en erken event tepede olsun
+struct Later {
+    bool operator()(const Entry& a, const Entry& b) const {
+        if (a.timeUs != b.timeUs) return a.timeUs > b.timeUs;
+        return a.sequence > b.sequence;
+    }
+};
+
+uint64_t g_nowUs = 0;
+uint32_t g_queryCostUs = 1;
+
+std::vector<Entry> g_queue;
+// İptal edilmiş ama kuyrukta duran id'ler (nadir). Canlılık için id başına
+// set tutulmaz: her event'te node allocation'ı heapAllocCount'u kirletirdi.
+std::unordered_set<hostsim::EventId> g_cancelled;
+hostsim::EventId g_runningId = 0;
+bool g_runningCancelled = false;
+hostsim::EventId g_nextId = 1;
+uint64_t g_sequence = 0;
+
+hostsim::TraceHook g_hook = nullptr;
+void* g_hookUser = nullptr;
+hostsim::SimStats g_stats = {};
+
+uint64_t hostNanos() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void push(Entry entry) {
+    entry.sequence = g_sequence++;
+    g_queue.push_back(std::move(entry));
+    std::push_heap(g_queue.begin(), g_queue.end(), Later());
+}
+
+void trace(hostsim::TraceKind kind, const char* name, hostsim::EventId id,
+           uint64_t timeUs, uint64_t virtualUs, uint64_t hostNs) {
+    if (g_hook == nullptr) return;
+    hostsim::Trace t = { kind, name, id, timeUs, virtualUs, hostNs };
+    g_hook(t, g_hookUser);
+}
+
+void advanceTo(uint64_t targetUs) {
+    while (!g_queue.empty() && g_queue.front().timeUs <= targetUs) {
+        std::pop_heap(g_queue.begin(), g_queue.end(), Later());
+        Entry entry = std::move(g_queue.back());
+        g_queue.pop_back();
+
+        if (g_cancelled.erase(entry.id) > 0) continue;
+        if (entry.timeUs > g_nowUs) g_nowUs = entry.timeUs;
+
+        uint64_t firedUs = g_nowUs;
+        uint64_t startNs = hostNanos();
+        hostsim::EventId outerId = g_runningId;
+        bool outerCancelled = g_runningCancelled;
+        g_runningId = entry.id;
+        g_runningCancelled = false;
+        entry.callback();
+        bool cancelled = g_runningCancelled;
+        g_runningId = outerId;
+        g_runningCancelled = outerCancelled;
+        uint64_t elapsedNs = hostNanos() - startNs;
+
+        g_stats.eventsFired++;
+        g_stats.callbackNs += elapsedNs;
+        trace(hostsim::TraceKind::Event, entry.name, entry.id, firedUs, 0, elapsedNs);
+
+        // Callback kendini iptal etmiş olabilir
+        if (cancelled || entry.periodUs == 0) continue;
+        entry.timeUs += entry.periodUs;
+        push(std::move(entry));
+    }
+    if (targetUs > g_nowUs) g_nowUs = targetUs;
+}
+
+void timedDelay(uint64_t us) {
+    uint64_t startUs = g_nowUs;
+    uint64_t startNs = hostNanos();
+    advanceTo(g_nowUs + us);
+
+    g_stats.delayCalls++;
+    g_stats.delayedUs += us;
+    trace(hostsim::TraceKind::Delay, "delay", 0, startUs, us, hostNanos() - startNs);
+}
+
+} // namespace
+
+namespace hostsim {
+
+uint64_t nowMicros() { return g_nowUs; }
+
+void advanceMicros(uint64_t us) { advanceTo(g_nowUs + us); }
+
+void setClockQueryCost(uint32_t us) { g_queryCostUs = us; }
+
+EventId scheduleAt(uint64_t timeUs, EventCallback callback, const char* name) {
+    if (!callback) return 0;
+    EventId id = g_nextId++;
+    push(Entry{ timeUs < g_nowUs ? g_nowUs : timeUs, 0, id, 0, name, std::move(callback) });
+    return id;
+}
+
+EventId scheduleAfter(uint64_t delayUs, EventCallback callback, const char* name) {
+    return scheduleAt(g_nowUs + delayUs, std::move(callback), name);
+}
+
+EventId scheduleEvery(uint64_t periodUs, EventCallback callback, const char* name) {
+    if (!callback || periodUs == 0) return 0;
+    EventId id = g_nextId++;
+    push(Entry{ g_nowUs + periodUs, 0, id, periodUs, name, std::move(callback) });
+    return id;
+}
+
+bool cancel(EventId id) {
+    if (id == 0) return false;
+    if (id == g_runningId) {
+        if (g_runningCancelled) return false;
+        g_runningCancelled = true;
+        return true;
+    }
+    if (g_cancelled.count(id) > 0) return false;
+    for (const Entry& entry : g_queue) {
+        if (entry.id == id) {
+            g_cancelled.insert(id);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t pendingEvents() {
+    return g_queue.size() - g_cancelled.size();
+}
+
+EventId driveSquareWave(uint8_t pin, float frequencyHz) {
+    if (frequencyHz <= 0.0f) return 0;
+    uint64_t halfPeriodUs = static_cast<uint64_t>(500000.0f / frequencyHz);
+    if (halfPeriodUs == 0) halfPeriodUs = 1;
+    return scheduleEvery(halfPeriodUs, [pin]() {
+        driveInput(pin, pinLevel(pin) ? LOW : HIGH);
+    }, "square_wave");
+}
+
+void setTraceHook(TraceHook hook, void* user) {
+    g_hook = hook;
+    g_hookUser = user;
+}
+
+const SimStats& simStats() { return g_stats; }
+
+namespace internal {
+
+void runInterrupt(void (*isr)(void)) {
+    uint64_t startNs = hostNanos();
+    isr();
+    uint64_t elapsedNs = hostNanos() - startNs;
+
+    g_stats.interruptsFired++;
+    g_stats.callbackNs += elapsedNs;
+    trace(TraceKind::Interrupt, "isr", 0, g_nowUs, 0, elapsedNs);
+}
+
+} // namespace internal
+
+} // namespace hostsim
+
+// ============================================================================
+// Time API
+// ============================================================================
+
+unsigned long millis() {
+    advanceTo(g_nowUs + g_queryCostUs);
+    return static_cast<unsigned long>(g_nowUs / 1000);
+}
+
+unsigned long micros() {
+    advanceTo(g_nowUs + g_queryCostUs);
+    return static_cast<unsigned long>(g_nowUs);
+}
+
+void delay(unsigned long ms) {
+    timedDelay(static_cast<uint64_t>(ms) * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+    timedDelay(us);
+}
+
+void yield() {
+}
@@ -0,0 +1,132 @@
+/**
+ * @file Sockets.cpp
+ * @brief Host lwIP socket API: POSIX sockets gated by the simulated WiFi link
+ */
+
+#include <lwip/sockets.h>
+#include <lwip/netdb.h>
+#include "HostInternal.h"
+#include "HostSim.h"
+
+#include <poll.h>
+#include <unistd.h>
+
+namespace {
+
+// Sanal saat gerçek zamandan yüzlerce kat hızlı akar, karşı taraf (broker,
+// sunucu) ise gerçek zamanda cevap verir. Bloklayacak okuma / select en fazla
+// kSocketWaitUs gerçek süre bekler: sanal timeout'lar cevap gelmeden dolmasın.
+// Sanal saat son beklemeden beri kSocketWaitAfterUs ilerlemediyse (delay()'siz
+// sıkı döngü, ör. aynı süreçte istemci + sunucu) beklenmez.
+constexpr long kSocketWaitUs = 100;
+constexpr uint64_t kSocketWaitAfterUs = 1000;
+
+uint64_t g_lastWaitUs = 0;
+
+bool shouldWait() {
+    uint64_t now = hostsim::nowMicros();
+    if (now - g_lastWaitUs < kSocketWaitAfterUs) return false;
+    g_lastWaitUs = now;
+    return true;
+}
+
+/**
+ * @brief Non-blocking çağrı EWOULDBLOCK verdiyse kısa süre okunabilir olmasını bekle
+ */
+bool waitReadable(int s) {
+    if ((errno != EAGAIN && errno != EWOULDBLOCK) || !shouldWait()) return false;
+    struct pollfd pfd = {s, POLLIN, 0};
+    struct timespec ts = {0, kSocketWaitUs * 1000};
+    if (::ppoll(&pfd, 1, &ts, nullptr) > 0) return true;
+    errno = EWOULDBLOCK;
+    return false;
+}
+
+bool linkDown(int err) {
+    if (hostsim::internal::wifiHasIp()) return false;
+    errno = err;
+    return true;
+}
+
+} // namespace
+
+extern "C" int lwip_socket(int domain, int type, int protocol) {
+    return ::socket(domain, type, protocol);
+}
+
+extern "C" int lwip_bind(int s, const struct sockaddr* name, socklen_t namelen) {
+    return ::bind(s, name, namelen);
+}
+
+extern "C" int lwip_listen(int s, int backlog) {
+    return ::listen(s, backlog);
+}
+
+extern "C" int lwip_accept(int s, struct sockaddr* addr, socklen_t* addrlen) {
+    if (linkDown(EWOULDBLOCK)) return -1;
+    int fd = ::accept(s, addr, addrlen);
+    if (fd < 0 && waitReadable(s)) fd = ::accept(s, addr, addrlen);
+    return fd;
+}
+
+extern "C" int lwip_connect(int s, const struct sockaddr* name, socklen_t namelen) {
+    if (linkDown(EHOSTUNREACH)) return -1;
+    return ::connect(s, name, namelen);
+}
+
+extern "C" int lwip_shutdown(int s, int how) {
+    return ::shutdown(s, how);
+}
+
+extern "C" int lwip_close(int s) {
+    return ::close(s);
+}
+
+extern "C" ssize_t lwip_send(int s, const void* dataptr, size_t size, int flags) {
+    if (linkDown(ECONNABORTED)) return -1;
+    // Kapanmış karşı taraf SIGPIPE yerine EPIPE versin (lwIP gibi)
+    return ::send(s, dataptr, size, flags | MSG_NOSIGNAL);
+}
+
+extern "C" ssize_t lwip_recv(int s, void* mem, size_t len, int flags) {
+    if (linkDown(ECONNABORTED)) return -1;
+    ssize_t n = ::recv(s, mem, len, flags);
+    if (n < 0 && waitReadable(s)) n = ::recv(s, mem, len, flags);
+    return n;
+}
+
+extern "C" int lwip_select(int maxfdp1, fd_set* readset, fd_set* writeset, fd_set* exceptset,
+                           struct timeval* timeout) {
+    bool poll = timeout != nullptr && timeout->tv_sec == 0 && timeout->tv_usec == 0;
+    fd_set r, w, e;
+    if (poll) {
+        if (readset) r = *readset;
+        if (writeset) w = *writeset;
+        if (exceptset) e = *exceptset;
+    }
+    int n = ::select(maxfdp1, readset, writeset, exceptset, timeout);
+    if (n == 0 && poll && shouldWait()) {
+        if (readset) *readset = r;
+        if (writeset) *writeset = w;
+        if (exceptset) *exceptset = e;
+        struct timeval wait = {0, kSocketWaitUs};
+        n = ::select(maxfdp1, readset, writeset, exceptset, &wait);
+    }
+    return n;
+}
+
+extern "C" int lwip_fcntl(int s, int cmd, int val) {
+    return ::fcntl(s, cmd, val);
+}
+
+extern "C" int lwip_setsockopt(int s, int level, int optname, const void* optval, socklen_t optlen) {
+    return ::setsockopt(s, level, optname, optval, optlen);
+}
+
+extern "C" int lwip_getsockopt(int s, int level, int optname, void* optval, socklen_t* optlen) {
+    return ::getsockopt(s, level, optname, optval, optlen);
+}
+
+extern "C" struct hostent* lwip_gethostbyname(const char* name) {
+    return ::gethostbyname(name);
+}
@@ -0,0 +1,65 @@
+/**
+ * @file WString.cpp
+ * @brief Host String implementation
+ */
+
+#include "WString.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 16) base = 10;
+    char buf[72];
+    size_t pos = sizeof(buf);
+    buf[--pos] = '\0';
+    do {
+        buf[--pos] = "0123456789abcdef"[value % base];
+        value /= base;
+    } while (value != 0);
+    if (negative) buf[--pos] = '-';
+    return std::string(&buf[pos]);
+}
+
+String::String(int value, unsigned char base)
+    : _str(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base)
+                      : formatInteger(static_cast<unsigned int>(value), false, base)) {}
+
+String::String(unsigned int value, unsigned char base) : _str(formatInteger(value, false, base)) {}
+
+String::String(long value, unsigned char base)
+    : _str(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base)
+                      : formatInteger(static_cast<unsigned long>(value), false, base)) {}
+
+String::String(unsigned long value, unsigned char base) : _str(formatInteger(value, false, base)) {}
+
+String::String(double value, unsigned char decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    _str = buf;
+}
+
+int String::indexOf(char c) const {
+    size_t pos = _str.find(c);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned int from) const {
+    return from < _str.size() ? String(_str.substr(from)) : String();
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= _str.size()) return String();
+    return String(_str.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t begin = _str.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) { _str.clear(); return; }
+    size_t end = _str.find_last_not_of(" \t\r\n");
+    _str = _str.substr(begin, end - begin + 1);
+}
+
+long String::toInt() const {
+    return strtol(_str.c_str(), nullptr, 10);
+}
@@ -0,0 +1,584 @@
+/**
+ * @file WiFi.cpp
+ * @brief Scripted WiFi stand-in for the host build
+ */
+
+#include <WiFi.h>
+#include <wifi_conf.h>
+#include "HostSim.h"
+#include "HostInternal.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+WiFiClass WiFi;
+
+namespace {
+
+struct NetworkEntry {
+    std::string ssid;
+    hostsim::ScriptedNetwork info;
+};
+
+struct ScriptEntry {
+    std::string ssid;
+    hostsim::ConnectScript script;
+};
+
+std::vector<NetworkEntry> g_networks;
+std::vector<NetworkEntry> g_scanResults;
+std::vector<ScriptEntry> g_scripts;
+uint32_t g_scanDurationMs = 2500;
+uint32_t g_fullScanMs = 1000;
+uint32_t g_beginCount = 0;
+uint8_t g_pscanChannel = 0;         // wifi_set_pscan_chan ile verilen kanal (0: yok)
+std::vector<uint8_t> g_pscanList;   // Bir sonraki wifi_scan_networks için kanal listesi
+bool g_pscanFast = false;           // PSCAN_FAST_SURVEY (kısa dwell)
+bool g_scanActive = false;
+uint64_t g_outageUntilUs = 0;       // wifiDropLink(outageMs) sonrası AP erişilemez
+bool g_powerSave = true;            // SDK default: LPS açık
+uint8_t g_lpsDtim = 1;
+
+// Tek kanal partial scan süresi
+constexpr uint32_t kSingleChannelScanMs = 60;
+
+// PSCAN_FAST_SURVEY kanal dwell süresi
+constexpr uint32_t kFastSurveyDwellMs = 25;
+
+// wifiTransmit airtime modeli
+constexpr uint32_t kTxRateMbps = 24;
+constexpr uint32_t kTxOverheadUs = 100;     // DIFS + backoff + preamble + ACK
+constexpr uint64_t kTxQueueUs = 2000;       // Sürücü TX kuyruğu (bekleyen airtime)
+constexpr uint64_t kTxHistoryUs = 50000;    // Geçmiş TX aralıkları (BLE scan tick'i geriye bakar)
+
+// Ortamı meşgul eden ardışık TX aralıkları
+struct TxBurst {
+    uint64_t startUs;
+    uint64_t endUs;
+};
+
+std::deque<TxBurst> g_txBursts;
+uint64_t g_txBytes = 0;
+uint64_t g_txAirtimeUs = 0;
+
+// Full scan sırası (2.4 GHz 1-13, 5 GHz UNII-1/2/2e/3)
+const uint8_t kAllChannels[] = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    36, 40, 44, 48, 52, 56, 60, 64,
+    100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 140,
+    149, 153, 157, 161, 165
+};
+constexpr size_t kAllChannelCount = sizeof(kAllChannels) / sizeof(kAllChannels[0]);
+
+struct LinkState {
+    bool active = false;            // begin() çağrıldı, disconnect/drop olmadı
+    bool dropped = false;
+    std::string ssid;
+    uint8_t bssid[6] = {0};         // Association'da seçilen AP
+    bool hasBssid = false;
+    uint64_t startUs = 0;
+    hostsim::ConnectScript script = {};
+    IPAddress staticIp;
+    IPAddress staticGateway;
+    IPAddress staticSubnet;
+    bool useStatic = false;
+} g_link;
+
+const hostsim::ConnectScript kDefaultScript = { 1200, 300, true, { 192, 168, 1, 100 } };
+
+// SSID ile bağlanırken sürücü en güçlü AP'yi seçer
+const NetworkEntry* findNetwork(const std::string& ssid) {
+    const NetworkEntry* best = nullptr;
+    for (const NetworkEntry& n : g_networks) {
+        if (n.ssid == ssid && (best == nullptr || n.info.rssi > best->info.rssi)) best = &n;
+    }
+    return best;
+}
+
+const NetworkEntry* findBssid(const uint8_t bssid[6]) {
+    for (const NetworkEntry& n : g_networks) {
+        if (memcmp(n.info.bssid, bssid, sizeof(n.info.bssid)) == 0) return &n;
+    }
+    return nullptr;
+}
+
+bool associated() {
+    if (!g_link.active || g_link.dropped || !g_link.script.succeed) return false;
+    return hostsim::nowMicros() >= g_link.startUs + g_link.script.associateMs * 1000ULL;
+}
+
+bool leased() {
+    if (!associated()) return false;
+    if (g_link.useStatic) return true;
+    uint64_t doneUs = g_link.startUs +
+        (static_cast<uint64_t>(g_link.script.associateMs) + g_link.script.dhcpMs) * 1000ULL;
+    return hostsim::nowMicros() >= doneUs;
+}
+
+void startLink(const char* ssid) {
+    g_beginCount++;
+
+    g_link.active = true;
+    g_link.dropped = false;
+    g_link.ssid = ssid ? ssid : "";
+    g_link.startUs = hostsim::nowMicros();
+    g_link.script = kDefaultScript;
+
+    bool scripted = false;
+    for (const ScriptEntry& e : g_scripts) {
+        if (e.ssid == g_link.ssid) { g_link.script = e.script; scripted = true; break; }
+    }
+    const NetworkEntry* n = findNetwork(g_link.ssid);
+    g_link.hasBssid = n != nullptr;
+    if (n != nullptr) memcpy(g_link.bssid, n->info.bssid, sizeof(g_link.bssid));
+
+    // Senaryo yoksa: sadece taramada görünen ağlara bağlanılabilir
+    if (!scripted && n == nullptr) {
+        g_link.script.succeed = false;
+    }
+    if (hostsim::nowMicros() < g_outageUntilUs) {
+        g_link.script.succeed = false;
+    }
+}
+
+rtw_security_t toRtwSecurity(uint8_t encryption) {
+    switch (encryption) {
+        case 0: return RTW_SECURITY_OPEN;
+        case 1: return RTW_SECURITY_WEP_PSK;
+        case 2: return RTW_SECURITY_WPA_TKIP_PSK;
+        case 3: return RTW_SECURITY_WPA2_AES_PSK;
+        case 4: return RTW_SECURITY_WPA_WPA2_MIXED_PSK;
+        case 5: return RTW_SECURITY_WPA2_ENTERPRISE;
+        case 6: return RTW_SECURITY_WPA3_AES_PSK;
+        default: return RTW_SECURITY_UNKNOWN;
+    }
+}
+
+void fillScanResult(const NetworkEntry& n, rtw_scan_result_t& r) {
+    memset(&r, 0, sizeof(r));
+    size_t len = n.ssid.size() < 32 ? n.ssid.size() : 32;
+    memcpy(r.SSID.val, n.ssid.data(), len);
+    r.SSID.len = static_cast<unsigned char>(len);
+    memcpy(r.BSSID.octet, n.info.bssid, sizeof(r.BSSID.octet));
+    r.signal_strength = static_cast<signed short>(n.info.rssi);
+    r.bss_type = RTW_BSS_TYPE_INFRASTRUCTURE;
+    r.security = toRtwSecurity(n.info.encryption);
+    r.channel = n.info.channel;
+    r.band = n.info.channel > 14 ? RTW_802_11_BAND_5GHZ : RTW_802_11_BAND_2_4GHZ;
+}
+
+// Bağlı AP (RSSI / kanal değişimleri canlı okunur)
+const NetworkEntry* linkNetwork() {
+    if (!associated() || !g_link.hasBssid) return nullptr;
+    return findBssid(g_link.bssid);
+}
+
+const NetworkEntry* scanEntry(uint8_t item) {
+    return item < g_scanResults.size() ? &g_scanResults[item] : nullptr;
+}
+
+} // namespace
+
+namespace hostsim {
+
+void wifiAddNetwork(const ScriptedNetwork& network) {
+    NetworkEntry entry;
+    entry.ssid = network.ssid ? network.ssid : "";
+    entry.info = network;
+    entry.info.ssid = nullptr;
+    g_networks.push_back(entry);
+}
+
+void wifiUpdateNetwork(const ScriptedNetwork& network) {
+    for (NetworkEntry& n : g_networks) {
+        if (memcmp(n.info.bssid, network.bssid, sizeof(network.bssid)) != 0) continue;
+        if (network.ssid != nullptr) n.ssid = network.ssid;
+        n.info = network;
+        n.info.ssid = nullptr;
+        return;
+    }
+    wifiAddNetwork(network);
+}
+
+bool wifiRemoveNetwork(const uint8_t bssid[6]) {
+    for (size_t i = 0; i < g_networks.size(); i++) {
+        if (memcmp(g_networks[i].info.bssid, bssid, sizeof(g_networks[i].info.bssid)) == 0) {
+            // Bağlı AP kapandı: link kopar
+            if (g_link.active && g_link.hasBssid && memcmp(g_link.bssid, bssid, sizeof(g_link.bssid)) == 0) {
+                g_link.dropped = true;
+            }
+            g_networks.erase(g_networks.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void wifiClearNetworks() {
+    g_networks.clear();
+    g_scanResults.clear();
+}
+
+void wifiSetScanDuration(uint32_t ms) {
+    g_scanDurationMs = ms;
+}
+
+void wifiSetFullScanMs(uint32_t ms) {
+    g_fullScanMs = ms;
+}
+
+void wifiSetConnectScript(const char* ssid, const ConnectScript& script) {
+    for (ScriptEntry& e : g_scripts) {
+        if (e.ssid == ssid) { e.script = script; return; }
+    }
+    g_scripts.push_back({ ssid, script });
+}
+
+void wifiDropLink(uint32_t outageMs) {
+    if (g_link.active) g_link.dropped = true;
+    g_outageUntilUs = hostsim::nowMicros() + static_cast<uint64_t>(outageMs) * 1000;
+}
+
+uint32_t wifiBeginCount() {
+    return g_beginCount;
+}
+
+bool wifiPowerSaveEnabled() {
+    return g_powerSave;
+}
+
+uint8_t wifiLpsDtim() {
+    return g_lpsDtim;
+}
+
+bool wifiTransmit(uint32_t bytes) {
+    if (!leased()) return false;
+
+    uint64_t now = nowMicros();
+    while (!g_txBursts.empty() && g_txBursts.front().endUs + kTxHistoryUs < now) {
+        g_txBursts.pop_front();
+    }
+
+    uint64_t busyUntil = g_txBursts.empty() ? 0 : g_txBursts.back().endUs;
+    if (busyUntil > now + kTxQueueUs) return false;
+
+    uint64_t airtime = static_cast<uint64_t>(bytes) * 8 / kTxRateMbps + kTxOverheadUs;
+    if (busyUntil >= now) {
+        g_txBursts.back().endUs += airtime;
+    } else {
+        g_txBursts.push_back({now, now + airtime});
+    }
+    g_txBytes += bytes;
+    g_txAirtimeUs += airtime;
+    return true;
+}
+
+uint64_t wifiTxBytes() {
+    return g_txBytes;
+}
+
+uint64_t wifiTxAirtimeUs() {
+    return g_txAirtimeUs;
+}
+
+namespace internal {
+
+bool wifiHasIp() {
+    return leased();
+}
+
+bool wifiMediumBusy(uint64_t timeUs) {
+    const NetworkEntry* n = linkNetwork();
+    if (n == nullptr || n->info.channel > 14) return false;
+    for (const TxBurst& burst : g_txBursts) {
+        if (timeUs >= burst.startUs && timeUs < burst.endUs) return true;
+    }
+    return false;
+}
+
+} // namespace internal
+
+} // namespace hostsim
+
+WiFiClass::WiFiClass() {
+    _ssidBuf[0] = '\0';
+}
+
+// ============================================================================
+// Connection
+// ============================================================================
+
+int WiFiClass::begin(char* ssid) {
+    return begin(ssid, nullptr);
+}
+
+int WiFiClass::begin(char* ssid, const char* passphrase) {
+    (void)passphrase;
+    g_pscanChannel = 0;
+    startLink(ssid);
+
+    // Host'ta begin() bloklamaz; status() sanal saate göre ilerler
+    return WL_IDLE_STATUS;
+}
+
+int WiFiClass::disconnect() {
+    g_link.active = false;
+    g_link.dropped = false;
+    return WL_DISCONNECTED;
+}
+
+uint8_t WiFiClass::status() {
+    if (!g_link.active) return WL_IDLE_STATUS;
+    if (g_link.dropped) return WL_CONNECTION_LOST;
+    if (associated()) return WL_CONNECTED;
+
+    uint64_t elapsedUs = hostsim::nowMicros() - g_link.startUs;
+    if (!g_link.script.succeed && elapsedUs >= g_link.script.associateMs * 1000ULL) {
+        return WL_CONNECT_FAILED;
+    }
+    return WL_IDLE_STATUS;
+}
+
+int WiFiClass::apbegin(char* ssid, char* channel) {
+    (void)ssid;
+    (void)channel;
+    return WL_CONNECTED;
+}
+
+int WiFiClass::apbegin(char* ssid, char* password, char* channel) {
+    (void)password;
+    return apbegin(ssid, channel);
+}
+
+int WiFiClass::enableConcurrent() {
+    return 0;
+}
+
+int WiFiClass::disablePowerSave() {
+    return wifi_disable_powersave();
+}
+
+void WiFiClass::config(IPAddress localIp) {
+    g_link.useStatic = true;
+    g_link.staticIp = localIp;
+}
+
+void WiFiClass::config(IPAddress localIp, IPAddress dnsServer, IPAddress gateway, IPAddress subnet) {
+    (void)dnsServer;
+    g_link.useStatic = true;
+    g_link.staticIp = localIp;
+    g_link.staticGateway = gateway;
+    g_link.staticSubnet = subnet;
+}
+
+// ============================================================================
+// Connected network info
+// ============================================================================
+
+char* WiFiClass::SSID() {
+    snprintf(_ssidBuf, sizeof(_ssidBuf), "%s", associated() ? g_link.ssid.c_str() : "");
+    return _ssidBuf;
+}
+
+uint8_t* WiFiClass::BSSID(uint8_t* bssid) {
+    const NetworkEntry* n = linkNetwork();
+    if (n != nullptr) {
+        memcpy(bssid, n->info.bssid, WL_MAC_ADDR_LENGTH);
+    } else {
+        memset(bssid, 0, WL_MAC_ADDR_LENGTH);
+    }
+    return bssid;
+}
+
+int32_t WiFiClass::RSSI() {
+    const NetworkEntry* n = linkNetwork();
+    return n != nullptr ? n->info.rssi : 0;
+}
+
+uint8_t WiFiClass::encryptionType() {
+    const NetworkEntry* n = linkNetwork();
+    return n != nullptr ? n->info.encryption : 0;
+}
+
+IPAddress WiFiClass::localIP() {
+    if (!leased()) return IPAddress();
+    if (g_link.useStatic) return g_link.staticIp;
+    const uint8_t* ip = g_link.script.ip;
+    return IPAddress(ip[0], ip[1], ip[2], ip[3]);
+}
+
+IPAddress WiFiClass::subnetMask() {
+    if (!leased()) return IPAddress();
+    if (g_link.useStatic) return g_link.staticSubnet;
+    return IPAddress(255, 255, 255, 0);
+}
+
+IPAddress WiFiClass::gatewayIP() {
+    if (!leased()) return IPAddress();
+    if (g_link.useStatic) return g_link.staticGateway;
+    const uint8_t* ip = g_link.script.ip;
+    return IPAddress(ip[0], ip[1], ip[2], 1);
+}
+
+uint8_t* WiFiClass::macAddress(uint8_t* mac) {
+    static const uint8_t kHostMac[WL_MAC_ADDR_LENGTH] = { 0x00, 0xE0, 0x4C, 0x87, 0x20, 0xD0 };
+    memcpy(mac, kHostMac, WL_MAC_ADDR_LENGTH);
+    return mac;
+}
+
+// ============================================================================
+// Scan
+// ============================================================================
+
+int8_t WiFiClass::scanNetworks() {
+    hostsim::advanceMicros(static_cast<uint64_t>(g_scanDurationMs) * 1000);
+    g_scanResults = g_networks;
+    if (g_scanResults.size() > WL_NETWORKS_LIST_MAXNUM) {
+        g_scanResults.resize(WL_NETWORKS_LIST_MAXNUM);
+    }
+    return static_cast<int8_t>(g_scanResults.size());
+}
+
+char* WiFiClass::SSID(uint8_t networkItem) {
+    const NetworkEntry* n = scanEntry(networkItem);
+    snprintf(_ssidBuf, sizeof(_ssidBuf), "%s", n ? n->ssid.c_str() : "");
+    return _ssidBuf;
+}
+
+int32_t WiFiClass::RSSI(uint8_t networkItem) {
+    const NetworkEntry* n = scanEntry(networkItem);
+    return n ? n->info.rssi : 0;
+}
+
+uint8_t WiFiClass::encryptionType(uint8_t networkItem) {
+    const NetworkEntry* n = scanEntry(networkItem);
+    return n ? n->info.encryption : 0;
+}
+
+uint32_t WiFiClass::encryptionTypeEx(uint8_t networkItem) {
+    return encryptionType(networkItem);
+}
+
+// ============================================================================
+// wifi_conf.h
+// ============================================================================
+
+int wifi_set_pscan_chan(uint8_t* channel_list, uint8_t* pscan_config, uint8_t length) {
+    g_pscanChannel = (channel_list != nullptr && length == 1) ? channel_list[0] : 0;
+    g_pscanList.clear();
+    g_pscanFast = false;
+    if (channel_list != nullptr) g_pscanList.assign(channel_list, channel_list + length);
+    if (pscan_config != nullptr && length > 0) g_pscanFast = (pscan_config[0] & PSCAN_FAST_SURVEY) != 0;
+    return RTW_SUCCESS;
+}
+
+int wifi_scan_networks(rtw_scan_result_handler_t results_handler, void* user_data) {
+    if (results_handler == nullptr || g_scanActive) return RTW_ERROR;
+
+    std::vector<uint8_t> channels = g_pscanList;
+    bool fast = g_pscanFast;
+    g_pscanList.clear();
+    g_pscanFast = false;
+    g_pscanChannel = 0;
+    if (channels.empty()) channels.assign(kAllChannels, kAllChannels + kAllChannelCount);
+
+    // wifiSetScanDuration() full scan süresidir; kanal başına eşit dwell
+    uint64_t dwellUs = static_cast<uint64_t>(g_scanDurationMs) * 1000 / kAllChannelCount;
+    if (fast) dwellUs = static_cast<uint64_t>(kFastSurveyDwellMs) * 1000;
+    uint64_t atUs = 0;
+    g_scanActive = true;
+
+    for (uint8_t channel : channels) {
+        atUs += dwellUs;
+        hostsim::scheduleAfter(atUs, [channel, results_handler, user_data] {
+            for (const NetworkEntry& n : g_networks) {
+                if (n.info.channel != channel) continue;
+                rtw_scan_handler_result_t result;
+                fillScanResult(n, result.ap_details);
+                result.scan_complete = RTW_FALSE;
+                result.user_data = user_data;
+                results_handler(&result);
+            }
+        }, "wifi_scan_channel");
+    }
+
+    hostsim::scheduleAfter(atUs, [results_handler, user_data] {
+        g_scanActive = false;
+        rtw_scan_handler_result_t result;
+        memset(&result, 0, sizeof(result));
+        result.scan_complete = RTW_TRUE;
+        result.user_data = user_data;
+        results_handler(&result);
+    }, "wifi_scan_done");
+    return RTW_SUCCESS;
+}
+
+int wifi_connect_bssid(unsigned char bssid[6], char* ssid, rtw_security_t security_type,
+                       char* password, int bssid_len, int ssid_len, int password_len,
+                       int key_id, void* semaphore) {
+    (void)security_type;
+    (void)password;
+    (void)bssid_len;
+    (void)ssid_len;
+    (void)password_len;
+    (void)key_id;
+    (void)semaphore;
+
+    uint8_t hintChannel = g_pscanChannel;
+    g_pscanChannel = 0;
+    startLink(ssid);
+
+    const NetworkEntry* n = findBssid(bssid);
+    g_link.hasBssid = true;
+    memcpy(g_link.bssid, bssid, sizeof(g_link.bssid));
+    if (n == nullptr || n->ssid != g_link.ssid) {
+        // AP değişmiş / kapanmış: full connect süresi kadar sonra başarısız
+        g_link.script.succeed = false;
+        return RTW_SUCCESS;
+    }
+
+    // Doğru kanal ipucu ile SSID araması tek kanala iner
+    if (hintChannel == n->info.channel) {
+        uint32_t assocMs = g_link.script.associateMs;
+        uint32_t searchMs = g_fullScanMs < assocMs ? g_fullScanMs : assocMs;
+        g_link.script.associateMs = assocMs - searchMs + kSingleChannelScanMs;
+    }
+    return RTW_SUCCESS;
+}
+
+int wifi_get_setting(const char* ifname, rtw_wifi_setting_t* setting) {
+    (void)ifname;
+    memset(setting, 0, sizeof(*setting));
+    setting->mode = RTW_MODE_STA;
+
+    const NetworkEntry* n = linkNetwork();
+    if (n == nullptr) return RTW_SUCCESS;
+
+    snprintf(reinterpret_cast<char*>(setting->ssid), sizeof(setting->ssid), "%s", g_link.ssid.c_str());
+    setting->channel = n->info.channel;
+    setting->security_type = toRtwSecurity(n->info.encryption);
+    return RTW_SUCCESS;
+}
+
+int wifi_enable_powersave(void) {
+    g_powerSave = true;
+    return RTW_SUCCESS;
+}
+
+int wifi_disable_powersave(void) {
+    g_powerSave = false;
+    return RTW_SUCCESS;
+}
+
+int wifi_set_lps_dtim(unsigned char dtim) {
+    if (dtim == 0) return RTW_ERROR;
+    g_lpsDtim = dtim;
+    return RTW_SUCCESS;
+}
+
+int wifi_get_lps_dtim(unsigned char* dtim) {
+    if (dtim == nullptr) return RTW_ERROR;
+    *dtim = g_lpsDtim;
+    return RTW_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file flash_api.cpp
+ * @brief NOR flash emulation for the host build
+ */
+
+#include "flash_api.h"
+#include "HostSim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+// Tipik SPI NOR süreleri (sanal saat)
+constexpr uint32_t kSectorEraseUs = 45000;
+constexpr uint32_t kPageProgramUs = 700;
+constexpr uint32_t kPageSize = 256;
+
+std::vector<uint8_t> g_flash;
+const char* g_path = nullptr;
+uint32_t g_eraseCount = 0;
+uint32_t g_writeCount = 0;
+bool g_fileComplete = false;     // Dosyada tam 2 MB imaj var
+
+std::vector<uint8_t>& storage() {
+    if (!g_flash.empty()) return g_flash;
+
+    g_flash.assign(HOST_FLASH_SIZE, 0xFF);
+    g_path = getenv("HOST_FLASH");
+    if (g_path != nullptr) {
+        FILE* f = fopen(g_path, "rb");
+        if (f != nullptr) {
+            g_fileComplete = fread(g_flash.data(), 1, g_flash.size(), f) == g_flash.size();
+            fclose(f);
+        }
+    }
+    return g_flash;
+}
+
+// Değişen aralığı dosyaya yaz (ilk yazımda / reset'te tüm içerik)
+void persist(uint32_t address, uint32_t len) {
+    if (g_path == nullptr) return;
+    if (!g_fileComplete) {
+        address = 0;
+        len = HOST_FLASH_SIZE;
+    }
+    FILE* f = fopen(g_path, g_fileComplete ? "r+b" : "wb");
+    if (f == nullptr) return;
+    if (fseek(f, address, SEEK_SET) == 0 && fwrite(g_flash.data() + address, 1, len, f) == len) {
+        g_fileComplete = true;
+    }
+    fclose(f);
+}
+
+bool inRange(uint32_t address, uint32_t len) {
+    return address < HOST_FLASH_SIZE && len <= HOST_FLASH_SIZE - address;
+}
+
+} // namespace
+
+namespace hostsim {
+
+void flashReset() {
+    storage().assign(HOST_FLASH_SIZE, 0xFF);
+    g_eraseCount = 0;
+    g_writeCount = 0;
+    g_fileComplete = false;
+    persist(0, HOST_FLASH_SIZE);
+}
+
+uint32_t flashEraseCount() { return g_eraseCount; }
+
+uint32_t flashWriteCount() { return g_writeCount; }
+
+} // namespace hostsim
+
+void flash_erase_sector(flash_t* obj, uint32_t address) {
+    (void)obj;
+    address &= ~(FLASH_SECTOR_SIZE - 1);
+    if (!inRange(address, FLASH_SECTOR_SIZE)) return;
+
+    memset(storage().data() + address, 0xFF, FLASH_SECTOR_SIZE);
+    g_eraseCount++;
+    hostsim::advanceMicros(kSectorEraseUs);
+    persist(address, FLASH_SECTOR_SIZE);
+}
+
+int flash_stream_read(flash_t* obj, uint32_t address, uint32_t len, uint8_t* data) {
+    (void)obj;
+    if (!inRange(address, len)) return 0;
+    memcpy(data, storage().data() + address, len);
+    return 1;
+}
+
+int flash_stream_write(flash_t* obj, uint32_t address, uint32_t len, uint8_t* data) {
+    (void)obj;
+    if (!inRange(address, len)) return 0;
+
+    // NOR: program sadece 1 -> 0 yapabilir
+    uint8_t* dst = storage().data() + address;
+    for (uint32_t i = 0; i < len; i++) {
+        dst[i] &= data[i];
+    }
+    g_writeCount++;
+    hostsim::advanceMicros(((len + kPageSize - 1) / kPageSize) * kPageProgramUs);
+    persist(address, len);
+    return 1;
+}
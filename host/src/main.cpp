@@ -0,0 +1,127 @@
+/**
+ * @file main.cpp
+ * @brief Host entry point: runs setup() once, then loop() on the virtual clock
+ *
+ * Kullanım:
+ *   ./sketch [--run-ms N] [--loops N] [--pin-log dosya.csv] [--trace dosya.csv] [--stats]
+ *
+ * --run-ms  : sanal süre limiti (default: sınırsız)
+ * --loops   : loop() çağrı limiti (default: sınırsız)
+ * --pin-log : digitalWrite geçmişi (CSV)
+ * --trace   : event/ISR/delay kaydı (CSV: kind,name,id,time_us,virtual_us,host_ns)
+ * --stats   : çıkışta sanal/gerçek süre ve event sayaçlarını stderr'e yaz
+ */
+
+#include <Arduino.h>
+#include "HostSim.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+bool g_stopRequested = false;
+int g_exitCode = 0;
+
+const char* traceKindName(hostsim::TraceKind kind) {
+    switch (kind) {
+        case hostsim::TraceKind::Event:     return "event";
+        case hostsim::TraceKind::Interrupt: return "isr";
+        case hostsim::TraceKind::Delay:     return "delay";
+    }
+    return "?";
+}
+
+void writeTrace(const hostsim::Trace& trace, void* user) {
+    fprintf(static_cast<FILE*>(user), "%s,%s,%u,%llu,%llu,%llu\n",
+            traceKindName(trace.kind), trace.name, trace.id,
+            static_cast<unsigned long long>(trace.timeUs),
+            static_cast<unsigned long long>(trace.virtualUs),
+            static_cast<unsigned long long>(trace.hostNs));
+}
+
+void printStats(double wallSeconds, unsigned long long loops) {
+    const hostsim::SimStats& stats = hostsim::simStats();
+    double virtualSeconds = hostsim::nowMicros() / 1e6;
+
+    fprintf(stderr, "[host] virtual %.3f s, wall %.3f s, speedup x%.0f\n",
+            virtualSeconds, wallSeconds, wallSeconds > 0 ? virtualSeconds / wallSeconds : 0.0);
+    fprintf(stderr, "[host] loops %llu, events %llu, isr %llu, delay %llu (%.3f s), callbacks %.3f ms\n",
+            loops,
+            static_cast<unsigned long long>(stats.eventsFired),
+            static_cast<unsigned long long>(stats.interruptsFired),
+            static_cast<unsigned long long>(stats.delayCalls),
+            stats.delayedUs / 1e6,
+            stats.callbackNs / 1e6);
+}
+
+} // namespace
+
+namespace hostsim {
+
+void requestStop(int exitCode) {
+    g_stopRequested = true;
+    g_exitCode = exitCode;
+}
+
+} // namespace hostsim
+
+int main(int argc, char** argv) {
+    uint64_t runLimitUs = 0;
+    unsigned long long loopLimit = 0;
+    bool stats = false;
+    FILE* traceFile = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--run-ms") == 0 && i + 1 < argc) {
+            runLimitUs = strtoull(argv[++i], nullptr, 10) * 1000ULL;
+        } else if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+            loopLimit = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--pin-log") == 0 && i + 1 < argc) {
+            if (!hostsim::setPinLogFile(argv[++i])) {
+                fprintf(stderr, "[host] pin log açılamadı: %s\n", argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceFile = fopen(argv[++i], "w");
+            if (traceFile == nullptr) {
+                fprintf(stderr, "[host] trace açılamadı: %s\n", argv[i]);
+                return 2;
+            }
+            fprintf(traceFile, "kind,name,id,time_us,virtual_us,host_ns\n");
+            hostsim::setTraceHook(writeTrace, traceFile);
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            stats = true;
+        } else {
+            fprintf(stderr, "usage: %s [--run-ms N] [--loops N] [--pin-log file.csv] "
+                            "[--trace file.csv] [--stats]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+
+    setup();
+
+    unsigned long long loops = 0;
+    while (!g_stopRequested) {
+        if (loopLimit != 0 && loops >= loopLimit) break;
+        if (runLimitUs != 0 && hostsim::nowMicros() >= runLimitUs) break;
+        loop();
+        loops++;
+    }
+
+    Serial.flush();
+    hostsim::setPinLogFile(nullptr);
+    if (traceFile != nullptr) {
+        hostsim::setTraceHook(nullptr);
+        fclose(traceFile);
+    }
+    if (stats) {
+        std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wallStart;
+        printStats(wall.count(), loops);
+    }
+    return g_exitCode;
+}
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""
+Host TLS test server
+
+TlsClient / tls_upload için localhost'ta TLS 1.2 sunucusu. Her bağlantıda bir
+HTTP isteği okur (body Content-Length kadar), "200 stored" ile cevap verip
+kapatır. Sunucu oturumları (session ID cache ve ticket) süreç boyunca geçerli:
+sketch'i aynı HOST_FLASH dosyasıyla tekrar çalıştırmak deep sleep sonrası
+resume'u test eder.
+
+Sertifika ilk çalıştırmada openssl CLI ile üretilir (self-signed, CN=localhost).
+
+Kullanım:
+    host/tls_server.py                      # 127.0.0.1:8443, ticket açık
+    host/tls_server.py --no-tickets         # sadece session ID ile resume
+    host/tls_server.py --no-resume          # her bağlantı tam handshake
+"""
+
+import argparse
+import os
+import signal
+import socket
+import ssl
+import subprocess
+import sys
+import threading
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_CERT_DIR = os.path.join(SCRIPT_DIR, "..", "_host_build", "tls")
+
+
+def ensure_certificate(cert_dir, key_type):
+    """Self-signed sertifika yoksa üret; (cert, key) yollarını döndür."""
+    os.makedirs(cert_dir, exist_ok=True)
+    cert = os.path.join(cert_dir, "server-%s.pem" % key_type)
+    key = os.path.join(cert_dir, "server-%s.key" % key_type)
+    if os.path.exists(cert) and os.path.exists(key):
+        return cert, key
+
+    if key_type == "ec":
+        newkey = ["-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1"]
+    else:
+        newkey = ["-newkey", "rsa:2048"]
+    subprocess.run(["openssl", "req", "-x509", "-nodes", "-days", "365", "-subj", "/CN=localhost",
+                    "-addext", "subjectAltName=DNS:localhost,IP:127.0.0.1",
+                    "-keyout", key, "-out", cert] + newkey,
+                   check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return cert, key
+
+
+def make_context(cert, key, tickets):
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    ctx.load_cert_chain(cert, key)
+    if not tickets:
+        ctx.options |= ssl.OP_NO_TICKET
+    return ctx
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.connections = 0
+        self.resumed = 0
+        self.failed = 0
+        self.bytes = 0
+
+    def add(self, resumed, failed, nbytes):
+        with self.lock:
+            self.connections += 1
+            self.resumed += 1 if resumed else 0
+            self.failed += 1 if failed else 0
+            self.bytes += nbytes
+
+    def summary(self):
+        with self.lock:
+            return "%d connections, %d resumed, %d failed, %d body bytes" % (
+                self.connections, self.resumed, self.failed, self.bytes)
+
+
+def read_request(conn):
+    """Header'ları ve Content-Length kadar body'yi oku; body uzunluğunu döndür."""
+    data = b""
+    while b"\r\n\r\n" not in data:
+        chunk = conn.recv(4096)
+        if not chunk:
+            return None
+        data += chunk
+    head, body = data.split(b"\r\n\r\n", 1)
+    length = 0
+    for line in head.split(b"\r\n")[1:]:
+        name, _, value = line.partition(b":")
+        if name.strip().lower() == b"content-length":
+            length = int(value.strip())
+    while len(body) < length:
+        chunk = conn.recv(4096)
+        if not chunk:
+            return None
+        body += chunk
+    return length
+
+
+def handle(ctx, sock, addr, stats, verbose):
+    resumed = False
+    failed = True
+    nbytes = 0
+    try:
+        sock.settimeout(10)
+        # Cevap ve close_notify Nagle ile bekletilmesin
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        with ctx.wrap_socket(sock, server_side=True) as conn:
+            resumed = conn.session_reused
+            version, cipher = conn.version(), conn.cipher()[0]
+            length = read_request(conn)
+            if length is not None:
+                nbytes = length
+                conn.sendall(b"HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n"
+                             b"Content-Length: 7\r\nConnection: close\r\n\r\nstored\n")
+                failed = False
+            # close_notify: temiz kapanmayan oturum OpenSSL session ID cache'inden silinir
+            try:
+                conn.unwrap()
+            except (OSError, ssl.SSLError):
+                pass
+            if verbose:
+                print("[tls] %s:%d %s %s %s, %d bytes" % (addr[0], addr[1], version, cipher,
+                                                          "resumed" if resumed else "full", nbytes), flush=True)
+    except (OSError, ssl.SSLError) as e:
+        if verbose:
+            print("[tls] %s:%d error: %s" % (addr[0], addr[1], e), flush=True)
+    finally:
+        sock.close()
+    stats.add(resumed, failed, nbytes)
+
+
+def stop(signum, frame):
+    raise KeyboardInterrupt
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Host TLS test server")
+    parser.add_argument("--bind", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8443)
+    parser.add_argument("--key", choices=["ec", "rsa"], default="ec", help="server key type")
+    parser.add_argument("--cert-dir", default=DEFAULT_CERT_DIR)
+    parser.add_argument("--no-tickets", action="store_true", help="disable session tickets (session ID only)")
+    parser.add_argument("--no-resume", action="store_true", help="refuse every resumption")
+    parser.add_argument("--quiet", action="store_true", help="no per-connection log")
+    args = parser.parse_args()
+
+    cert, key = ensure_certificate(os.path.abspath(args.cert_dir), args.key)
+    tickets = not (args.no_tickets or args.no_resume)
+    shared = make_context(cert, key, tickets)
+
+    def context():
+        # Her bağlantıda yeni context: session ID cache paylaşılmaz
+        return make_context(cert, key, False) if args.no_resume else shared
+
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind((args.bind, args.port))
+    server.listen(16)
+    print("[tls] listening on %s:%d (%s key, certificate %s, tickets %s, resume %s)" % (
+        args.bind, args.port, args.key, cert, "on" if tickets else "off",
+        "off" if args.no_resume else "on"), flush=True)
+
+    # timeout / kill ile durdurulunca da özet yazılsın
+    signal.signal(signal.SIGTERM, stop)
+
+    stats = Stats()
+    try:
+        while True:
+            sock, addr = server.accept()
+            threading.Thread(target=handle, args=(context(), sock, addr, stats, not args.quiet),
+                             daemon=True).start()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.close()
+        print("[tls] %s" % stats.summary(), flush=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,223 @@
+/**
+ * @file EventBus.cpp
+ * @brief Publish/subscribe event bus implementation
+ */
+
+#include "EventBus.h"
+
+#define EVENT_BUS_QUEUE_MASK    (EVENT_BUS_QUEUE_SIZE - 1)
+
+static_assert((EVENT_BUS_QUEUE_SIZE & EVENT_BUS_QUEUE_MASK) == 0,
+              "EVENT_BUS_QUEUE_SIZE must be a power of two");
+
+int16_t EventBus::_gpioPins[EVENT_BUS_MAX_GPIO] = { -1, -1, -1, -1 };
+
+EventBus::EventBus()
+    : _head(0)
+    , _tail(0)
+    , _pollerCount(0)
+    , _dispatching(false)
+    , _posted(0)
+    , _dropped(0)
+    , _delivered(0)
+    , _dispatched(0)
+    , _highWater(0)
+{
+    for (uint32_t i = 0; i < EVENT_BUS_QUEUE_SIZE; i++) {
+        _cells[i].seq = i;
+    }
+    memset(_subscribers, 0, sizeof(_subscribers));
+    memset(_pollers, 0, sizeof(_pollers));
+}
+
+// ============================================================================
+// Subscribe
+// ============================================================================
+
+int EventBus::subscribe(uint16_t sourceMask, EventHandler handler, void* user) {
+    if (handler == nullptr || sourceMask == 0) return -1;
+    for (uint8_t i = 0; i < EVENT_BUS_MAX_SUBSCRIBERS; i++) {
+        if (_subscribers[i].handler != nullptr) continue;
+        _subscribers[i].user = user;
+        _subscribers[i].mask = sourceMask;
+        _subscribers[i].handler = handler;
+        return i;
+    }
+    return -1;
+}
+
+bool EventBus::unsubscribe(int id) {
+    if (id < 0 || id >= EVENT_BUS_MAX_SUBSCRIBERS || _subscribers[id].handler == nullptr) {
+        return false;
+    }
+    _subscribers[id].handler = nullptr;
+    return true;
+}
+
+bool EventBus::addPoller(EventPoller poller) {
+    if (poller == nullptr) return false;
+    for (uint8_t i = 0; i < _pollerCount; i++) {
+        if (_pollers[i] == poller) return true;
+    }
+    if (_pollerCount >= EVENT_BUS_MAX_POLLERS) return false;
+    _pollers[_pollerCount++] = poller;
+    return true;
+}
+
+// ============================================================================
+// Post
+// ============================================================================
+
+bool EventBus::post(EventSource source, uint8_t code, uint16_t arg, uint32_t value) {
+    uint32_t pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    Cell* cell;
+
+    for (;;) {
+        cell = &_cells[pos & EVENT_BUS_QUEUE_MASK];
+        uint32_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        int32_t diff = static_cast<int32_t>(seq - pos);
+
+        if (diff == 0) {
+            // Slot boş: sahiplen (başka üretici / ISR araya girdiyse pos güncellenir)
+            if (__atomic_compare_exchange_n(&_head, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Tüketici bu slotu henüz boşaltmadı: kuyruk dolu
+            __atomic_fetch_add(&_dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            pos = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->event.source = source;
+    cell->event.code = code;
+    cell->event.arg = arg;
+    cell->event.value = value;
+    cell->event.timeMs = millis();
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&_posted, 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+uint16_t EventBus::dispatch(uint16_t maxEvents) {
+    // Handler içinden çağrılırsa iç içe dağıtım yapılmaz
+    if (_dispatching) return 0;
+    _dispatching = true;
+
+    for (uint8_t i = 0; i < _pollerCount; i++) {
+        _pollers[i]();
+    }
+
+    uint16_t depth = pending();
+    if (depth > _highWater) _highWater = depth;
+
+    uint16_t count = 0;
+    while (maxEvents == 0 || count < maxEvents) {
+        Cell& cell = _cells[_tail & EVENT_BUS_QUEUE_MASK];
+        uint32_t seq = __atomic_load_n(&cell.seq, __ATOMIC_ACQUIRE);
+        if (seq != _tail + 1) break;    // Boş veya üretici henüz yazıyor
+
+        Event event = cell.event;
+        __atomic_store_n(&cell.seq, _tail + EVENT_BUS_QUEUE_SIZE, __ATOMIC_RELEASE);
+        _tail++;
+        count++;
+
+        uint16_t bit = static_cast<uint16_t>(EVENT_SOURCE_MASK(event.source));
+        for (uint8_t i = 0; i < EVENT_BUS_MAX_SUBSCRIBERS; i++) {
+            const Subscriber& s = _subscribers[i];
+            if (s.handler == nullptr || (s.mask & bit) == 0) continue;
+            s.handler(event, s.user);
+            _delivered++;
+        }
+    }
+
+    _dispatched += count;
+    _dispatching = false;
+    return count;
+}
+
+uint16_t EventBus::pending() const {
+    uint32_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    return static_cast<uint16_t>(head - _tail);
+}
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+template <int Slot>
+void EventBus::gpioTrampoline() {
+    int16_t pin = _gpioPins[Slot];
+    if (pin < 0) return;
+    uint8_t level = digitalRead(pin) ? 1 : 0;
+    getInstance().post(EventSource::Gpio, level, static_cast<uint16_t>(pin));
+}
+
+bool EventBus::watchPin(uint8_t pin, uint32_t mode) {
+    static void (*const trampolines[EVENT_BUS_MAX_GPIO])(void) = {
+        &gpioTrampoline<0>, &gpioTrampoline<1>, &gpioTrampoline<2>, &gpioTrampoline<3>
+    };
+
+    int free = -1;
+    for (uint8_t i = 0; i < EVENT_BUS_MAX_GPIO; i++) {
+        if (_gpioPins[i] == pin) return false;
+        if (_gpioPins[i] < 0 && free < 0) free = i;
+    }
+    if (free < 0) return false;
+
+    _gpioPins[free] = pin;
+    pinMode(pin, INPUT);
+    attachInterrupt(pin, trampolines[free], mode);
+    return true;
+}
+
+void EventBus::unwatchPin(uint8_t pin) {
+    for (uint8_t i = 0; i < EVENT_BUS_MAX_GPIO; i++) {
+        if (_gpioPins[i] != pin) continue;
+        detachInterrupt(pin);
+        _gpioPins[i] = -1;
+    }
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+EventBusStats EventBus::getStats() const {
+    EventBusStats stats;
+    stats.posted = __atomic_load_n(&_posted, __ATOMIC_RELAXED);
+    stats.dropped = __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+    stats.delivered = _delivered;
+    stats.dispatched = _dispatched;
+    stats.highWater = _highWater;
+    return stats;
+}
+
+uint8_t EventBus::getSubscriberCount() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < EVENT_BUS_MAX_SUBSCRIBERS; i++) {
+        if (_subscribers[i].handler != nullptr) count++;
+    }
+    return count;
+}
+
+const char* EventBus::sourceToString(EventSource source) {
+    switch (source) {
+        case EventSource::System:    return "System";
+        case EventSource::WiFi:      return "WiFi";
+        case EventSource::Ble:       return "BLE";
+        case EventSource::Uart:      return "UART";
+        case EventSource::Gpio:      return "GPIO";
+        case EventSource::PowerMode: return "Power";
+        default:
+            return static_cast<uint8_t>(source) >= static_cast<uint8_t>(EventSource::User)
+                ? "User" : "Unknown";
+    }
+}
@@ -0,0 +1,222 @@
+/**
+ * @file EventBus.h
+ * @brief Lightweight publish/subscribe event bus (ISR-safe post, task-context delivery)
+ *
+ * Kaynaklar (WiFi, BLE, UART, GPIO, güç profili...) durum değişimlerini post()
+ * ile kuyruğa yazar; aboneler dispatch() içinden, loop() / task context'inde
+ * çağrılır. Böylece bileşenler her loop'ta durum sorgulamak yerine olaya
+ * tepki verir.
+ *
+ * - post() kilitsizdir (CAS ile slot ayırma, slot başına sequence numarası);
+ *   ISR ve task'lar aynı anda post edebilir, kuyruk doluysa olay düşer
+ *   (getStats().dropped)
+ * - Abone, poller ve GPIO tabloları sabit boyutludur; heap kullanılmaz
+ * - Event 12 byte POD'dur; kaynağa özgü anlamı code/arg/value taşır
+ *   (ör. WiFiEventCode, BleEventCode)
+ *
+ * Kullanım:
+ *   Events.subscribe(EVENT_SOURCE_MASK(EventSource::WiFi), onWiFiEvent);
+ *   Events.watchPin(PIN_BUTTON, CHANGE);
+ *   void loop() { Events.dispatch(); ... }
+ */
+
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+
+// Kuyruk kapasitesi (2'nin kuvveti)
+#ifndef EVENT_BUS_QUEUE_SIZE
+    #define EVENT_BUS_QUEUE_SIZE        32
+#endif
+
+#ifndef EVENT_BUS_MAX_SUBSCRIBERS
+    #define EVENT_BUS_MAX_SUBSCRIBERS   16
+#endif
+
+// dispatch() başında çağrılan kaynak poll fonksiyonları (ör. LP_UART RX)
+#ifndef EVENT_BUS_MAX_POLLERS
+    #define EVENT_BUS_MAX_POLLERS       4
+#endif
+
+// watchPin() ile izlenebilecek pin sayısı
+#define EVENT_BUS_MAX_GPIO              4
+
+/**
+ * @brief Olay kaynağı (abonelik maskesinde bit numarası)
+ */
+enum class EventSource : uint8_t {
+    System = 0,
+    WiFi = 1,
+    Ble = 2,
+    Uart = 3,
+    Gpio = 4,
+    PowerMode = 5,      // PowerManager ("Power" makrosu ile çakışmasın diye)
+    User = 8            // Uygulama olayları: User, User+1, ...
+};
+
+#define EVENT_SOURCE_MASK(source)   (1U << static_cast<uint8_t>(source))
+#define EVENT_SOURCE_ALL            0xFFFFU
+
+/**
+ * @brief GPIO olayı: code = yeni seviye (LOW/HIGH), arg = pin
+ */
+enum class GpioEventCode : uint8_t {
+    Low = 0,
+    High = 1
+};
+
+/**
+ * @brief UART olayı: arg = bekleyen byte sayısı
+ */
+enum class UartEventCode : uint8_t {
+    DataAvailable = 1   // LP_UART RX boştan dolu duruma geçti
+};
+
+/**
+ * @brief Olay (POD, kuyrukta kopyalanır)
+ */
+struct Event {
+    EventSource source;
+    uint8_t code;       // Kaynağa özgü olay tipi
+    uint16_t arg;       // Ör. yeni durum / pin
+    uint32_t value;     // Ör. önceki durum / sayaç
+    uint32_t timeMs;    // post() anı
+};
+
+/**
+ * @brief Abone callback'i (loop() / task context'i)
+ */
+typedef void (*EventHandler)(const Event& event, void* user);
+
+/**
+ * @brief Kaynak poll fonksiyonu (dispatch() başında, task context'i)
+ */
+typedef void (*EventPoller)();
+
+struct EventBusStats {
+    uint32_t posted;
+    uint32_t delivered;     // Abone çağrısı sayısı
+    uint32_t dispatched;    // Kuyruktan çıkan olay
+    uint32_t dropped;       // Kuyruk doluydu
+    uint16_t highWater;     // dispatch() başında görülen en uzun kuyruk
+};
+
+class EventBus {
+public:
+    static EventBus& getInstance() {
+        static EventBus instance;
+        return instance;
+    }
+
+    // ========================================================================
+    // Subscribe
+    // ========================================================================
+
+    /**
+     * @brief Abone ekle
+     * @param sourceMask EVENT_SOURCE_MASK(...) birleşimi
+     * @return Abone id'si, tablo doluysa -1
+     */
+    int subscribe(uint16_t sourceMask, EventHandler handler, void* user = nullptr);
+
+    /**
+     * @brief Aboneliği kaldır (handler içinden de çağrılabilir)
+     */
+    bool unsubscribe(int id);
+
+    /**
+     * @brief dispatch() başında çağrılacak kaynak poll fonksiyonu ekle
+     * @return false: tablo dolu (aynı fonksiyon tekrar eklenmez)
+     */
+    bool addPoller(EventPoller poller);
+
+    // ========================================================================
+    // Post (ISR-safe)
+    // ========================================================================
+
+    /**
+     * @brief Olayı kuyruğa yaz - ISR dahil her context'ten çağrılabilir
+     * @return false: kuyruk dolu, olay düştü
+     */
+    bool post(EventSource source, uint8_t code, uint16_t arg = 0, uint32_t value = 0);
+
+    // ========================================================================
+    // Dispatch (task context)
+    // ========================================================================
+
+    /**
+     * @brief Kuyruktaki olayları abonelere dağıt - loop() içinden çağrılır
+     * @param maxEvents Bu çağrıda en fazla (0: kuyruk boşalana kadar)
+     * @return Dağıtılan olay sayısı
+     */
+    uint16_t dispatch(uint16_t maxEvents = 0);
+
+    /**
+     * @brief Kuyrukta bekleyen olay sayısı (yaklaşık)
+     */
+    uint16_t pending() const;
+
+    // ========================================================================
+    // GPIO
+    // ========================================================================
+
+    /**
+     * @brief Pin kesmesini GPIO olayına bağla
+     * @param mode RISING / FALLING / CHANGE
+     * @return false: slot yok veya pin zaten izleniyor
+     */
+    bool watchPin(uint8_t pin, uint32_t mode = CHANGE);
+    void unwatchPin(uint8_t pin);
+
+    // ========================================================================
+    // Status
+    // ========================================================================
+
+    EventBusStats getStats() const;
+    uint8_t getSubscriberCount() const;
+
+    static const char* sourceToString(EventSource source);
+
+private:
+    EventBus();
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    template <int Slot>
+    static void gpioTrampoline();
+
+    struct Subscriber {
+        EventHandler handler;
+        void* user;
+        uint16_t mask;
+    };
+
+    // Bounded MPSC kuyruk: seq == pos -> boş, seq == pos + 1 -> dolu (okunmayı bekliyor)
+    struct Cell {
+        uint32_t seq;
+        Event event;
+    };
+
+    Cell _cells[EVENT_BUS_QUEUE_SIZE];
+    uint32_t _head;             // Üreticiler (CAS)
+    uint32_t _tail;             // Tek tüketici: dispatch()
+
+    Subscriber _subscribers[EVENT_BUS_MAX_SUBSCRIBERS];
+    EventPoller _pollers[EVENT_BUS_MAX_POLLERS];
+    uint8_t _pollerCount;
+    bool _dispatching;
+
+    uint32_t _posted;
+    uint32_t _dropped;
+    uint32_t _delivered;
+    uint32_t _dispatched;
+    uint16_t _highWater;
+
+    static int16_t _gpioPins[EVENT_BUS_MAX_GPIO];
+};
+
+// Global erişim için kısayol
+#define Events EventBus::getInstance()
+
+#endif // EVENT_BUS_H
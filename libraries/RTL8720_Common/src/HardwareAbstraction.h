@@ -13,6 +13,13 @@
 #include <Arduino.h>
 #include "BoardConfig.h"
 
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "FreeRTOS.h"
+#include "task.h"
+}
+#endif
+
 /**
  * @brief Hardware Abstraction Layer sınıfı
  *
@@ -131,6 +138,44 @@ public:
         }
     }
 
+    // ========================================================================
+    // Memory
+    // ========================================================================
+
+    /**
+     * @brief Boş heap (byte)
+     * @return Host build'de 0 (ölçülmez)
+     */
+    uint32_t getFreeHeap() const {
+#if defined(RTL8720_HOST)
+        return 0;
+#else
+        return xPortGetFreeHeapSize();
+#endif
+    }
+
+    /**
+     * @brief Açılıştan beri en düşük boş heap (byte)
+     */
+    uint32_t getMinFreeHeap() const {
+#if defined(RTL8720_HOST)
+        return 0;
+#else
+        return xPortGetMinimumEverFreeHeapSize();
+#endif
+    }
+
+    /**
+     * @brief Çağıran task'ın stack high-water mark'ı (hiç kullanılmamış byte)
+     */
+    uint32_t getStackHighWaterMark() const {
+#if defined(RTL8720_HOST)
+        return 0;
+#else
+        return uxTaskGetStackHighWaterMark(nullptr) * sizeof(StackType_t);
+#endif
+    }
+
     // ========================================================================
     // Utility
     // ========================================================================
@@ -0,0 +1,167 @@
+/**
+ * @file OpenHashTable.h
+ * @brief Fixed-capacity open-addressing hash table (linear probing, backward-shift delete)
+ *
+ * Sabit kapasiteli, heap kullanmayan hash tablosu:
+ * - Çakışmada sonraki slot denenir (linear probing)
+ * - Silmede arkadaki zincir geri kaydırılır (backward-shift); tombstone
+ *   yoktur, probe zincirleri silmelerle uzamaz
+ * - Kapasitenin en fazla %75'i kullanılır; full() iken hangi kaydın
+ *   atılacağı (LRU, en eski...) kullanan sınıfa bırakılır
+ *
+ * Anahtar ve kayıt tipi Traits ile verilir:
+ *   struct Traits {
+ *       static uint32_t hash(Key key);                      // 32-bit, maskelenmemiş
+ *       static bool matches(const Entry& entry, Key key);
+ *       static Key keyOf(const Entry& entry);
+ *       static void setKey(Entry& entry, Key key);
+ *   };
+ * Entry memset / atama ile taşınabilen POD olmalıdır; Key küçük bir değer
+ * tipidir (ör. adres pointer'ı).
+ *
+ * Kullanım:
+ *   OpenHashTable<const uint8_t*, Entry, 64, EntryTraits> table;
+ *   int slot = table.find(bssid);
+ *   if (slot < 0 && !table.full()) slot = table.insert(bssid);
+ */
+
+#ifndef OPEN_HASH_TABLE_H
+#define OPEN_HASH_TABLE_H
+
+#include <Arduino.h>
+
+template <typename Key, typename Entry, uint16_t Slots, typename Traits>
+class OpenHashTable {
+public:
+    static constexpr uint16_t kSlots = Slots;
+    static constexpr uint16_t kMask = Slots - 1;
+    static constexpr uint16_t kMaxEntries = Slots * 3 / 4;
+
+    static_assert(Slots >= 4 && (Slots & (Slots - 1)) == 0 && Slots <= 32768,
+                  "OpenHashTable slot count must be a power of two in [4, 32768]");
+
+    OpenHashTable() { clear(); }
+
+    void clear() {
+        memset(_entries, 0, sizeof(_entries));
+        memset(_used, 0, sizeof(_used));
+        _count = 0;
+    }
+
+    uint16_t size() const { return _count; }
+    bool full() const { return _count >= kMaxEntries; }
+
+    bool isUsed(uint16_t slot) const { return _used[slot]; }
+    Entry& operator[](uint16_t slot) { return _entries[slot]; }
+    const Entry& operator[](uint16_t slot) const { return _entries[slot]; }
+
+    /**
+     * @brief Anahtarın slot'u
+     * @param probes Boş slot'a / eşleşmeye kadar atlanan slot sayısı (output)
+     * @return Slot, yoksa -1
+     */
+    int find(Key key, uint16_t& probes) const {
+        uint16_t i = home(key);
+        for (probes = 0; probes < kSlots; probes++) {
+            if (!_used[i]) return -1;
+            if (Traits::matches(_entries[i], key)) return i;
+            i = (i + 1) & kMask;
+        }
+        return -1;
+    }
+
+    int find(Key key) const {
+        uint16_t probes;
+        return find(key, probes);
+    }
+
+    /**
+     * @brief Yeni kayıt ekle (anahtar tabloda olmamalı, full() false olmalı)
+     *
+     * Kayıt sıfırlanır, sadece anahtarı yazılır.
+     * @param probes Home slot'tan sonra atlanan dolu slot sayısı (output)
+     * @return Slot
+     */
+    int insert(Key key, uint16_t& probes) {
+        uint16_t i = home(key);
+        probes = 0;
+        while (_used[i]) {
+            i = (i + 1) & kMask;
+            probes++;
+        }
+        memset(&_entries[i], 0, sizeof(Entry));
+        Traits::setKey(_entries[i], key);
+        _used[i] = true;
+        _count++;
+        return i;
+    }
+
+    int insert(Key key) {
+        uint16_t probes;
+        return insert(key, probes);
+    }
+
+    /**
+     * @brief Slot'u sil
+     *
+     * Arkadaki zincirden bir kayıt bu slot'a kayabilir: tablo üzerinde
+     * silerek dolaşılacaksa eraseIf() kullanılmalı.
+     */
+    void erase(uint16_t slot) {
+        uint16_t hole = slot;
+        uint16_t j = slot;
+        for (;;) {
+            j = (j + 1) & kMask;
+            if (!_used[j]) break;
+
+            // j'deki kayıt hole'a taşınabilir mi? (home, (hole, j] aralığında değilse)
+            uint16_t h = home(Traits::keyOf(_entries[j]));
+            bool homeInRange = (hole <= j) ? (h > hole && h <= j)
+                                           : (h > hole || h <= j);
+            if (!homeInRange) {
+                _entries[hole] = _entries[j];
+                hole = j;
+            }
+        }
+        memset(&_entries[hole], 0, sizeof(Entry));
+        _used[hole] = false;
+        _count--;
+    }
+
+    /**
+     * @brief match(entry) true olan kayıtları sil, her biri için erased(kopya)
+     *
+     * erased() kayıt tablodan çıktıktan sonra, silinmeden önceki kopyayla
+     * çağrılır.
+     * @return Silinen kayıt sayısı
+     */
+    template <typename Match, typename Erased>
+    uint16_t eraseIf(Match match, Erased erased) {
+        uint16_t removed = 0;
+        // Backward-shift silme kayıtları geri kaydırabilir; koşul idempotent
+        // olduğu için silinen slot yeniden kontrol edilir
+        for (uint16_t i = 0; i < kSlots; ) {
+            if (_used[i] && match(_entries[i])) {
+                Entry entry = _entries[i];
+                erase(i);
+                removed++;
+                erased(entry);
+                continue;
+            }
+            i++;
+        }
+        return removed;
+    }
+
+private:
+    static uint16_t home(Key key) {
+        uint32_t h = Traits::hash(key);
+        return static_cast<uint16_t>((h ^ (h >> 16)) & kMask);
+    }
+
+    Entry _entries[Slots];
+    bool _used[Slots];
+    uint16_t _count;
+};
+
+#endif // OPEN_HASH_TABLE_H
@@ -0,0 +1,130 @@
+/**
+ * @file Profiler.cpp
+ * @brief Cycle-accurate profiling implementation
+ */
+
+#include "Profiler.h"
+#include "SerialManager.h"
+#include <string.h>
+
+// ============================================================================
+// ProfileProbe
+// ============================================================================
+
+ProfileProbe::ProfileProbe(const char* name)
+    : _name(name)
+{
+    reset();
+    Profiler::getInstance().registerProbe(this);
+}
+
+void ProfileProbe::reset() {
+    _count = 0;
+    _min = UINT32_MAX;
+    _max = 0;
+    _total = 0;
+    memset(_histogram, 0, sizeof(_histogram));
+}
+
+// ============================================================================
+// Profiler
+// ============================================================================
+
+bool Profiler::begin() {
+#if !defined(RTL8720_HOST)
+    // DWT erişimi için trace bloğunu aç
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    if (DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) {
+        return false;
+    }
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    _started = true;
+    calibrate();
+    return true;
+}
+
+uint32_t Profiler::ticksPerSecond() {
+#if defined(RTL8720_HOST)
+    return 1000000000UL;
+#else
+    return SystemCoreClock;
+#endif
+}
+
+const char* Profiler::tickUnit() {
+#if defined(RTL8720_HOST)
+    return "ns";
+#else
+    return "cyc";
+#endif
+}
+
+void Profiler::calibrate() {
+    // Ardışık iki ticks() okuması arasındaki minimum fark = ölçüm overhead'i
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < 16; i++) {
+        uint32_t start = ticks();
+        uint32_t stop = ticks();
+        uint32_t delta = stop - start;
+        if (delta < best) best = delta;
+    }
+    _overhead = best;
+}
+
+bool Profiler::registerProbe(ProfileProbe* probe) {
+    if (_probeCount >= PROFILER_MAX_PROBES) return false;
+    _probes[_probeCount++] = probe;
+    return true;
+}
+
+ProfileProbe* Profiler::findProbe(const char* name) const {
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        if (strcmp(_probes[i]->getName(), name) == 0) return _probes[i];
+    }
+    return nullptr;
+}
+
+void Profiler::reset() {
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        _probes[i]->reset();
+    }
+}
+
+void Profiler::printReport(bool histogram) const {
+    serialManager.logPrintln("================================");
+    serialManager.logPrintf("Profiler (%s, %lu/s, overhead %lu %s)\n",
+                            tickUnit(), (unsigned long)ticksPerSecond(),
+                            (unsigned long)_overhead, tickUnit());
+    if (!_started) {
+        serialManager.logPrintln("  (begin() çağrılmadı)");
+    }
+    serialManager.logPrintf("%-20s %8s %10s %10s %10s %10s\n",
+                            "probe", "count", "min", "mean", "max", "mean_us");
+
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        const ProfileProbe* p = _probes[i];
+        // newlib-nano printf float desteklemez - 0.01 µs çözünürlükte tamsayı yaz
+        uint32_t meanCentiUs = static_cast<uint32_t>(ticksToMicros(p->getMean()) * 100.0f);
+        serialManager.logPrintf("%-20s %8lu %10lu %10lu %10lu %7lu.%02lu\n",
+                                p->getName(),
+                                (unsigned long)p->getCount(),
+                                (unsigned long)p->getMin(),
+                                (unsigned long)p->getMean(),
+                                (unsigned long)p->getMax(),
+                                (unsigned long)(meanCentiUs / 100),
+                                (unsigned long)(meanCentiUs % 100));
+
+        if (!histogram || p->getCount() == 0) continue;
+
+        serialManager.logPrint("    hist:");
+        for (uint8_t b = 0; b < PROFILER_HISTOGRAM_BUCKETS; b++) {
+            uint32_t n = p->getBucket(b);
+            if (n == 0) continue;
+            serialManager.logPrintf(" [%lu+]=%lu", (unsigned long)(1UL << b), (unsigned long)n);
+        }
+        serialManager.logPrintln();
+    }
+    serialManager.logPrintln("================================");
+}
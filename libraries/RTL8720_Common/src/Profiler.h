@@ -0,0 +1,235 @@
+/**
+ * @file Profiler.h
+ * @brief Cycle-accurate profiling based on the Cortex-M33 DWT cycle counter
+ *
+ * millis()'ten daha ince zaman ölçümü için:
+ * - Cihazda DWT->CYCCNT (200 MHz'de 5 ns çözünürlük)
+ * - Host build'de (RTL8720_HOST) std::chrono::steady_clock (ns)
+ *
+ * Her probe için count / min / max / mean ve log2 histogram tutulur.
+ * Kayıt maliyeti birkaç on cycle'dır (CLZ ile bucket, heap yok).
+ *
+ * Kullanım:
+ *   void sendPacket() {
+ *       PROFILE_SCOPE("sendPacket");
+ *       ...
+ *   }
+ *
+ *   Profiler::getInstance().begin();   // setup()
+ *   Profiler::getInstance().printReport();
+ *
+ * PROFILER_ENABLED=0 ile tüm makrolar boş derlenir.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "BoardConfig.h"
+
+#if defined(RTL8720_HOST)
+#include <chrono>
+#endif
+
+#ifndef PROFILER_ENABLED
+    #define PROFILER_ENABLED            1
+#endif
+
+// Kayıt edilebilecek maksimum probe sayısı (statik tablo)
+#ifndef PROFILER_MAX_PROBES
+    #define PROFILER_MAX_PROBES         32
+#endif
+
+// log2 histogram: bucket k = [2^k, 2^(k+1)) tick
+#define PROFILER_HISTOGRAM_BUCKETS      32
+
+/**
+ * @brief İsimli ölçüm noktası
+ *
+ * Statik ömürlü olmalıdır (global veya fonksiyon içi static);
+ * constructor Profiler tablosuna kaydeder.
+ */
+class ProfileProbe {
+public:
+    explicit ProfileProbe(const char* name);
+
+    /**
+     * @brief Bir ölçüm ekle
+     * @param ticks Süre (cihazda cycle, host'ta ns)
+     */
+    void record(uint32_t ticks) {
+        _count++;
+        _total += ticks;
+        if (ticks < _min) _min = ticks;
+        if (ticks > _max) _max = ticks;
+        _histogram[31 - __builtin_clz(ticks | 1)]++;
+    }
+
+    void reset();
+
+    const char* getName() const { return _name; }
+    uint32_t getCount() const { return _count; }
+    uint32_t getMin() const { return _count ? _min : 0; }
+    uint32_t getMax() const { return _max; }
+    uint64_t getTotal() const { return _total; }
+    uint32_t getMean() const { return _count ? static_cast<uint32_t>(_total / _count) : 0; }
+    uint32_t getBucket(uint8_t index) const { return _histogram[index]; }
+
+private:
+    const char* _name;
+    uint32_t _count;
+    uint32_t _min;
+    uint32_t _max;
+    uint64_t _total;
+    uint32_t _histogram[PROFILER_HISTOGRAM_BUCKETS];
+};
+
+/**
+ * @brief Probe tablosu ve zaman kaynağı
+ *
+ * Singleton pattern ile tek instance kullanımı sağlar.
+ */
+class Profiler {
+public:
+    static Profiler& getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    /**
+     * @brief Cycle counter'ı etkinleştir (DWT TRCENA + CYCCNTENA)
+     * @return false: çekirdekte DWT cycle counter yok
+     */
+    bool begin();
+
+    /**
+     * @brief Anlık tick değeri (wrap eden 32-bit sayaç)
+     */
+    static inline uint32_t ticks() {
+#if defined(RTL8720_HOST)
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+        return DWT->CYCCNT;
+#endif
+    }
+
+    /**
+     * @brief Saniyedeki tick sayısı (cihazda SystemCoreClock, host'ta 1e9)
+     */
+    static uint32_t ticksPerSecond();
+
+    /**
+     * @brief Tick -> mikrosaniye
+     */
+    static float ticksToMicros(uint32_t ticks) {
+        return ticks * 1e6f / ticksPerSecond();
+    }
+
+    /**
+     * @brief Tick birimi ("cyc" veya "ns")
+     */
+    static const char* tickUnit();
+
+    // ========================================================================
+    // Probe table
+    // ========================================================================
+
+    bool registerProbe(ProfileProbe* probe);
+    ProfileProbe* findProbe(const char* name) const;
+    uint8_t getProbeCount() const { return _probeCount; }
+    ProfileProbe* getProbe(uint8_t index) const {
+        return index < _probeCount ? _probes[index] : nullptr;
+    }
+
+    /**
+     * @brief Tüm probe istatistiklerini sıfırla
+     */
+    void reset();
+
+    /**
+     * @brief Ardışık iki ticks() okuması arasındaki minimum fark (bilgi amaçlı,
+     *        ölçümlerden düşülmez)
+     */
+    uint32_t getOverhead() const { return _overhead; }
+
+    /**
+     * @brief Rapor yazdır (SerialManager / LOG_UART)
+     * @param histogram Sıfır olmayan histogram bucket'larını da yazdır
+     */
+    void printReport(bool histogram = true) const;
+
+private:
+    Profiler() : _probeCount(0), _overhead(0), _started(false) {}
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void calibrate();
+
+    ProfileProbe* _probes[PROFILER_MAX_PROBES];
+    uint8_t _probeCount;
+    uint32_t _overhead;
+    bool _started;
+};
+
+/**
+ * @brief RAII zamanlayıcı - scope sonunda probe'a kaydeder
+ */
+class ScopedProfile {
+public:
+    explicit ScopedProfile(ProfileProbe& probe) : _probe(probe), _start(Profiler::ticks()) {}
+    ~ScopedProfile() { _probe.record(Profiler::ticks() - _start); }
+
+    ScopedProfile(const ScopedProfile&) = delete;
+    ScopedProfile& operator=(const ScopedProfile&) = delete;
+
+private:
+    ProfileProbe& _probe;
+    uint32_t _start;
+};
+
+// ============================================================================
+// Macros
+// ============================================================================
+
+#define PROFILER_CONCAT_(a, b)          a##b
+#define PROFILER_CONCAT(a, b)           PROFILER_CONCAT_(a, b)
+
+#if PROFILER_ENABLED
+
+/**
+ * @brief Bulunduğu scope'u isimli probe ile ölç
+ */
+#define PROFILE_SCOPE(name) \
+    static ProfileProbe PROFILER_CONCAT(_profProbe, __LINE__)(name); \
+    ScopedProfile PROFILER_CONCAT(_profScope, __LINE__)(PROFILER_CONCAT(_profProbe, __LINE__))
+
+/**
+ * @brief Global probe tanımla (birden fazla yerden ölçüm için)
+ */
+#define PROFILE_PROBE(var, name)        ProfileProbe var(name)
+
+/**
+ * @brief Tanımlı probe ile scope ölç
+ */
+#define PROFILE_SCOPE_PROBE(var) \
+    ScopedProfile PROFILER_CONCAT(_profScope, __LINE__)(var)
+
+/**
+ * @brief Manuel başlangıç/bitiş (scope dışı ölçümler için)
+ */
+#define PROFILE_START(tickVar)          uint32_t tickVar = Profiler::ticks()
+#define PROFILE_STOP(var, tickVar)      (var).record(Profiler::ticks() - (tickVar))
+
+#else
+
+#define PROFILE_SCOPE(name)             do {} while (0)
+#define PROFILE_PROBE(var, name)        ProfileProbe var(name)
+#define PROFILE_SCOPE_PROBE(var)        do {} while (0)
+#define PROFILE_START(tickVar)          do {} while (0)
+#define PROFILE_STOP(var, tickVar)      do {} while (0)
+
+#endif // PROFILER_ENABLED
+
+#endif // PROFILER_H
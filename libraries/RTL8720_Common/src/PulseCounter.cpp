@@ -0,0 +1,302 @@
+/**
+ * @file PulseCounter.cpp
+ * @brief Edge counter / frequency meter implementation
+ */
+
+#include "PulseCounter.h"
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "ameba_soc.h"
+}
+#endif
+
+PulseCounter* PulseCounter::_interruptSlots[PulseCounter::kMaxInterruptCounters] = { nullptr };
+PulseCounter* PulseCounter::_captureOwner = nullptr;
+
+PulseCounter::PulseCounter(uint8_t pin, PulseEdge edge)
+    : _pin(pin)
+    , _edge(edge)
+    , _gateMs(1000)
+    , _running(false)
+    , _capture(false)
+    , _slot(-1)
+    , _gateStartUs(0)
+    , _totalCount(0)
+    , _measurement{0, 0, 0.0f, 0.0f, false}
+    , _isrCount(0)
+    , _isrFirstUs(0)
+    , _isrLastUs(0)
+    , _captureGateUs(0)
+    , _captureCount(0)
+    , _captureGates(0)
+{
+}
+
+PulseCounter::~PulseCounter() {
+    end();
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+bool PulseCounter::begin(uint32_t gateMs, PulseCounterMode mode) {
+    end();
+
+    _gateMs = clampGate(gateMs);
+    _totalCount = 0;
+    _measurement = PulseMeasurement{0, 0, 0.0f, 0.0f, false};
+
+    // Pulse-number capture tek polariteyi sayar; Both kenar sadece Interrupt modunda
+    bool capturePossible = isCaptureCapable(_pin) && _edge != PulseEdge::Both;
+
+    switch (mode) {
+        case PulseCounterMode::Capture:
+            if (!capturePossible) return false;
+            _capture = beginCapture();
+            if (!_capture) return false;
+            break;
+        case PulseCounterMode::Auto:
+            _capture = capturePossible && beginCapture();
+            if (!_capture && !beginInterrupt()) return false;
+            break;
+        case PulseCounterMode::Interrupt:
+            _capture = false;
+            if (!beginInterrupt()) return false;
+            break;
+    }
+
+    _gateStartUs = micros();
+    _running = true;
+    return true;
+}
+
+void PulseCounter::end() {
+    if (!_running) return;
+
+    if (_capture) {
+        endCapture();
+    } else {
+        endInterrupt();
+    }
+    _running = false;
+    _capture = false;
+}
+
+void PulseCounter::setGateTime(uint32_t gateMs) {
+    _gateMs = clampGate(gateMs);
+    if (_running && _capture) {
+        // Timer periyodu gate'e bağlı - yeniden programla
+        endCapture();
+        beginCapture();
+        _gateStartUs = micros();
+    }
+}
+
+bool PulseCounter::poll() {
+    if (!_running) return false;
+    return _capture ? pollCapture() : pollInterrupt();
+}
+
+float PulseCounter::getCpuLoad() const {
+    if (_capture || !_measurement.valid || _measurement.gateUs == 0) return 0.0f;
+    float edgesPerSecond = _measurement.count * 1e6f / _measurement.gateUs;
+    return edgesPerSecond * PULSE_COUNTER_ISR_COST_NS * 1e-9f;
+}
+
+uint32_t PulseCounter::clampGate(uint32_t gateMs) {
+    if (gateMs == 0) return 1;
+    return gateMs > PULSE_COUNTER_MAX_GATE_MS ? PULSE_COUNTER_MAX_GATE_MS : gateMs;
+}
+
+bool PulseCounter::isCaptureCapable(uint8_t pin) {
+#ifdef BOARD_PWM_PINS
+    static const uint8_t pwmPins[] = BOARD_PWM_PINS;
+    for (uint8_t pwmPin : pwmPins) {
+        if (pwmPin == pin) return true;
+    }
+#endif
+    return false;
+}
+
+// ============================================================================
+// Capture mode (timer; kenar başına değil gate başına 1 kesme)
+// ============================================================================
+
+bool PulseCounter::beginCapture() {
+#if defined(RTL8720_HOST)
+    return false;
+#else
+    if (_captureOwner != nullptr && _captureOwner != this) return false;
+
+    // Gate = timer periyodu; her periyot sonunda kenar sayısı CCR0'a latch'lenir,
+    // update kesmesi onu biriktirir
+    uint32_t ticks = static_cast<uint32_t>(
+        static_cast<uint64_t>(_gateMs) * PULSE_COUNTER_TIM_CLK_HZ / 1000);
+    if (ticks < 2) ticks = 2;
+
+    RTIM_TimeBaseInitTypeDef timInit;
+    RTIM_TimeBaseStructInit(&timInit);
+    timInit.TIM_Idx = PULSE_COUNTER_TIM_IDX;
+    timInit.TIM_Prescaler = 0;
+    timInit.TIM_Period = ticks - 1;
+    _captureCount = 0;
+    _captureGates = 0;
+    RTIM_TimeBaseInit(PULSE_COUNTER_TIM, &timInit, TIMER5_IRQ, reinterpret_cast<IRQ_FUN>(&captureIrq),
+                      reinterpret_cast<u32>(this));
+    RTIM_INTConfig(PULSE_COUNTER_TIM, TIM_IT_Update, ENABLE);
+
+    TIM_CCInitTypeDef ccInit;
+    RTIM_CCStructInit(&ccInit);
+    ccInit.TIM_CCMode = TIM_CCMode_Inputcapture;
+    ccInit.TIM_CCPolarity = (_edge == PulseEdge::Falling) ? TIM_CCPolarity_Low : TIM_CCPolarity_High;
+    ccInit.TIM_ICPulseMode = TIM_CCMode_PulseNumber;
+    RTIM_CCxInit(PULSE_COUNTER_TIM, &ccInit, 0);
+    RTIM_CCxCmd(PULSE_COUNTER_TIM, 0, TIM_CCx_Enable);
+
+    Pinmux_Config(static_cast<u8>(g_APinDescription[_pin].pinname), PULSE_COUNTER_PINMUX);
+    RTIM_Cmd(PULSE_COUNTER_TIM, ENABLE);
+
+    _captureGateUs = static_cast<uint32_t>(
+        static_cast<uint64_t>(ticks) * 1000000ULL / PULSE_COUNTER_TIM_CLK_HZ);
+    _captureOwner = this;
+    return true;
+#endif
+}
+
+void PulseCounter::endCapture() {
+#if !defined(RTL8720_HOST)
+    if (_captureOwner != this) return;
+    RTIM_INTConfig(PULSE_COUNTER_TIM, TIM_IT_Update, DISABLE);
+    InterruptDis(TIMER5_IRQ);
+    InterruptUnRegister(TIMER5_IRQ);
+    RTIM_CCxCmd(PULSE_COUNTER_TIM, 0, TIM_CCx_Disable);
+    RTIM_Cmd(PULSE_COUNTER_TIM, DISABLE);
+
+    // Poll edilmemiş gate'ler toplamda kalsın (setGateTime yeniden programlarken)
+    _totalCount += _captureCount;
+    _captureCount = 0;
+    _captureGates = 0;
+    Pinmux_Config(static_cast<u8>(g_APinDescription[_pin].pinname), PINMUX_FUNCTION_GPIO);
+    _captureOwner = nullptr;
+#endif
+}
+
+bool PulseCounter::pollCapture() {
+#if defined(RTL8720_HOST)
+    return false;
+#else
+    // Son poll'dan beri biten gate'ler (loop() geç kaldıysa birden fazla)
+    noInterrupts();
+    uint32_t count = _captureCount;
+    uint32_t gates = _captureGates;
+    _captureCount = 0;
+    _captureGates = 0;
+    interrupts();
+    if (gates == 0) return false;
+
+    // Çok geç poll'da gate toplamı 32-bit'i aşabilir
+    uint64_t gateUs = static_cast<uint64_t>(_captureGateUs) * gates;
+    _gateStartUs = micros();
+    _totalCount += count;
+    _measurement.count = count;
+    _measurement.gateUs = gateUs > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(gateUs);
+    _measurement.frequencyHz = count * 1e6f / static_cast<float>(gateUs);
+    _measurement.periodUs = count > 0 ? static_cast<float>(gateUs) / count : 0.0f;
+    _measurement.valid = true;
+    return true;
+#endif
+}
+
+uint32_t PulseCounter::captureIrq(void* data) {
+#if !defined(RTL8720_HOST)
+    PulseCounter* counter = static_cast<PulseCounter*>(data);
+    counter->_captureCount = counter->_captureCount + RTIM_CCRxGet(PULSE_COUNTER_TIM, 0);
+    counter->_captureGates = counter->_captureGates + 1;
+    RTIM_INTClear(PULSE_COUNTER_TIM);
+#else
+    (void)data;
+#endif
+    return 0;
+}
+
+// ============================================================================
+// Interrupt mode (GPIO kesmesi)
+// ============================================================================
+
+template <int Slot>
+void PulseCounter::isrTrampoline() {
+    PulseCounter* counter = _interruptSlots[Slot];
+    if (counter != nullptr) counter->handleEdge();
+}
+
+void PulseCounter::handleEdge() {
+    uint32_t now = micros();
+    if (_isrCount == 0) _isrFirstUs = now;
+    _isrLastUs = now;
+    _isrCount = _isrCount + 1;
+}
+
+bool PulseCounter::beginInterrupt() {
+    static void (*const trampolines[kMaxInterruptCounters])(void) = {
+        &isrTrampoline<0>, &isrTrampoline<1>, &isrTrampoline<2>, &isrTrampoline<3>
+    };
+
+    for (uint8_t i = 0; i < kMaxInterruptCounters; i++) {
+        if (_interruptSlots[i] != nullptr) continue;
+
+        _slot = static_cast<int8_t>(i);
+        _isrCount = 0;
+        _interruptSlots[i] = this;
+
+        uint32_t mode = RISING;
+        if (_edge == PulseEdge::Falling) mode = FALLING;
+        if (_edge == PulseEdge::Both) mode = CHANGE;
+
+        pinMode(_pin, INPUT);
+        attachInterrupt(_pin, trampolines[i], mode);
+        return true;
+    }
+    return false;
+}
+
+void PulseCounter::endInterrupt() {
+    if (_slot < 0) return;
+    detachInterrupt(_pin);
+    _interruptSlots[_slot] = nullptr;
+    _slot = -1;
+}
+
+bool PulseCounter::pollInterrupt() {
+    unsigned long now = micros();
+    unsigned long gateUs = now - _gateStartUs;
+    if (gateUs < static_cast<uint64_t>(_gateMs) * 1000) return false;
+
+    noInterrupts();
+    uint32_t count = _isrCount;
+    uint32_t firstUs = _isrFirstUs;
+    uint32_t lastUs = _isrLastUs;
+    _isrCount = 0;
+    interrupts();
+
+    _gateStartUs = now;
+    _totalCount += count;
+
+    // Both modunda periyot başına iki kenar
+    float edgesPerPeriod = (_edge == PulseEdge::Both) ? 2.0f : 1.0f;
+
+    _measurement.count = count;
+    _measurement.gateUs = gateUs;
+    if (count >= 2 && lastUs != firstUs) {
+        // Reciprocal: ilk ve son kenar arası (count - 1) aralık
+        float edgeIntervalUs = static_cast<float>(lastUs - firstUs) / (count - 1);
+        _measurement.periodUs = edgeIntervalUs * edgesPerPeriod;
+        _measurement.frequencyHz = 1e6f / _measurement.periodUs;
+    } else {
+        _measurement.frequencyHz = count * 1e6f / (gateUs * edgesPerPeriod);
+        _measurement.periodUs = count > 0 ? 1e6f / _measurement.frequencyHz : 0.0f;
+    }
+    _measurement.valid = true;
+    return true;
+}
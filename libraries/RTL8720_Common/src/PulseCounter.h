@@ -0,0 +1,204 @@
+/**
+ * @file PulseCounter.h
+ * @brief Edge counter and frequency meter for flow meters / fan tachometers
+ *
+ * İki ölçüm yolu sunar:
+ * - Capture   : Timer capture (pulse-number modu). Kenarlar donanımda sayılır,
+ *               her gate sonunda update kesmesi latch'lenen sayıyı biriktirir;
+ *               loop() gecikip birden fazla gate kaçırsa da kenar kaybolmaz.
+ *               Tamamen ISR'siz değildir: kenar başına değil ama gate başına
+ *               bir timer kesmesi gerekir (latch sadece son gate'i tutar,
+ *               poll() ile okumak geç kalan loop()'ta gate kaybettirir).
+ *               Sadece board header'daki PIN_PWM* pinlerinde kullanılabilir.
+ * - Interrupt : GPIO kesmesi ile sayım (her pin). Gate içindeki ilk/son kenar
+ *               zaman damgasından reciprocal frekans hesaplanır.
+ *
+ * Doğruluk ve CPU yükü (200 MHz KM4, tahmini):
+ *
+ * | Mod      | Çözünürlük                         | CPU yükü                      |
+ * |----------|------------------------------------|-------------------------------|
+ * | Capture  | ±1 kenar / gate (1 s → ±1 Hz)      | ~0 (gate başına 1 kesme)      |
+ * | Interrupt| ±1 µs / ölçülen periyot aralığı    | f × PULSE_COUNTER_ISR_COST_NS |
+ *
+ * Interrupt modda 10 kHz sinyal ≈ %1.5 CPU harcar; yüksek devirli fanlar için
+ * Capture modu tercih edilmelidir. Düşük frekanslı (<100 Hz) flow meter'larda
+ * Interrupt modun reciprocal ölçümü gate sayımından daha hassastır.
+ */
+
+#ifndef PULSE_COUNTER_H
+#define PULSE_COUNTER_H
+
+#include <Arduino.h>
+#include "BoardConfig.h"
+
+// GPIO IRQ dispatch + ISR gövdesi (ns) - CPU yükü tahmini için
+#ifndef PULSE_COUNTER_ISR_COST_NS
+    #define PULSE_COUNTER_ISR_COST_NS   1500
+#endif
+
+// Gate üst sınırı (ms): micros() ~71 dk'da taşar, gate µs hesabı 32-bit kalır
+#ifndef PULSE_COUNTER_MAX_GATE_MS
+    #define PULSE_COUNTER_MAX_GATE_MS   3600000UL
+#endif
+
+// Timer capture kaynağı (RTL8721D TIM5 - pulse number modu)
+#ifndef PULSE_COUNTER_TIM
+    #define PULSE_COUNTER_TIM           TIMM05
+    #define PULSE_COUNTER_TIM_IDX       5
+    #define PULSE_COUNTER_TIM_CLK_HZ    32768
+    #define PULSE_COUNTER_PINMUX        PINMUX_FUNCTION_TIMINPUT
+#endif
+
+/**
+ * @brief Ölçüm yolu seçimi
+ */
+enum class PulseCounterMode {
+    Auto,       // Pin destekliyorsa Capture, değilse Interrupt
+    Capture,    // Timer capture, gate başına 1 kesme (sadece PIN_PWM* pinleri)
+    Interrupt   // GPIO kesmesi (her pin)
+};
+
+/**
+ * @brief Sayılacak kenar
+ */
+enum class PulseEdge {
+    Rising,
+    Falling,
+    Both
+};
+
+/**
+ * @brief Tek gate'in ölçüm sonucu
+ */
+struct PulseMeasurement {
+    uint32_t count;         // Gate içindeki kenar sayısı
+    uint32_t gateUs;        // Gerçek gate süresi (µs); Capture'da geç poll'da birden fazla gate
+    float frequencyHz;      // Hesaplanan frekans
+    float periodUs;         // Ortalama periyot (0 ise sinyal yok)
+    bool valid;             // En az bir gate tamamlandı mı?
+};
+
+/**
+ * @brief Pulse counter / frekans ölçer
+ *
+ * Kullanım:
+ *   PulseCounter flow(PIN_PWM4);
+ *   flow.begin(1000);                  // 1 s gate
+ *   if (flow.poll()) {                 // loop() içinde
+ *       float hz = flow.getFrequency();
+ *   }
+ */
+class PulseCounter {
+public:
+    /**
+     * @brief Constructor
+     * @param pin Arduino pin numarası
+     * @param edge Sayılacak kenar (default: Rising)
+     */
+    explicit PulseCounter(uint8_t pin, PulseEdge edge = PulseEdge::Rising);
+    ~PulseCounter();
+
+    /**
+     * @brief Sayacı başlat
+     * @param gateMs Gate süresi (ms, 1..PULSE_COUNTER_MAX_GATE_MS'e sınırlanır)
+     * @param mode Ölçüm yolu
+     * @return false: Capture istendi ama pin desteklemiyor / kesme slotu yok
+     */
+    bool begin(uint32_t gateMs = 1000, PulseCounterMode mode = PulseCounterMode::Auto);
+
+    /**
+     * @brief Sayacı durdur, kesme/timer'ı serbest bırak
+     */
+    void end();
+
+    /**
+     * @brief Gate süresini değiştir (bir sonraki gate'ten itibaren)
+     * @param gateMs 1..PULSE_COUNTER_MAX_GATE_MS'e sınırlanır
+     */
+    void setGateTime(uint32_t gateMs);
+    uint32_t getGateTime() const { return _gateMs; }
+
+    /**
+     * @brief loop() içinden çağrılır
+     * @return true: yeni bir gate tamamlandı, ölçüm güncellendi
+     */
+    bool poll();
+
+    // ========================================================================
+    // Results
+    // ========================================================================
+
+    const PulseMeasurement& getMeasurement() const { return _measurement; }
+    float getFrequency() const { return _measurement.frequencyHz; }
+    float getPeriodUs() const { return _measurement.periodUs; }
+
+    /**
+     * @brief begin()'den beri toplam kenar sayısı (flow meter hacmi için)
+     */
+    uint32_t getTotalCount() const { return _totalCount; }
+    void resetTotalCount() { _totalCount = 0; }
+
+    /**
+     * @brief Son gate'in tahmini CPU yükü (0.0 - 1.0)
+     *
+     * Capture modda 0 (gate başına tek kesme ihmal edilir); Interrupt modda kenar/s × PULSE_COUNTER_ISR_COST_NS.
+     */
+    float getCpuLoad() const;
+
+    bool isCapture() const { return _capture; }
+    bool isRunning() const { return _running; }
+    uint8_t getPin() const { return _pin; }
+
+    /**
+     * @brief Pin timer capture destekliyor mu? (BOARD_PWM_PINS listesinde mi)
+     */
+    static bool isCaptureCapable(uint8_t pin);
+
+private:
+    uint8_t _pin;
+    PulseEdge _edge;
+    uint32_t _gateMs;
+    bool _running;
+    bool _capture;
+    int8_t _slot;
+
+    unsigned long _gateStartUs;
+    uint32_t _totalCount;
+    PulseMeasurement _measurement;
+
+    // Interrupt modu - ISR tarafından güncellenir
+    volatile uint32_t _isrCount;
+    volatile uint32_t _isrFirstUs;
+    volatile uint32_t _isrLastUs;
+
+    // Capture modu - timer update kesmesi tarafından güncellenir
+    uint32_t _captureGateUs;
+    volatile uint32_t _captureCount;    // Son poll'dan beri biten gate'lerin kenarları
+    volatile uint32_t _captureGates;    // Son poll'dan beri biten gate sayısı
+
+    static uint32_t clampGate(uint32_t gateMs);
+
+    bool beginCapture();
+    void endCapture();
+    bool pollCapture();
+
+    // Timer update IRQ (IRQ_FUN imzası): gate'in kenar sayısını biriktir
+    static uint32_t captureIrq(void* data);
+
+    bool beginInterrupt();
+    void endInterrupt();
+    bool pollInterrupt();
+
+    void handleEdge();
+
+    // Aynı anda kullanılabilecek Interrupt modu sayaç sayısı
+    static constexpr uint8_t kMaxInterruptCounters = 4;
+
+    template <int Slot>
+    static void isrTrampoline();
+
+    static PulseCounter* _interruptSlots[kMaxInterruptCounters];
+    static PulseCounter* _captureOwner;
+};
+
+#endif // PULSE_COUNTER_H
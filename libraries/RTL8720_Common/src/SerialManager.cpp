@@ -4,6 +4,7 @@
  */
 
 #include "SerialManager.h"
+#include "EventBus.h"
 #include <stdarg.h>
 
 // Global instance
@@ -166,3 +167,22 @@ void SerialManager::flushDataBuffer() {
 void SerialManager::flushLogBuffer() {
     DEBUG_SERIAL.flush();
 }
+
+// ============================================================================
+// Events
+// ============================================================================
+
+bool SerialManager::enableEvents() {
+    return Events.addPoller(&SerialManager::pollEvents);
+}
+
+void SerialManager::pollEvents() {
+    static bool hadData = false;
+
+    int available = DATA_SERIAL.available();
+    if (available > 0 && !hadData) {
+        uint16_t bytes = available > UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>(available);
+        Events.post(EventSource::Uart, static_cast<uint8_t>(UartEventCode::DataAvailable), bytes);
+    }
+    hadData = available > 0;
+}
@@ -111,7 +111,22 @@ public:
      */
     void flushLogBuffer();
 
+    // ========================================================================
+    // Events
+    // ========================================================================
+
+    /**
+     * @brief LP_UART RX'i EventBus'a bağla
+     *
+     * Events.dispatch() her çağrıldığında RX kontrol edilir; buffer boştan
+     * doluya geçince UartEventCode::DataAvailable post edilir
+     * (arg = bekleyen byte). Veri okunup buffer boşalana kadar tekrar post edilmez.
+     */
+    bool enableEvents();
+
 private:
+    static void pollEvents();
+
     bool _initialized = false;
     unsigned long _logBaud = DEBUG_BAUD_RATE;
     unsigned long _dataBaud = DATA_BAUD_RATE;
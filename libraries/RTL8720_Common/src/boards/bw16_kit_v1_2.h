@@ -92,6 +92,9 @@
 // PA_30 da PWM destekliyor ama LP_PWM1 ile paylaşımlı
 #define PIN_PWM1_ALT            3       // AMB_D3 / PA_30 / LP_PWM1 (alternatif)
 
+// Timer/PWM capture destekli pinler (PulseCounter Capture modu)
+#define BOARD_PWM_PINS          { PIN_PWM0, PIN_PWM1, PIN_PWM4, PIN_PWM5, PIN_PWM1_ALT }
+
 // ============================================================================
 // SWD Debug Pins
 // ============================================================================
@@ -90,6 +90,9 @@
 #define PIN_PWM12               13      // AMB_D13 / PB_20 / HS_PWM12
 #define PIN_PWM13               14      // AMB_D14 / PB_21 / HS_PWM13
 
+// Timer/PWM capture destekli pinler (PulseCounter Capture modu)
+#define BOARD_PWM_PINS          { PIN_PWM0, PIN_PWM1, PIN_PWM4, PIN_PWM5, PIN_PWM7, PIN_PWM12, PIN_PWM13 }
+
 // ============================================================================
 // SWD Debug Pins
 // ============================================================================
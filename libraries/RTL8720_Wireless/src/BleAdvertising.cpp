@@ -0,0 +1,312 @@
+/**
+ * @file BleAdvertising.cpp
+ * @brief BLE advertising payload builder and rotation implementation
+ */
+
+#include "BleAdvertising.h"
+
+namespace {
+
+// Eddystone-URL şema önekleri (kod = index)
+const char* const kUrlSchemes[] = {
+    "http://www.", "https://www.", "http://", "https://"
+};
+
+// Eddystone-URL uzantıları (kod = index); ".com/" ".com"dan önce denenmeli
+const char* const kUrlExpansions[] = {
+    ".com/", ".org/", ".edu/", ".net/", ".info/", ".biz/", ".gov/",
+    ".com", ".org", ".edu", ".net", ".info", ".biz", ".gov"
+};
+
+const uint8_t kUrlMaxEncoded = 17;
+
+bool startsWith(const char* s, const char* prefix, size_t& len) {
+    len = strlen(prefix);
+    return strncmp(s, prefix, len) == 0;
+}
+
+} // namespace
+
+// ============================================================================
+// AD fields
+// ============================================================================
+
+bool BleAdvPayload::beginField(uint8_t type, uint8_t len) {
+    // length byte + type byte + data
+    if (static_cast<uint16_t>(len) + 2 > remaining()) return false;
+    put(len + 1);
+    put(type);
+    return true;
+}
+
+bool BleAdvPayload::addField(uint8_t type, const uint8_t* data, uint8_t len) {
+    if (!beginField(type, len)) return false;
+    memcpy(_data + _length, data, len);
+    _length += len;
+    return true;
+}
+
+bool BleAdvPayload::addFlags(uint8_t flags) {
+    return addField(BLE_AD_FLAGS, &flags, 1);
+}
+
+bool BleAdvPayload::addTxPower(int8_t dbm) {
+    uint8_t value = static_cast<uint8_t>(dbm);
+    return addField(BLE_AD_TX_POWER, &value, 1);
+}
+
+bool BleAdvPayload::addServiceUuid16(uint16_t uuid) {
+    if (!beginField(BLE_AD_UUID16_COMPLETE, 2)) return false;
+    put(uuid & 0xFF);
+    put(uuid >> 8);
+    return true;
+}
+
+bool BleAdvPayload::addName(const char* name) {
+    if (name == nullptr) return false;
+    size_t len = strlen(name);
+    if (len + 2 <= remaining()) {
+        return addField(BLE_AD_NAME_COMPLETE, reinterpret_cast<const uint8_t*>(name),
+                        static_cast<uint8_t>(len));
+    }
+    if (remaining() < 3) return false;
+    return addField(BLE_AD_NAME_SHORT, reinterpret_cast<const uint8_t*>(name), remaining() - 2);
+}
+
+bool BleAdvPayload::addManufacturerData(uint16_t companyId, const uint8_t* data, uint8_t len) {
+    if (static_cast<uint16_t>(len) + 2 > UINT8_MAX) return false;
+    if (!beginField(BLE_AD_MANUFACTURER, len + 2)) return false;
+    put(companyId & 0xFF);
+    put(companyId >> 8);
+    memcpy(_data + _length, data, len);
+    _length += len;
+    return true;
+}
+
+bool BleAdvPayload::addServiceData16(uint16_t uuid, const uint8_t* data, uint8_t len) {
+    if (static_cast<uint16_t>(len) + 2 > UINT8_MAX) return false;
+    if (!beginField(BLE_AD_SERVICE_DATA16, len + 2)) return false;
+    put(uuid & 0xFF);
+    put(uuid >> 8);
+    memcpy(_data + _length, data, len);
+    _length += len;
+    return true;
+}
+
+// ============================================================================
+// Beacons
+// ============================================================================
+
+bool BleAdvPayload::setIBeacon(const uint8_t uuid[16], uint16_t major, uint16_t minor,
+                               int8_t measuredPower) {
+    clear();
+    addFlags();
+
+    // 0x4C00 | type 0x02 | length 0x15 | UUID | major | minor | power = 30 byte
+    beginField(BLE_AD_MANUFACTURER, 25);
+    put(BLE_COMPANY_APPLE & 0xFF);
+    put(BLE_COMPANY_APPLE >> 8);
+    put(0x02);
+    put(0x15);
+    memcpy(_data + _length, uuid, 16);
+    _length += 16;
+    putBe16(major);
+    putBe16(minor);
+    put(static_cast<uint8_t>(measuredPower));
+    return true;
+}
+
+bool BleAdvPayload::beginEddystone(uint8_t frameLen) {
+    clear();
+    addFlags();
+    addServiceUuid16(BLE_UUID16_EDDYSTONE);
+    if (!beginField(BLE_AD_SERVICE_DATA16, frameLen + 2)) {
+        clear();
+        return false;
+    }
+    put(BLE_UUID16_EDDYSTONE & 0xFF);
+    put(BLE_UUID16_EDDYSTONE >> 8);
+    return true;
+}
+
+bool BleAdvPayload::setEddystoneUid(const uint8_t ns[10], const uint8_t instance[6],
+                                    int8_t txPower0m) {
+    if (!beginEddystone(20)) return false;
+    put(0x00);
+    put(static_cast<uint8_t>(txPower0m));
+    memcpy(_data + _length, ns, 10);
+    _length += 10;
+    memcpy(_data + _length, instance, 6);
+    _length += 6;
+    put(0x00);      // RFU
+    put(0x00);
+    return true;
+}
+
+bool BleAdvPayload::setEddystoneUrl(const char* url, int8_t txPower0m) {
+    if (url == nullptr) return false;
+
+    size_t len = 0;
+    uint8_t scheme = 0xFF;
+    for (uint8_t i = 0; i < sizeof(kUrlSchemes) / sizeof(kUrlSchemes[0]); i++) {
+        if (startsWith(url, kUrlSchemes[i], len)) {
+            scheme = i;
+            url += len;
+            break;
+        }
+    }
+    if (scheme == 0xFF) return false;
+
+    // Önce ayrı buffer'a kodla: uzunluk belli olmadan AD header yazılamaz
+    uint8_t encoded[kUrlMaxEncoded];
+    uint8_t count = 0;
+    while (*url != '\0') {
+        if (count >= kUrlMaxEncoded) return false;
+        uint8_t code = 0xFF;
+        for (uint8_t i = 0; i < sizeof(kUrlExpansions) / sizeof(kUrlExpansions[0]); i++) {
+            if (startsWith(url, kUrlExpansions[i], len)) {
+                code = i;
+                break;
+            }
+        }
+        if (code != 0xFF) {
+            encoded[count++] = code;
+            url += len;
+        } else {
+            encoded[count++] = static_cast<uint8_t>(*url++);
+        }
+    }
+
+    if (!beginEddystone(3 + count)) return false;
+    put(0x10);
+    put(static_cast<uint8_t>(txPower0m));
+    put(scheme);
+    memcpy(_data + _length, encoded, count);
+    _length += count;
+    return true;
+}
+
+bool BleAdvPayload::setEddystoneTlm(uint16_t batteryMv, int16_t temperatureQ8,
+                                    uint32_t advCount, uint32_t uptimeDs) {
+    if (!beginEddystone(14)) return false;
+    put(0x20);
+    put(0x00);      // Unencrypted TLM
+    putBe16(batteryMv);
+    putBe16(static_cast<uint16_t>(temperatureQ8));
+    putBe32(advCount);
+    putBe32(uptimeDs);
+    return true;
+}
+
+// ============================================================================
+// Rotation
+// ============================================================================
+
+BleAdvRotation::BleAdvRotation()
+    : _count(0)
+    , _active(-1)
+    , _enteredMs(0)
+    , _dirty(false)
+    , _stats{0, 0, 0, 0}
+{
+    clear();
+}
+
+void BleAdvRotation::clear() {
+    for (uint8_t i = 0; i < BLE_ADV_ROTATION_SLOTS; i++) {
+        _slots[i] = Slot();
+    }
+    _count = 0;
+    _active = -1;
+    _dirty = false;
+}
+
+int BleAdvRotation::insert(uint16_t dwellMs) {
+    for (uint8_t i = 0; i < BLE_ADV_ROTATION_SLOTS; i++) {
+        if (_slots[i].used) continue;
+        _slots[i].encoder = nullptr;
+        _slots[i].user = nullptr;
+        _slots[i].dwellMs = dwellMs ? dwellMs : 1;
+        _slots[i].used = true;
+        _count++;
+        return i;
+    }
+    return -1;
+}
+
+int BleAdvRotation::add(const BleAdvPayload& payload, uint16_t dwellMs) {
+    int slot = insert(dwellMs);
+    if (slot >= 0) _slots[slot].payload = payload;
+    return slot;
+}
+
+int BleAdvRotation::add(BleAdvEncoder encoder, void* user, uint16_t dwellMs) {
+    if (encoder == nullptr) return -1;
+    int slot = insert(dwellMs);
+    if (slot < 0) return -1;
+    _slots[slot].encoder = encoder;
+    _slots[slot].user = user;
+    return slot;
+}
+
+bool BleAdvRotation::update(int slot, const BleAdvPayload& payload) {
+    if (slot < 0 || slot >= BLE_ADV_ROTATION_SLOTS || !_slots[slot].used ||
+        _slots[slot].encoder != nullptr) {
+        return false;
+    }
+    _slots[slot].payload = payload;
+    if (slot == _active) _dirty = true;
+    return true;
+}
+
+bool BleAdvRotation::remove(int slot) {
+    if (slot < 0 || slot >= BLE_ADV_ROTATION_SLOTS || !_slots[slot].used) return false;
+    _slots[slot].used = false;
+    _count--;
+    if (slot == _active) _dirty = true;
+    return true;
+}
+
+bool BleAdvRotation::load(int slot) {
+    Slot& s = _slots[slot];
+    if (!s.used) return false;
+    if (s.encoder == nullptr) return true;
+
+    s.payload.clear();
+    _stats.encodes++;
+    return s.encoder(s.payload, s.user);
+}
+
+bool BleAdvRotation::poll(unsigned long nowMs) {
+    if (_count == 0) return false;
+
+    bool expired = _active < 0 || !_slots[_active].used ||
+                   nowMs - _enteredMs >= _slots[_active].dwellMs;
+    if (!expired && !_dirty) return false;
+    _dirty = false;
+
+    // Süre dolduysa sıradaki slot (tek slot varsa kendisi yeniden encode edilir)
+    int start = expired ? _active + 1 : _active;
+    int next = -1;
+    for (uint8_t i = 0; i < BLE_ADV_ROTATION_SLOTS; i++) {
+        int slot = (start + i) % BLE_ADV_ROTATION_SLOTS;
+        if (load(slot)) {
+            next = slot;
+            break;
+        }
+    }
+    if (next < 0) return false;
+
+    if (next != _active) _stats.rotations++;
+    _active = next;
+    _enteredMs = nowMs;
+
+    const BleAdvPayload& payload = _slots[next].payload;
+    if (payload == _current) {
+        _stats.unchanged++;
+        return false;
+    }
+    _current = payload;
+    _stats.updates++;
+    return true;
+}
@@ -0,0 +1,225 @@
+/**
+ * @file BleAdvertising.h
+ * @brief Heap-free BLE advertising payload builder and payload rotation
+ *
+ * BleAdvPayload: legacy advertising PDU'nun 31 byte'lık AD (length, type,
+ * data) alanını sabit buffer'a yazar. Sığmayan alan eklenmez ve false
+ * döner; buffer tutarlı kalır. Hazır beacon formatları:
+ * - iBeacon (Apple manufacturer data, 0x4C00 / 0x02 0x15)
+ * - Eddystone UID / URL / TLM (service data, UUID 0xFEAA)
+ *
+ * BleAdvRotation: sabit sayıda slot arasında dwell süresiyle döner
+ * (ör. Eddystone-UID + TLM + iBeacon). Encoder'lı slot her sırası geldiğinde
+ * yeniden encode edilir; sensör verisi advertising durdurulmadan güncellenir.
+ * poll() sadece yayındaki byte'lar değiştiğinde true döner.
+ *
+ * Her iki sınıf SDK'dan bağımsızdır; host build'de aynen çalışır.
+ *
+ * Kullanım:
+ *   BleAdvPayload p;
+ *   p.setIBeacon(uuid, 1, 42, -59);
+ *   ble.setAdvertisingData(p);
+ *
+ *   ble.addRotatingPayload(encodeTlm, nullptr, 1000);
+ *   void loop() { ble.poll(); ... }
+ */
+
+#ifndef BLE_ADVERTISING_H
+#define BLE_ADVERTISING_H
+
+#include <Arduino.h>
+
+// Legacy advertising / scan response data uzunluğu
+#define BLE_ADV_MAX_LEN                 31
+
+// Rotation slot sayısı
+#ifndef BLE_ADV_ROTATION_SLOTS
+    #define BLE_ADV_ROTATION_SLOTS      4
+#endif
+
+// AD type
+#define BLE_AD_FLAGS                    0x01
+#define BLE_AD_UUID16_INCOMPLETE        0x02
+#define BLE_AD_UUID16_COMPLETE          0x03
+#define BLE_AD_NAME_SHORT               0x08
+#define BLE_AD_NAME_COMPLETE            0x09
+#define BLE_AD_TX_POWER                 0x0A
+#define BLE_AD_SERVICE_DATA16           0x16
+#define BLE_AD_MANUFACTURER             0xFF
+
+// Flags: LE General Discoverable + BR/EDR Not Supported
+#define BLE_ADV_FLAGS_GENERAL           0x06
+
+#define BLE_COMPANY_APPLE               0x004C
+#define BLE_UUID16_EDDYSTONE            0xFEAA
+
+/**
+ * @brief 31 byte AD payload (POD, kopyalanabilir)
+ */
+class BleAdvPayload {
+public:
+    BleAdvPayload() : _length(0) {}
+
+    void clear() { _length = 0; }
+
+    const uint8_t* data() const { return _data; }
+    uint8_t length() const { return _length; }
+    uint8_t remaining() const { return BLE_ADV_MAX_LEN - _length; }
+
+    bool operator==(const BleAdvPayload& other) const {
+        return _length == other._length && memcmp(_data, other._data, _length) == 0;
+    }
+    bool operator!=(const BleAdvPayload& other) const { return !(*this == other); }
+
+    // ========================================================================
+    // AD fields
+    // ========================================================================
+
+    /**
+     * @brief Ham AD alanı ekle
+     * @return false: sığmıyor (payload değişmez)
+     */
+    bool addField(uint8_t type, const uint8_t* data, uint8_t len);
+
+    bool addFlags(uint8_t flags = BLE_ADV_FLAGS_GENERAL);
+    bool addTxPower(int8_t dbm);
+    bool addServiceUuid16(uint16_t uuid);
+
+    /**
+     * @brief Cihaz adı; tamamı sığmazsa kalan yere kısaltılmış ad (0x08) yazılır
+     */
+    bool addName(const char* name);
+
+    /**
+     * @brief Manufacturer specific data (company id little-endian)
+     */
+    bool addManufacturerData(uint16_t companyId, const uint8_t* data, uint8_t len);
+
+    /**
+     * @brief 16-bit UUID service data
+     */
+    bool addServiceData16(uint16_t uuid, const uint8_t* data, uint8_t len);
+
+    // ========================================================================
+    // Beacons (payload'ı baştan yazar)
+    // ========================================================================
+
+    /**
+     * @param measuredPower 1 m'deki RSSI (dBm)
+     */
+    bool setIBeacon(const uint8_t uuid[16], uint16_t major, uint16_t minor, int8_t measuredPower);
+
+    /**
+     * @param txPower0m 0 m'deki RSSI (dBm, tipik: 1 m değeri + 41)
+     */
+    bool setEddystoneUid(const uint8_t ns[10], const uint8_t instance[6], int8_t txPower0m);
+
+    /**
+     * @brief Eddystone-URL: şema ve .com/.org/... uzantıları tek byte'a kodlanır
+     * @return false: desteklenmeyen şema veya kodlanmış URL 17 byte'ı aşıyor
+     */
+    bool setEddystoneUrl(const char* url, int8_t txPower0m);
+
+    /**
+     * @brief Eddystone-TLM (unencrypted)
+     * @param batteryMv 0: bilinmiyor
+     * @param temperatureQ8 8.8 fixed point °C (0x8000: bilinmiyor)
+     * @param advCount Açılıştan beri advertising PDU sayısı
+     * @param uptimeDs Açılıştan beri geçen süre (0.1 s)
+     */
+    bool setEddystoneTlm(uint16_t batteryMv, int16_t temperatureQ8,
+                         uint32_t advCount, uint32_t uptimeDs);
+
+private:
+    bool beginField(uint8_t type, uint8_t len);
+    void put(uint8_t b) { _data[_length++] = b; }
+    void putBe16(uint16_t v) { put(v >> 8); put(v & 0xFF); }
+    void putBe32(uint32_t v) { putBe16(v >> 16); putBe16(v & 0xFFFF); }
+    bool beginEddystone(uint8_t frameLen);
+
+    uint8_t _data[BLE_ADV_MAX_LEN];
+    uint8_t _length;
+};
+
+/**
+ * @brief Rotation slot'unu yeniden encode eden callback (poll() context'i)
+ *
+ * payload boş gelir; false dönerse slot bu tur atlanır.
+ */
+typedef bool (*BleAdvEncoder)(BleAdvPayload& payload, void* user);
+
+struct BleAdvRotationStats {
+    uint32_t rotations;     // Slot değişimi
+    uint32_t encodes;       // Encoder çağrısı
+    uint32_t updates;       // Yayındaki byte'lar değişti (controller'a yazıldı)
+    uint32_t unchanged;     // Encode sonucu aynıydı, controller'a gidilmedi
+};
+
+/**
+ * @brief Sabit slot'lu payload rotation
+ */
+class BleAdvRotation {
+public:
+    BleAdvRotation();
+
+    void clear();
+
+    /**
+     * @brief Sabit payload slot'u
+     * @param dwellMs Slot'ta kalma süresi (0 = 1 ms)
+     * @return Slot id, yer yoksa -1
+     */
+    int add(const BleAdvPayload& payload, uint16_t dwellMs);
+
+    /**
+     * @brief Sırası geldiğinde encoder ile yeniden üretilen slot
+     */
+    int add(BleAdvEncoder encoder, void* user, uint16_t dwellMs);
+
+    /**
+     * @brief Sabit slot'un içeriğini değiştir (aktifse sonraki poll()'da yayına girer)
+     */
+    bool update(int slot, const BleAdvPayload& payload);
+
+    bool remove(int slot);
+
+    uint8_t getCount() const { return _count; }
+
+    /**
+     * @brief Dwell süresi dolduysa sonraki slot'a geç
+     * @return true: current() değişti, controller'a yazılmalı
+     */
+    bool poll(unsigned long nowMs);
+
+    const BleAdvPayload& current() const { return _current; }
+    int getCurrentSlot() const { return _active; }
+
+    /**
+     * @brief Sonraki poll()'da aktif slot'u yeniden değerlendir
+     */
+    void invalidate() { _dirty = true; }
+
+    const BleAdvRotationStats& getStats() const { return _stats; }
+
+private:
+    struct Slot {
+        BleAdvPayload payload;
+        BleAdvEncoder encoder;
+        void* user;
+        uint16_t dwellMs;
+        bool used;
+    };
+
+    int insert(uint16_t dwellMs);
+    bool load(int slot);
+
+    Slot _slots[BLE_ADV_ROTATION_SLOTS];
+    BleAdvPayload _current;
+    uint8_t _count;
+    int _active;
+    unsigned long _enteredMs;
+    bool _dirty;
+    BleAdvRotationStats _stats;
+};
+
+#endif // BLE_ADVERTISING_H
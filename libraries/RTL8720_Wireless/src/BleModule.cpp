@@ -0,0 +1,906 @@
+/**
+ * @file BleModule.cpp
+ * @brief BLE module implementation (AmebaD GAP advertising / scanning / GATT stream)
+ */
+
+#include "BleModule.h"
+#include <SerialManager.h>
+
+extern "C" {
+#include "gap.h"
+#include "gap_le.h"
+#include "gap_adv.h"
+#include "gap_scan.h"
+#include "gap_conn_le.h"
+#include "gap_config.h"
+#include "gap_msg.h"
+#include "app_msg.h"
+#include "profile_server.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "wifi_conf.h"
+#include "os_msg.h"
+#include "os_task.h"
+#include "bte.h"
+#include "trace_app.h"
+void bt_coex_init(void);
+}
+#endif
+
+// 1M PHY advertising PDU: preamble 1 + access address 4 + header 2 + AdvA 6 + CRC 3
+#define BLE_ADV_PDU_OVERHEAD        16
+#define BLE_ADV_BYTE_US             8
+
+// Bağlanabilir / taranabilir PDU sonrası request için RX penceresi (T_IFS + SCAN_REQ)
+#define BLE_ADV_RX_WINDOW_US        150
+
+// Spec: her event'e 0-10 ms rastgele advDelay eklenir (ortalama 5 ms)
+#define BLE_ADV_DELAY_AVG_MS        5
+
+#define BLE_SCAN_QUEUE_MASK         (BLE_SCAN_QUEUE_SIZE - 1)
+
+static_assert((BLE_SCAN_QUEUE_SIZE & BLE_SCAN_QUEUE_MASK) == 0,
+              "BLE_SCAN_QUEUE_SIZE must be a power of two");
+
+/**
+ * @brief GAP task'ından BleModule'ün private üyelerine erişim
+ */
+struct BleModuleAccess {
+    static void stackReady(BleModule& module) { module.onStackReady(); }
+    static void scanIdle(BleModule& module) { module.onScanIdle(); }
+    static void scanReport(BleModule& module, const BleScanReport& report) {
+        module.onScanReport(report);
+    }
+    static void connected(BleModule& module, uint8_t connId) { module.onConnected(connId); }
+    static void disconnected(BleModule& module, uint16_t cause) { module.onDisconnected(cause); }
+    static void linkUpdate(BleModule& module, uint16_t mtu, uint16_t txOctets, uint8_t phy) {
+        module.onLinkUpdate(mtu, txOctets, phy);
+    }
+    static void subscribe(BleModule& module, bool enabled) { module.onSubscribe(enabled); }
+    static void streamFrame(BleModule& module, const uint8_t* data, uint16_t length) {
+        module._streamRx.onFrame(data, length);
+    }
+};
+
+namespace {
+
+uint16_t intervalUnits(uint16_t ms) {
+    // 0.625 ms birim
+    return static_cast<uint16_t>(static_cast<uint32_t>(ms) * 8 / 5);
+}
+
+uint8_t eventType(BleAdvMode mode) {
+    switch (mode) {
+        case BleAdvMode::Scannable:      return GAP_ADTYPE_ADV_SCAN_IND;
+        case BleAdvMode::NonConnectable: return GAP_ADTYPE_ADV_NONCONN_IND;
+        default:                         return GAP_ADTYPE_ADV_IND;
+    }
+}
+
+BleModule* g_module = nullptr;
+T_SERVER_ID g_streamService = 0;
+
+// Stream servisi: 5A2D0001-8720-4E1A-9C6B-3F0D5B1E7A10 (little-endian)
+#define BLE_STREAM_UUID(id)     0x10, 0x7A, 0x1E, 0x5B, 0x0D, 0x3F, 0x6B, 0x9C, \
+                                0x1A, 0x4E, 0x20, 0x87, (id), 0x00, 0x2D, 0x5A
+
+uint8_t kStreamServiceUuid[UUID_128BIT_SIZE] = { BLE_STREAM_UUID(0x01) };
+
+enum StreamAttr : uint16_t {
+    kAttrService = 0,
+    kAttrRxDecl,
+    kAttrRxValue,           // Write command: karşı taraftan gelen frame'ler
+    kAttrTxDecl,
+    kAttrTxValue,           // Notify: stream frame'leri
+    kAttrTxCccd
+};
+
+T_ATTRIB_APPL kStreamAttrs[] = {
+    { (ATTRIB_FLAG_VOID | ATTRIB_FLAG_LE),
+      { LO_WORD(GATT_UUID_PRIMARY_SERVICE), HI_WORD(GATT_UUID_PRIMARY_SERVICE) },
+      UUID_128BIT_SIZE, kStreamServiceUuid, GATT_PERM_READ },
+
+    { ATTRIB_FLAG_VALUE_INCL,
+      { LO_WORD(GATT_UUID_CHARACTERISTIC), HI_WORD(GATT_UUID_CHARACTERISTIC),
+        (GATT_CHAR_PROP_WRITE_NO_RSP | GATT_CHAR_PROP_WRITE) },
+      1, nullptr, GATT_PERM_READ },
+    { (ATTRIB_FLAG_VALUE_APPL | ATTRIB_FLAG_UUID_128BIT),
+      { BLE_STREAM_UUID(0x02) },
+      0, nullptr, GATT_PERM_WRITE },
+
+    { ATTRIB_FLAG_VALUE_INCL,
+      { LO_WORD(GATT_UUID_CHARACTERISTIC), HI_WORD(GATT_UUID_CHARACTERISTIC), GATT_CHAR_PROP_NOTIFY },
+      1, nullptr, GATT_PERM_READ },
+    { (ATTRIB_FLAG_VALUE_APPL | ATTRIB_FLAG_UUID_128BIT),
+      { BLE_STREAM_UUID(0x03) },
+      0, nullptr, GATT_PERM_NONE },
+    { (ATTRIB_FLAG_VALUE_INCL | ATTRIB_FLAG_CCCD_APPL),
+      { LO_WORD(GATT_UUID_CHAR_CLIENT_CONFIG), HI_WORD(GATT_UUID_CHAR_CLIENT_CONFIG),
+        LO_WORD(GATT_CLIENT_CHAR_CONFIG_DEFAULT), HI_WORD(GATT_CLIENT_CHAR_CONFIG_DEFAULT) },
+      2, nullptr, (GATT_PERM_READ | GATT_PERM_WRITE) }
+};
+
+uint8_t phyValue(T_GAP_PHYS_TYPE phy) {
+    return phy == GAP_PHYS_2M ? 2 : 1;
+}
+
+T_APP_RESULT gapCallback(uint8_t type, void* data) {
+    // GAP task context'i (host: scheduler)
+    if (g_module == nullptr) return APP_RESULT_SUCCESS;
+
+    switch (type) {
+        case GAP_MSG_LE_SCAN_INFO: {
+            const T_LE_SCAN_INFO* info = static_cast<T_LE_CB_DATA*>(data)->p_le_scan_info;
+            BleScanReport report;
+            memcpy(report.addr, info->bd_addr, sizeof(report.addr));
+            report.addrType = static_cast<uint8_t>(info->remote_addr_type);
+            report.advType = static_cast<uint8_t>(info->adv_type);
+            report.rssi = info->rssi;
+            report.length = info->data_len > BLE_ADV_MAX_LEN ? BLE_ADV_MAX_LEN : info->data_len;
+            memcpy(report.data, info->data, report.length);
+            BleModuleAccess::scanReport(*g_module, report);
+            break;
+        }
+        case GAP_MSG_LE_DATA_LEN_CHANGE_INFO: {
+            const T_LE_DATA_LEN_CHANGE_INFO* info = static_cast<T_LE_DATA_LEN_CHANGE_INFO*>(data);
+            BleModuleAccess::linkUpdate(*g_module, 0, info->max_tx_octets, 0);
+            break;
+        }
+        case GAP_MSG_LE_PHY_UPDATE_INFO: {
+            const T_LE_PHY_UPDATE_INFO* info = static_cast<T_LE_PHY_UPDATE_INFO*>(data);
+            if (info->cause == 0) {
+                BleModuleAccess::linkUpdate(*g_module, 0, 0, phyValue(info->tx_phy));
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return APP_RESULT_SUCCESS;
+}
+
+T_APP_RESULT streamWrite(uint8_t connId, T_SERVER_ID serviceId, uint16_t index,
+                         T_WRITE_TYPE type, uint16_t length, uint8_t* value,
+                         P_FUN_WRITE_IND_POST_PROC* postProc) {
+    (void)connId;
+    (void)serviceId;
+    (void)type;
+    if (postProc != nullptr) *postProc = nullptr;
+    if (index == kAttrRxValue && g_module != nullptr) {
+        BleModuleAccess::streamFrame(*g_module, value, length);
+    }
+    return APP_RESULT_SUCCESS;
+}
+
+void streamCccd(uint8_t connId, T_SERVER_ID serviceId, uint16_t index, uint16_t bits) {
+    (void)connId;
+    (void)serviceId;
+    if (index == kAttrTxCccd && g_module != nullptr) {
+        BleModuleAccess::subscribe(*g_module, (bits & GATT_CLIENT_CHAR_CONFIG_NOTIFY) != 0);
+    }
+}
+
+T_APP_RESULT serverCallback(T_SERVER_ID serviceId, void* data) {
+    // Credit'ler poll() içinde le_get_gap_param ile okunur
+    (void)serviceId;
+    (void)data;
+    return APP_RESULT_SUCCESS;
+}
+
+const T_FUN_GATT_SERVICE_CBS kStreamCallbacks = { nullptr, streamWrite, streamCccd };
+
+void registerServices() {
+    server_init(1);
+    server_register_app_cb(serverCallback);
+    server_add_service(&g_streamService, reinterpret_cast<uint8_t*>(kStreamAttrs),
+                       sizeof(kStreamAttrs), kStreamCallbacks);
+}
+
+void handleGapMessage(T_IO_MSG* msg) {
+    T_LE_GAP_MSG gapMsg;
+    memcpy(&gapMsg, &msg->u.param, sizeof(msg->u.param));
+    if (g_module == nullptr) return;
+
+    switch (msg->subtype) {
+        case GAP_MSG_LE_DEV_STATE_CHANGE: {
+            T_GAP_DEV_STATE state = gapMsg.msg_data.gap_dev_state_change.new_state;
+            if (state.gap_init_state == GAP_INIT_STATE_STACK_READY) {
+                BleModuleAccess::stackReady(*g_module);
+            }
+            if (state.gap_scan_state == GAP_SCAN_STATE_IDLE) {
+                BleModuleAccess::scanIdle(*g_module);
+            }
+            break;
+        }
+        case GAP_MSG_LE_CONN_STATE_CHANGE: {
+            const T_GAP_CONN_STATE_CHANGE& change = gapMsg.msg_data.gap_conn_state_change;
+            if (change.new_state == GAP_CONN_STATE_CONNECTED) {
+                BleModuleAccess::connected(*g_module, change.conn_id);
+            } else if (change.new_state == GAP_CONN_STATE_DISCONNECTED) {
+                BleModuleAccess::disconnected(*g_module, change.disc_cause);
+            }
+            break;
+        }
+        case GAP_MSG_LE_CONN_MTU_INFO:
+            BleModuleAccess::linkUpdate(*g_module, gapMsg.msg_data.gap_conn_mtu_info.mtu_size, 0, 0);
+            break;
+        default:
+            break;
+    }
+}
+
+#if !defined(RTL8720_HOST)
+
+void* g_appTask = nullptr;
+void* g_evtQueue = nullptr;
+void* g_ioQueue = nullptr;
+
+const uint8_t kMaxGapMessages = 0x20;
+const uint8_t kMaxIoMessages = 0x20;
+const uint8_t kMaxEvents = kMaxGapMessages + kMaxIoMessages;
+
+void appTask(void* param) {
+    (void)param;
+    uint8_t event;
+
+    gap_start_bt_stack(g_evtQueue, g_ioQueue, kMaxGapMessages);
+    for (;;) {
+        if (!os_msg_recv(g_evtQueue, &event, 0xFFFFFFFF)) continue;
+        if (event == EVENT_IO_TO_APP) {
+            T_IO_MSG msg;
+            if (os_msg_recv(g_ioQueue, &msg, 0) && msg.type == IO_MSG_TYPE_BT_STATUS) {
+                handleGapMessage(&msg);
+            }
+        } else {
+            gap_handle_msg(event);
+        }
+    }
+}
+
+bool startStack(const char* deviceName, bool peripheral) {
+    if (g_appTask != nullptr) return true;
+
+    // BT coex WiFi sürücüsüne bağlı: WiFi kapalıysa station modunda aç
+    if (!wifi_is_up(RTW_STA_INTERFACE) && !wifi_is_up(RTW_AP_INTERFACE)) {
+        wifi_on(RTW_MODE_STA);
+    }
+
+    bt_trace_init();
+    gap_config_max_mtu_size(BLE_GATT_MTU);
+    if (!bte_init()) return false;
+    le_gap_init(1);
+
+    uint8_t name[GAP_DEVICE_NAME_LEN] = {0};
+    strncpy(reinterpret_cast<char*>(name), deviceName, GAP_DEVICE_NAME_LEN - 1);
+    le_set_gap_param(GAP_PARAM_DEVICE_NAME, GAP_DEVICE_NAME_LEN, name);
+    // Peripheral da MTU exchange başlatsın: bazı telefonlar hiç başlatmaz
+    uint8_t mtuReq = 1;
+    le_set_gap_param(GAP_PARAM_SLAVE_INIT_GATT_MTU_REQ, sizeof(mtuReq), &mtuReq);
+    le_register_app_cb(gapCallback);
+    if (peripheral) registerServices();
+
+    os_msg_queue_create(&g_ioQueue, kMaxIoMessages, sizeof(T_IO_MSG));
+    os_msg_queue_create(&g_evtQueue, kMaxEvents, sizeof(uint8_t));
+    os_task_create(&g_appTask, "ble_app", appTask, nullptr, 256 * 4, 1);
+    bt_coex_init();
+    return true;
+}
+
+#endif
+
+} // namespace
+
+BleModule::BleModule()
+    : _state(BleConnectionState::Idle)
+    , _role(BleRole::Peripheral)
+    , _advMode(BleAdvMode::Connectable)
+    , _advIntervalMs(BLE_ADV_INTERVAL_MS)
+    , _stackReady(false)
+    , _advPending(false)
+    , _advDataUpdates(0)
+    , _advEvents(0)
+    , _advSinceMs(0)
+    , _scanConfig(defaultScanConfig())
+    , _scanHead(0)
+    , _scanTail(0)
+    , _scanDrops(0)
+    , _scanning(false)
+    , _scanPending(false)
+    , _scanStopping(false)
+    , _scanRestart(false)
+    , _scanOriginMs(0)
+    , _scanStartMs(0)
+    , _scanDurationMs(0)
+    , _scanExpireMs(0)
+    , _link{BLE_STREAM_DEFAULT_MTU, 27, 1, 0, 0}
+    , _connId(0)
+    , _streamSubscribed(false)
+    , _streamRestart(false)
+    , _advResume(false)
+{
+}
+
+// ============================================================================
+// Initialization
+// ============================================================================
+
+bool BleModule::begin(const char* deviceName, BleRole role) {
+    _deviceName = deviceName;
+    _role = role;
+
+    // Default payload: flags + ad (sığmazsa kısaltılmış)
+    _advData.clear();
+    _advData.addFlags();
+    _advData.addName(deviceName);
+
+    g_module = this;
+#if defined(RTL8720_HOST)
+    gap_config_max_mtu_size(BLE_GATT_MTU);
+    gap_host_set_io_handler(handleGapMessage);
+    le_register_app_cb(gapCallback);
+    if (_role == BleRole::Peripheral) registerServices();
+    _stackReady = true;
+#else
+    if (!startStack(deviceName, _role == BleRole::Peripheral)) {
+        DEBUG_SERIAL.println("[BLE] Error: stack init failed");
+        return false;
+    }
+#endif
+
+    DEBUG_SERIAL.print("[BLE] Initialized as: ");
+    DEBUG_SERIAL.println(_deviceName);
+    DEBUG_SERIAL.print("[BLE] Role: ");
+    DEBUG_SERIAL.println(_role == BleRole::Peripheral ? "Peripheral" : "Central");
+
+    return true;
+}
+
+void BleModule::end() {
+    _advResume = false;
+    disconnect();
+    stopAdvertising();
+    stopScan();
+    setState(BleConnectionState::Idle);
+    DEBUG_SERIAL.println("[BLE] Disabled");
+}
+
+void BleModule::onStackReady() {
+    // GAP task context'i
+    _stackReady = true;
+    if (_advPending) {
+        _advPending = false;
+        if (applyAdvertisingParams()) {
+            le_adv_start();
+        }
+    }
+    if (_scanPending) {
+        _scanPending = false;
+        if (applyScanParams() && le_scan_start() == GAP_CAUSE_SUCCESS) {
+            _scanOriginMs = millis();
+        }
+    }
+}
+
+void BleModule::poll() {
+    if (_rotation.poll(millis())) {
+        pushAdvertisingData(_rotation.current());
+    }
+
+    if (_streamRestart) {
+        _streamRestart = false;
+        _stream.restart();
+    }
+
+    if (isStreamReady()) {
+        uint8_t credits = 0;
+        le_get_gap_param(GAP_PARAM_LE_REMAIN_CREDITS, &credits);
+        _stream.setMtu(_link.mtu);
+        _stream.pump(millis(), credits, sendStreamFrame, this);
+    }
+
+    if (!_scanning) return;
+    drainScanQueue();
+
+    unsigned long now = millis();
+    if (now - _scanExpireMs >= BLE_SCAN_EXPIRE_CHECK_MS) {
+        _scanExpireMs = now;
+        _scanCache.expire(now);
+    }
+    if (_scanDurationMs > 0 && now - _scanStartMs >= _scanDurationMs) {
+        stopScan();
+    }
+}
+
+// ============================================================================
+// Advertising
+// ============================================================================
+
+bool BleModule::startAdvertising() {
+    if (_role != BleRole::Peripheral) {
+        DEBUG_SERIAL.println("[BLE] Error: Not in Peripheral mode");
+        return false;
+    }
+    if (isAdvertising()) return true;
+
+    // Rotation varsa ilk slot hemen yayına girer
+    _rotation.invalidate();
+    _rotation.poll(millis());
+
+    if (!_stackReady) {
+        _advPending = true;
+    } else if (!applyAdvertisingParams() || le_adv_start() != GAP_CAUSE_SUCCESS) {
+        DEBUG_SERIAL.println("[BLE] Error: Advertising start failed");
+        return false;
+    }
+
+    _advSinceMs = millis();
+    setState(BleConnectionState::Advertising);
+    serialManager.logPrintf("[BLE] Advertising started (%u ms, %u byte payload)\n",
+                            _advIntervalMs,
+                            _rotation.getCount() > 0 ? _rotation.current().length() : _advData.length());
+    return true;
+}
+
+void BleModule::stopAdvertising() {
+    _advPending = false;
+    if (_state == BleConnectionState::Advertising) {
+        if (_stackReady) le_adv_stop();
+        accountAdvertisingEvents();
+        setState(BleConnectionState::Idle);
+        DEBUG_SERIAL.println("[BLE] Advertising stopped");
+    }
+}
+
+bool BleModule::setAdvertisingData(const BleAdvPayload& payload) {
+    _rotation.clear();
+    _advData = payload;
+    if (!isAdvertising() || !_stackReady) return true;
+    return pushAdvertisingData(_advData);
+}
+
+bool BleModule::setScanResponseData(const BleAdvPayload& payload) {
+    _scanRspData = payload;
+    if (!isAdvertising() || !_stackReady) return true;
+
+    le_adv_set_param(GAP_PARAM_SCAN_RSP_DATA, _scanRspData.length(),
+                     const_cast<uint8_t*>(_scanRspData.data()));
+    return le_adv_update_param() == GAP_CAUSE_SUCCESS;
+}
+
+void BleModule::setAdvertisingInterval(uint16_t intervalMs) {
+    if (intervalMs < 20) intervalMs = 20;
+    if (intervalMs > 10240) intervalMs = 10240;
+    if (intervalMs == _advIntervalMs) return;
+
+    accountAdvertisingEvents();
+    _advIntervalMs = intervalMs;
+    if (!isAdvertising() || !_stackReady) return;
+
+    uint16_t units = intervalUnits(_advIntervalMs);
+    le_adv_set_param(GAP_PARAM_ADV_INTERVAL_MIN, sizeof(units), &units);
+    le_adv_set_param(GAP_PARAM_ADV_INTERVAL_MAX, sizeof(units), &units);
+    le_adv_update_param();
+}
+
+bool BleModule::applyAdvertisingParams() {
+    uint8_t type = eventType(_advMode);
+    uint8_t channels = GAP_ADVCHAN_ALL;
+    uint16_t units = intervalUnits(_advIntervalMs);
+    const BleAdvPayload& data = _rotation.getCount() > 0 ? _rotation.current() : _advData;
+
+    le_adv_set_param(GAP_PARAM_ADV_EVENT_TYPE, sizeof(type), &type);
+    le_adv_set_param(GAP_PARAM_ADV_CHANNEL_MAP, sizeof(channels), &channels);
+    le_adv_set_param(GAP_PARAM_ADV_INTERVAL_MIN, sizeof(units), &units);
+    le_adv_set_param(GAP_PARAM_ADV_INTERVAL_MAX, sizeof(units), &units);
+    le_adv_set_param(GAP_PARAM_SCAN_RSP_DATA, _scanRspData.length(),
+                     const_cast<uint8_t*>(_scanRspData.data()));
+    return le_adv_set_param(GAP_PARAM_ADV_DATA, data.length(),
+                            const_cast<uint8_t*>(data.data())) == GAP_CAUSE_SUCCESS;
+}
+
+bool BleModule::pushAdvertisingData(const BleAdvPayload& payload) {
+    if (!isAdvertising() || !_stackReady) return false;
+
+    // Controller'a yeni data: advertising durdurulmaz, sonraki event'ten itibaren geçerli
+    if (le_adv_set_param(GAP_PARAM_ADV_DATA, payload.length(),
+                         const_cast<uint8_t*>(payload.data())) != GAP_CAUSE_SUCCESS ||
+        le_adv_update_param() != GAP_CAUSE_SUCCESS) {
+        return false;
+    }
+    _advDataUpdates++;
+    return true;
+}
+
+// ============================================================================
+// Connection
+// ============================================================================
+
+bool BleModule::connect(const char* address) {
+    if (_role != BleRole::Central) {
+        DEBUG_SERIAL.println("[BLE] Error: Not in Central mode");
+        return false;
+    }
+
+    // "AA:BB:CC:DD:EE:FF" (MSB first) -> bd_addr (LSB first)
+    uint8_t addr[6];
+    unsigned int b[6];
+    if (address == nullptr ||
+        sscanf(address, "%2x:%2x:%2x:%2x:%2x:%2x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) {
+        DEBUG_SERIAL.println("[BLE] Error: Invalid address");
+        return false;
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        addr[i] = static_cast<uint8_t>(b[5 - i]);
+    }
+
+    const BleScanDevice* device = _scanCache.find(addr);
+    T_GAP_REMOTE_ADDR_TYPE type = device != nullptr
+        ? static_cast<T_GAP_REMOTE_ADDR_TYPE>(device->addrType) : GAP_REMOTE_ADDR_LE_PUBLIC;
+
+    // Tarama ile bağlantı kurulumu aynı radyoyu paylaşır
+    stopScan();
+    if (le_connect(GAP_PHYS_CONN_INIT_1M_BIT, addr, type, GAP_LOCAL_ADDR_LE_PUBLIC, 1000) !=
+        GAP_CAUSE_SUCCESS) {
+        DEBUG_SERIAL.print("[BLE] Error: Connect failed: ");
+        DEBUG_SERIAL.println(address);
+        return false;
+    }
+
+    DEBUG_SERIAL.print("[BLE] Connecting to: ");
+    DEBUG_SERIAL.println(address);
+    return true;
+}
+
+void BleModule::disconnect() {
+    if (!isConnected()) return;
+    _advResume = false;
+    le_disconnect(_connId);
+}
+
+void BleModule::onConnected(uint8_t connId) {
+    // GAP task context'i: controller advertising'i kendisi bırakır
+    if (_state == BleConnectionState::Advertising) {
+        accountAdvertisingEvents();
+        _advResume = true;
+    }
+    _connId = connId;
+    _streamSubscribed = false;
+
+    uint16_t interval = 0;
+    le_get_conn_param(GAP_PARAM_CONN_INTERVAL, &interval, connId);
+    _link.mtu = BLE_STREAM_DEFAULT_MTU;
+    _link.txOctets = 27;
+    _link.phy = 1;
+    _link.intervalUs = static_cast<uint32_t>(interval) * 1250;
+    // Bağlantı başında tüm TX buffer'ları boş: toplam credit sayısı
+    le_get_gap_param(GAP_PARAM_LE_REMAIN_CREDITS, &_link.credits);
+
+    // Throughput için DLE + 2M PHY iste; karşı taraf desteklemezse 27 byte / 1M kalır
+    le_set_data_len(connId, BLE_LL_TX_OCTETS, BLE_LL_TX_TIME_US);
+    le_set_phy(connId, 0, GAP_PHYS_PREFER_2M_BIT, GAP_PHYS_PREFER_2M_BIT,
+               GAP_PHYS_OPTIONS_CODING_PREFER_NO);
+
+    setState(BleConnectionState::Connected);
+    serialManager.logPrintf("[BLE] Connected (interval %lu us)\n", (unsigned long)_link.intervalUs);
+}
+
+void BleModule::onDisconnected(uint16_t cause) {
+    // Ring loop() context'inde boşaltılır (poll())
+    _streamSubscribed = false;
+    _streamRestart = true;
+    setState(BleConnectionState::Disconnected);
+    serialManager.logPrintf("[BLE] Disconnected (cause 0x%03X)\n", cause);
+
+    // Peripheral: bağlantı öncesi advertising yapılıyorsa yeniden keşfedilebilir ol
+    if (_advResume && _role == BleRole::Peripheral) {
+        _advResume = false;
+        if (applyAdvertisingParams() && le_adv_start() == GAP_CAUSE_SUCCESS) {
+            _advSinceMs = millis();
+            setState(BleConnectionState::Advertising);
+        }
+    }
+}
+
+void BleModule::onLinkUpdate(uint16_t mtu, uint16_t txOctets, uint8_t phy) {
+    // 0: değişmedi
+    if (mtu > 0) _link.mtu = mtu > BLE_STREAM_MAX_MTU ? BLE_STREAM_MAX_MTU : mtu;
+    if (txOctets > 0) _link.txOctets = txOctets;
+    if (phy > 0) _link.phy = phy;
+    postLinkEvent();
+}
+
+void BleModule::postLinkEvent() {
+    Events.post(EventSource::Ble, static_cast<uint8_t>(BleEventCode::LinkUpdated), _link.mtu,
+                (static_cast<uint32_t>(_link.phy) << 16) | _link.txOctets);
+}
+
+void BleModule::onSubscribe(bool enabled) {
+    _streamSubscribed = enabled;
+    Events.post(EventSource::Ble, static_cast<uint8_t>(BleEventCode::StreamSubscribed),
+                enabled ? 1 : 0);
+}
+
+// ============================================================================
+// Streaming
+// ============================================================================
+
+size_t BleModule::streamWrite(const uint8_t* data, size_t len) {
+    return _stream.write(data, len);
+}
+
+bool BleModule::sendStreamFrame(const uint8_t* frame, uint16_t length, void* user) {
+    BleModule* module = static_cast<BleModule*>(user);
+    return server_send_data(module->_connId, g_streamService, kAttrTxValue,
+                            const_cast<uint8_t*>(frame), length, GATT_PDU_TYPE_NOTIFICATION);
+}
+
+// ============================================================================
+// Scanning
+// ============================================================================
+
+bool BleModule::beginScan(const BleScanConfig& config, uint32_t durationMs) {
+    if (_role != BleRole::Central) {
+        DEBUG_SERIAL.println("[BLE] Error: Not in Central mode");
+        return false;
+    }
+    if (_scanning) stopScan();
+
+    _scanConfig = config;
+    if (_scanConfig.intervalMs < 3) _scanConfig.intervalMs = 3;
+    if (_scanConfig.intervalMs > 10240) _scanConfig.intervalMs = 10240;
+    if (_scanConfig.windowMs == 0 || _scanConfig.windowMs > _scanConfig.intervalMs) {
+        _scanConfig.windowMs = _scanConfig.intervalMs;
+    }
+
+    // Önceki taramadan kalan raporlar yeni filtreyle işlenmesin
+    _scanTail = __atomic_load_n(&_scanHead, __ATOMIC_ACQUIRE);
+
+    if (!_stackReady) {
+        _scanPending = true;
+    } else if (!startScanStack()) {
+        DEBUG_SERIAL.println("[BLE] Error: Scan start failed");
+        return false;
+    }
+
+    _scanning = true;
+    _scanStartMs = millis();
+    _scanExpireMs = _scanStartMs;
+    _scanDurationMs = durationMs;
+    setState(BleConnectionState::Scanning);
+    serialManager.logPrintf("[BLE] Scanning (%s, %u/%u ms, %lu ms)\n",
+                            _scanConfig.mode == BleScanMode::Active ? "active" : "passive",
+                            _scanConfig.windowMs, _scanConfig.intervalMs,
+                            (unsigned long)durationMs);
+    return true;
+}
+
+bool BleModule::setScanTiming(uint16_t intervalMs, uint16_t windowMs) {
+    if (intervalMs < 3) intervalMs = 3;
+    if (intervalMs > 10240) intervalMs = 10240;
+    if (windowMs == 0 || windowMs > intervalMs) windowMs = intervalMs;
+    _scanConfig.intervalMs = intervalMs;
+    _scanConfig.windowMs = windowMs;
+
+    // Parametreler sadece tarama dururken kabul edilir; yeniden başlatma
+    // durdurma tamamlanınca (scan idle) GAP task'ında yapılır
+    if (!_scanning || !_stackReady) return true;
+    serialManager.logPrintf("[BLE] Scan timing: %u/%u ms\n", windowMs, intervalMs);
+    stopScanStack();
+    return startScanStack();
+}
+
+void BleModule::stopScan() {
+    _scanPending = false;
+    if (!_scanning) return;
+
+    if (_stackReady) stopScanStack();
+    drainScanQueue();
+    _scanning = false;
+    if (_state == BleConnectionState::Scanning) {
+        setState(BleConnectionState::Idle);
+    }
+    serialManager.logPrintf("[BLE] Scan stopped (%u devices)\n", _scanCache.size());
+}
+
+int BleModule::startScan(uint8_t duration) {
+    // beginScan()'de 0 süresiz demektir: burada beklenecek bir son olmaz
+    if (duration == 0) {
+        DEBUG_SERIAL.println("[BLE] Error: Blocking scan needs a duration");
+        return -1;
+    }
+    if (!beginScan(defaultScanConfig(), static_cast<uint32_t>(duration) * 1000)) {
+        return -1;
+    }
+    while (_scanning) {
+        poll();
+        delay(10);
+    }
+    return _scanCache.size();
+}
+
+bool BleModule::applyScanParams() {
+    uint8_t mode = _scanConfig.mode == BleScanMode::Active ? GAP_SCAN_MODE_ACTIVE
+                                                           : GAP_SCAN_MODE_PASSIVE;
+    uint16_t interval = intervalUnits(_scanConfig.intervalMs);
+    uint16_t window = intervalUnits(_scanConfig.windowMs);
+    uint8_t duplicates = _scanConfig.controllerDuplicates ? GAP_SCAN_FILTER_DUPLICATE_ENABLE
+                                                          : GAP_SCAN_FILTER_DUPLICATE_DISABLE;
+
+    le_scan_set_param(GAP_PARAM_SCAN_MODE, sizeof(mode), &mode);
+    le_scan_set_param(GAP_PARAM_SCAN_INTERVAL, sizeof(interval), &interval);
+    le_scan_set_param(GAP_PARAM_SCAN_WINDOW, sizeof(window), &window);
+    return le_scan_set_param(GAP_PARAM_SCAN_FILTER_DUPLICATES, sizeof(duplicates),
+                             &duplicates) == GAP_CAUSE_SUCCESS;
+}
+
+bool BleModule::startScanStack() {
+    // le_scan_stop() asenkron: scan idle gelmeden le_scan_start() reddedilir,
+    // başlatma onScanIdle()'a bırakılır
+    noInterrupts();
+    bool stopping = _scanStopping;
+    if (stopping) _scanRestart = true;
+    interrupts();
+    if (stopping) return true;
+    if (!applyScanParams() || le_scan_start() != GAP_CAUSE_SUCCESS) return false;
+    _scanOriginMs = millis();
+    return true;
+}
+
+void BleModule::stopScanStack() {
+    noInterrupts();
+    bool stopping = _scanStopping;
+    _scanRestart = false;
+    _scanStopping = true;
+    interrupts();
+    // Durdurma zaten sürüyorsa sadece bekleyen yeniden başlatma iptal edilir
+    if (!stopping && le_scan_stop() != GAP_CAUSE_SUCCESS) _scanStopping = false;
+}
+
+void BleModule::onScanIdle() {
+    // GAP task context'i (GAP_MSG_LE_DEV_STATE_CHANGE, scan idle)
+    noInterrupts();
+    bool restart = _scanRestart;
+    _scanRestart = false;
+    _scanStopping = false;
+    interrupts();
+    if (restart && applyScanParams() && le_scan_start() == GAP_CAUSE_SUCCESS) {
+        _scanOriginMs = millis();
+    }
+}
+
+void BleModule::onScanReport(const BleScanReport& report) {
+    // GAP task context'i: tek üretici, sadece kopyala
+    uint32_t head = _scanHead;
+    if (head - __atomic_load_n(&_scanTail, __ATOMIC_ACQUIRE) >= BLE_SCAN_QUEUE_SIZE) {
+        _scanDrops++;
+        return;
+    }
+    _scanQueue[head & BLE_SCAN_QUEUE_MASK] = report;
+    __atomic_store_n(&_scanHead, head + 1, __ATOMIC_RELEASE);
+}
+
+void BleModule::drainScanQueue() {
+    uint32_t head = __atomic_load_n(&_scanHead, __ATOMIC_ACQUIRE);
+    uint32_t now = millis();
+    while (_scanTail != head) {
+        _scanCache.process(_scanQueue[_scanTail & BLE_SCAN_QUEUE_MASK], now);
+        __atomic_store_n(&_scanTail, _scanTail + 1, __ATOMIC_RELEASE);
+    }
+}
+
+// ============================================================================
+// Payload rotation
+// ============================================================================
+
+int BleModule::addRotatingPayload(const BleAdvPayload& payload, uint16_t dwellMs) {
+    return _rotation.add(payload, dwellMs);
+}
+
+int BleModule::addRotatingPayload(BleAdvEncoder encoder, void* user, uint16_t dwellMs) {
+    return _rotation.add(encoder, user, dwellMs);
+}
+
+bool BleModule::updateRotatingPayload(int slot, const BleAdvPayload& payload) {
+    return _rotation.update(slot, payload);
+}
+
+bool BleModule::removeRotatingPayload(int slot) {
+    return _rotation.remove(slot);
+}
+
+// ============================================================================
+// Estimates
+// ============================================================================
+
+void BleModule::accountAdvertisingEvents() {
+    if (!isAdvertising()) return;
+    unsigned long now = millis();
+    _advEvents += (now - _advSinceMs) / (_advIntervalMs + BLE_ADV_DELAY_AVG_MS);
+    _advSinceMs = now;
+}
+
+uint32_t BleModule::getAdvertisingEventCount() const {
+    if (!isAdvertising()) return _advEvents;
+    return _advEvents + (millis() - _advSinceMs) / (_advIntervalMs + BLE_ADV_DELAY_AVG_MS);
+}
+
+uint32_t BleModule::getAdvertisingDutyPpm() const {
+    uint8_t length = _rotation.getCount() > 0 ? _rotation.current().length() : _advData.length();
+    uint32_t eventUs = 3 * (BLE_ADV_PDU_OVERHEAD + length) * BLE_ADV_BYTE_US;
+    if (_advMode != BleAdvMode::NonConnectable) {
+        eventUs += 3 * BLE_ADV_RX_WINDOW_US;
+    }
+    uint32_t periodUs = (static_cast<uint32_t>(_advIntervalMs) + BLE_ADV_DELAY_AVG_MS) * 1000;
+    return static_cast<uint32_t>(static_cast<uint64_t>(eventUs) * 1000000 / periodUs);
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+void BleModule::printStatus() const {
+    DEBUG_SERIAL.println("[BLE Status]");
+    DEBUG_SERIAL.print("  Device: ");
+    DEBUG_SERIAL.println(_deviceName);
+    DEBUG_SERIAL.print("  Role: ");
+    DEBUG_SERIAL.println(_role == BleRole::Peripheral ? "Peripheral" : "Central");
+    DEBUG_SERIAL.print("  State: ");
+    switch (_state) {
+        case BleConnectionState::Idle: DEBUG_SERIAL.println("Idle"); break;
+        case BleConnectionState::Advertising: DEBUG_SERIAL.println("Advertising"); break;
+        case BleConnectionState::Scanning: DEBUG_SERIAL.println("Scanning"); break;
+        case BleConnectionState::Connected: DEBUG_SERIAL.println("Connected"); break;
+        case BleConnectionState::Disconnected: DEBUG_SERIAL.println("Disconnected"); break;
+    }
+
+    if (_role == BleRole::Peripheral) {
+        const BleAdvRotationStats& stats = _rotation.getStats();
+        serialManager.logPrintf("  Advertising: %u ms, duty %lu ppm, ~%lu events, %lu data updates\n",
+                                _advIntervalMs,
+                                (unsigned long)getAdvertisingDutyPpm(),
+                                (unsigned long)getAdvertisingEventCount(),
+                                (unsigned long)_advDataUpdates);
+        if (_rotation.getCount() > 0) {
+            serialManager.logPrintf("  Rotation: %u slots, rotations %lu, encodes %lu, unchanged %lu\n",
+                                    _rotation.getCount(),
+                                    (unsigned long)stats.rotations,
+                                    (unsigned long)stats.encodes,
+                                    (unsigned long)stats.unchanged);
+        }
+    }
+
+    if (isConnected()) {
+        serialManager.logPrintf("  Link: MTU %u, LL %u bytes, %uM PHY, interval %lu us\n",
+                                _link.mtu, _link.txOctets, _link.phy,
+                                (unsigned long)_link.intervalUs);
+    }
+
+    const BleStreamStats& stream = _stream.getStats();
+    if (stream.written > 0) {
+        serialManager.logPrintf("  Stream: %lu B/s (avg %lu, estimate %lu), frames %lu, "
+                                "pending %u, stalls %lu, rejected %lu\n",
+                                (unsigned long)_stream.getRate(),
+                                (unsigned long)_stream.getAverageRate(millis()),
+                                (unsigned long)getStreamEstimate(),
+                                (unsigned long)stream.frames,
+                                (unsigned)_stream.pending(),
+                                (unsigned long)stream.creditStalls,
+                                (unsigned long)stream.rejected);
+    }
+
+    const BleScanCacheStats& scan = _scanCache.getStats();
+    if (scan.reports > 0 || _scanning) {
+        serialManager.logPrintf("  Scan: %u/%u devices, reports %lu, filtered %lu, dup %lu, "
+                                "found %lu, lost %lu, evicted %lu, queue drops %lu\n",
+                                _scanCache.size(), BleScanCache::capacity(),
+                                (unsigned long)scan.reports,
+                                (unsigned long)scan.filtered,
+                                (unsigned long)scan.duplicates,
+                                (unsigned long)scan.found,
+                                (unsigned long)scan.lost,
+                                (unsigned long)scan.evicted,
+                                (unsigned long)_scanDrops);
+    }
+}
@@ -4,14 +4,19 @@
  *
  * RTL8720DN Bluetooth Low Energy 5.0 özelliklerini saran modül.
  *
- * NOT: Bu dosya placeholder olarak oluşturulmuştur.
- * BLE implementasyonu sonradan eklenecektir.
+ * Özellikler:
+ * - Advertising (AmebaD GAP): iBeacon / Eddystone / manufacturer data
+ *   payload'ları (BleAdvertising.h), aralık kontrolü, payload rotation
+ * - Scanning (AmebaD GAP): passive / active, non-blocking; raporlar adres
+ *   anahtarlı sabit kapasiteli cache'te toplanır (BleScanCache.h)
+ * - Bağlantı: bağlantı kurulunca DLE (251 byte), 2M PHY istenir, büyük ATT
+ *   MTU kabul edilir; sonuçlar getLinkParams() ile okunur
+ * - GATT server bulk stream servisi: TX (notify) / RX (write command)
+ *   characteristic'leri, ring buffer + credit tabanlı akış kontrolü ve
+ *   kB/s ölçümü (BleStream.h)
  *
  * Planlanan özellikler:
- * - Peripheral mode (GATT Server)
- * - Central mode (GATT Client)
- * - Advertising
- * - Scanning
+ * - Central mode GATT client (service discovery, stream'e abone olma)
  * - Custom services/characteristics
  */
 
@@ -20,6 +25,48 @@
 
 #include <Arduino.h>
 #include <BoardConfig.h>
+#include <EventBus.h>
+#include "BleAdvertising.h"
+#include "BleScanCache.h"
+#include "BleStream.h"
+
+// Default advertising aralığı (ms)
+#ifndef BLE_ADV_INTERVAL_MS
+    #define BLE_ADV_INTERVAL_MS     100
+#endif
+
+// Default scan interval / window (ms); eşitse controller sürekli dinler
+#ifndef BLE_SCAN_INTERVAL_MS
+    #define BLE_SCAN_INTERVAL_MS    100
+#endif
+
+#ifndef BLE_SCAN_WINDOW_MS
+    #define BLE_SCAN_WINDOW_MS      100
+#endif
+
+// GAP task -> poll() rapor kuyruğu (2'nin kuvveti); doluysa rapor düşer
+#ifndef BLE_SCAN_QUEUE_SIZE
+    #define BLE_SCAN_QUEUE_SIZE     32
+#endif
+
+// Tarama sürerken cache expire() aralığı (ms)
+#ifndef BLE_SCAN_EXPIRE_CHECK_MS
+    #define BLE_SCAN_EXPIRE_CHECK_MS 1000
+#endif
+
+// Kabul edilen en büyük ATT MTU (<= BLE_STREAM_MAX_MTU)
+#ifndef BLE_GATT_MTU
+    #define BLE_GATT_MTU            BLE_STREAM_MAX_MTU
+#endif
+
+// Bağlantıda istenen LL TX payload (27-251 byte) ve süresi (us, 1M PHY için)
+#ifndef BLE_LL_TX_OCTETS
+    #define BLE_LL_TX_OCTETS        251
+#endif
+
+#ifndef BLE_LL_TX_TIME_US
+    #define BLE_LL_TX_TIME_US       2120
+#endif
 
 /**
  * @brief BLE bağlantı durumu
@@ -32,6 +79,19 @@ enum class BleConnectionState {
     Disconnected
 };
 
+/**
+ * @brief BLE olayı (EventSource::Ble)
+ *
+ * StateChanged: arg = yeni durum, value = önceki durum
+ * LinkUpdated : arg = ATT MTU, value = (PHY << 16) | LL TX octets
+ * StreamSubscribed: arg = 1 notification açıldı / 0 kapandı
+ */
+enum class BleEventCode : uint8_t {
+    StateChanged = 1,
+    LinkUpdated = 2,
+    StreamSubscribed = 3
+};
+
 /**
  * @brief BLE rol
  */
@@ -41,14 +101,48 @@ enum class BleRole {
 };
 
 /**
- * @brief BLE Module sınıfı (Placeholder)
+ * @brief Advertising PDU tipi
+ */
+enum class BleAdvMode : uint8_t {
+    Connectable,        // ADV_IND
+    Scannable,          // ADV_SCAN_IND (scan response, bağlantı yok)
+    NonConnectable      // ADV_NONCONN_IND (beacon, en düşük duty cycle)
+};
+
+/**
+ * @brief Tarama tipi
+ */
+enum class BleScanMode : uint8_t {
+    Passive,            // Sadece dinler
+    Active              // SCAN_REQ gönderir, scan response (ad vb.) alınır
+};
+
+/**
+ * @brief Tarama parametreleri
+ */
+struct BleScanConfig {
+    BleScanMode mode;
+    uint16_t intervalMs;        // 3-10240
+    uint16_t windowMs;          // <= intervalMs
+    bool controllerDuplicates;  // true: controller her adresi bir kez raporlar
+                                // (RSSI takibi / Lost tespiti yapılamaz)
+};
+
+/**
+ * @brief BLE Module sınıfı
  *
- * BLE işlemleri için wrapper.
- * TODO: RTL8720DN BLE API implementasyonu
+ * Advertising AmebaD BLE stack (GAP le_adv_*) üzerinde çalışır; payload
+ * BleAdvPayload ile heap kullanmadan kurulur. Rotation slot'ları poll()
+ * içinden advertising durdurulmadan (le_adv_update_param) yayına alınır.
+ * Tarama raporları GAP task'ında sabit bir kuyruğa kopyalanır, poll()
+ * içinde BleScanCache'e işlenir; Found / Lost callback'leri loop()
+ * context'inde çalışır. Stream verisi de poll() içinde controller'ın boş
+ * buffer'ı kadar notification olarak gönderilir.
+ * TODO: Central mode GATT client
  */
 class BleModule {
 public:
-    BleModule() : _state(BleConnectionState::Idle), _role(BleRole::Peripheral) {}
+    BleModule();
 
     // ========================================================================
     // Initialization
@@ -56,111 +150,179 @@ public:
 
     /**
      * @brief BLE'yi başlat
-     * @param deviceName Cihaz adı (advertising'de görünür)
+     * @param deviceName Cihaz adı (default advertising payload'ında görünür)
      * @param role BLE rolü
      */
-    bool begin(const char* deviceName = "RTL8720DN", BleRole role = BleRole::Peripheral) {
-        _deviceName = deviceName;
-        _role = role;
-
-        // TODO: BLE initialization
-        DEBUG_SERIAL.print("[BLE] Initialized as: ");
-        DEBUG_SERIAL.println(_deviceName);
-        DEBUG_SERIAL.print("[BLE] Role: ");
-        DEBUG_SERIAL.println(_role == BleRole::Peripheral ? "Peripheral" : "Central");
-
-        return true;
-    }
+    bool begin(const char* deviceName = "RTL8720DN", BleRole role = BleRole::Peripheral);
 
     /**
      * @brief BLE'yi kapat
      */
-    void end() {
-        // TODO: BLE cleanup
-        _state = BleConnectionState::Idle;
-        DEBUG_SERIAL.println("[BLE] Disabled");
-    }
+    void end();
+
+    /**
+     * @brief Payload rotation + tarama raporları + stream - loop() içinden çağrılır
+     */
+    void poll();
 
     // ========================================================================
     // Advertising (Peripheral Mode)
     // ========================================================================
 
     /**
-     * @brief Advertising başlat
+     * @brief Advertising başlat (stack henüz hazır değilse hazır olunca başlar)
      */
-    bool startAdvertising() {
-        if (_role != BleRole::Peripheral) {
-            DEBUG_SERIAL.println("[BLE] Error: Not in Peripheral mode");
-            return false;
-        }
-
-        // TODO: Start advertising
-        _state = BleConnectionState::Advertising;
-        DEBUG_SERIAL.println("[BLE] Advertising started");
-        return true;
-    }
+    bool startAdvertising();
 
     /**
      * @brief Advertising durdur
      */
-    void stopAdvertising() {
-        // TODO: Stop advertising
-        if (_state == BleConnectionState::Advertising) {
-            _state = BleConnectionState::Idle;
-            DEBUG_SERIAL.println("[BLE] Advertising stopped");
-        }
-    }
+    void stopAdvertising();
+
+    bool isAdvertising() const { return _state == BleConnectionState::Advertising; }
+
+    /**
+     * @brief Sabit advertising payload'ı (rotation slot'larını temizler)
+     *
+     * Advertising sürüyorsa yeniden başlatmadan güncellenir. begin() cihaz
+     * adı ve flags ile default payload kurar.
+     */
+    bool setAdvertisingData(const BleAdvPayload& payload);
+    bool setScanResponseData(const BleAdvPayload& payload);
+
+    /**
+     * @brief PDU tipi (sonraki startAdvertising()'de uygulanır)
+     */
+    void setAdvertisingMode(BleAdvMode mode) { _advMode = mode; }
+    BleAdvMode getAdvertisingMode() const { return _advMode; }
+
+    /**
+     * @brief Advertising aralığını ayarla (20-10240 ms, spec sınırları)
+     *
+     * Uzun aralık ortalama akımı düşürür, keşfedilme süresini uzatır.
+     * Advertising sürüyorsa durdurmadan uygulanır.
+     */
+    void setAdvertisingInterval(uint16_t intervalMs);
+
+    uint16_t getAdvertisingInterval() const { return _advIntervalMs; }
 
     // ========================================================================
-    // Scanning (Central Mode)
+    // Payload rotation
     // ========================================================================
 
     /**
-     * @brief Tarama başlat
-     * @param duration Tarama süresi (saniye)
-     * @return Bulunan cihaz sayısı
+     * @brief Rotation'a sabit payload ekle
+     * @return Slot id, yer yoksa -1
      */
-    int startScan(uint8_t duration = 5) {
-        if (_role != BleRole::Central) {
-            DEBUG_SERIAL.println("[BLE] Error: Not in Central mode");
-            return -1;
-        }
+    int addRotatingPayload(const BleAdvPayload& payload, uint16_t dwellMs);
+
+    /**
+     * @brief Sırası her geldiğinde encoder ile yeniden üretilen payload (ör. sensör)
+     */
+    int addRotatingPayload(BleAdvEncoder encoder, void* user, uint16_t dwellMs);
+
+    bool updateRotatingPayload(int slot, const BleAdvPayload& payload);
+    bool removeRotatingPayload(int slot);
+
+    const BleAdvRotation& getRotation() const { return _rotation; }
 
-        // TODO: BLE scanning
-        _state = BleConnectionState::Scanning;
-        DEBUG_SERIAL.print("[BLE] Scanning for ");
-        DEBUG_SERIAL.print(duration);
-        DEBUG_SERIAL.println(" seconds...");
+    // ========================================================================
+    // Estimates
+    // ========================================================================
 
-        delay(duration * 1000);  // Placeholder
+    /**
+     * @brief Advertising radyo duty cycle tahmini (milyonda)
+     *
+     * 3 kanalda 1M PHY PDU süresi (+ bağlanabilir/taranabilir modda RX
+     * penceresi) / (aralık + ortalama 5 ms advDelay).
+     */
+    uint32_t getAdvertisingDutyPpm() const;
+
+    /**
+     * @brief startAdvertising()'den beri tahmini advertising event sayısı
+     *        (Eddystone-TLM advCount için)
+     */
+    uint32_t getAdvertisingEventCount() const;
 
-        _state = BleConnectionState::Idle;
-        return 0;  // TODO: Return actual count
+    /**
+     * @brief Payload'ın controller'a yazılma sayısı (advertising yeniden başlatılmadan)
+     */
+    uint32_t getAdvertisingDataUpdates() const { return _advDataUpdates; }
+
+    // ========================================================================
+    // Scanning (Central Mode)
+    // ========================================================================
+
+    static BleScanConfig defaultScanConfig() {
+        return { BleScanMode::Passive, BLE_SCAN_INTERVAL_MS, BLE_SCAN_WINDOW_MS, false };
     }
 
+    /**
+     * @brief Taramayı başlat (non-blocking); raporlar poll() ile cache'e işlenir
+     * @param durationMs 0: stopScan()'e kadar
+     */
+    bool beginScan(const BleScanConfig& config = defaultScanConfig(), uint32_t durationMs = 0);
+
+    /**
+     * @brief Taramayı durdur (cache korunur)
+     */
+    void stopScan();
+
+    bool isScanning() const { return _scanning; }
+
+    /**
+     * @brief Tarama aralığını / window'unu değiştir (cache ve süre korunur)
+     *
+     * Tarama sürüyorsa controller'da durdurulur; yeni parametrelerle yeniden
+     * başlatma durdurma tamamlanınca (GAP scan state idle) yapılır. İlk window
+     * o anda açılır: isScanRestartPending() false olunca
+     * getScanWindowOriginMs() ile okunur (coexistence scheduler window'u BLE
+     * slot'una bu sayede hizalar).
+     */
+    bool setScanTiming(uint16_t intervalMs, uint16_t windowMs);
+
+    /** @brief le_scan_stop() / bekleyen yeniden başlatma henüz tamamlanmadı */
+    bool isScanRestartPending() const { return _scanStopping || _scanRestart; }
+
+    /** @brief Son le_scan_start() anı (ilk scan window'un açıldığı an, ms) */
+    unsigned long getScanWindowOriginMs() const { return _scanOriginMs; }
+
+    const BleScanConfig& getScanConfig() const { return _scanConfig; }
+
+    /**
+     * @brief Tarama sonuçları (filtre / Found-Lost callback'i buradan kurulur)
+     */
+    BleScanCache& getScanCache() { return _scanCache; }
+    const BleScanCache& getScanCache() const { return _scanCache; }
+
+    /**
+     * @brief Kuyruk dolu olduğu için poll()'a ulaşamayan rapor sayısı
+     */
+    uint32_t getScanQueueDrops() const { return _scanDrops; }
+
+    /**
+     * @brief Blocking tarama (geriye uyumluluk): default parametrelerle
+     *        duration boyunca tarar, poll() kendi içinde çağrılır
+     * @param duration Tarama süresi (saniye, > 0; süresiz tarama için beginScan())
+     * @return Cache'teki cihaz sayısı, hata veya duration 0: -1
+     */
+    int startScan(uint8_t duration = 5);
+
     // ========================================================================
     // Connection
     // ========================================================================
 
     /**
-     * @brief Cihaza bağlan (Central mode)
-     * @param address MAC adresi
+     * @brief Cihaza bağlan (Central mode, asenkron)
+     * @param address "AA:BB:CC:DD:EE:FF" (adres tipi scan cache'ten alınır)
+     * @return false: adres geçersiz veya bağlantı isteği reddedildi
      */
-    bool connect(const char* address) {
-        // TODO: BLE connection
-        DEBUG_SERIAL.print("[BLE] Connecting to: ");
-        DEBUG_SERIAL.println(address);
-        return false;  // Not implemented
-    }
+    bool connect(const char* address);
 
     /**
      * @brief Bağlantıyı kes
      */
-    void disconnect() {
-        // TODO: BLE disconnect
-        _state = BleConnectionState::Disconnected;
-        DEBUG_SERIAL.println("[BLE] Disconnected");
-    }
+    void disconnect();
 
     /**
      * @brief Bağlı mı?
@@ -169,6 +331,41 @@ public:
         return _state == BleConnectionState::Connected;
     }
 
+    /**
+     * @brief Güncel link parametreleri (MTU / DLE / PHY / interval)
+     */
+    const BleLinkParams& getLinkParams() const { return _link; }
+
+    // ========================================================================
+    // Streaming (GATT server)
+    // ========================================================================
+
+    /**
+     * @brief Stream'e veri yaz (bağlantı yokken de ring'de bekler; kopan
+     *        bağlantıdan gönderilmeden kalanlar atılır)
+     * @return Kabul edilen byte (ring doluysa len'den az)
+     */
+    size_t streamWrite(const uint8_t* data, size_t len);
+
+    /**
+     * @brief Karşı taraf RX characteristic'ine yazdığı veri (aynı frame formatı)
+     */
+    size_t streamAvailable() const { return _streamRx.available(); }
+    size_t streamRead(uint8_t* out, size_t max) { return _streamRx.read(out, max); }
+
+    /**
+     * @brief Bağlı ve karşı taraf notification'ları açmış
+     */
+    bool isStreamReady() const { return isConnected() && _streamSubscribed; }
+
+    const BleStreamTx& getStream() const { return _stream; }
+    const BleStreamRx& getStreamRx() const { return _streamRx; }
+
+    /**
+     * @brief Mevcut link için teorik stream throughput'u (byte/s)
+     */
+    uint32_t getStreamEstimate() const { return BleStreamTx::estimateThroughput(_link); }
+
     // ========================================================================
     // Status
     // ========================================================================
@@ -180,26 +377,76 @@ public:
     /**
      * @brief Durum bilgisini yazdır
      */
-    void printStatus() const {
-        DEBUG_SERIAL.println("[BLE Status]");
-        DEBUG_SERIAL.print("  Device: ");
-        DEBUG_SERIAL.println(_deviceName);
-        DEBUG_SERIAL.print("  Role: ");
-        DEBUG_SERIAL.println(_role == BleRole::Peripheral ? "Peripheral" : "Central");
-        DEBUG_SERIAL.print("  State: ");
-        switch (_state) {
-            case BleConnectionState::Idle: DEBUG_SERIAL.println("Idle"); break;
-            case BleConnectionState::Advertising: DEBUG_SERIAL.println("Advertising"); break;
-            case BleConnectionState::Scanning: DEBUG_SERIAL.println("Scanning"); break;
-            case BleConnectionState::Connected: DEBUG_SERIAL.println("Connected"); break;
-            case BleConnectionState::Disconnected: DEBUG_SERIAL.println("Disconnected"); break;
-        }
-    }
+    void printStatus() const;
 
 private:
+    friend struct BleModuleAccess;
+
+    bool applyAdvertisingParams();
+    bool pushAdvertisingData(const BleAdvPayload& payload);
+    void accountAdvertisingEvents();
+    void onStackReady();
+    void onConnected(uint8_t connId);
+    void onDisconnected(uint16_t cause);
+    void onLinkUpdate(uint16_t mtu, uint16_t txOctets, uint8_t phy);
+    void onSubscribe(bool enabled);
+    void postLinkEvent();
+    static bool sendStreamFrame(const uint8_t* frame, uint16_t length, void* user);
+    void onScanReport(const BleScanReport& report);
+    void onScanIdle();
+    bool applyScanParams();
+    bool startScanStack();
+    void stopScanStack();
+    void drainScanQueue();
+
+    void setState(BleConnectionState state) {
+        if (state == _state) return;
+        BleConnectionState previous = _state;
+        _state = state;
+        Events.post(EventSource::Ble, static_cast<uint8_t>(BleEventCode::StateChanged),
+                    static_cast<uint16_t>(state), static_cast<uint32_t>(previous));
+    }
+
     String _deviceName;
     BleConnectionState _state;
     BleRole _role;
+
+    // Advertising
+    BleAdvPayload _advData;
+    BleAdvPayload _scanRspData;
+    BleAdvRotation _rotation;
+    BleAdvMode _advMode;
+    uint16_t _advIntervalMs;
+    volatile bool _stackReady;
+    volatile bool _advPending;      // startAdvertising() stack hazır olmadan çağrıldı
+    uint32_t _advDataUpdates;
+    uint32_t _advEvents;            // Önceki advertising dönemlerinden
+    unsigned long _advSinceMs;
+
+    // Scanning
+    BleScanCache _scanCache;
+    BleScanConfig _scanConfig;
+    BleScanReport _scanQueue[BLE_SCAN_QUEUE_SIZE];
+    uint32_t _scanHead;             // GAP task yazar
+    uint32_t _scanTail;             // poll() yazar
+    uint32_t _scanDrops;
+    bool _scanning;
+    volatile bool _scanPending;     // beginScan() stack hazır olmadan çağrıldı
+    volatile bool _scanStopping;    // le_scan_stop() verildi, GAP scan state idle bekleniyor
+    volatile bool _scanRestart;     // Scan idle olunca le_scan_start()
+    volatile unsigned long _scanOriginMs;   // Son başarılı le_scan_start() anı
+    unsigned long _scanStartMs;
+    uint32_t _scanDurationMs;
+    unsigned long _scanExpireMs;
+
+    // Connection / stream
+    BleLinkParams _link;
+    uint8_t _connId;
+    volatile bool _streamSubscribed;
+    volatile bool _streamRestart;   // Bağlantı koptu, bekleyen veri atılacak
+    bool _advResume;                // Bağlantı kopunca advertising'e dön
+    BleStreamTx _stream;
+    BleStreamRx _streamRx;
 };
 
 #endif // BLE_MODULE_H
@@ -0,0 +1,219 @@
+/**
+ * @file BleScanCache.cpp
+ * @brief Address-keyed BLE scan result cache implementation
+ */
+
+#include "BleScanCache.h"
+
+BleScanCache::BleScanCache(uint32_t maxAgeMs, uint8_t smoothingPercent)
+    : _maxAgeMs(maxAgeMs)
+    , _smoothing(smoothingPercent > 100 ? 100 : smoothingPercent)
+    , _callback(nullptr)
+    , _callbackUser(nullptr)
+    , _stats{0, 0, 0, 0, 0, 0, 0}
+{
+    clearFilter();
+}
+
+void BleScanCache::clear() {
+    _table.clear();
+}
+
+void BleScanCache::clearFilter() {
+    _filter.serviceUuid16 = BLE_SCAN_ANY_UUID;
+    _filter.companyId = BLE_SCAN_ANY_COMPANY;
+    _filter.minRssi = -128;
+}
+
+void BleScanCache::onDevice(BleScanCallback callback, void* user) {
+    _callback = callback;
+    _callbackUser = user;
+}
+
+// ============================================================================
+// Process
+// ============================================================================
+
+void BleScanCache::parse(const uint8_t* data, uint8_t length, uint16_t uuidMatch,
+                         uint16_t& companyId, uint16_t& firstUuid, bool& uuidFound,
+                         const uint8_t*& name, uint8_t& nameLen) {
+    companyId = BLE_SCAN_ANY_COMPANY;
+    firstUuid = 0;
+    uuidFound = false;
+    name = nullptr;
+    nameLen = 0;
+
+    uint8_t i = 0;
+    while (i + 1 < length) {
+        uint8_t len = data[i];
+        if (len == 0 || i + 1 + len > length) break;    // Padding veya bozuk alan
+        uint8_t type = data[i + 1];
+        const uint8_t* p = &data[i + 2];
+        uint8_t n = len - 1;
+
+        switch (type) {
+            case BLE_AD_MANUFACTURER:
+                if (n >= 2) companyId = p[0] | (p[1] << 8);
+                break;
+            case BLE_AD_UUID16_INCOMPLETE:
+            case BLE_AD_UUID16_COMPLETE:
+                for (uint8_t k = 0; k + 1 < n; k += 2) {
+                    uint16_t uuid = p[k] | (p[k + 1] << 8);
+                    if (firstUuid == 0) firstUuid = uuid;
+                    if (uuid == uuidMatch) uuidFound = true;
+                }
+                break;
+            case BLE_AD_SERVICE_DATA16:
+                if (n >= 2) {
+                    uint16_t uuid = p[0] | (p[1] << 8);
+                    if (firstUuid == 0) firstUuid = uuid;
+                    if (uuid == uuidMatch) uuidFound = true;
+                }
+                break;
+            case BLE_AD_NAME_SHORT:
+                if (name == nullptr) {
+                    name = p;
+                    nameLen = n;
+                }
+                break;
+            case BLE_AD_NAME_COMPLETE:
+                name = p;
+                nameLen = n;
+                break;
+            default:
+                break;
+        }
+        i += len + 1;
+    }
+}
+
+const BleScanDevice* BleScanCache::process(const BleScanReport& report, uint32_t nowMs) {
+    _stats.reports++;
+
+    if (report.rssi < _filter.minRssi) {
+        _stats.filtered++;
+        return nullptr;
+    }
+
+    uint16_t companyId;
+    uint16_t firstUuid;
+    bool uuidFound;
+    const uint8_t* name;
+    uint8_t nameLen;
+    parse(report.data, report.length, _filter.serviceUuid16, companyId, firstUuid, uuidFound,
+          name, nameLen);
+
+    bool pass = (_filter.companyId == BLE_SCAN_ANY_COMPANY || companyId == _filter.companyId) &&
+                (_filter.serviceUuid16 == BLE_SCAN_ANY_UUID || uuidFound);
+
+    Key key = { report.addr, report.addrType };
+    int slot = _table.find(key);
+    if (!pass && (slot < 0 || report.advType != BLE_ADV_EVT_SCAN_RSP)) {
+        _stats.filtered++;
+        return nullptr;
+    }
+
+    int32_t q4 = static_cast<int32_t>(report.rssi) * 16;
+    bool found = slot < 0;
+    if (found) {
+        if (_table.full()) evictOldest();
+        uint16_t probes;
+        slot = _table.insert(key, probes);
+        if (probes > _stats.maxProbe) _stats.maxProbe = probes;
+    }
+
+    Entry& e = _table[slot];
+    BleScanDevice& d = e.device;
+    if (found) {
+        e.rssiQ4 = static_cast<int16_t>(q4);
+        d.companyId = BLE_SCAN_ANY_COMPANY;
+        d.firstSeenMs = nowMs;
+    } else {
+        e.rssiQ4 += static_cast<int16_t>((q4 - e.rssiQ4) * _smoothing / 100);
+        _stats.duplicates++;
+    }
+
+    d.rssi = static_cast<int8_t>((e.rssiQ4 - 8) / 16);
+    d.lastRssi = report.rssi;
+    d.lastSeenMs = nowMs;
+    d.reports++;
+    if (companyId != BLE_SCAN_ANY_COMPANY) d.companyId = companyId;
+    if (firstUuid != 0 && d.serviceUuid16 == 0) d.serviceUuid16 = firstUuid;
+    if (name != nullptr && d.name[0] == '\0') {
+        uint8_t len = nameLen < BLE_SCAN_NAME_LEN - 1 ? nameLen : BLE_SCAN_NAME_LEN - 1;
+        memcpy(d.name, name, len);
+        d.name[len] = '\0';
+    }
+
+    if (found) {
+        _stats.found++;
+        if (_callback != nullptr) _callback(d, BleScanEvent::Found, _callbackUser);
+    }
+    return &d;
+}
+
+uint16_t BleScanCache::expire(uint32_t nowMs) {
+    return _table.eraseIf(
+        [&](const Entry& e) { return nowMs - e.device.lastSeenMs >= _maxAgeMs; },
+        [this](const Entry& e) {
+            _stats.lost++;
+            if (_callback != nullptr) _callback(e.device, BleScanEvent::Lost, _callbackUser);
+        });
+}
+
+const BleScanDevice* BleScanCache::find(const uint8_t addr[6]) const {
+    // Adres tipi bilinmiyorsa ilk eşleşen
+    for (uint8_t type = 0; type < 4; type++) {
+        int slot = _table.find(Key{ addr, type });
+        if (slot >= 0) return &_table[slot].device;
+    }
+    return nullptr;
+}
+
+void BleScanCache::forEach(void (*callback)(const BleScanDevice& device, void* user), void* user) const {
+    if (callback == nullptr) return;
+    for (uint16_t i = 0; i < Table::kSlots; i++) {
+        if (_table.isUsed(i)) callback(_table[i].device, user);
+    }
+}
+
+const char* BleScanCache::eventToString(BleScanEvent event) {
+    switch (event) {
+        case BleScanEvent::Found:   return "Found";
+        case BleScanEvent::Lost:    return "Lost";
+        default:                    return "Unknown";
+    }
+}
+
+// ============================================================================
+// Hash table
+// ============================================================================
+
+uint32_t BleScanCache::EntryTraits::hash(Key key) {
+    // FNV-1a; random adreslerde entropi düşük byte'larda (LSB first)
+    uint32_t h = 2166136261UL;
+    for (uint8_t i = 0; i < 6; i++) {
+        h ^= key.addr[i];
+        h *= 16777619UL;
+    }
+    h ^= key.addrType;
+    h *= 16777619UL;
+    return h;
+}
+
+void BleScanCache::evictOldest() {
+    int oldest = -1;
+    for (uint16_t i = 0; i < Table::kSlots; i++) {
+        if (!_table.isUsed(i)) continue;
+        if (oldest < 0 || static_cast<int32_t>(_table[i].device.lastSeenMs -
+                                               _table[oldest].device.lastSeenMs) < 0) {
+            oldest = i;
+        }
+    }
+    if (oldest < 0) return;
+
+    BleScanDevice device = _table[oldest].device;
+    _table.erase(static_cast<uint16_t>(oldest));
+    _stats.evicted++;
+    if (_callback != nullptr) _callback(device, BleScanEvent::Lost, _callbackUser);
+}
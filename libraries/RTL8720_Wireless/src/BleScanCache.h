@@ -0,0 +1,210 @@
+/**
+ * @file BleScanCache.h
+ * @brief Address-keyed BLE scan result cache with duplicate suppression
+ *
+ * Her advertising raporu process() ile işlenir:
+ * - RSSI ön filtresi, ardından AD alanları tek geçişte parse edilir
+ *   (company id, 16-bit service UUID, ad) ve UUID / manufacturer filtresi
+ *   uygulanır; eşleşmeyen rapor tabloya dokunmaz
+ * - Bilinen adres: sadece RSSI yumuşatılır (EWMA) ve sayaçlar güncellenir,
+ *   callback çağrılmaz (duplicate suppression)
+ * - Yeni adres: Found callback'i
+ * - maxAgeMs boyunca görülmeyen kayıt expire() ile atılır (Lost callback'i)
+ *
+ * Tablo sabit kapasiteli open-addressing hash'tir (OpenHashTable);
+ * kapasitenin %75'i doluyken yeni cihaz gelirse en uzun süredir görülmeyen
+ * kayıt atılır. Heap kullanılmaz, SDK'dan
+ * bağımsızdır (host'ta aynen çalışır).
+ *
+ * Kullanım:
+ *   BleScanCache& cache = ble.getScanCache();
+ *   cache.setFilter({BLE_UUID16_EDDYSTONE, BLE_SCAN_ANY_COMPANY, -90});
+ *   cache.onDevice(onTag);
+ *   ble.beginScan(config);
+ */
+
+#ifndef BLE_SCAN_CACHE_H
+#define BLE_SCAN_CACHE_H
+
+#include <Arduino.h>
+#include <OpenHashTable.h>
+#include "BleAdvertising.h"
+
+// Hash tablosu slot sayısı (2'nin kuvveti, <= 256); en fazla %75'i kullanılır
+#ifndef BLE_SCAN_CACHE_SIZE
+    #define BLE_SCAN_CACHE_SIZE         128
+#endif
+
+// Bu süre boyunca rapor gelmeyen cihaz Lost sayılır (ms)
+#ifndef BLE_SCAN_MAX_AGE_MS
+    #define BLE_SCAN_MAX_AGE_MS         30000
+#endif
+
+// Yeni RSSI örneğinin ağırlığı (%)
+#ifndef BLE_SCAN_SMOOTHING_PERCENT
+    #define BLE_SCAN_SMOOTHING_PERCENT  25
+#endif
+
+// Saklanan ad uzunluğu (NUL dahil)
+#define BLE_SCAN_NAME_LEN               12
+
+// Scan response raporu (GAP_ADV_EVT_TYPE_SCAN_RSP): filtreden bağımsız
+// olarak bilinen cihazın adını tamamlar
+#define BLE_ADV_EVT_SCAN_RSP            4
+
+#define BLE_SCAN_ANY_UUID               0x0000
+#define BLE_SCAN_ANY_COMPANY            0xFFFF
+
+/**
+ * @brief Controller'dan gelen ham advertising raporu
+ */
+struct BleScanReport {
+    uint8_t addr[6];            // LSB first (SDK bd_addr sırası)
+    uint8_t addrType;
+    uint8_t advType;            // GAP_ADV_EVT_TYPE_*
+    int8_t rssi;
+    uint8_t length;
+    uint8_t data[BLE_ADV_MAX_LEN];
+};
+
+/**
+ * @brief Rapor filtresi (tüm koşullar sağlanmalı)
+ */
+struct BleScanFilter {
+    uint16_t serviceUuid16;     // UUID listesinde veya service data'da (ANY: filtre yok)
+    uint16_t companyId;         // Manufacturer data company id (ANY: filtre yok)
+    int8_t minRssi;             // -128: filtre yok
+};
+
+/**
+ * @brief Cache kaydı
+ */
+struct BleScanDevice {
+    uint8_t addr[6];
+    uint8_t addrType;
+    int8_t rssi;                // Yumuşatılmış
+    int8_t lastRssi;
+    uint16_t companyId;         // Yoksa BLE_SCAN_ANY_COMPANY
+    uint16_t serviceUuid16;     // İlk 16-bit UUID, yoksa 0
+    uint32_t firstSeenMs;
+    uint32_t lastSeenMs;
+    uint32_t reports;
+    char name[BLE_SCAN_NAME_LEN];
+};
+
+enum class BleScanEvent : uint8_t {
+    Found = 1,
+    Lost = 2
+};
+
+typedef void (*BleScanCallback)(const BleScanDevice& device, BleScanEvent event, void* user);
+
+struct BleScanCacheStats {
+    uint32_t reports;           // process() çağrısı
+    uint32_t filtered;          // RSSI / UUID / company filtresine takılan
+    uint32_t duplicates;        // Bilinen cihazdan rapor
+    uint32_t found;
+    uint32_t lost;              // maxAgeMs aşıldı
+    uint32_t evicted;           // Tablo doluydu, en eski atıldı
+    uint16_t maxProbe;          // En uzun linear probe zinciri
+};
+
+class BleScanCache {
+public:
+    explicit BleScanCache(uint32_t maxAgeMs = BLE_SCAN_MAX_AGE_MS,
+                          uint8_t smoothingPercent = BLE_SCAN_SMOOTHING_PERCENT);
+
+    /**
+     * @brief Tüm kayıtları sil (Lost callback'i çağrılmaz)
+     */
+    void clear();
+
+    void setFilter(const BleScanFilter& filter) { _filter = filter; }
+    void clearFilter();
+    const BleScanFilter& getFilter() const { return _filter; }
+
+    /**
+     * @brief Found / Lost callback'i (process() / expire() context'i)
+     */
+    void onDevice(BleScanCallback callback, void* user = nullptr);
+
+    void setMaxAge(uint32_t ms) { _maxAgeMs = ms; }
+    void setSmoothing(uint8_t percent) { _smoothing = percent > 100 ? 100 : percent; }
+
+    /**
+     * @brief Raporu işle
+     * @return Kayıt (yeni veya güncellenen), filtreye takıldıysa nullptr
+     */
+    const BleScanDevice* process(const BleScanReport& report, uint32_t nowMs);
+
+    /**
+     * @brief maxAgeMs boyunca görülmeyen kayıtları at
+     * @return Atılan kayıt sayısı
+     */
+    uint16_t expire(uint32_t nowMs);
+
+    const BleScanDevice* find(const uint8_t addr[6]) const;
+
+    /**
+     * @brief Her kayıt için callback (sıra tanımsız)
+     */
+    void forEach(void (*callback)(const BleScanDevice& device, void* user), void* user = nullptr) const;
+
+    uint16_t size() const { return _table.size(); }
+    static constexpr uint16_t capacity() { return kMaxEntries; }
+
+    const BleScanCacheStats& getStats() const { return _stats; }
+
+    /**
+     * @brief AD alanlarından filtre / kayıt için gerekenleri çıkar (tek geçiş)
+     * @param uuidMatch Aranan 16-bit UUID (0: aranmaz); bulunduysa true yazılır
+     */
+    static void parse(const uint8_t* data, uint8_t length, uint16_t uuidMatch,
+                      uint16_t& companyId, uint16_t& firstUuid, bool& uuidFound,
+                      const uint8_t*& name, uint8_t& nameLen);
+
+    static const char* eventToString(BleScanEvent event);
+
+private:
+    static constexpr uint16_t kMaxEntries = BLE_SCAN_CACHE_SIZE * 3 / 4;
+
+    static_assert((BLE_SCAN_CACHE_SIZE & (BLE_SCAN_CACHE_SIZE - 1)) == 0 &&
+                  BLE_SCAN_CACHE_SIZE <= 256,
+                  "BLE_SCAN_CACHE_SIZE must be a power of two <= 256");
+
+    struct Entry {
+        BleScanDevice device;
+        int16_t rssiQ4;         // EWMA (1/16 dB)
+    };
+
+    struct Key {
+        const uint8_t* addr;
+        uint8_t addrType;
+    };
+
+    struct EntryTraits {
+        static uint32_t hash(Key key);
+        static bool matches(const Entry& entry, Key key) {
+            return entry.device.addrType == key.addrType && memcmp(entry.device.addr, key.addr, 6) == 0;
+        }
+        static Key keyOf(const Entry& entry) { return { entry.device.addr, entry.device.addrType }; }
+        static void setKey(Entry& entry, Key key) {
+            memcpy(entry.device.addr, key.addr, 6);
+            entry.device.addrType = key.addrType;
+        }
+    };
+
+    typedef OpenHashTable<Key, Entry, BLE_SCAN_CACHE_SIZE, EntryTraits> Table;
+
+    void evictOldest();
+
+    Table _table;
+    uint32_t _maxAgeMs;
+    uint8_t _smoothing;
+    BleScanFilter _filter;
+    BleScanCallback _callback;
+    void* _callbackUser;
+    BleScanCacheStats _stats;
+};
+
+#endif // BLE_SCAN_CACHE_H
@@ -0,0 +1,211 @@
+/**
+ * @file BleStream.cpp
+ * @brief Framed BLE bulk stream implementation
+ */
+
+#include "BleStream.h"
+
+#define BLE_STREAM_MASK             (BLE_STREAM_BUFFER_SIZE - 1)
+
+static_assert((BLE_STREAM_BUFFER_SIZE & BLE_STREAM_MASK) == 0,
+              "BLE_STREAM_BUFFER_SIZE must be a power of two");
+
+// LL data PDU: preamble + access address 4 + header 2 + CRC 3 (1M: preamble 1, 2M: 2)
+#define BLE_LL_OVERHEAD_1M          10
+#define BLE_LL_OVERHEAD_2M          11
+#define BLE_LL_T_IFS_US             150
+#define BLE_L2CAP_HEADER            4
+
+namespace {
+
+uint32_t pduUs(uint16_t payload, uint8_t phy) {
+    return phy == 2 ? (payload + BLE_LL_OVERHEAD_2M) * 4 : (payload + BLE_LL_OVERHEAD_1M) * 8;
+}
+
+} // namespace
+
+// ============================================================================
+// TX
+// ============================================================================
+
+BleStreamTx::BleStreamTx() {
+    reset();
+    setMtu(BLE_STREAM_DEFAULT_MTU);
+}
+
+void BleStreamTx::reset() {
+    _head = 0;
+    _tail = 0;
+    _seq = 0;
+    _pendingSinceMs = 0;
+    _startMs = 0;
+    _windowStartMs = 0;
+    _windowBytes = 0;
+    _rate = 0;
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void BleStreamTx::restart() {
+    _stats.discarded += pending();
+    _tail = _head;
+    _seq = 0;
+}
+
+void BleStreamTx::setMtu(uint16_t mtu) {
+    if (mtu < BLE_STREAM_DEFAULT_MTU) mtu = BLE_STREAM_DEFAULT_MTU;
+    if (mtu > BLE_STREAM_MAX_MTU) mtu = BLE_STREAM_MAX_MTU;
+    _framePayload = mtu - BLE_STREAM_ATT_HEADER - BLE_STREAM_FRAME_HEADER;
+}
+
+size_t BleStreamTx::write(const uint8_t* data, size_t len) {
+    size_t accepted = len < space() ? len : space();
+    if (accepted < len) _stats.rejected += len - accepted;
+    if (accepted == 0) return 0;
+
+    if (pending() == 0) _pendingSinceMs = millis();
+
+    size_t offset = _head & BLE_STREAM_MASK;
+    size_t first = BLE_STREAM_BUFFER_SIZE - offset;
+    if (first > accepted) first = accepted;
+    memcpy(&_ring[offset], data, first);
+    memcpy(&_ring[0], data + first, accepted - first);
+    _head += accepted;
+
+    _stats.written += accepted;
+    if (pending() > _stats.highWater) _stats.highWater = static_cast<uint16_t>(pending());
+    return accepted;
+}
+
+void BleStreamTx::copyOut(uint8_t* out, size_t len) const {
+    size_t offset = _tail & BLE_STREAM_MASK;
+    size_t first = BLE_STREAM_BUFFER_SIZE - offset;
+    if (first > len) first = len;
+    memcpy(out, &_ring[offset], first);
+    memcpy(out + first, &_ring[0], len - first);
+}
+
+uint16_t BleStreamTx::pump(unsigned long nowMs, uint16_t credits, BleStreamSendFn send, void* user) {
+    if (nowMs - _windowStartMs >= BLE_STREAM_RATE_WINDOW_MS) {
+        _rate = static_cast<uint32_t>(static_cast<uint64_t>(_windowBytes) * 1000 /
+                                      (nowMs - _windowStartMs));
+        _windowBytes = 0;
+        _windowStartMs = nowMs;
+    }
+
+    uint16_t sent = 0;
+    uint8_t frame[BLE_STREAM_MAX_FRAME];
+
+    while (pending() > 0) {
+        size_t len = pending() < _framePayload ? pending() : _framePayload;
+        bool shortFrame = len < _framePayload;
+        // Kısa frame sadece veri flushMs'den uzun beklediyse (küçük yazmaları birleştir)
+        if (shortFrame && nowMs - _pendingSinceMs < BLE_STREAM_FLUSH_MS) break;
+        if (credits == 0) {
+            _stats.creditStalls++;
+            break;
+        }
+
+        frame[0] = _seq;
+        copyOut(&frame[BLE_STREAM_FRAME_HEADER], len);
+        if (!send(frame, static_cast<uint16_t>(len + BLE_STREAM_FRAME_HEADER), user)) {
+            _stats.sendErrors++;
+            break;
+        }
+
+        if (_stats.frames == 0) {
+            _startMs = nowMs;
+            _windowStartMs = nowMs;
+        }
+        _tail += len;
+        _seq++;
+        credits--;
+        sent++;
+        _stats.frames++;
+        _stats.bytes += len;
+        if (shortFrame) _stats.shortFrames++;
+        _windowBytes += len;
+        _pendingSinceMs = nowMs;
+    }
+    return sent;
+}
+
+uint32_t BleStreamTx::getAverageRate(unsigned long nowMs) const {
+    unsigned long elapsed = nowMs - _startMs;
+    if (_stats.frames == 0 || elapsed == 0) return 0;
+    return static_cast<uint32_t>(static_cast<uint64_t>(_stats.bytes) * 1000 / elapsed);
+}
+
+uint32_t BleStreamTx::estimateThroughput(const BleLinkParams& link) {
+    if (link.intervalUs == 0 || link.txOctets == 0) return 0;
+    uint16_t mtu = link.mtu < BLE_STREAM_DEFAULT_MTU ? BLE_STREAM_DEFAULT_MTU : link.mtu;
+
+    // ATT notification (opcode + handle + value = mtu) + L2CAP header, txOctets'lik paketler
+    uint32_t remaining = mtu + BLE_L2CAP_HEADER;
+    uint32_t notifyUs = 0;
+    while (remaining > 0) {
+        uint16_t len = remaining > link.txOctets ? link.txOctets : static_cast<uint16_t>(remaining);
+        notifyUs += pduUs(len, link.phy) + BLE_LL_T_IFS_US + pduUs(0, link.phy) + BLE_LL_T_IFS_US;
+        remaining -= len;
+    }
+
+    uint32_t perEvent = link.intervalUs / notifyUs;
+    if (link.credits > 0 && perEvent > link.credits) perEvent = link.credits;
+    uint32_t payload = mtu - BLE_STREAM_ATT_HEADER - BLE_STREAM_FRAME_HEADER;
+    return static_cast<uint32_t>(static_cast<uint64_t>(perEvent) * payload * 1000000 / link.intervalUs);
+}
+
+// ============================================================================
+// RX
+// ============================================================================
+
+BleStreamRx::BleStreamRx() {
+    reset();
+}
+
+void BleStreamRx::reset() {
+    _head = 0;
+    _tail = 0;
+    _expectedSeq = 0;
+    _synced = false;
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool BleStreamRx::onFrame(const uint8_t* frame, uint16_t length) {
+    if (frame == nullptr || length <= BLE_STREAM_FRAME_HEADER) return false;
+
+    uint8_t seq = frame[0];
+    if (_synced && seq != _expectedSeq) {
+        _stats.lostFrames += static_cast<uint8_t>(seq - _expectedSeq);
+    }
+    _synced = true;
+    _expectedSeq = seq + 1;
+    _stats.frames++;
+
+    const uint8_t* data = frame + BLE_STREAM_FRAME_HEADER;
+    size_t len = length - BLE_STREAM_FRAME_HEADER;
+    size_t space = BLE_STREAM_BUFFER_SIZE - available();
+    if (len > space) {
+        _stats.overflow += len - space;
+        len = space;
+    }
+
+    size_t offset = _head & BLE_STREAM_MASK;
+    size_t first = BLE_STREAM_BUFFER_SIZE - offset;
+    if (first > len) first = len;
+    memcpy(&_ring[offset], data, first);
+    memcpy(&_ring[0], data + first, len - first);
+    __atomic_store_n(&_head, _head + len, __ATOMIC_RELEASE);
+    _stats.bytes += len;
+    return true;
+}
+
+size_t BleStreamRx::read(uint8_t* out, size_t max) {
+    size_t len = available() < max ? available() : max;
+    size_t offset = _tail & BLE_STREAM_MASK;
+    size_t first = BLE_STREAM_BUFFER_SIZE - offset;
+    if (first > len) first = len;
+    memcpy(out, &_ring[offset], first);
+    memcpy(out + first, &_ring[0], len - first);
+    __atomic_store_n(&_tail, _tail + len, __ATOMIC_RELEASE);
+    return len;
+}
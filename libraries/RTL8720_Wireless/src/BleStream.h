@@ -0,0 +1,201 @@
+/**
+ * @file BleStream.h
+ * @brief Framed BLE bulk stream with credit-based flow control
+ *
+ * BleStreamTx: uygulamanın yazdığı byte'lar sabit ring buffer'da bekler,
+ * pump() ile notification boyutunda frame'lere bölünüp controller'a verilir.
+ * - Frame: [seq (1 byte)] [payload (MTU - 3 - 1 byte)]
+ * - Controller'ın boş TX buffer sayısı (credit) kadar frame gönderilir;
+ *   credit yoksa veri ring'de kalır (stall sayılır), kaybolmaz
+ * - Tam frame dolmadan veri flushMs'den uzun beklerse kısa frame gider
+ *   (gecikme sınırı); aksi halde frame'ler hep tam boyda gider
+ * - Ring doluysa write() kısmi kabul eder, kalan byte sayısını uygulama görür
+ * - Bağlantı koptuğunda restart(): gönderilmemiş byte'lar atılır, sıra
+ *   numarası sıfırlanır; yeni abone stream'i kayıt sınırından alır
+ *
+ * BleStreamRx: karşı tarafta frame'leri sıra numarasıyla ring'e açar,
+ * atlanan sıra numaralarını kayıp frame olarak sayar. onFrame() (GAP task)
+ * ve read() (loop) farklı context'lerden çağrılabilir: tek üretici / tek
+ * tüketici.
+ *
+ * Her iki sınıf SDK'dan bağımsızdır; host build'de aynen çalışır. Link
+ * parametrelerinden (MTU, DLE, PHY, connection interval) teorik throughput
+ * tahmini estimateThroughput() ile alınır.
+ *
+ * Kullanım:
+ *   ble.streamWrite(record, sizeof(record));
+ *   void loop() { ble.poll(); ... }     // pump() poll() içinde
+ */
+
+#ifndef BLE_STREAM_H
+#define BLE_STREAM_H
+
+#include <Arduino.h>
+
+// TX / RX ring buffer boyutu (2'nin kuvveti)
+#ifndef BLE_STREAM_BUFFER_SIZE
+    #define BLE_STREAM_BUFFER_SIZE      4096
+#endif
+
+// Kısa frame gönderilmeden önce verinin bekleyebileceği süre (ms)
+#ifndef BLE_STREAM_FLUSH_MS
+    #define BLE_STREAM_FLUSH_MS         20
+#endif
+
+// Throughput ölçüm penceresi (ms)
+#ifndef BLE_STREAM_RATE_WINDOW_MS
+    #define BLE_STREAM_RATE_WINDOW_MS   1000
+#endif
+
+// DLE ile LL payload 251 byte; 4 byte L2CAP header ile tek pakete sığan en büyük ATT MTU
+#define BLE_STREAM_MAX_MTU              247
+#define BLE_STREAM_DEFAULT_MTU          23
+#define BLE_STREAM_ATT_HEADER           3
+#define BLE_STREAM_FRAME_HEADER         1
+#define BLE_STREAM_MAX_FRAME            (BLE_STREAM_MAX_MTU - BLE_STREAM_ATT_HEADER)
+
+/**
+ * @brief Bağlantının throughput'u belirleyen parametreleri
+ */
+struct BleLinkParams {
+    uint16_t mtu;               // ATT MTU (exchange sonucu)
+    uint16_t txOctets;          // LL max TX payload (27: DLE yok, 251: DLE)
+    uint8_t phy;                // 1: LE 1M, 2: LE 2M
+    uint32_t intervalUs;        // Connection interval
+    uint8_t credits;            // Controller TX buffer sayısı (0: sınırsız)
+};
+
+struct BleStreamStats {
+    uint32_t written;           // write() ile kabul edilen byte
+    uint32_t rejected;          // Ring dolu, kabul edilmeyen byte
+    uint32_t frames;
+    uint32_t bytes;             // Gönderilen payload byte (header hariç)
+    uint32_t shortFrames;       // flushMs dolduğu için tam olmayan frame
+    uint32_t creditStalls;      // Veri var ama credit yok (pump() çağrısı)
+    uint32_t sendErrors;        // Controller frame'i reddetti
+    uint32_t discarded;         // restart() ile atılan byte
+    uint16_t highWater;         // Ring'de en fazla bekleyen byte
+};
+
+struct BleStreamRxStats {
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t lostFrames;        // Sıra numarası boşlukları
+    uint32_t overflow;          // Ring dolu, atılan byte
+};
+
+/**
+ * @brief Tam frame'i controller'a ver (GATT notification)
+ * @return false: reddedildi (frame ring'de kalır, sonraki pump()'ta tekrar denenir)
+ */
+typedef bool (*BleStreamSendFn)(const uint8_t* frame, uint16_t length, void* user);
+
+/**
+ * @brief Gönderen taraf
+ */
+class BleStreamTx {
+public:
+    BleStreamTx();
+
+    /**
+     * @brief Ring'i boşalt, sıra numarası ve sayaçları sıfırla
+     */
+    void reset();
+
+    /**
+     * @brief Bekleyen byte'ları at ve sıra numarasını sıfırla (sayaçlar korunur)
+     */
+    void restart();
+
+    /**
+     * @brief Frame boyutunu ATT MTU'dan ayarla (bağlantı / MTU exchange sonrası)
+     */
+    void setMtu(uint16_t mtu);
+    uint16_t getFramePayload() const { return _framePayload; }
+
+    /**
+     * @brief Veriyi ring'e kopyala
+     * @return Kabul edilen byte (ring doluysa len'den az)
+     */
+    size_t write(const uint8_t* data, size_t len);
+
+    size_t pending() const { return _head - _tail; }
+    size_t space() const { return BLE_STREAM_BUFFER_SIZE - pending(); }
+
+    /**
+     * @brief Credit kadar frame gönder
+     * @param credits Controller'ın boş TX buffer sayısı
+     * @return Gönderilen frame sayısı
+     */
+    uint16_t pump(unsigned long nowMs, uint16_t credits, BleStreamSendFn send, void* user);
+
+    /**
+     * @brief Son ölçüm penceresindeki throughput (byte/s, payload)
+     */
+    uint32_t getRate() const { return _rate; }
+
+    /**
+     * @brief İlk frame'den beri ortalama throughput (byte/s)
+     */
+    uint32_t getAverageRate(unsigned long nowMs) const;
+
+    const BleStreamStats& getStats() const { return _stats; }
+
+    /**
+     * @brief Link parametrelerinden teorik stream throughput'u (byte/s, payload)
+     *
+     * Her notification (MTU - 3) byte + 4 byte L2CAP header'ı txOctets'lik LL
+     * paketlerine bölünür; her paket için PDU + T_IFS + boş ACK + T_IFS süresi
+     * harcanır ve connection interval'a sığan kadar paket gönderilir. Credit
+     * sayısı verilmişse event başına en fazla o kadar notification gider.
+     */
+    static uint32_t estimateThroughput(const BleLinkParams& link);
+
+private:
+    void copyOut(uint8_t* out, size_t len) const;
+
+    uint8_t _ring[BLE_STREAM_BUFFER_SIZE];
+    uint32_t _head;
+    uint32_t _tail;
+    uint16_t _framePayload;
+    uint8_t _seq;
+    unsigned long _pendingSinceMs;
+    unsigned long _startMs;
+    unsigned long _windowStartMs;
+    uint32_t _windowBytes;
+    uint32_t _rate;
+    BleStreamStats _stats;
+};
+
+/**
+ * @brief Alan taraf
+ */
+class BleStreamRx {
+public:
+    BleStreamRx();
+
+    void reset();
+
+    /**
+     * @brief Notification içeriğini işle
+     * @return false: geçersiz (boş) frame
+     */
+    bool onFrame(const uint8_t* frame, uint16_t length);
+
+    size_t available() const {
+        return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+    }
+    size_t read(uint8_t* out, size_t max);
+
+    const BleStreamRxStats& getStats() const { return _stats; }
+
+private:
+    uint8_t _ring[BLE_STREAM_BUFFER_SIZE];
+    uint32_t _head;             // onFrame() yazar
+    uint32_t _tail;             // read() yazar
+    uint8_t _expectedSeq;
+    bool _synced;
+    BleStreamRxStats _stats;
+};
+
+#endif // BLE_STREAM_H
@@ -0,0 +1,247 @@
+/**
+ * @file CoexScheduler.cpp
+ * @brief WiFi / BLE time-slicing plan implementation
+ */
+
+#include "CoexScheduler.h"
+
+#define COEX_BLE_ACTIVITIES     (COEX_ACTIVITY_BIT(CoexActivity::BleScan) | \
+                                 COEX_ACTIVITY_BIT(CoexActivity::BleAdvertising) | \
+                                 COEX_ACTIVITY_BIT(CoexActivity::BleConnection))
+
+CoexScheduler::CoexScheduler()
+    : _policy(defaultPolicy())
+    , _plan{0, 0, 0, 0, 0, false}
+    , _activities(0)
+    , _wifi5GHz(false)
+    , _baseScanIntervalMs(0)
+    , _baseScanWindowMs(0)
+    , _originMs(0)
+    , _accountedMs(0)
+    , _windowRemainder(0)
+    , _wifiRemainder(0)
+    , _bleRemainder(0)
+    , _deferredSlot(0)
+{
+    resetStats();
+}
+
+CoexPolicy CoexScheduler::defaultPolicy() {
+    CoexPolicy policy;
+    policy.periodMs = COEX_PERIOD_MS;
+    policy.priority[static_cast<uint8_t>(CoexActivity::WiFiBulk)] = CoexPriority::Normal;
+    policy.priority[static_cast<uint8_t>(CoexActivity::BleScan)] = CoexPriority::Normal;
+    policy.priority[static_cast<uint8_t>(CoexActivity::BleAdvertising)] = CoexPriority::Low;
+    policy.priority[static_cast<uint8_t>(CoexActivity::BleConnection)] = CoexPriority::High;
+    policy.minBlePercent = COEX_MIN_BLE_PERCENT;
+    policy.minWiFiPercent = COEX_MIN_WIFI_PERCENT;
+    policy.advStretchMs = COEX_ADV_STRETCH_MS;
+    policy.guardMs = COEX_GUARD_MS;
+    return policy;
+}
+
+void CoexScheduler::setPolicy(const CoexPolicy& policy) {
+    _policy = policy;
+    if (_policy.periodMs < 10) _policy.periodMs = 10;
+    if (_policy.minBlePercent + _policy.minWiFiPercent > 100) {
+        _policy.minWiFiPercent = 100 - _policy.minBlePercent;
+    }
+    if (_policy.guardMs > _policy.periodMs / 10) {
+        _policy.guardMs = static_cast<uint8_t>(_policy.periodMs / 10);
+    }
+}
+
+void CoexScheduler::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+    _windowRemainder = 0;
+    _wifiRemainder = 0;
+    _bleRemainder = 0;
+}
+
+void CoexScheduler::setBaseScan(uint16_t intervalMs, uint16_t windowMs) {
+    _baseScanIntervalMs = intervalMs;
+    _baseScanWindowMs = windowMs;
+}
+
+// ============================================================================
+// Plan
+// ============================================================================
+
+CoexPlan CoexScheduler::computePlan(const CoexPolicy& policy, uint8_t activities, bool wifi5GHz) {
+    CoexPlan plan = {0, 0, 0, 0, 0, false};
+    uint16_t period = policy.periodMs;
+
+    uint16_t wifiWeight = 0;
+    uint16_t bleWeight = 0;
+    for (uint8_t i = 0; i < COEX_ACTIVITY_COUNT; i++) {
+        if ((activities & (1u << i)) == 0) continue;
+        uint8_t weight = static_cast<uint8_t>(policy.priority[i]);
+        if (i == static_cast<uint8_t>(CoexActivity::WiFiBulk)) {
+            wifiWeight += weight;
+        } else {
+            bleWeight += weight;
+        }
+    }
+
+    // Tek radyo aktif veya farklı bantlar: iki taraf da tüm zamanı kullanır
+    if (wifiWeight == 0 || bleWeight == 0 || wifi5GHz) {
+        plan.wifiMs = period;
+        plan.bleMs = period;
+        return plan;
+    }
+
+    uint32_t ble = static_cast<uint32_t>(period) * bleWeight / (wifiWeight + bleWeight);
+    uint32_t bleMin = static_cast<uint32_t>(period) * policy.minBlePercent / 100;
+    uint32_t bleMax = period - static_cast<uint32_t>(period) * policy.minWiFiPercent / 100;
+    if (ble < bleMin) ble = bleMin;
+    if (ble > bleMax) ble = bleMax;
+    if (ble < COEX_MIN_SCAN_WINDOW_MS) ble = COEX_MIN_SCAN_WINDOW_MS;
+
+    plan.sliced = true;
+    plan.bleMs = static_cast<uint16_t>(ble);
+    plan.wifiMs = period - plan.bleMs;
+
+    if (activities & COEX_ACTIVITY_BIT(CoexActivity::BleScan)) {
+        plan.scanIntervalMs = period;
+        plan.scanWindowMs = plan.bleMs;
+    }
+
+    // Advertising WiFi'den düşük öncelikliyse event'leri seyrelt
+    uint8_t adv = static_cast<uint8_t>(CoexActivity::BleAdvertising);
+    if ((activities & COEX_ACTIVITY_BIT(CoexActivity::BleAdvertising)) && policy.advStretchMs > 0 &&
+        static_cast<uint8_t>(policy.priority[adv]) <
+        static_cast<uint8_t>(policy.priority[static_cast<uint8_t>(CoexActivity::WiFiBulk)])) {
+        plan.advIntervalMs = policy.advStretchMs;
+    }
+    return plan;
+}
+
+bool CoexScheduler::update(uint8_t activities, bool wifi5GHz, unsigned long nowMs) {
+    accumulate(nowMs);
+    _activities = activities;
+    _wifi5GHz = wifi5GHz;
+
+    CoexPlan plan = computePlan(_policy, activities, wifi5GHz);
+    if (plan.wifiMs == _plan.wifiMs && plan.bleMs == _plan.bleMs &&
+        plan.scanIntervalMs == _plan.scanIntervalMs && plan.scanWindowMs == _plan.scanWindowMs &&
+        plan.advIntervalMs == _plan.advIntervalMs && plan.sliced == _plan.sliced) {
+        return false;
+    }
+
+    _plan = plan;
+    _originMs = nowMs;
+    _deferredSlot = 0;
+    _stats.replans++;
+    return true;
+}
+
+void CoexScheduler::alignBleSlot(unsigned long nowMs) {
+    _originMs = nowMs - _plan.wifiMs;
+    _deferredSlot = 0;
+}
+
+void CoexScheduler::accumulate(unsigned long nowMs) {
+    uint32_t dt = nowMs - _accountedMs;
+    _accountedMs = nowMs;
+    if (dt == 0) return;
+
+    bool wifi = (_activities & COEX_ACTIVITY_BIT(CoexActivity::WiFiBulk)) != 0;
+    bool ble = (_activities & COEX_BLE_ACTIVITIES) != 0;
+    uint16_t period = _policy.periodMs;
+
+    if (_plan.sliced) {
+        // poll() aralığı periyottan çok kısa: kesirler bir sonrakine taşınır
+        uint32_t wifiScaled = dt * _plan.wifiMs + _wifiRemainder;
+        uint32_t bleScaled = dt * _plan.bleMs + _bleRemainder;
+        _wifiRemainder = wifiScaled % period;
+        _bleRemainder = bleScaled % period;
+        _stats.slicedMs += dt;
+        _stats.wifiAirtimeMs += wifiScaled / period;
+        _stats.bleAirtimeMs += bleScaled / period;
+    } else {
+        if (wifi) _stats.wifiAirtimeMs += dt;
+        if (ble) _stats.bleAirtimeMs += dt;
+    }
+
+    if ((_activities & COEX_ACTIVITY_BIT(CoexActivity::BleScan)) == 0) return;
+
+    // Açık scan window süresi = dt * window / interval (kesir bir sonrakine taşınır)
+    uint16_t interval = _plan.scanWindowMs > 0 ? _plan.scanIntervalMs : _baseScanIntervalMs;
+    uint16_t window = _plan.scanWindowMs > 0 ? _plan.scanWindowMs : _baseScanWindowMs;
+    if (interval == 0) return;
+    uint32_t scaled = dt * window + _windowRemainder;
+    _windowRemainder = scaled % interval;
+    uint32_t windowMs = scaled / interval;
+    if (wifi && !_wifi5GHz) {
+        _stats.bleWindowShared += windowMs;
+    } else {
+        _stats.bleWindowClean += windowMs;
+    }
+}
+
+// ============================================================================
+// Slots
+// ============================================================================
+
+bool CoexScheduler::inWiFiSlot(unsigned long nowMs) const {
+    if (!_plan.sliced) return true;
+    return (nowMs - _originMs) % _policy.periodMs < _plan.wifiMs;
+}
+
+uint16_t CoexScheduler::msUntilBleSlot(unsigned long nowMs) const {
+    if (!_plan.sliced) return 0;
+    uint32_t phase = (nowMs - _originMs) % _policy.periodMs;
+    return phase < _plan.wifiMs ? static_cast<uint16_t>(_plan.wifiMs - phase) : 0;
+}
+
+bool CoexScheduler::grantWiFi(unsigned long nowMs) {
+    uint16_t until = msUntilBleSlot(nowMs);
+    if (!_plan.sliced || until > _policy.guardMs) {
+        _stats.wifiGrants++;
+        return true;
+    }
+    uint32_t elapsed = nowMs - _originMs;
+    uint32_t slot = elapsed / _policy.periodMs + 1;
+    _stats.wifiDeferrals++;
+    // Bekleme süresi BLE slot'u başına bir kez: ilk reddedilen istekten slot sonuna
+    if (slot != _deferredSlot) {
+        _deferredSlot = slot;
+        _stats.wifiWaitMs += _policy.periodMs - elapsed % _policy.periodMs;
+    }
+    return false;
+}
+
+// ============================================================================
+// Loss
+// ============================================================================
+
+void CoexScheduler::addScanReports(uint32_t reports, uint32_t drops) {
+    bool shared = (_activities & COEX_ACTIVITY_BIT(CoexActivity::WiFiBulk)) && !_wifi5GHz;
+    if (shared) {
+        _stats.bleReportsShared += reports;
+    } else {
+        _stats.bleReportsClean += reports;
+    }
+    _stats.bleQueueDrops += drops;
+}
+
+uint8_t CoexScheduler::getBleScanLossPercent() const {
+    if (_stats.bleWindowClean == 0 || _stats.bleWindowShared == 0 || _stats.bleReportsClean == 0) {
+        return 0;
+    }
+    // Window ms başına rapor: shared / clean
+    uint64_t shared = static_cast<uint64_t>(_stats.bleReportsShared) * _stats.bleWindowClean;
+    uint64_t clean = static_cast<uint64_t>(_stats.bleReportsClean) * _stats.bleWindowShared;
+    if (shared >= clean) return 0;
+    return static_cast<uint8_t>(100 - shared * 100 / clean);
+}
+
+const char* CoexScheduler::activityToString(CoexActivity activity) {
+    switch (activity) {
+        case CoexActivity::WiFiBulk:        return "WiFi bulk";
+        case CoexActivity::BleScan:         return "BLE scan";
+        case CoexActivity::BleAdvertising:  return "BLE adv";
+        case CoexActivity::BleConnection:   return "BLE conn";
+        default:                            return "Unknown";
+    }
+}
@@ -0,0 +1,198 @@
+/**
+ * @file CoexScheduler.h
+ * @brief WiFi / BLE time-slicing plan with per-radio airtime and loss stats
+ *
+ * RTL8720DN'de BLE ve 2.4 GHz WiFi aynı RF yolunu paylaşır: WiFi bulk
+ * transfer sürerken açık kalan scan window'ları rapor kaçırır, BLE'nin
+ * aldığı süre de WiFi throughput'undan gider.
+ *
+ * Zaman periodMs'lik periyotlara bölünür; her periyot [0, wifiMs) WiFi
+ * slot'u ve [wifiMs, periodMs) BLE slot'undan oluşur. Slot'lar aktif
+ * aktivitelerin öncelik ağırlıklarıyla (Low 1, Normal 2, High 4) paylaştırılır:
+ * - Scan: interval = periodMs, window = BLE slot'u (fazı BLE slot'una hizalı)
+ * - Advertising: önceliği WiFi bulk'tan düşükse aralık advStretchMs'e çıkar
+ * - WiFi bulk: gönderen taraf her chunk'tan önce grantWiFi() sorar; BLE
+ *   slot'unda (veya WiFi slot'unun son guardMs'inde) gelen istek ertelenir
+ * Sadece bir radyo aktifse veya WiFi 5 GHz kanalındaysa dilimleme yapılmaz.
+ *
+ * Kayıp: WiFi bulk yokken ve varken scan window'u başına rapor oranı ayrı
+ * tutulur; aradaki fark BLE scan kaybı tahminidir (getBleScanLossPercent()).
+ *
+ * Bu sınıf sadece plan ve sayaçları tutar; BLE parametreleri WirelessManager
+ * tarafından uygulanır.
+ *
+ * Kullanım:
+ *   Wireless.enableCoex(policy, &ble);
+ *   Wireless.beginWiFiBulk();
+ *   if (Wireless.grantWiFi()) sendChunk();
+ */
+
+#ifndef COEX_SCHEDULER_H
+#define COEX_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Default coexistence politikası
+#ifndef COEX_PERIOD_MS
+    #define COEX_PERIOD_MS              100
+#endif
+#ifndef COEX_MIN_BLE_PERCENT
+    #define COEX_MIN_BLE_PERCENT        10
+#endif
+#ifndef COEX_MIN_WIFI_PERCENT
+    #define COEX_MIN_WIFI_PERCENT       20
+#endif
+#ifndef COEX_ADV_STRETCH_MS
+    #define COEX_ADV_STRETCH_MS         500
+#endif
+// WiFi slot'unun son guardMs'inde grant verilmez: kuyruğa giren frame'ler
+// BLE slot'una taşmasın (1460 byte @ 24 Mbps ~0.6 ms, sürücü kuyruğu ~2 ms)
+#ifndef COEX_GUARD_MS
+    #define COEX_GUARD_MS               3
+#endif
+
+// Scan window'u bundan kısaysa anlamsız (bir advertising event'i ~0.4 ms x 3 kanal)
+#define COEX_MIN_SCAN_WINDOW_MS         3
+
+/**
+ * @brief Aktivite önceliği (değer = paylaştırma ağırlığı)
+ */
+enum class CoexPriority : uint8_t {
+    Low = 1,
+    Normal = 2,
+    High = 4
+};
+
+enum class CoexActivity : uint8_t {
+    WiFiBulk,           // Bulk transfer, bağlantı kurma, WiFi taraması
+    BleScan,
+    BleAdvertising,
+    BleConnection
+};
+
+#define COEX_ACTIVITY_COUNT     4
+#define COEX_ACTIVITY_BIT(a)    (1u << static_cast<uint8_t>(a))
+
+/**
+ * @brief Coexistence politikası
+ */
+struct CoexPolicy {
+    uint16_t periodMs;                          // Slot periyodu (= dilimli scan interval)
+    CoexPriority priority[COEX_ACTIVITY_COUNT]; // CoexActivity sırasıyla
+    uint8_t minBlePercent;                      // BLE aktifken en az bu kadar
+    uint8_t minWiFiPercent;                     // WiFi bulk aktifken en az bu kadar
+    uint16_t advStretchMs;                      // WiFi bulk sürerken advertising aralığı (0: dokunma)
+    uint8_t guardMs;                            // WiFi slot sonunda grant verilmeyen süre
+};
+
+/**
+ * @brief Güncel slot planı
+ */
+struct CoexPlan {
+    uint16_t wifiMs;            // WiFi slot'u [0, wifiMs)
+    uint16_t bleMs;             // BLE slot'u [wifiMs, periodMs)
+    uint16_t scanIntervalMs;    // 0: kullanıcının tarama ayarı
+    uint16_t scanWindowMs;
+    uint16_t advIntervalMs;     // 0: kullanıcının advertising aralığı
+    bool sliced;                // İki radyo zamanı paylaşıyor
+};
+
+/**
+ * @brief Sayaçlar (enableCoex()'ten beri)
+ */
+struct CoexStats {
+    uint32_t replans;           // Plan değişikliği
+    uint32_t slicedMs;          // Dilimlemeyle geçen süre
+    uint32_t wifiAirtimeMs;     // WiFi bulk aktifken WiFi'ye ayrılan süre
+    uint32_t bleAirtimeMs;      // BLE aktifken BLE'ye ayrılan süre
+    uint32_t wifiGrants;
+    uint32_t wifiDeferrals;     // BLE slot'una denk gelen gönderim isteği
+    uint32_t wifiWaitMs;        // BLE slot'unda bekletilen süre (ilk ret -> slot sonu)
+    uint32_t bleReportsClean;   // WiFi bulk yokken scan raporu
+    uint32_t bleWindowClean;    // ... açık scan window süresi (ms)
+    uint32_t bleReportsShared;  // WiFi bulk varken scan raporu
+    uint32_t bleWindowShared;   // ... açık scan window süresi (ms)
+    uint32_t bleQueueDrops;     // Scan kuyruğu taşması (BleModule)
+};
+
+class CoexScheduler {
+public:
+    CoexScheduler();
+
+    void setPolicy(const CoexPolicy& policy);
+    const CoexPolicy& getPolicy() const { return _policy; }
+
+    /**
+     * @brief Aktif aktiviteleri bildir
+     * @param activities COEX_ACTIVITY_BIT maskesi
+     * @param wifi5GHz Bağlı AP 5 GHz kanalında (BLE ile çakışmaz)
+     * @return true: plan değişti (BLE parametreleri yeniden uygulanmalı)
+     */
+    bool update(uint8_t activities, bool wifi5GHz, unsigned long nowMs);
+
+    /**
+     * @brief Kullanıcının scan ayarı (dilimleme yokken window oranı için)
+     */
+    void setBaseScan(uint16_t intervalMs, uint16_t windowMs);
+
+    const CoexPlan& getPlan() const { return _plan; }
+    uint8_t getActivities() const { return _activities; }
+
+    /**
+     * @brief WiFi gönderebilir mi? (dilimleme yoksa hep true)
+     */
+    bool grantWiFi(unsigned long nowMs);
+
+    bool inWiFiSlot(unsigned long nowMs) const;
+
+    /**
+     * @brief Slot fazını kaydır: BLE slot'u şimdi başlar (scan yeniden
+     *        başlatıldığında window ile hizalamak için)
+     */
+    void alignBleSlot(unsigned long nowMs);
+
+    /**
+     * @brief Sonraki BLE slot'unun başlangıcına kalan süre (ms, slot içindeyse 0)
+     */
+    uint16_t msUntilBleSlot(unsigned long nowMs) const;
+
+    /**
+     * @brief Son update()'ten beri gelen scan raporları ve kuyruk taşmaları
+     */
+    void addScanReports(uint32_t reports, uint32_t drops);
+
+    /**
+     * @brief WiFi bulk sürerken scan window'u başına rapor kaybı (%, ölçüm yoksa 0)
+     */
+    uint8_t getBleScanLossPercent() const;
+
+    const CoexStats& getStats() const { return _stats; }
+    void resetStats();
+
+    /**
+     * @brief Plan hesabı (SDK'dan bağımsız, test edilebilir)
+     */
+    static CoexPlan computePlan(const CoexPolicy& policy, uint8_t activities, bool wifi5GHz);
+
+    static CoexPolicy defaultPolicy();
+    static const char* activityToString(CoexActivity activity);
+
+private:
+    void accumulate(unsigned long nowMs);
+
+    CoexPolicy _policy;
+    CoexPlan _plan;
+    CoexStats _stats;
+    uint8_t _activities;
+    bool _wifi5GHz;
+    uint16_t _baseScanIntervalMs;
+    uint16_t _baseScanWindowMs;
+    unsigned long _originMs;        // Slot fazı (plan değişiminde sıfırlanır)
+    unsigned long _accountedMs;
+    uint32_t _windowRemainder;      // Window süresi kesir birikimi (ms * interval)
+    uint32_t _wifiRemainder;        // Airtime kesir birikimi (ms * period)
+    uint32_t _bleRemainder;
+    uint32_t _deferredSlot;         // Bekleme süresi sayılan son slot (+1, 0: yok)
+};
+
+#endif // COEX_SCHEDULER_H
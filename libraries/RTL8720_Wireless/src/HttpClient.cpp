@@ -0,0 +1,551 @@
+/**
+ * @file HttpClient.cpp
+ * @brief Non-blocking HTTP/1.1 client implementation (TcpPool + pipelining)
+ */
+
+#include "HttpClient.h"
+#include <SerialManager.h>
+
+#include <stdlib.h>
+
+namespace {
+
+bool isIdempotent(HttpMethod method) {
+    return method == HttpMethod::Get || method == HttpMethod::Head || method == HttpMethod::Options;
+}
+
+bool containsIgnoreCase(const char* s, const char* token) {
+    size_t len = strlen(token);
+    for (size_t n = strlen(s); n >= len; n--, s++) {
+        HttpSlice slice = {s, static_cast<uint16_t>(len)};
+        if (slice.equalsIgnoreCase(token)) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+HttpClient::HttpClient(TcpPool& pool)
+    : _pool(pool)
+    , _seq(0)
+    , _depth(HTTP_CLIENT_PIPELINE_DEPTH)
+    , _keepAlive(true)
+{
+    for (Request& r : _requests) {
+        r.state = Free;
+    }
+    for (Lane& lane : _lanes) {
+        lane.sock = nullptr;
+        lane.pendingCount = 0;
+        lane.sentCount = 0;
+    }
+    resetStats();
+}
+
+bool HttpClient::request(HttpMethod method, const IPAddress& ip, uint16_t port, const char* path,
+                         HttpClientCallback callback, void* user,
+                         const uint8_t* body, size_t bodyLength, const char* contentType) {
+    // Request line + Host + Content-Length / Type + Connection için yer
+    size_t headerSize = strlen(path) + (contentType ? strlen(contentType) : 0) + 112;
+    if (callback == nullptr || method == HttpMethod::Any || method == HttpMethod::Unknown ||
+        headerSize > HTTP_CLIENT_TX_BUFFER) {
+        return false;
+    }
+
+    for (Request& r : _requests) {
+        if (r.state != Free) continue;
+        r.state = Queued;
+        r.method = method;
+        r.ip = ip;
+        r.port = port;
+        r.path = path;
+        r.body = body;
+        r.bodyLength = body ? bodyLength : 0;
+        r.contentType = contentType;
+        r.callback = callback;
+        r.user = user;
+        r.seq = _seq++;
+        r.startMs = millis();
+        r.retries = 0;
+        _stats.requests++;
+        return true;
+    }
+    return false;
+}
+
+void HttpClient::setPipelineDepth(uint8_t depth) {
+    _depth = constrain(depth, 1, HTTP_CLIENT_PIPELINE_DEPTH);
+}
+
+uint8_t HttpClient::getPending() const {
+    uint8_t n = 0;
+    for (const Request& r : _requests) {
+        if (r.state != Free) n++;
+    }
+    return n;
+}
+
+void HttpClient::poll() {
+    unsigned long now = millis();
+    _pool.poll();
+    assign(now);
+    for (Lane& lane : _lanes) {
+        if (lane.sock != nullptr) serviceLane(lane, now);
+    }
+}
+
+// ============================================================================
+// Bağlantı atama
+// ============================================================================
+
+bool HttpClient::canPipeline(const Lane& lane, const Request& req) const {
+    if (lane.closing || lane.pendingCount >= _depth) return false;
+    if (lane.pendingCount == 0) return true;
+    if (!isIdempotent(req.method)) return false;
+    for (uint8_t i = 0; i < lane.pendingCount; i++) {
+        if (!isIdempotent(_requests[lane.pending[i]].method)) return false;
+    }
+    return true;
+}
+
+void HttpClient::assign(unsigned long now) {
+    // Kuyruktakiler istek sırasıyla
+    uint8_t order[HTTP_CLIENT_MAX_REQUESTS];
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < HTTP_CLIENT_MAX_REQUESTS; i++) {
+        if (_requests[i].state != Queued) continue;
+        uint8_t j = count++;
+        while (j > 0 && _requests[order[j - 1]].seq > _requests[i].seq) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    bool waiting[HTTP_CLIENT_MAX_REQUESTS] = {false};
+    for (uint8_t k = 0; k < count; k++) {
+        Request& req = _requests[order[k]];
+        if (now - req.startMs >= HTTP_CLIENT_TIMEOUT_MS) {
+            finish(req, -1, false);
+            continue;
+        }
+
+        // Aynı endpoint'in önceki isteği bekliyorsa sıra bozulmasın
+        bool blocked = false;
+        for (uint8_t j = 0; j < k && !blocked; j++) {
+            const Request& prev = _requests[order[j]];
+            blocked = waiting[j] && prev.port == req.port && prev.ip == req.ip;
+        }
+
+        Lane* target = nullptr;
+        bool endpointBusy = false;
+        for (Lane& lane : _lanes) {
+            if (lane.sock == nullptr || lane.port != req.port || lane.ip != req.ip) continue;
+            endpointBusy = true;
+            if (!blocked && canPipeline(lane, req)) {
+                target = &lane;
+                break;
+            }
+        }
+
+        if (target == nullptr && !blocked && !endpointBusy) {
+            for (Lane& lane : _lanes) {
+                if (lane.sock == nullptr) {
+                    target = &lane;
+                    break;
+                }
+            }
+            if (target != nullptr) {
+                TcpPoolStats before = _pool.getStats();
+                TcpSocket* sock = _pool.acquire(req.ip, req.port);
+                if (sock == nullptr) {
+                    if (_pool.getStats().connectFailures != before.connectFailures) {
+                        finish(req, -1, false);
+                        continue;
+                    }
+                    target = nullptr;
+                } else {
+                    target->sock = sock;
+                    target->ip = req.ip;
+                    target->port = req.port;
+                    target->pendingCount = 0;
+                    target->sentCount = 0;
+                    target->writing = false;
+                    target->closing = false;
+                    target->reused = _pool.getStats().reuses != before.reuses;
+                    target->established = target->reused;
+                    target->carried = 0;
+                    target->lastProgressMs = now;
+                    target->txLength = 0;
+                    target->txOffset = 0;
+                    resetParser(*target);
+                }
+            }
+        }
+
+        if (target == nullptr) {
+            waiting[k] = true;
+            continue;
+        }
+
+        if (target->pendingCount > 0) _stats.pipelined++;
+        if (target->reused || target->carried > 0) _stats.connectionReuses++;
+        target->carried++;
+        target->pending[target->pendingCount++] = order[k];
+        req.state = Assigned;
+        if (!_keepAlive) target->closing = true;
+    }
+}
+
+// ============================================================================
+// Gönderim
+// ============================================================================
+
+void HttpClient::formatRequest(Lane& lane, const Request& req) {
+    int n = snprintf(lane.tx, sizeof(lane.tx), "%s %s HTTP/1.1\r\nHost: %u.%u.%u.%u:%u\r\n",
+                     methodToString(req.method), req.path, req.ip[0], req.ip[1], req.ip[2], req.ip[3],
+                     req.port);
+    if (req.body != nullptr || req.method == HttpMethod::Post || req.method == HttpMethod::Put) {
+        n += snprintf(&lane.tx[n], sizeof(lane.tx) - n, "Content-Length: %lu\r\n",
+                      (unsigned long)req.bodyLength);
+    }
+    if (req.contentType != nullptr) {
+        n += snprintf(&lane.tx[n], sizeof(lane.tx) - n, "Content-Type: %s\r\n", req.contentType);
+    }
+    n += snprintf(&lane.tx[n], sizeof(lane.tx) - n, "%s\r\n", _keepAlive ? "" : "Connection: close\r\n");
+
+    lane.txLength = static_cast<uint16_t>(n);
+    lane.txOffset = 0;
+    lane.bodyOffset = 0;
+    lane.writing = true;
+}
+
+bool HttpClient::writeLane(Lane& lane, unsigned long now) {
+    while (true) {
+        if (lane.txOffset < lane.txLength) {
+            int n = lane.sock->write(reinterpret_cast<const uint8_t*>(&lane.tx[lane.txOffset]),
+                                     lane.txLength - lane.txOffset);
+            if (n < 0) return false;
+            if (n == 0) return true;
+            lane.txOffset += n;
+            lane.lastProgressMs = now;
+            continue;
+        }
+
+        if (lane.writing) {
+            const Request& req = _requests[lane.pending[lane.sentCount]];
+            if (lane.bodyOffset < req.bodyLength) {
+                int n = lane.sock->write(&req.body[lane.bodyOffset], req.bodyLength - lane.bodyOffset);
+                if (n < 0) return false;
+                if (n == 0) return true;
+                lane.bodyOffset += n;
+                lane.lastProgressMs = now;
+                continue;
+            }
+            lane.writing = false;
+            lane.sentCount++;
+        }
+
+        if (lane.sentCount >= lane.pendingCount) return true;
+        formatRequest(lane, _requests[lane.pending[lane.sentCount]]);
+    }
+}
+
+void HttpClient::serviceLane(Lane& lane, unsigned long now) {
+    TcpState state = lane.sock->poll();
+    if (state == TcpState::Connecting) return;
+    if (state == TcpState::Connected) lane.established = true;
+    if (state != TcpState::Connected || !writeLane(lane, now)) {
+        failLane(lane, true);
+        return;
+    }
+
+    uint8_t buf[512];
+    while (lane.sock != nullptr) {
+        int n = lane.sock->read(buf, sizeof(buf));
+        if (n == 0) break;
+        if (n < 0) {
+            // Content-Length'siz cevap bağlantı kapanınca biter
+            if (lane.rxState == UntilClose && lane.pendingCount > 0) complete(lane);
+            else failLane(lane, true);
+            return;
+        }
+        lane.lastProgressMs = now;
+        if (!parse(lane, buf, n)) {
+            serialManager.logPrintf("[HttpClient] Malformed response from %u.%u.%u.%u:%u\n",
+                                    lane.ip[0], lane.ip[1], lane.ip[2], lane.ip[3], lane.port);
+            failLane(lane, false);
+            return;
+        }
+    }
+
+    if (lane.sock != nullptr && now - lane.lastProgressMs >= HTTP_CLIENT_TIMEOUT_MS) {
+        failLane(lane, false);
+    }
+}
+
+// ============================================================================
+// Cevap çözümleme
+// ============================================================================
+
+bool HttpClient::parse(Lane& lane, const uint8_t* data, size_t len) {
+    size_t i = 0;
+    while (i < len && lane.sock != nullptr && lane.pendingCount > 0) {
+        lane.received = true;
+        switch (lane.rxState) {
+            case Body:
+            case ChunkData: {
+                size_t n = len - i < lane.remaining ? len - i : lane.remaining;
+                deliver(lane, &data[i], n);
+                i += n;
+                lane.remaining -= n;
+                if (lane.remaining == 0) {
+                    if (lane.rxState == Body) complete(lane);
+                    else lane.rxState = ChunkEnd;
+                }
+                break;
+            }
+            case UntilClose:
+                deliver(lane, &data[i], len - i);
+                i = len;
+                break;
+            default: {
+                char c = static_cast<char>(data[i++]);
+                if (c == '\n') {
+                    if (lane.lineLength > 0 && lane.line[lane.lineLength - 1] == '\r') lane.lineLength--;
+                    lane.line[lane.lineLength] = '\0';
+                    if (!parseLine(lane)) return false;
+                    lane.lineLength = 0;
+                } else if (lane.lineLength < sizeof(lane.line) - 1) {
+                    lane.line[lane.lineLength++] = c;
+                } else {
+                    return false;
+                }
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+bool HttpClient::parseLine(Lane& lane) {
+    const char* line = lane.line;
+    switch (lane.rxState) {
+        case StatusLine:
+            if (lane.lineLength == 0) return true;
+            if (lane.lineLength < 12 || memcmp(line, "HTTP/1.", 7) != 0) return false;
+            lane.status = static_cast<int16_t>(atoi(&line[9]));
+            if (lane.status < 100) return false;
+            lane.chunked = false;
+            lane.hasLength = false;
+            lane.remaining = 0;
+            lane.rxState = Headers;
+            return true;
+
+        case Headers: {
+            if (lane.lineLength == 0) return startBody(lane);
+            const char* colon = strchr(line, ':');
+            if (colon == nullptr) return false;
+            HttpSlice name = {line, static_cast<uint16_t>(colon - line)};
+            const char* value = colon + 1;
+            while (*value == ' ' || *value == '\t') value++;
+            if (name.equalsIgnoreCase("Content-Length")) {
+                lane.remaining = strtoul(value, nullptr, 10);
+                lane.hasLength = true;
+            } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+                lane.chunked = containsIgnoreCase(value, "chunked");
+            } else if (name.equalsIgnoreCase("Connection") && containsIgnoreCase(value, "close")) {
+                lane.closing = true;
+            }
+            return true;
+        }
+
+        case ChunkSize: {
+            char* end;
+            lane.remaining = strtoul(line, &end, 16);
+            if (end == line) return false;
+            lane.rxState = lane.remaining == 0 ? Trailers : ChunkData;
+            return true;
+        }
+
+        case ChunkEnd:
+            if (lane.lineLength != 0) return false;
+            lane.rxState = ChunkSize;
+            return true;
+
+        case Trailers:
+            if (lane.lineLength == 0) complete(lane);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool HttpClient::startBody(Lane& lane) {
+    const Request& req = _requests[lane.pending[0]];
+    if (lane.status < 200) {
+        // 1xx: asıl cevap arkasından gelir
+        lane.rxState = StatusLine;
+    } else if (req.method == HttpMethod::Head || lane.status == 204 || lane.status == 304) {
+        complete(lane);
+    } else if (lane.chunked) {
+        lane.rxState = ChunkSize;
+    } else if (lane.hasLength) {
+        if (lane.remaining == 0) complete(lane);
+        else lane.rxState = Body;
+    } else {
+        lane.rxState = UntilClose;
+        lane.closing = true;
+    }
+    return true;
+}
+
+void HttpClient::deliver(Lane& lane, const uint8_t* data, size_t len) {
+    if (len == 0) return;
+    const Request& req = _requests[lane.pending[0]];
+    _stats.bytesReceived += len;
+    HttpClientResponse res = {lane.status, data, len, false, lane.reused, 0};
+    req.callback(res, req.user);
+}
+
+void HttpClient::complete(Lane& lane) {
+    uint8_t index = lane.pending[0];
+    bool sent = lane.sentCount > 0;
+    lane.pendingCount--;
+    memmove(lane.pending, &lane.pending[1], lane.pendingCount);
+    if (sent) {
+        lane.sentCount--;
+    } else {
+        // İstek yazılırken cevap geldi (ör. 413): bağlantının geri kalanı belirsiz
+        lane.writing = false;
+        lane.txOffset = lane.txLength;
+        lane.closing = true;
+    }
+
+    int16_t status = lane.status;
+    resetParser(lane);
+    finish(_requests[index], status, lane.reused);
+
+    if (lane.closing) {
+        // Sunucu kapatacak: gönderilmiş ama cevaplanmamış istekler yeni bağlantıya
+        failLane(lane, true);
+    } else if (lane.pendingCount == 0) {
+        releaseLane(lane, true);
+    }
+}
+
+void HttpClient::failLane(Lane& lane, bool retry) {
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < lane.pendingCount; i++) {
+        Request& req = _requests[lane.pending[i]];
+        bool answered = i == 0 && lane.received;
+        bool expired = now - req.startMs >= HTTP_CLIENT_TIMEOUT_MS;
+        // Tek byte'ı bile yazılmış istek sunucuda işlenmiş olabilir (RFC 7230 6.3.1):
+        // sadece idempotent olan, havuzdan gelen (boştayken kapanmış olabilecek) veya
+        // sunucunun "Connection: close" ile kapattığı (arkasındakiler işlenmez, 6.6)
+        // bağlantıda tekrar denenir. Hiç yazılmamış istek kuyruğa döner; bağlantı
+        // hiç kurulamadıysa bu da tek tekrar hakkından düşer.
+        bool written = i < lane.sentCount || (i == lane.sentCount && lane.writing && lane.txOffset > 0);
+        bool counted = written || !lane.established;
+        bool replay = !written || ((lane.reused || lane.closing) && isIdempotent(req.method));
+        if (retry && !answered && !expired && replay && (!counted || req.retries == 0)) {
+            if (counted) req.retries++;
+            req.state = Queued;
+            _stats.retried++;
+        } else {
+            finish(req, -1, lane.reused);
+        }
+    }
+    lane.pendingCount = 0;
+    releaseLane(lane, false);
+}
+
+void HttpClient::finish(Request& req, int16_t status, bool reused) {
+    uint32_t elapsed = millis() - req.startMs;
+    if (status < 0) {
+        _stats.failed++;
+    } else {
+        _stats.completed++;
+        _stats.latencySumMs += elapsed;
+        if (elapsed > _stats.latencyMaxMs) _stats.latencyMaxMs = elapsed;
+    }
+
+    // Slot önce boşaltılır: callback yeni istek ekleyebilir
+    HttpClientCallback callback = req.callback;
+    void* user = req.user;
+    req.state = Free;
+    HttpClientResponse res = {status, nullptr, 0, true, reused, elapsed};
+    callback(res, user);
+}
+
+void HttpClient::releaseLane(Lane& lane, bool reusable) {
+    _pool.release(lane.sock, reusable && _keepAlive && !lane.closing);
+    lane.sock = nullptr;
+    lane.pendingCount = 0;
+    lane.sentCount = 0;
+    lane.writing = false;
+    lane.txLength = 0;
+    lane.txOffset = 0;
+}
+
+void HttpClient::resetParser(Lane& lane) {
+    lane.rxState = StatusLine;
+    lane.lineLength = 0;
+    lane.status = 0;
+    lane.remaining = 0;
+    lane.chunked = false;
+    lane.hasLength = false;
+    lane.received = false;
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+void HttpClient::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint32_t HttpClient::getAverageLatencyMs() const {
+    if (_stats.completed == 0) return 0;
+    return _stats.latencySumMs / _stats.completed;
+}
+
+uint8_t HttpClient::getReuseRate() const {
+    // Tekrar denenen istekler iki kez atanır
+    uint32_t assigned = _stats.requests + _stats.retried;
+    if (assigned == 0) return 0;
+    return static_cast<uint8_t>(static_cast<uint64_t>(_stats.connectionReuses) * 100 / assigned);
+}
+
+uint32_t HttpClient::getTimeSavedPerRequestUs() const {
+    uint32_t assigned = _stats.requests + _stats.retried;
+    if (assigned == 0) return 0;
+    return static_cast<uint32_t>(static_cast<uint64_t>(_stats.connectionReuses) * _pool.getAverageConnectUs() /
+                                 assigned);
+}
+
+void HttpClient::printStatus() const {
+    const HttpClientStats& s = _stats;
+    serialManager.logPrintf("[HttpClient] Requests %lu, completed %lu, failed %lu, retried %lu, "
+                            "pipelined %lu, %lu body bytes, latency avg %lu ms (max %lu)\n",
+                            (unsigned long)s.requests, (unsigned long)s.completed, (unsigned long)s.failed,
+                            (unsigned long)s.retried, (unsigned long)s.pipelined,
+                            (unsigned long)s.bytesReceived, (unsigned long)getAverageLatencyMs(),
+                            (unsigned long)s.latencyMaxMs);
+    serialManager.logPrintf("[HttpClient] Reused connection %u%%, saved %lu us/request\n",
+                            getReuseRate(), (unsigned long)getTimeSavedPerRequestUs());
+}
+
+const char* HttpClient::methodToString(HttpMethod method) {
+    switch (method) {
+        case HttpMethod::Get:       return "GET";
+        case HttpMethod::Head:      return "HEAD";
+        case HttpMethod::Post:      return "POST";
+        case HttpMethod::Put:       return "PUT";
+        case HttpMethod::Delete:    return "DELETE";
+        case HttpMethod::Options:   return "OPTIONS";
+        default:                    return "UNKNOWN";
+    }
+}
@@ -0,0 +1,235 @@
+/**
+ * @file HttpClient.h
+ * @brief Non-blocking HTTP/1.1 client on TcpPool: keep-alive connection
+ *        reuse and request pipelining
+ *
+ * request() isteği sabit tablodaki bir slota ekler ve döner; poll():
+ * - Endpoint'in bağlantısını TcpPool'dan alır (boştaki keep-alive socket
+ *   varsa handshake yok), cevap bitince havuza geri verir
+ * - GET / HEAD istekleri aynı bağlantıda cevap beklenmeden art arda
+ *   gönderilir (pipeline derinliği kadar); cevaplar sırayla çözülür.
+ *   POST / PUT / DELETE pipeline'a girmez: önceki cevaplar bitince tek
+ *   başına gönderilir
+ * - Cevap body'si parça parça callback'e verilir (Content-Length, chunked
+ *   veya bağlantı kapanana kadar), kopya / heap yok
+ * - Havuzdan alınmış bağlantı hiç cevap alınmadan koparsa (sunucu boştaki
+ *   socket'i tam o anda kapattı) veya sunucu "Connection: close" ile
+ *   kapatırsa cevapsız GET / HEAD / OPTIONS yeni bağlantıda bir kez tekrar
+ *   denenir; POST / PUT / DELETE sadece hiç
+ *   yazılmamışsa tekrar kuyruğa girer (yan etki iki kez oluşmasın). Aynı
+ *   endpoint'e istek sırası korunur
+ * - Bağlantı kurulamazsa istek bir kez daha denenir, sonra hata ile biter;
+ *   request()'ten HTTP_CLIENT_TIMEOUT_MS sonra hiçbir istek kuyruğa dönmez
+ *
+ * path, body ve contentType callback'in done çağrısına kadar geçerli kalmalıdır.
+ *
+ * Kullanım:
+ *   TcpPool pool;
+ *   HttpClient http(pool);
+ *   http.request(HttpMethod::Post, server, 80, "/upload", onResponse, nullptr,
+ *                data, len, "application/octet-stream");
+ *   void loop() { http.poll(); ... }
+ */
+
+#ifndef HTTP_CLIENT_H
+#define HTTP_CLIENT_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "TcpPool.h"
+#include "HttpServer.h"
+
+// Kuyruktaki + gönderilmiş, cevabı bekleyen istek
+#ifndef HTTP_CLIENT_MAX_REQUESTS
+    #define HTTP_CLIENT_MAX_REQUESTS        8
+#endif
+
+// Bir bağlantıda cevap beklenmeden gönderilen istek üst sınırı
+#ifndef HTTP_CLIENT_PIPELINE_DEPTH
+    #define HTTP_CLIENT_PIPELINE_DEPTH      4
+#endif
+
+// Bağlantıda ilerleme olmadan geçen süre
+#ifndef HTTP_CLIENT_TIMEOUT_MS
+    #define HTTP_CLIENT_TIMEOUT_MS          10000
+#endif
+
+// Request line + header'lar
+#define HTTP_CLIENT_TX_BUFFER               256
+
+// Status / header satırı, chunk boyutu satırı
+#define HTTP_CLIENT_LINE_BUFFER             256
+
+/**
+ * @brief Cevap olayı: body parçaları (done=false), sonra bir kez done=true
+ */
+struct HttpClientResponse {
+    int16_t status;             // -1: bağlantı hatası / zaman aşımı
+    const uint8_t* data;        // Body parçası (done=true ise nullptr)
+    size_t length;
+    bool done;
+    bool reused;                // Havuzdan alınmış (handshake'siz) bağlantı
+    uint32_t elapsedMs;         // request() -> done
+};
+
+typedef void (*HttpClientCallback)(const HttpClientResponse& res, void* user);
+
+struct HttpClientStats {
+    uint32_t requests;          // request() kabul etti
+    uint32_t completed;         // Cevap tamamlandı (her status)
+    uint32_t failed;
+    uint32_t retried;           // Cevapsız kopan bağlantı: yeni bağlantıda tekrar / yazılmadan kuyruğa dönen
+                                // (bağlantı kurulamadıysa bir kez; HTTP_CLIENT_TIMEOUT_MS'ten sonra hiç)
+    uint32_t pipelined;         // Önceki cevap beklenirken gönderilen
+    uint32_t connectionReuses;  // Handshake'siz (havuzdan / aynı bağlantıda) gönderilen
+    uint32_t bytesReceived;     // Body
+    uint32_t latencySumMs;      // request() -> done (completed)
+    uint32_t latencyMaxMs;
+};
+
+class HttpClient {
+public:
+    explicit HttpClient(TcpPool& pool);
+
+    /**
+     * @brief İsteği kuyruğa ekle (beklemez)
+     * @return false: tablo dolu veya path çok uzun
+     */
+    bool request(HttpMethod method, const IPAddress& ip, uint16_t port, const char* path,
+                 HttpClientCallback callback, void* user = nullptr,
+                 const uint8_t* body = nullptr, size_t bodyLength = 0, const char* contentType = nullptr);
+
+    bool get(const IPAddress& ip, uint16_t port, const char* path, HttpClientCallback callback,
+             void* user = nullptr) {
+        return request(HttpMethod::Get, ip, port, path, callback, user);
+    }
+
+    /**
+     * @brief false: her istek "Connection: close" ile yeni bağlantıda (karşılaştırma için)
+     */
+    void setKeepAlive(bool enabled) { _keepAlive = enabled; }
+
+    /**
+     * @brief Pipeline derinliği (1..HTTP_CLIENT_PIPELINE_DEPTH, 1: kapalı)
+     */
+    void setPipelineDepth(uint8_t depth);
+
+    /**
+     * @brief Bağlantıları sür, istekleri gönder, cevapları çöz (pool.poll() dahil)
+     */
+    void poll();
+
+    /**
+     * @brief Tamamlanmamış istek
+     */
+    uint8_t getPending() const;
+    bool isIdle() const { return getPending() == 0; }
+    uint8_t getFree() const { return HTTP_CLIENT_MAX_REQUESTS - getPending(); }
+
+    const HttpClientStats& getStats() const { return _stats; }
+    void resetStats();
+    uint32_t getAverageLatencyMs() const;
+
+    /**
+     * @brief Handshake'siz gönderilen isteklerin oranı (%)
+     */
+    uint8_t getReuseRate() const;
+
+    /**
+     * @brief İstek başına kazanılan tahmini süre (reuse x havuzun ortalama connect süresi)
+     */
+    uint32_t getTimeSavedPerRequestUs() const;
+
+    void printStatus() const;
+
+    static const char* methodToString(HttpMethod method);
+
+private:
+    enum RequestState : uint8_t {
+        Free,
+        Queued,             // Bağlantı bekliyor
+        Assigned            // Bir lane'de (gönderiliyor / cevap bekliyor)
+    };
+
+    enum RxState : uint8_t {
+        StatusLine,
+        Headers,
+        Body,
+        ChunkSize,
+        ChunkData,
+        ChunkEnd,           // Chunk sonrası CRLF
+        Trailers,
+        UntilClose
+    };
+
+    struct Request {
+        uint8_t state;
+        HttpMethod method;
+        IPAddress ip;
+        uint16_t port;
+        const char* path;
+        const uint8_t* body;
+        size_t bodyLength;
+        const char* contentType;
+        HttpClientCallback callback;
+        void* user;
+        uint32_t seq;           // İstek sırası (tekrar denemede korunur)
+        unsigned long startMs;
+        uint8_t retries;
+    };
+
+    // Bir bağlantı ve üzerindeki istekler
+    struct Lane {
+        TcpSocket* sock;        // nullptr: boş
+        IPAddress ip;
+        uint16_t port;
+        uint8_t pending[HTTP_CLIENT_PIPELINE_DEPTH];    // Request indeksleri, gönderim sırası
+        uint8_t pendingCount;
+        uint8_t sentCount;      // Tamamen yazılmış olanlar
+        bool writing;           // tx, pending[sentCount]'a ait
+        bool closing;           // Sunucu kapatacak: yeni istek atanmaz
+        bool reused;            // Havuzda boştaydı
+        bool established;       // Bağlantı kuruldu (reused veya Connected görüldü)
+        uint16_t carried;       // Bu bağlantıya atanan istek
+        unsigned long lastProgressMs;
+
+        char tx[HTTP_CLIENT_TX_BUFFER];
+        uint16_t txLength;
+        uint16_t txOffset;
+        size_t bodyOffset;
+
+        uint8_t rxState;
+        char line[HTTP_CLIENT_LINE_BUFFER];
+        uint16_t lineLength;
+        int16_t status;
+        uint32_t remaining;     // Body / chunk'ta kalan
+        bool chunked;
+        bool hasLength;
+        bool received;          // pending[0] için byte geldi
+    };
+
+    void assign(unsigned long now);
+    bool canPipeline(const Lane& lane, const Request& req) const;
+    void serviceLane(Lane& lane, unsigned long now);
+    bool writeLane(Lane& lane, unsigned long now);
+    void formatRequest(Lane& lane, const Request& req);
+    bool parse(Lane& lane, const uint8_t* data, size_t len);
+    bool parseLine(Lane& lane);
+    bool startBody(Lane& lane);
+    void deliver(Lane& lane, const uint8_t* data, size_t len);
+    void complete(Lane& lane);
+    void failLane(Lane& lane, bool retry);
+    void finish(Request& req, int16_t status, bool reused);
+    void releaseLane(Lane& lane, bool reusable);
+    void resetParser(Lane& lane);
+
+    TcpPool& _pool;
+    Request _requests[HTTP_CLIENT_MAX_REQUESTS];
+    Lane _lanes[TCP_POOL_SIZE];
+    uint32_t _seq;
+    uint8_t _depth;
+    bool _keepAlive;
+    HttpClientStats _stats;
+};
+
+#endif // HTTP_CLIENT_H
@@ -0,0 +1,655 @@
+/**
+ * @file HttpServer.cpp
+ * @brief Non-blocking HTTP/1.1 server implementation (lwIP sockets)
+ */
+
+#include "HttpServer.h"
+#include <SerialManager.h>
+#include <Profiler.h>
+
+extern "C" {
+#include "lwip/sockets.h"
+}
+
+#include <errno.h>
+
+// Chunk başlığı "XXX\r\n" (HTTP_TX_BUFFER < 0x10000) ve son "0\r\n\r\n" için yer
+#define HTTP_CHUNK_HEADER   6
+#define HTTP_CHUNK_TRAILER  2
+
+namespace {
+
+inline char lower(char c) {
+    return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+bool equalsIgnoreCase(const char* a, const char* b, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (lower(a[i]) != lower(b[i])) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Header bloğunun sonu ("\r\n\r\n" sonrası), yoksa 0
+ */
+uint16_t findHeaderEnd(const char* buf, uint16_t len) {
+    for (uint16_t i = 3; i < len; i++) {
+        if (buf[i] == '\n' && buf[i - 1] == '\r' && buf[i - 2] == '\n' && buf[i - 3] == '\r') return i + 1;
+    }
+    return 0;
+}
+
+bool containsToken(const HttpSlice& value, const char* token) {
+    size_t len = strlen(token);
+    for (uint16_t i = 0; i + len <= value.length; i++) {
+        if (equalsIgnoreCase(value.data + i, token, len)) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// HttpSlice / HttpRequest
+// ============================================================================
+
+bool HttpSlice::equals(const char* s) const {
+    return strlen(s) == length && memcmp(data, s, length) == 0;
+}
+
+bool HttpSlice::equalsIgnoreCase(const char* s) const {
+    return strlen(s) == length && ::equalsIgnoreCase(data, s, length);
+}
+
+long HttpSlice::toInt() const {
+    long value = 0;
+    bool negative = length > 0 && data[0] == '-';
+    for (uint16_t i = negative ? 1 : 0; i < length && data[i] >= '0' && data[i] <= '9'; i++) {
+        value = value * 10 + (data[i] - '0');
+    }
+    return negative ? -value : value;
+}
+
+size_t HttpSlice::copyTo(char* out, size_t max) const {
+    if (max == 0) return 0;
+    size_t n = length < max - 1 ? length : max - 1;
+    memcpy(out, data, n);
+    out[n] = '\0';
+    return n;
+}
+
+HttpSlice HttpRequest::header(const char* name) const {
+    size_t nameLen = strlen(name);
+    const char* p = _headers.data;
+    const char* end = _headers.data + _headers.length;
+
+    while (p < end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\r', end - p));
+        if (eol == nullptr) eol = end;
+        if (static_cast<size_t>(eol - p) > nameLen && p[nameLen] == ':' && equalsIgnoreCase(p, name, nameLen)) {
+            const char* v = p + nameLen + 1;
+            while (v < eol && (*v == ' ' || *v == '\t')) v++;
+            return {v, static_cast<uint16_t>(eol - v)};
+        }
+        p = eol + 2;
+    }
+    return {"", 0};
+}
+
+HttpSlice HttpRequest::param(const char* name) const {
+    size_t nameLen = strlen(name);
+    const char* p = _query.data;
+    const char* end = _query.data + _query.length;
+
+    while (p < end) {
+        const char* amp = static_cast<const char*>(memchr(p, '&', end - p));
+        if (amp == nullptr) amp = end;
+        if (static_cast<size_t>(amp - p) >= nameLen && memcmp(p, name, nameLen) == 0) {
+            if (p + nameLen == amp) return {amp, 0};
+            if (p[nameLen] == '=') return {p + nameLen + 1, static_cast<uint16_t>(amp - p - nameLen - 1)};
+        }
+        p = amp + 1;
+    }
+    return {"", 0};
+}
+
+// ============================================================================
+// HttpResponse
+// ============================================================================
+
+bool HttpResponse::addHeader(const char* name, const char* value) {
+    int n = snprintf(&_extra[_extraLength], sizeof(_extra) - _extraLength, "%s: %s\r\n", name, value);
+    if (n < 0 || _extraLength + n >= static_cast<int>(sizeof(_extra))) {
+        _extra[_extraLength] = '\0';
+        return false;
+    }
+    _extraLength += n;
+    return true;
+}
+
+bool HttpResponse::writeHeader(uint16_t status, const char* contentType, long contentLength) {
+    HttpConnection& c = *_conn;
+    const int size = static_cast<int>(sizeof(c.tx));
+    int n = snprintf(reinterpret_cast<char*>(c.tx), size,
+                     "HTTP/1.1 %u %s\r\nContent-Type: %s\r\n", status, HttpServer::statusText(status),
+                     contentType);
+    // Kesilen satırdan sonra kalan boyut negatif olmasın
+    if (n < 0 || n >= size) return false;
+    if (contentLength >= 0) {
+        n += snprintf(reinterpret_cast<char*>(&c.tx[n]), size - n, "Content-Length: %ld\r\n", contentLength);
+    } else {
+        n += snprintf(reinterpret_cast<char*>(&c.tx[n]), size - n, "Transfer-Encoding: chunked\r\n");
+    }
+    if (n >= size) return false;
+    n += snprintf(reinterpret_cast<char*>(&c.tx[n]), size - n, "%s%s\r\n",
+                  c.keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n", _extra);
+    if (n >= size) return false;
+
+    c.txLength = static_cast<uint16_t>(n);
+    c.txOffset = 0;
+    c.status = status;
+    _sent = true;
+    return true;
+}
+
+void HttpResponse::send(uint16_t status, const char* contentType, const char* body) {
+    send(status, contentType, reinterpret_cast<const uint8_t*>(body), strlen(body));
+}
+
+void HttpResponse::send(uint16_t status, const char* contentType, const uint8_t* body, size_t len) {
+    if (_sent || !writeHeader(status, contentType, static_cast<long>(len))) return;
+
+    HttpConnection& c = *_conn;
+    if (c.headOnly) return;
+    if (c.txLength + len > sizeof(c.tx)) {
+        // Body sığmıyor: handler'ın buffer'ı dönüşte geçersiz, sendStatic / stream gerekir
+        DEBUG_SERIAL.println("[HTTP] Body too large for send(), use sendStatic() or stream()");
+        _sent = false;
+        _extraLength = 0;
+        _extra[0] = '\0';
+        c.keepAlive = false;
+        send(500, "text/plain", "Response too large\n");
+        return;
+    }
+    memcpy(&c.tx[c.txLength], body, len);
+    c.txLength += len;
+}
+
+void HttpResponse::sendStatic(uint16_t status, const char* contentType, const uint8_t* data, size_t len) {
+    if (_sent || !writeHeader(status, contentType, static_cast<long>(len))) return;
+
+    HttpConnection& c = *_conn;
+    if (c.headOnly) return;
+    c.staticData = data;
+    c.staticLength = len;
+    c.staticOffset = 0;
+}
+
+void HttpResponse::stream(uint16_t status, const char* contentType, HttpChunkSource source, void* user) {
+    if (_sent || source == nullptr || !writeHeader(status, contentType, -1)) return;
+
+    HttpConnection& c = *_conn;
+    if (c.headOnly) return;
+    c.source = source;
+    c.stream.user = user;
+    c.stream.index = 0;
+    c.stream.cursor = 0;
+    c.streamDone = false;
+}
+
+// ============================================================================
+// HttpServer
+// ============================================================================
+
+HttpServer::HttpServer()
+    : _listenFd(-1)
+    , _port(0)
+    , _routes(nullptr)
+    , _routeCount(0)
+{
+    for (HttpConnection& c : _conns) {
+        c.state = HttpConnection::Free;
+    }
+    resetStats();
+}
+
+bool HttpServer::begin(uint16_t port, const HttpRoute* routes, size_t count) {
+    if (_listenFd >= 0) end();
+
+    int fd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) {
+        serialManager.logPrintf("[HTTP] Socket failed: %s\n", strerror(errno));
+        return false;
+    }
+    int one = 1;
+    lwip_setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (lwip_bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        lwip_listen(fd, HTTP_MAX_CONNECTIONS) < 0) {
+        serialManager.logPrintf("[HTTP] Listen on port %u failed: %s\n", port, strerror(errno));
+        lwip_close(fd);
+        return false;
+    }
+    int flags = lwip_fcntl(fd, F_GETFL, 0);
+    lwip_fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+    _listenFd = fd;
+    _port = port;
+    _routes = routes;
+    _routeCount = count;
+    serialManager.logPrintf("[HTTP] Listening on port %u, %u routes, %u connections\n",
+                            port, (unsigned)count, HTTP_MAX_CONNECTIONS);
+    return true;
+}
+
+void HttpServer::end() {
+    for (HttpConnection& c : _conns) {
+        if (c.state != HttpConnection::Free) closeConnection(c);
+    }
+    if (_listenFd >= 0) {
+        lwip_close(_listenFd);
+        _listenFd = -1;
+    }
+}
+
+void HttpServer::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint8_t HttpServer::getActiveConnections() const {
+    uint8_t active = 0;
+    for (const HttpConnection& c : _conns) {
+        if (c.state != HttpConnection::Free) active++;
+    }
+    return active;
+}
+
+void HttpServer::poll() {
+    if (_listenFd < 0) return;
+
+    unsigned long now = millis();
+    accept(now);
+
+    for (HttpConnection& c : _conns) {
+        if (c.state == HttpConnection::Reading) serviceRead(c, now);
+        if (c.state == HttpConnection::Writing) {
+            serviceWrite(c, now);
+            // Okumayan istemci bağlantıyı süresiz tutmasın
+            if (c.state == HttpConnection::Writing && now - c.lastActivityMs >= HTTP_REQUEST_TIMEOUT_MS) {
+                _stats.timeouts++;
+                closeConnection(c);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Connections
+// ============================================================================
+
+void HttpServer::accept(unsigned long now) {
+    while (true) {
+        HttpConnection* slot = nullptr;
+        HttpConnection* idlest = nullptr;
+        uint8_t active = 0;
+        for (HttpConnection& c : _conns) {
+            if (c.state == HttpConnection::Free) {
+                if (slot == nullptr) slot = &c;
+                continue;
+            }
+            active++;
+            // Boşta keep-alive: önceki cevap bitti, yeni istekten byte yok
+            if (c.state == HttpConnection::Reading && c.requests > 0 && c.rxLength == 0 &&
+                (idlest == nullptr || c.lastActivityMs < idlest->lastActivityMs)) {
+                idlest = &c;
+            }
+        }
+        if (slot == nullptr && idlest == nullptr) return;   // Backlog'da beklesin
+
+        int fd = lwip_accept(_listenFd, nullptr, nullptr);
+        if (fd < 0) return;
+
+        if (slot == nullptr) {
+            closeConnection(*idlest);
+            _stats.evictions++;
+            slot = idlest;
+        } else {
+            active++;
+        }
+
+        HttpConnection& c = *slot;
+        c.sock.adopt(fd);
+        c.state = HttpConnection::Reading;
+        c.requests = 0;
+        c.rxLength = 0;
+        c.lastActivityMs = now;
+        _stats.connections++;
+        if (active > _stats.connectionsHighWater) _stats.connectionsHighWater = active;
+    }
+}
+
+void HttpServer::closeConnection(HttpConnection& c) {
+    c.sock.close();
+    c.state = HttpConnection::Free;
+    c.source = nullptr;
+    c.staticData = nullptr;
+}
+
+void HttpServer::serviceRead(HttpConnection& c, unsigned long now) {
+    if (c.rxLength < sizeof(c.rx)) {
+        int n = c.sock.read(reinterpret_cast<uint8_t*>(&c.rx[c.rxLength]), sizeof(c.rx) - c.rxLength);
+        if (n < 0) {
+            closeConnection(c);
+            return;
+        }
+        if (n > 0) {
+            c.rxLength += n;
+            c.lastActivityMs = now;
+        }
+    }
+
+    uint16_t headerEnd = findHeaderEnd(c.rx, c.rxLength);
+    if (headerEnd == 0) {
+        if (c.rxLength == sizeof(c.rx)) {
+            c.keepAlive = false;
+            sendError(c, 431);
+        } else if (c.rxLength > 0 && now - c.lastActivityMs >= HTTP_REQUEST_TIMEOUT_MS) {
+            requestTimeout(c, now);
+        } else if (c.rxLength == 0 && now - c.lastActivityMs >= HTTP_KEEPALIVE_MS) {
+            _stats.timeouts++;
+            closeConnection(c);
+        }
+        return;
+    }
+
+    HttpRequest req;
+    if (!parseRequest(c, req, headerEnd)) {
+        // Header tamam, body eksik: yavaş istemci havuzu kilitlemesin
+        if (c.state == HttpConnection::Reading && now - c.lastActivityMs >= HTTP_REQUEST_TIMEOUT_MS) {
+            requestTimeout(c, now);
+        }
+        return;
+    }
+    dispatch(c, req);
+}
+
+void HttpServer::requestTimeout(HttpConnection& c, unsigned long now) {
+    _stats.timeouts++;
+    c.keepAlive = false;
+    c.lastActivityMs = now;     // 408'in gönderim süresi buradan sayılır
+    sendError(c, 408);
+}
+
+bool HttpServer::parseRequest(HttpConnection& c, HttpRequest& req, uint16_t headerEnd) {
+    const char* buf = c.rx;
+    const char* end = buf + headerEnd;
+    c.keepAlive = false;
+
+    // Request line: METHOD SP target SP HTTP/1.x CRLF
+    // Boşluklar sadece ilk satırda aranır (header'lardaki boşluk request line sayılmaz)
+    const char* eol = static_cast<const char*>(memchr(buf, '\r', headerEnd));
+    const char* sp1 = eol ? static_cast<const char*>(memchr(buf, ' ', eol - buf)) : nullptr;
+    const char* sp2 = sp1 ? static_cast<const char*>(memchr(sp1 + 1, ' ', eol - sp1 - 1)) : nullptr;
+    if (sp2 == nullptr || eol - sp2 != 9 || memcmp(sp2 + 1, "HTTP/1.", 7) != 0) {
+        sendError(c, 400);
+        return false;
+    }
+
+    req._method = parseMethod(buf, static_cast<uint16_t>(sp1 - buf));
+    const char* target = sp1 + 1;
+    const char* q = static_cast<const char*>(memchr(target, '?', sp2 - target));
+    req._path = {target, static_cast<uint16_t>((q ? q : sp2) - target)};
+    req._query = q ? HttpSlice{q + 1, static_cast<uint16_t>(sp2 - q - 1)} : HttpSlice{"", 0};
+    req._headers = {eol + 2, static_cast<uint16_t>(end - eol - 2)};
+    req._wildcard = {"", 0};
+
+    // HTTP/1.1: varsayılan keep-alive, HTTP/1.0: sadece istenirse
+    bool http11 = sp2[8] == '1';
+    HttpSlice connection = req.header("Connection");
+    req._keepAlive = http11 ? !containsToken(connection, "close") : containsToken(connection, "keep-alive");
+
+    HttpSlice cl = req.header("Content-Length");
+    long bodyLength = cl.empty() ? 0 : cl.toInt();
+    if (!req.header("Transfer-Encoding").empty()) {
+        // Chunked istek body'si desteklenmez
+        sendError(c, 411);
+        return false;
+    }
+    if (bodyLength < 0 || headerEnd + bodyLength > static_cast<long>(sizeof(c.rx))) {
+        sendError(c, 413);
+        return false;
+    }
+    if (c.rxLength < headerEnd + bodyLength) return false;     // Body bekleniyor
+
+    req._body = {buf + headerEnd, static_cast<uint16_t>(bodyLength)};
+    c.requestLength = static_cast<uint16_t>(headerEnd + bodyLength);
+    c.keepAlive = req._keepAlive && c.requests + 1 < HTTP_MAX_KEEPALIVE_REQUESTS;
+    c.headOnly = req._method == HttpMethod::Head;
+    return true;
+}
+
+void HttpServer::dispatch(HttpConnection& c, HttpRequest& req) {
+    _stats.requests++;
+    if (c.requests > 0) _stats.keepAliveReuses++;
+
+    // HEAD, GET route'una gider; body gönderilmez
+    HttpMethod method = req._method == HttpMethod::Head ? HttpMethod::Get : req._method;
+    bool methodMismatch = false;
+    const HttpRoute* route = match(_routes, _routeCount, method, req._path.data, req._path.length,
+                                   &methodMismatch);
+    if (route == nullptr) {
+        sendError(c, methodMismatch ? 405 : 404);
+        return;
+    }
+    if (route->path[route->pathLength - 1] == '*') {
+        uint16_t prefix = route->pathLength - 1;
+        req._wildcard = {req._path.data + prefix, static_cast<uint16_t>(req._path.length - prefix)};
+    }
+
+    HttpResponse res;
+    res._conn = &c;
+    res._extra[0] = '\0';
+    c.staticData = nullptr;
+    c.source = nullptr;
+    c.streamDone = true;
+
+    uint32_t start = Profiler::ticks();
+    route->handler(req, res);
+    uint32_t us = static_cast<uint32_t>(Profiler::ticksToMicros(Profiler::ticks() - start));
+    if (us > _stats.handlerMaxUs) _stats.handlerMaxUs = us;
+
+    if (!res.isSent()) {
+        sendError(c, 500);
+        return;
+    }
+    if (c.status >= 200 && c.status < 300) _stats.responses2xx++;
+    else if (c.status >= 400 && c.status < 500) _stats.responses4xx++;
+    else if (c.status >= 500) _stats.responses5xx++;
+    c.state = HttpConnection::Writing;
+}
+
+void HttpServer::sendError(HttpConnection& c, uint16_t status) {
+    char body[48];
+    int n = snprintf(body, sizeof(body), "%u %s\n", status, statusText(status));
+    if (status != 404 && status != 405) c.keepAlive = false;
+
+    c.staticData = nullptr;
+    c.source = nullptr;
+    c.streamDone = true;
+    c.headOnly = false;
+    c.status = status;
+    int len = snprintf(reinterpret_cast<char*>(c.tx), sizeof(c.tx),
+                       "HTTP/1.1 %u %s\r\nContent-Type: text/plain\r\nContent-Length: %d\r\n%s\r\n%s",
+                       status, statusText(status), n,
+                       c.keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n", body);
+    c.txLength = static_cast<uint16_t>(len);
+    c.txOffset = 0;
+    // Çözülemeyen istekte kalan byte'ların sınırı belli değil: hepsi atılır
+    if (!c.keepAlive || c.requestLength == 0 || c.requestLength > c.rxLength) c.requestLength = c.rxLength;
+
+    if (status >= 500) _stats.responses5xx++;
+    else _stats.responses4xx++;
+    c.state = HttpConnection::Writing;
+}
+
+void HttpServer::serviceWrite(HttpConnection& c, unsigned long now) {
+    while (true) {
+        if (c.txOffset < c.txLength) {
+            int n = c.sock.write(&c.tx[c.txOffset], c.txLength - c.txOffset);
+            if (n < 0) {
+                closeConnection(c);
+                return;
+            }
+            if (n == 0) return;
+            c.txOffset += n;
+            _stats.bytesSent += n;
+            c.lastActivityMs = now;
+            continue;
+        }
+
+        if (c.staticData != nullptr && c.staticOffset < c.staticLength) {
+            int n = c.sock.write(&c.staticData[c.staticOffset], c.staticLength - c.staticOffset);
+            if (n < 0) {
+                closeConnection(c);
+                return;
+            }
+            if (n == 0) return;
+            c.staticOffset += n;
+            _stats.bytesSent += n;
+            c.lastActivityMs = now;
+            continue;
+        }
+
+        if (c.source != nullptr && !c.streamDone) {
+            // Bir sonraki chunk: sadece önceki tamamen yazıldığında üretilir
+            uint8_t* data = &c.tx[HTTP_CHUNK_HEADER];
+            size_t max = sizeof(c.tx) - HTTP_CHUNK_HEADER - HTTP_CHUNK_TRAILER;
+            size_t n = c.source(data, max, c.stream);
+            c.stream.index++;
+            if (n == 0) {
+                memcpy(c.tx, "0\r\n\r\n", 5);
+                c.txOffset = 0;
+                c.txLength = 5;
+                c.streamDone = true;
+                continue;
+            }
+            if (n > max) n = max;
+            char hex[HTTP_CHUNK_HEADER + 1];
+            int k = snprintf(hex, sizeof(hex), "%X\r\n", static_cast<unsigned>(n));
+            memcpy(&c.tx[HTTP_CHUNK_HEADER - k], hex, k);
+            memcpy(&data[n], "\r\n", HTTP_CHUNK_TRAILER);
+            c.txOffset = static_cast<uint16_t>(HTTP_CHUNK_HEADER - k);
+            c.txLength = static_cast<uint16_t>(HTTP_CHUNK_HEADER + n + HTTP_CHUNK_TRAILER);
+            _stats.chunks++;
+            continue;
+        }
+
+        finishResponse(c, now);
+        return;
+    }
+}
+
+void HttpServer::finishResponse(HttpConnection& c, unsigned long now) {
+    c.requests++;
+    c.source = nullptr;
+    c.staticData = nullptr;
+    if (!c.keepAlive) {
+        closeConnection(c);
+        return;
+    }
+
+    // Pipelined istekler buffer'da kalır
+    c.rxLength -= c.requestLength;
+    memmove(c.rx, &c.rx[c.requestLength], c.rxLength);
+    c.requestLength = 0;
+    c.lastActivityMs = now;
+    c.state = HttpConnection::Reading;
+}
+
+// ============================================================================
+// Router
+// ============================================================================
+
+const HttpRoute* HttpServer::match(const HttpRoute* routes, size_t count, HttpMethod method,
+                                   const char* path, uint16_t length, bool* methodMismatch) {
+    for (size_t i = 0; i < count; i++) {
+        const HttpRoute& r = routes[i];
+        bool prefix = r.path[r.pathLength - 1] == '*';
+        uint16_t cmp = prefix ? r.pathLength - 1 : r.pathLength;
+        if (prefix ? length < cmp : length != cmp) continue;
+        if (memcmp(r.path, path, cmp) != 0) continue;
+
+        if (r.method == HttpMethod::Any || r.method == method) return &r;
+        if (methodMismatch != nullptr) *methodMismatch = true;
+    }
+    return nullptr;
+}
+
+HttpMethod HttpServer::parseMethod(const char* s, uint16_t length) {
+    switch (length) {
+        case 3:
+            if (memcmp(s, "GET", 3) == 0) return HttpMethod::Get;
+            if (memcmp(s, "PUT", 3) == 0) return HttpMethod::Put;
+            break;
+        case 4:
+            if (memcmp(s, "POST", 4) == 0) return HttpMethod::Post;
+            if (memcmp(s, "HEAD", 4) == 0) return HttpMethod::Head;
+            break;
+        case 6:
+            if (memcmp(s, "DELETE", 6) == 0) return HttpMethod::Delete;
+            break;
+        case 7:
+            if (memcmp(s, "OPTIONS", 7) == 0) return HttpMethod::Options;
+            break;
+        default:
+            break;
+    }
+    return HttpMethod::Unknown;
+}
+
+const char* HttpServer::statusText(uint16_t status) {
+    switch (status) {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 204: return "No Content";
+        case 301: return "Moved Permanently";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 408: return "Request Timeout";
+        case 411: return "Length Required";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default:  return "Unknown";
+    }
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+void HttpServer::printStatus() const {
+    const HttpServerStats& s = _stats;
+    serialManager.logPrintf("[HTTP] Port %u, connections %u/%u (peak %u), accepted %lu, evicted %lu, "
+                            "timeouts %lu\n",
+                            _port, getActiveConnections(), HTTP_MAX_CONNECTIONS, s.connectionsHighWater,
+                            (unsigned long)s.connections, (unsigned long)s.evictions,
+                            (unsigned long)s.timeouts);
+    serialManager.logPrintf("[HTTP] Requests %lu (%lu keep-alive), 2xx %lu, 4xx %lu, 5xx %lu, "
+                            "%lu bytes, %lu chunks, handler max %lu us\n",
+                            (unsigned long)s.requests, (unsigned long)s.keepAliveReuses,
+                            (unsigned long)s.responses2xx, (unsigned long)s.responses4xx,
+                            (unsigned long)s.responses5xx, (unsigned long)s.bytesSent,
+                            (unsigned long)s.chunks, (unsigned long)s.handlerMaxUs);
+}
@@ -0,0 +1,331 @@
+/**
+ * @file HttpServer.h
+ * @brief Non-blocking HTTP/1.1 server: fixed connection pool, zero-copy
+ *        router over constexpr route tables, chunked streaming responses
+ *
+ * WiFiServer döngüleri bir istemciyi servis ederken her şeyi bloklar.
+ * HttpServer poll() içinde çalışır ve hiç beklemez:
+ * - HTTP_MAX_CONNECTIONS bağlantı sabit havuzdan; havuz doluysa en uzun
+ *   süredir boşta bekleyen keep-alive bağlantısı kapatılır, yoksa yeni
+ *   bağlantı listen backlog'unda bekler
+ * - İstek bağlantının kendi buffer'ında çözümlenir; path, query, header ve
+ *   body bu buffer'ı gösteren HttpSlice'lardır (kopya / heap yok)
+ * - Route tablosu constexpr dizidir (flash'ta kalır, kayıt kopyası yok);
+ *   path uzunlukları derleme zamanında hesaplanır. Sonu '*' olan path önek eşler
+ * - Cevap: kopyalanan küçük body (send), kopyasız sabit veri (sendStatic)
+ *   veya callback'ten parça parça üretilen chunked body (stream). stream()
+ *   ile büyük bir tarama / log dökümü RAM'de tutulmaz: socket bir sonraki
+ *   parçayı alabildiğinde callback bir kez daha çağrılır
+ * - HTTP/1.1 keep-alive (ve pipelining): bağlantı HTTP_KEEPALIVE_MS boşta
+ *   kalana veya HTTP_MAX_KEEPALIVE_REQUESTS isteğe kadar açık kalır
+ *
+ * Handler'lar poll() context'inde çalışır ve beklememelidir.
+ *
+ * Kullanım:
+ *   void handleStatus(const HttpRequest& req, HttpResponse& res) {
+ *       res.send(200, "application/json", "{\"ok\":true}");
+ *   }
+ *   constexpr HttpRoute ROUTES[] = {
+ *       {HttpMethod::Get, "/status", handleStatus},
+ *   };
+ *   static_assert(httpRoutesValid(ROUTES), "bad route table");
+ *   server.begin(80, ROUTES);
+ *   void loop() { server.poll(); ... }
+ */
+
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include "TcpSocket.h"
+
+#ifndef HTTP_MAX_CONNECTIONS
+    #define HTTP_MAX_CONNECTIONS            4
+#endif
+
+// Request line + header'lar + body (bağlantı başına)
+#ifndef HTTP_REQUEST_BUFFER
+    #define HTTP_REQUEST_BUFFER             1024
+#endif
+
+// Cevap header'ı + kopyalanan body veya bir chunk (bağlantı başına)
+#ifndef HTTP_TX_BUFFER
+    #define HTTP_TX_BUFFER                  1024
+#endif
+
+#ifndef HTTP_KEEPALIVE_MS
+    #define HTTP_KEEPALIVE_MS               5000
+#endif
+
+#ifndef HTTP_MAX_KEEPALIVE_REQUESTS
+    #define HTTP_MAX_KEEPALIVE_REQUESTS     100
+#endif
+
+// Yarım kalmış isteğin (header veya body) tamamlanma süresi; cevap
+// gönderimi bu süre ilerlemezse bağlantı kapatılır
+#ifndef HTTP_REQUEST_TIMEOUT_MS
+    #define HTTP_REQUEST_TIMEOUT_MS         3000
+#endif
+
+// addHeader() ile eklenebilecek header alanı (byte)
+#define HTTP_EXTRA_HEADERS_SIZE             128
+
+enum class HttpMethod : uint8_t {
+    Get,
+    Head,
+    Post,
+    Put,
+    Delete,
+    Options,
+    Any,                // Sadece route tablosunda: her method
+    Unknown
+};
+
+/**
+ * @brief İstek buffer'ındaki bir parça (null-terminated değil)
+ */
+struct HttpSlice {
+    const char* data;
+    uint16_t length;
+
+    bool empty() const { return length == 0; }
+    bool equals(const char* s) const;
+    bool equalsIgnoreCase(const char* s) const;
+    long toInt() const;
+
+    /**
+     * @brief Null-terminated kopya (max - 1 byte'a kısaltılır)
+     */
+    size_t copyTo(char* out, size_t max) const;
+};
+
+class HttpRequest {
+public:
+    HttpMethod method() const { return _method; }
+    HttpSlice path() const { return _path; }
+    HttpSlice query() const { return _query; }
+    HttpSlice body() const { return _body; }
+
+    /**
+     * @brief Önek route'unda (sonu '*') '*' ile eşleşen kısım
+     */
+    HttpSlice wildcard() const { return _wildcard; }
+
+    /**
+     * @brief Header değeri (isim büyük/küçük harf duyarsız, yoksa boş)
+     */
+    HttpSlice header(const char* name) const;
+
+    /**
+     * @brief Query parametresi (URL-decode edilmez, yoksa boş)
+     */
+    HttpSlice param(const char* name) const;
+
+    bool keepAlive() const { return _keepAlive; }
+
+private:
+    friend class HttpServer;
+
+    HttpMethod _method;
+    HttpSlice _path;
+    HttpSlice _query;
+    HttpSlice _headers;     // Request line sonrası header bloğu
+    HttpSlice _body;
+    HttpSlice _wildcard;
+    bool _keepAlive;
+};
+
+/**
+ * @brief stream() callback durumu
+ */
+struct HttpStreamState {
+    void* user;
+    uint32_t index;         // Kaçıncı çağrı (0'dan)
+    uint32_t cursor;        // Callback'in serbest kullanımı (ör. sıradaki kayıt)
+};
+
+/**
+ * @brief Sonraki parçayı buf'a yaz
+ * @return Yazılan byte (0: body bitti)
+ */
+typedef size_t (*HttpChunkSource)(uint8_t* buf, size_t max, HttpStreamState& state);
+
+/**
+ * @brief Havuzdaki bağlantı (HttpServer iç durumu)
+ */
+struct HttpConnection {
+    enum State : uint8_t {
+        Free,
+        Reading,            // İstek bekleniyor / okunuyor
+        Writing             // Cevap gönderiliyor
+    };
+
+    TcpSocket sock;
+    uint8_t state;
+    bool keepAlive;
+    bool headOnly;
+    bool streamDone;
+    uint16_t requests;
+    unsigned long lastActivityMs;
+
+    char rx[HTTP_REQUEST_BUFFER];
+    uint16_t rxLength;
+    uint16_t requestLength;     // Cevap bitince rx'ten atılacak (header + body)
+
+    uint8_t tx[HTTP_TX_BUFFER];
+    uint16_t txLength;
+    uint16_t txOffset;
+    const uint8_t* staticData;  // sendStatic()
+    uint32_t staticLength;
+    uint32_t staticOffset;
+    HttpChunkSource source;     // stream()
+    HttpStreamState stream;
+    uint16_t status;
+};
+
+class HttpResponse {
+public:
+    /**
+     * @brief Ek header (send / stream'den önce)
+     * @return false: HTTP_EXTRA_HEADERS_SIZE doldu
+     */
+    bool addHeader(const char* name, const char* value);
+
+    /**
+     * @brief Body'yi kopyalayarak gönder (header'larla birlikte HTTP_TX_BUFFER'a sığmalı)
+     */
+    void send(uint16_t status, const char* contentType, const char* body);
+    void send(uint16_t status, const char* contentType, const uint8_t* body, size_t len);
+
+    /**
+     * @brief Sabit veriyi kopyalamadan gönder (veri gönderim bitene kadar geçerli kalmalı)
+     */
+    void sendStatic(uint16_t status, const char* contentType, const uint8_t* data, size_t len);
+
+    /**
+     * @brief Chunked body: source socket yer açtıkça tekrar çağrılır
+     */
+    void stream(uint16_t status, const char* contentType, HttpChunkSource source, void* user = nullptr);
+
+    bool isSent() const { return _sent; }
+
+private:
+    friend class HttpServer;
+
+    HttpResponse() : _conn(nullptr), _extraLength(0), _sent(false) {}
+
+    bool writeHeader(uint16_t status, const char* contentType, long contentLength);
+
+    HttpConnection* _conn;
+    char _extra[HTTP_EXTRA_HEADERS_SIZE];
+    uint16_t _extraLength;
+    bool _sent;
+};
+
+typedef void (*HttpHandler)(const HttpRequest& req, HttpResponse& res);
+
+namespace httpdetail {
+constexpr uint16_t length(const char* s, uint16_t n = 0) {
+    return s[n] == '\0' ? n : length(s, n + 1);
+}
+constexpr bool validPath(const char* s, uint16_t n = 0) {
+    return n == 0 ? (s[0] == '/' && validPath(s, 1)) :
+           s[n] == '\0' ? true :
+           s[n] == '*' ? s[n + 1] == '\0' :
+           (s[n] != ' ' && s[n] != '?' && validPath(s, n + 1));
+}
+} // namespace httpdetail
+
+struct HttpRoute {
+    HttpMethod method;
+    const char* path;       // "/status" veya önek için "/files/*"
+    HttpHandler handler;
+    uint16_t pathLength;    // Derleme zamanında
+
+    constexpr HttpRoute(HttpMethod m, const char* p, HttpHandler h)
+        : method(m), path(p), handler(h), pathLength(httpdetail::length(p)) {}
+};
+
+/**
+ * @brief Route tablosu kontrolü (static_assert ile): path '/' ile başlar,
+ *        boşluk / '?' içermez, '*' sadece sonda
+ */
+template <size_t N>
+constexpr bool httpRoutesValid(const HttpRoute (&routes)[N], size_t i = 0) {
+    return i == N ? true :
+           (routes[i].handler != nullptr && httpdetail::validPath(routes[i].path) &&
+            httpRoutesValid(routes, i + 1));
+}
+
+struct HttpServerStats {
+    uint32_t connections;       // Kabul edilen bağlantı
+    uint32_t requests;
+    uint32_t keepAliveReuses;   // Aynı bağlantıda ikinci ve sonraki istekler
+    uint32_t responses2xx;
+    uint32_t responses4xx;
+    uint32_t responses5xx;
+    uint32_t bytesSent;
+    uint32_t chunks;            // stream() parçası
+    uint32_t timeouts;          // Boşta / yarım istek / ilerlemeyen gönderim zaman aşımı
+    uint32_t evictions;         // Havuz dolu: boşta keep-alive kapatıldı
+    uint32_t handlerMaxUs;      // En uzun handler çağrısı
+    uint8_t connectionsHighWater;
+};
+
+class HttpServer {
+public:
+    HttpServer();
+
+    /**
+     * @brief Dinlemeye başla
+     * @param routes Kalıcı route tablosu (kopyalanmaz)
+     */
+    bool begin(uint16_t port, const HttpRoute* routes, size_t count);
+
+    template <size_t N>
+    bool begin(uint16_t port, const HttpRoute (&routes)[N]) { return begin(port, routes, N); }
+
+    void end();
+
+    /**
+     * @brief Bağlantı kabul et, istekleri oku, cevapları gönder
+     */
+    void poll();
+
+    bool isListening() const { return _listenFd >= 0; }
+    uint8_t getActiveConnections() const;
+
+    const HttpServerStats& getStats() const { return _stats; }
+    void resetStats();
+    void printStatus() const;
+
+    /**
+     * @brief Router (SDK'dan bağımsız, test edilebilir)
+     * @param methodMismatch Path eşleşti ama method eşleşmedi (405)
+     */
+    static const HttpRoute* match(const HttpRoute* routes, size_t count, HttpMethod method,
+                                  const char* path, uint16_t length, bool* methodMismatch = nullptr);
+
+    static HttpMethod parseMethod(const char* s, uint16_t length);
+    static const char* statusText(uint16_t status);
+
+private:
+    void accept(unsigned long now);
+    void serviceRead(HttpConnection& c, unsigned long now);
+    void requestTimeout(HttpConnection& c, unsigned long now);
+    void serviceWrite(HttpConnection& c, unsigned long now);
+    bool parseRequest(HttpConnection& c, HttpRequest& req, uint16_t headerEnd);
+    void dispatch(HttpConnection& c, HttpRequest& req);
+    void sendError(HttpConnection& c, uint16_t status);
+    void finishResponse(HttpConnection& c, unsigned long now);
+    void closeConnection(HttpConnection& c);
+
+    int _listenFd;
+    uint16_t _port;
+    const HttpRoute* _routes;
+    size_t _routeCount;
+    HttpConnection _conns[HTTP_MAX_CONNECTIONS];
+    HttpServerStats _stats;
+};
+
+#endif // HTTP_SERVER_H
@@ -0,0 +1,686 @@
+/**
+ * @file MqttClient.cpp
+ * @brief Non-blocking MQTT 3.1.1 client implementation
+ */
+
+#include "MqttClient.h"
+#include <SerialManager.h>
+#include <WiFi.h>
+
+// Packet type (fixed header üst 4 bit)
+#define MQTT_CONNECT        0x10
+#define MQTT_CONNACK        0x20
+#define MQTT_PUBLISH        0x30
+#define MQTT_PUBACK         0x40
+#define MQTT_SUBSCRIBE      0x82
+#define MQTT_SUBACK         0x90
+#define MQTT_PINGREQ        0xC0
+#define MQTT_PINGRESP       0xD0
+#define MQTT_DISCONNECT     0xE0
+
+#define MQTT_PUBLISH_DUP    0x08
+
+// Socket'ten tek seferde okunan; gelen QoS1 PUBLISH başına 4 byte PUBACK
+// (en küçük PUBLISH 7 byte) kontrol buffer'ında yer kalmalı
+#define MQTT_RX_CHUNK       64
+#define MQTT_RX_CTRL_SPACE  ((MQTT_RX_CHUNK / 7 + 1) * 4)
+
+namespace {
+
+size_t lengthBytes(uint32_t len) {
+    return len < 128 ? 1 : len < 16384 ? 2 : len < 2097152 ? 3 : 4;
+}
+
+uint8_t* putLength(uint8_t* p, uint32_t len) {
+    do {
+        uint8_t b = len & 0x7F;
+        len >>= 7;
+        *p++ = len ? (b | 0x80) : b;
+    } while (len);
+    return p;
+}
+
+uint8_t* putString(uint8_t* p, const char* s, size_t len) {
+    *p++ = static_cast<uint8_t>(len >> 8);
+    *p++ = static_cast<uint8_t>(len);
+    memcpy(p, s, len);
+    return p + len;
+}
+
+bool networkReady() {
+    return WiFi.status() == WL_CONNECTED && static_cast<uint32_t>(WiFi.localIP()) != 0;
+}
+
+const char* connackToString(uint8_t code) {
+    switch (code) {
+        case 1:  return "unacceptable protocol version";
+        case 2:  return "identifier rejected";
+        case 3:  return "server unavailable";
+        case 4:  return "bad user name or password";
+        case 5:  return "not authorized";
+        default: return "refused";
+    }
+}
+
+} // namespace
+
+MqttClient::MqttClient()
+    : _port(0)
+    , _state(MqttState::Idle)
+    , _freeCount(0)
+    , _queueCount(0)
+    , _inflightCount(0)
+    , _txOffset(0)
+    , _packetId(0)
+    , _ctrlLen(0)
+    , _ctrlOffset(0)
+    , _rxHeader(0)
+    , _rxRemaining(0)
+    , _rxPos(0)
+    , _rxMultiplier(1)
+    , _rxStage(0)
+    , _subCount(0)
+    , _callback(nullptr)
+    , _callbackUser(nullptr)
+    , _stateMs(0)
+    , _lastTxMs(0)
+    , _pingSentMs(0)
+    , _pingPending(false)
+    , _backoffMs(0)
+{
+    _config = defaultConfig("rtl8720");
+    for (uint8_t i = 0; i < MQTT_POOL_SIZE; i++) {
+        _free[_freeCount++] = i;
+    }
+    resetStats();
+}
+
+bool MqttClient::begin(const IPAddress& broker, uint16_t port, const MqttConfig& config) {
+    if (config.clientId == nullptr) return false;
+    if (_state != MqttState::Idle) end();
+
+    _config = config;
+    setInflightWindow(config.inflightWindow);
+    _broker = broker;
+    _port = port;
+    _state = MqttState::Offline;
+    _stateMs = millis();
+    _backoffMs = 0;
+
+    serialManager.logPrintf("[MQTT] Broker %u.%u.%u.%u:%u, client %s, window %u, pool %u\n",
+                            broker[0], broker[1], broker[2], broker[3], port,
+                            _config.clientId, _config.inflightWindow, MQTT_POOL_SIZE);
+    return true;
+}
+
+void MqttClient::end() {
+    if (_state == MqttState::Idle) return;
+    if (_state == MqttState::Connected) {
+        // Best effort: kuyruktaki yarım paket yoksa DISCONNECT gider
+        static const uint8_t disconnect[] = {MQTT_DISCONNECT, 0};
+        if (_txOffset == 0 && queueControl(disconnect, sizeof(disconnect))) pumpTx(millis());
+    }
+    _sock.close();
+    requeueInflight();
+    _txOffset = 0;
+    _state = MqttState::Idle;
+    serialManager.logPrintf("[MQTT] Stopped, %u queued\n", _queueCount);
+}
+
+void MqttClient::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+bool MqttClient::subscribe(const char* filter, uint8_t qos) {
+    if (filter == nullptr || _subCount >= MQTT_MAX_SUBSCRIPTIONS) return false;
+    _subs[_subCount].filter = filter;
+    _subs[_subCount].qos = qos > 1 ? 1 : qos;
+    _subCount++;
+    if (_state == MqttState::Connected) sendSubscribe();
+    return true;
+}
+
+void MqttClient::onMessage(MqttMessageCallback callback, void* user) {
+    _callback = callback;
+    _callbackUser = user;
+}
+
+void MqttClient::setInflightWindow(uint8_t window) {
+    if (window == 0) window = 1;
+    if (window > MQTT_MAX_INFLIGHT) window = MQTT_MAX_INFLIGHT;
+    _config.inflightWindow = window;
+}
+
+void MqttClient::discardQueued() {
+    for (uint8_t i = 0; i < _inflightCount; i++) {
+        freePacket(_inflight[i]);
+    }
+    _inflightCount = 0;
+    while (dropOldestQueued()) {
+    }
+}
+
+// ============================================================================
+// Packet pool
+// ============================================================================
+
+int8_t MqttClient::allocPacket() {
+    if (_freeCount == 0) return -1;
+    return static_cast<int8_t>(_free[--_freeCount]);
+}
+
+void MqttClient::freePacket(uint8_t index) {
+    _free[_freeCount++] = index;
+}
+
+uint16_t MqttClient::nextPacketId() {
+    if (++_packetId == 0) _packetId = 1;
+    return _packetId;
+}
+
+bool MqttClient::dropOldestQueued() {
+    // Yazılmaya başlamış paket socket'te yarım kalmasın diye atlanır
+    uint8_t pos = _txOffset > 0 ? 1 : 0;
+    if (pos >= _queueCount) return false;
+
+    freePacket(_queue[pos]);
+    memmove(&_queue[pos], &_queue[pos + 1], _queueCount - pos - 1);
+    _queueCount--;
+    return true;
+}
+
+void MqttClient::requeueInflight() {
+    if (_inflightCount == 0) return;
+
+    // Ack'lenmemişler kuyruğun önüne, yazılma sırasıyla
+    for (uint8_t i = 0; i < _inflightCount; i++) {
+        _pool[_inflight[i]].data[0] |= MQTT_PUBLISH_DUP;
+    }
+    memmove(&_queue[_inflightCount], &_queue[0], _queueCount);
+    memcpy(&_queue[0], _inflight, _inflightCount);
+    _queueCount += _inflightCount;
+    _inflightCount = 0;
+}
+
+// ============================================================================
+// Publish
+// ============================================================================
+
+bool MqttClient::publish(const char* topic, const uint8_t* payload, size_t len, uint8_t qos, bool retain) {
+    if (_state == MqttState::Idle || topic == nullptr) return false;
+    if (qos > 1) qos = 1;
+
+    size_t topicLen = strlen(topic);
+    uint32_t remaining = 2 + topicLen + (qos ? 2 : 0) + len;
+    if (1 + lengthBytes(remaining) + remaining > MQTT_PACKET_SIZE) {
+        _stats.oversize++;
+        return false;
+    }
+
+    int8_t index = allocPacket();
+    if (index < 0 && _config.queueFull == MqttQueueFull::DropOldest && dropOldestQueued()) {
+        _stats.dropped++;
+        index = allocPacket();
+    }
+    if (index < 0) {
+        _stats.dropped++;
+        return false;
+    }
+
+    Packet& pk = _pool[index];
+    uint8_t* p = pk.data;
+    *p++ = MQTT_PUBLISH | (qos << 1) | (retain ? 1 : 0);
+    p = putLength(p, remaining);
+    p = putString(p, topic, topicLen);
+    pk.packetId = 0;
+    if (qos) {
+        pk.packetId = nextPacketId();
+        *p++ = static_cast<uint8_t>(pk.packetId >> 8);
+        *p++ = static_cast<uint8_t>(pk.packetId);
+    }
+    if (len) memcpy(p, payload, len);
+    pk.length = static_cast<uint16_t>(p + len - pk.data);
+
+    _queue[_queueCount++] = static_cast<uint8_t>(index);
+    _stats.published++;
+    uint8_t used = MQTT_POOL_SIZE - _freeCount;
+    if (used > _stats.queueHighWater) _stats.queueHighWater = used;
+    return true;
+}
+
+bool MqttClient::publish(const char* topic, const char* payload, uint8_t qos, bool retain) {
+    return publish(topic, reinterpret_cast<const uint8_t*>(payload), strlen(payload), qos, retain);
+}
+
+// ============================================================================
+// Connection
+// ============================================================================
+
+MqttState MqttClient::poll() {
+    if (_state == MqttState::Idle) return _state;
+
+    unsigned long now = millis();
+    bool network = networkReady();
+
+    switch (_state) {
+        case MqttState::Offline:
+            if (network && now - _stateMs >= _backoffMs) startConnect(now);
+            break;
+
+        case MqttState::TcpConnecting: {
+            if (!network) {
+                connectFailed("network down");
+                break;
+            }
+            TcpState tcp = _sock.poll();
+            if (tcp == TcpState::Connected) {
+                sendConnect();
+            } else if (tcp == TcpState::Failed) {
+                connectFailed(strerror(_sock.getError()));
+            }
+            break;
+        }
+
+        case MqttState::Handshake:
+        case MqttState::Connected:
+            if (!network) {
+                if (_state == MqttState::Connected) dropConnection("network down");
+                else connectFailed("network down");
+                break;
+            }
+            if (!pumpRx(now)) break;
+
+            if (_state == MqttState::Handshake) {
+                if (now - _stateMs >= MQTT_CONNECT_TIMEOUT_MS) {
+                    connectFailed("CONNACK timeout");
+                    break;
+                }
+            } else if (_config.keepAliveS > 0) {
+                uint32_t keepAliveMs = static_cast<uint32_t>(_config.keepAliveS) * 1000;
+                if (_pingPending && now - _pingSentMs >= keepAliveMs) {
+                    dropConnection("ping timeout");
+                    break;
+                }
+                static const uint8_t ping[] = {MQTT_PINGREQ, 0};
+                if (!_pingPending && now - _lastTxMs >= keepAliveMs && queueControl(ping, sizeof(ping))) {
+                    _pingPending = true;
+                    _pingSentMs = now;
+                }
+            }
+            pumpTx(now);
+            break;
+
+        default:
+            break;
+    }
+    return _state;
+}
+
+void MqttClient::startConnect(unsigned long now) {
+    _stateMs = now;
+    _ctrlLen = _ctrlOffset = 0;
+    _txOffset = 0;
+    _rxStage = 0;
+    _pingPending = false;
+
+    if (!_sock.connect(_broker, _port, MQTT_CONNECT_TIMEOUT_MS)) {
+        connectFailed(strerror(_sock.getError()));
+        return;
+    }
+    _state = MqttState::TcpConnecting;
+}
+
+void MqttClient::connectFailed(const char* reason) {
+    _sock.close();
+    _stats.connectFailures++;
+    _backoffMs = _backoffMs == 0 ? MQTT_RECONNECT_MIN_MS :
+                 (_backoffMs * 2 > MQTT_RECONNECT_MAX_MS ? MQTT_RECONNECT_MAX_MS : _backoffMs * 2);
+    _state = MqttState::Offline;
+    _stateMs = millis();
+    serialManager.logPrintf("[MQTT] Connect failed: %s, retry in %lu ms\n",
+                            reason, (unsigned long)_backoffMs);
+}
+
+void MqttClient::dropConnection(const char* reason) {
+    _sock.close();
+    _stats.disconnects++;
+    requeueInflight();
+    _txOffset = 0;
+    _ctrlLen = _ctrlOffset = 0;
+    _pingPending = false;
+    _backoffMs = 0;
+    _state = MqttState::Offline;
+    _stateMs = millis();
+    serialManager.logPrintf("[MQTT] Connection lost: %s, %u queued\n", reason, _queueCount);
+}
+
+bool MqttClient::queueControl(const uint8_t* data, size_t len) {
+    if (_ctrlOffset > 0) {
+        memmove(_ctrl, &_ctrl[_ctrlOffset], _ctrlLen - _ctrlOffset);
+        _ctrlLen -= _ctrlOffset;
+        _ctrlOffset = 0;
+    }
+    if (_ctrlLen + len > sizeof(_ctrl)) return false;
+    memcpy(&_ctrl[_ctrlLen], data, len);
+    _ctrlLen += len;
+    return true;
+}
+
+void MqttClient::sendConnect() {
+    size_t idLen = strlen(_config.clientId);
+    size_t userLen = _config.username ? strlen(_config.username) : 0;
+    size_t passLen = (_config.username && _config.password) ? strlen(_config.password) : 0;
+
+    uint32_t remaining = 10 + 2 + idLen;
+    if (_config.username) remaining += 2 + userLen;
+    if (_config.username && _config.password) remaining += 2 + passLen;
+    if (1 + lengthBytes(remaining) + remaining > sizeof(_ctrl)) {
+        connectFailed("CONNECT too large");
+        return;
+    }
+
+    uint8_t flags = _config.cleanSession ? 0x02 : 0;
+    if (_config.username) {
+        flags |= 0x80;
+        if (_config.password) flags |= 0x40;
+    }
+
+    uint8_t* p = _ctrl;
+    *p++ = MQTT_CONNECT;
+    p = putLength(p, remaining);
+    p = putString(p, "MQTT", 4);
+    *p++ = 4;                   // Protocol level 3.1.1
+    *p++ = flags;
+    *p++ = static_cast<uint8_t>(_config.keepAliveS >> 8);
+    *p++ = static_cast<uint8_t>(_config.keepAliveS);
+    p = putString(p, _config.clientId, idLen);
+    if (flags & 0x80) p = putString(p, _config.username, userLen);
+    if (flags & 0x40) p = putString(p, _config.password, passLen);
+    _ctrlLen = static_cast<uint16_t>(p - _ctrl);
+    _ctrlOffset = 0;
+
+    _state = MqttState::Handshake;
+    pumpTx(millis());
+}
+
+void MqttClient::sendSubscribe() {
+    if (_subCount == 0) return;
+
+    uint32_t remaining = 2;
+    for (uint8_t i = 0; i < _subCount; i++) {
+        remaining += 2 + strlen(_subs[i].filter) + 1;
+    }
+    uint8_t packet[MQTT_PACKET_SIZE];
+    if (1 + lengthBytes(remaining) + remaining > sizeof(packet)) {
+        DEBUG_SERIAL.println("[MQTT] SUBSCRIBE too large");
+        return;
+    }
+
+    uint16_t id = nextPacketId();
+    uint8_t* p = packet;
+    *p++ = MQTT_SUBSCRIBE;
+    p = putLength(p, remaining);
+    *p++ = static_cast<uint8_t>(id >> 8);
+    *p++ = static_cast<uint8_t>(id);
+    for (uint8_t i = 0; i < _subCount; i++) {
+        p = putString(p, _subs[i].filter, strlen(_subs[i].filter));
+        *p++ = _subs[i].qos;
+    }
+    if (!queueControl(packet, p - packet)) {
+        DEBUG_SERIAL.println("[MQTT] Control buffer full, SUBSCRIBE dropped");
+    }
+}
+
+// ============================================================================
+// Receive
+// ============================================================================
+
+bool MqttClient::pumpRx(unsigned long now) {
+    uint8_t chunk[MQTT_RX_CHUNK];
+
+    // PUBACK'ler için yer yoksa okuma bekler (kontrol buffer'ı önce boşalsın)
+    while (sizeof(_ctrl) - (_ctrlLen - _ctrlOffset) >= MQTT_RX_CTRL_SPACE) {
+        int n = _sock.read(chunk, sizeof(chunk));
+        if (n == 0) break;
+        if (n < 0) {
+            if (_state == MqttState::Connected) dropConnection(strerror(_sock.getError()));
+            else connectFailed(strerror(_sock.getError()));
+            return false;
+        }
+
+        for (int i = 0; i < n; ) {
+            uint8_t b = chunk[i];
+            switch (_rxStage) {
+                case 0:
+                    _rxHeader = b;
+                    _rxRemaining = 0;
+                    _rxMultiplier = 1;
+                    _rxStage = 1;
+                    i++;
+                    break;
+
+                case 1:
+                    _rxRemaining += (b & 0x7F) * _rxMultiplier;
+                    _rxMultiplier *= 128;
+                    i++;
+                    if (b & 0x80) {
+                        if (_rxMultiplier > 128UL * 128 * 128) {
+                            dropConnection("malformed length");
+                            return false;
+                        }
+                        break;
+                    }
+                    _rxPos = 0;
+                    _rxStage = 2;
+                    if (_rxRemaining > 0) break;
+                    // Gövdesiz paket (PINGRESP)
+                    // fall through
+
+                case 2: {
+                    uint32_t take = _rxRemaining - _rxPos;
+                    if (take > static_cast<uint32_t>(n - i)) take = n - i;
+                    if (_rxPos < sizeof(_rx)) {
+                        uint32_t fit = sizeof(_rx) - _rxPos;
+                        memcpy(&_rx[_rxPos], &chunk[i], take < fit ? take : fit);
+                    }
+                    _rxPos += take;
+                    i += take;
+                    if (_rxPos < _rxRemaining) break;
+
+                    _rxStage = 0;
+                    if (_rxRemaining > sizeof(_rx)) {
+                        _stats.oversize++;
+                    } else if (!handlePacket(now)) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool MqttClient::handlePacket(unsigned long now) {
+    switch (_rxHeader & 0xF0) {
+        case MQTT_CONNACK:
+            if (_state != MqttState::Handshake) break;
+            if (_rxRemaining < 2 || _rx[1] != 0) {
+                connectFailed(_rxRemaining < 2 ? "bad CONNACK" : connackToString(_rx[1]));
+                return false;
+            }
+            _state = MqttState::Connected;
+            _stats.connects++;
+            _backoffMs = 0;
+            serialManager.logPrintf("[MQTT] Connected in %lu ms%s, %u queued\n",
+                                    (unsigned long)(now - _stateMs),
+                                    (_rx[0] & 0x01) ? " (session present)" : "", _queueCount);
+            _stateMs = now;
+            sendSubscribe();
+            break;
+
+        case MQTT_PUBACK:
+            if (_rxRemaining >= 2) handlePuback(static_cast<uint16_t>((_rx[0] << 8) | _rx[1]), now);
+            break;
+
+        case MQTT_PUBLISH:
+            handlePublish();
+            break;
+
+        case MQTT_SUBACK:
+            for (uint32_t i = 2; i < _rxRemaining; i++) {
+                if (_rx[i] == 0x80) DEBUG_SERIAL.println("[MQTT] Subscription rejected");
+            }
+            break;
+
+        case MQTT_PINGRESP:
+            _pingPending = false;
+            break;
+
+        default:
+            break;
+    }
+    return true;
+}
+
+void MqttClient::handlePuback(uint16_t packetId, unsigned long now) {
+    for (uint8_t i = 0; i < _inflightCount; i++) {
+        uint8_t index = _inflight[i];
+        if (_pool[index].packetId != packetId) continue;
+
+        uint32_t latency = now - _pool[index].sentMs;
+        _stats.acked++;
+        _stats.ackLatencySumMs += latency;
+        if (latency > _stats.ackLatencyMaxMs) _stats.ackLatencyMaxMs = latency;
+
+        memmove(&_inflight[i], &_inflight[i + 1], _inflightCount - i - 1);
+        _inflightCount--;
+        freePacket(index);
+        return;
+    }
+}
+
+void MqttClient::handlePublish() {
+    uint8_t qos = (_rxHeader >> 1) & 0x03;
+    if (_rxRemaining < 2) return;
+    uint16_t topicLen = static_cast<uint16_t>((_rx[0] << 8) | _rx[1]);
+    uint32_t offset = 2 + topicLen + (qos ? 2 : 0);
+    if (offset > _rxRemaining || qos > 1) return;
+
+    if (qos == 1) {
+        const uint8_t puback[] = {MQTT_PUBACK, 2, _rx[2 + topicLen], _rx[3 + topicLen]};
+        queueControl(puback, sizeof(puback));
+    }
+    _stats.received++;
+    if (_callback == nullptr) return;
+
+    if (topicLen >= MQTT_MAX_TOPIC_LENGTH) {
+        _stats.oversize++;
+        return;
+    }
+    char topic[MQTT_MAX_TOPIC_LENGTH];
+    memcpy(topic, &_rx[2], topicLen);
+    topic[topicLen] = '\0';
+    _callback(topic, &_rx[offset], _rxRemaining - offset, _callbackUser);
+}
+
+// ============================================================================
+// Transmit
+// ============================================================================
+
+void MqttClient::pumpTx(unsigned long now) {
+    while (_state == MqttState::Handshake || _state == MqttState::Connected) {
+        // Kontrol paketleri yarım kalmış bir PUBLISH'in arasına girmez
+        if (_ctrlOffset < _ctrlLen && _txOffset == 0) {
+            int n = _sock.write(&_ctrl[_ctrlOffset], _ctrlLen - _ctrlOffset);
+            if (n < 0) {
+                if (_state == MqttState::Connected) dropConnection(strerror(_sock.getError()));
+                else connectFailed(strerror(_sock.getError()));
+                return;
+            }
+            if (n == 0) return;
+            _ctrlOffset += n;
+            _lastTxMs = now;
+            if (_ctrlOffset == _ctrlLen) _ctrlLen = _ctrlOffset = 0;
+            continue;
+        }
+
+        if (_state != MqttState::Connected || _queueCount == 0) return;
+
+        uint8_t index = _queue[0];
+        Packet& pk = _pool[index];
+        if (_txOffset == 0 && pk.packetId != 0 && _inflightCount >= _config.inflightWindow) return;
+
+        int n = _sock.write(&pk.data[_txOffset], pk.length - _txOffset);
+        if (n < 0) {
+            dropConnection(strerror(_sock.getError()));
+            return;
+        }
+        if (n == 0) return;
+        _txOffset += n;
+        _lastTxMs = now;
+        if (_txOffset < pk.length) return;
+
+        _txOffset = 0;
+        memmove(&_queue[0], &_queue[1], _queueCount - 1);
+        _queueCount--;
+        _stats.sent++;
+        if (pk.data[0] & MQTT_PUBLISH_DUP) _stats.resent++;
+
+        if (pk.packetId != 0) {
+            pk.sentMs = now;
+            _inflight[_inflightCount++] = index;
+            if (_inflightCount > _stats.inflightHighWater) _stats.inflightHighWater = _inflightCount;
+        } else {
+            freePacket(index);
+        }
+    }
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+uint32_t MqttClient::getAverageAckLatencyMs() const {
+    return _stats.acked ? _stats.ackLatencySumMs / _stats.acked : 0;
+}
+
+void MqttClient::printStatus() const {
+    const MqttStats& s = _stats;
+    serialManager.logPrintf("[MQTT] State %s, queued %u, in flight %u/%u, pool %u/%u (peak %u)\n",
+                            stateToString(_state), _queueCount, _inflightCount, _config.inflightWindow,
+                            MQTT_POOL_SIZE - _freeCount, MQTT_POOL_SIZE, s.queueHighWater);
+    serialManager.logPrintf("[MQTT] Published %lu, sent %lu, acked %lu, resent %lu, dropped %lu, "
+                            "oversize %lu, received %lu\n",
+                            (unsigned long)s.published, (unsigned long)s.sent, (unsigned long)s.acked,
+                            (unsigned long)s.resent, (unsigned long)s.dropped,
+                            (unsigned long)s.oversize, (unsigned long)s.received);
+    serialManager.logPrintf("[MQTT] Connects %lu, failures %lu, disconnects %lu, "
+                            "ack latency avg %lu ms / max %lu ms\n",
+                            (unsigned long)s.connects, (unsigned long)s.connectFailures,
+                            (unsigned long)s.disconnects, (unsigned long)getAverageAckLatencyMs(),
+                            (unsigned long)s.ackLatencyMaxMs);
+}
+
+MqttConfig MqttClient::defaultConfig(const char* clientId) {
+    MqttConfig config;
+    config.clientId = clientId;
+    config.username = nullptr;
+    config.password = nullptr;
+    config.keepAliveS = MQTT_KEEPALIVE_S;
+    config.inflightWindow = MQTT_MAX_INFLIGHT;
+    config.cleanSession = true;
+    config.queueFull = MqttQueueFull::RejectNew;
+    return config;
+}
+
+const char* MqttClient::stateToString(MqttState state) {
+    switch (state) {
+        case MqttState::Idle:           return "Idle";
+        case MqttState::Offline:        return "Offline";
+        case MqttState::TcpConnecting:  return "TCP connecting";
+        case MqttState::Handshake:      return "Handshake";
+        case MqttState::Connected:      return "Connected";
+        default:                        return "Unknown";
+    }
+}
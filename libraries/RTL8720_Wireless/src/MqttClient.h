@@ -0,0 +1,270 @@
+/**
+ * @file MqttClient.h
+ * @brief Non-blocking MQTT 3.1.1 client: static packet pool, QoS1 in-flight
+ *        window and an ordered offline queue
+ *
+ * Blocking istemciler (PubSubClient) her QoS1 publish'te PUBACK bekler ve
+ * bağlantı yokken publish'i reddeder. MqttClient:
+ * - publish() paketi sabit havuzdaki bir buffer'a kodlar ve kuyruğa ekler,
+ *   hiç beklemez (heap yok, kopya sadece topic + payload)
+ * - poll() kuyruğu socket'e yazar; PUBACK beklenmeden inflightWindow kadar
+ *   QoS1 paketi yolda olabilir (RTT başına 1 yerine window kadar mesaj)
+ * - Bağlantı yokken publish edilenler aynı kuyrukta bekler (havuz kadar);
+ *   havuz dolunca politika: yeni mesajı reddet veya en eskiyi at
+ * - Yeniden bağlanınca önce ack'lenmemiş QoS1 paketleri (DUP) sonra kuyruk
+ *   gönderilir: sıra korunur
+ * - Bağlantı WiFi IP'si varken kurulur, koparsa üstel backoff ile tekrar
+ *
+ * Topic / payload pakete sığmalıdır (MQTT_PACKET_SIZE, header dahil).
+ * Gelen QoS2 desteklenmez (subscribe en fazla QoS1 ister).
+ *
+ * Kullanım:
+ *   mqtt.begin(IPAddress(192, 168, 1, 10), 1883, MqttClient::defaultConfig("node-1"));
+ *   mqtt.publish("sensors/temp", "21.5", 1);
+ *   void loop() { mqtt.poll(); ... }
+ */
+
+#ifndef MQTT_CLIENT_H
+#define MQTT_CLIENT_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "TcpSocket.h"
+
+// Kodlanmış paket boyutu üst sınırı (fixed header dahil)
+#ifndef MQTT_PACKET_SIZE
+    #define MQTT_PACKET_SIZE            256
+#endif
+
+// Publish paket havuzu = gönderim + in-flight + offline kuyruk kapasitesi
+#ifndef MQTT_POOL_SIZE
+    #define MQTT_POOL_SIZE              16
+#endif
+
+// Aynı anda ack bekleyen QoS1 paketi üst sınırı (MqttConfig::inflightWindow)
+#ifndef MQTT_MAX_INFLIGHT
+    #define MQTT_MAX_INFLIGHT           8
+#endif
+
+#ifndef MQTT_KEEPALIVE_S
+    #define MQTT_KEEPALIVE_S            30
+#endif
+
+// TCP connect + CONNACK için süre
+#ifndef MQTT_CONNECT_TIMEOUT_MS
+    #define MQTT_CONNECT_TIMEOUT_MS     5000
+#endif
+
+#ifndef MQTT_RECONNECT_MIN_MS
+    #define MQTT_RECONNECT_MIN_MS       1000
+#endif
+#ifndef MQTT_RECONNECT_MAX_MS
+    #define MQTT_RECONNECT_MAX_MS       30000
+#endif
+
+#ifndef MQTT_MAX_SUBSCRIPTIONS
+    #define MQTT_MAX_SUBSCRIPTIONS      4
+#endif
+
+// Callback'e verilen topic için stack buffer
+#define MQTT_MAX_TOPIC_LENGTH           96
+
+enum class MqttState : uint8_t {
+    Idle,               // begin() çağrılmadı
+    Offline,            // WiFi / backoff bekleniyor
+    TcpConnecting,
+    Handshake,          // CONNECT gönderildi, CONNACK bekleniyor
+    Connected
+};
+
+/**
+ * @brief Havuz doluyken publish() davranışı
+ */
+enum class MqttQueueFull : uint8_t {
+    RejectNew,          // publish() false döner
+    DropOldest          // Gönderilmeye başlamamış en eski mesaj atılır
+};
+
+struct MqttConfig {
+    const char* clientId;
+    const char* username;       // nullptr: yok
+    const char* password;
+    uint16_t keepAliveS;
+    uint8_t inflightWindow;     // 1..MQTT_MAX_INFLIGHT
+    bool cleanSession;
+    MqttQueueFull queueFull;
+};
+
+struct MqttStats {
+    uint32_t published;         // publish() kabul etti
+    uint32_t sent;              // Socket'e yazılan PUBLISH (DUP dahil)
+    uint32_t acked;             // PUBACK alınan QoS1
+    uint32_t resent;            // Yeniden bağlanınca DUP ile tekrar
+    uint32_t dropped;           // Havuz dolu (reddedilen veya atılan)
+    uint32_t oversize;          // Pakete sığmayan publish / gelen paket
+    uint32_t received;          // Gelen PUBLISH
+    uint32_t connects;          // CONNACK ile kabul
+    uint32_t connectFailures;
+    uint32_t disconnects;       // Kurulu bağlantının kopması
+    uint32_t ackLatencySumMs;   // Yazma -> PUBACK
+    uint32_t ackLatencyMaxMs;
+    uint8_t queueHighWater;     // Havuzda en fazla dolu paket
+    uint8_t inflightHighWater;
+};
+
+/**
+ * @brief Gelen mesaj (topic null-terminated, payload değil)
+ */
+typedef void (*MqttMessageCallback)(const char* topic, const uint8_t* payload, size_t len, void* user);
+
+class MqttClient {
+public:
+    MqttClient();
+
+    /**
+     * @brief Broker ve oturum ayarı; bağlantı poll() içinde kurulur
+     * @note config'teki string'ler kopyalanmaz, kalıcı olmalıdır
+     */
+    bool begin(const IPAddress& broker, uint16_t port, const MqttConfig& config);
+
+    /**
+     * @brief DISCONNECT gönder ve kapat (kuyruktakiler korunur)
+     */
+    void end();
+
+    /**
+     * @brief Mesajı kuyruğa ekle (beklemez)
+     * @param qos 0 veya 1
+     * @return false: pakete sığmıyor veya havuz dolu (RejectNew)
+     */
+    bool publish(const char* topic, const uint8_t* payload, size_t len, uint8_t qos = 0, bool retain = false);
+    bool publish(const char* topic, const char* payload, uint8_t qos = 0, bool retain = false);
+
+    /**
+     * @brief Abonelik ekle; her bağlantıda yeniden gönderilir
+     * @note filter kalıcı bir string olmalıdır
+     */
+    bool subscribe(const char* filter, uint8_t qos = 0);
+
+    void onMessage(MqttMessageCallback callback, void* user = nullptr);
+
+    /**
+     * @brief In-flight penceresini değiştir (1..MQTT_MAX_INFLIGHT, bağlantı korunur)
+     */
+    void setInflightWindow(uint8_t window);
+
+    /**
+     * @brief Kuyruktaki ve ack bekleyen mesajları at (yarım yazılmış paket hariç)
+     */
+    void discardQueued();
+
+    /**
+     * @brief Bağlantıyı yönet, kuyruğu gönder, gelen paketleri işle
+     */
+    MqttState poll();
+
+    MqttState getState() const { return _state; }
+    bool isConnected() const { return _state == MqttState::Connected; }
+
+    /**
+     * @brief Gönderilmeyi bekleyen (in-flight hariç) mesaj
+     */
+    uint8_t getQueued() const { return _queueCount; }
+    uint8_t getInflight() const { return _inflightCount; }
+
+    /**
+     * @brief Boş paket (publish() bu kadar mesajı reddetmeden alır)
+     */
+    uint8_t getFree() const { return _freeCount; }
+
+    /**
+     * @brief Kuyruk ve in-flight boş (her şey gönderildi ve ack'lendi)
+     */
+    bool isIdle() const { return _queueCount == 0 && _inflightCount == 0; }
+
+    const MqttStats& getStats() const { return _stats; }
+    void resetStats();
+    uint32_t getAverageAckLatencyMs() const;
+
+    void printStatus() const;
+
+    static MqttConfig defaultConfig(const char* clientId);
+    static const char* stateToString(MqttState state);
+
+private:
+    struct Packet {
+        uint8_t data[MQTT_PACKET_SIZE];
+        uint16_t length;
+        uint16_t packetId;      // 0: QoS0
+        uint32_t sentMs;
+    };
+
+    struct Subscription {
+        const char* filter;
+        uint8_t qos;
+    };
+
+    int8_t allocPacket();
+    void freePacket(uint8_t index);
+    uint16_t nextPacketId();
+
+    void startConnect(unsigned long now);
+    void connectFailed(const char* reason);
+    void dropConnection(const char* reason);
+    void requeueInflight();
+    bool dropOldestQueued();
+
+    bool queueControl(const uint8_t* data, size_t len);
+    void sendConnect();
+    void sendSubscribe();
+
+    bool pumpRx(unsigned long now);
+    bool handlePacket(unsigned long now);
+    void handlePuback(uint16_t packetId, unsigned long now);
+    void handlePublish();
+    void pumpTx(unsigned long now);
+
+    TcpSocket _sock;
+    MqttConfig _config;
+    IPAddress _broker;
+    uint16_t _port;
+    MqttState _state;
+
+    // Sabit paket havuzu; _queue ve _inflight havuz indekslerini tutar
+    Packet _pool[MQTT_POOL_SIZE];
+    uint8_t _free[MQTT_POOL_SIZE];
+    uint8_t _freeCount;
+    uint8_t _queue[MQTT_POOL_SIZE];     // Gönderim sırası, [0] en eski
+    uint8_t _queueCount;
+    uint8_t _inflight[MQTT_MAX_INFLIGHT]; // Yazılma sırasıyla
+    uint8_t _inflightCount;
+    uint16_t _txOffset;                 // Kuyruk başındaki paketin yazılan kısmı (0: başlamadı)
+    uint16_t _packetId;
+
+    // Kontrol paketleri (CONNECT, SUBSCRIBE, PUBACK, PINGREQ)
+    uint8_t _ctrl[MQTT_PACKET_SIZE];
+    uint16_t _ctrlLen;
+    uint16_t _ctrlOffset;
+
+    // Gelen paket çözümleyici
+    uint8_t _rx[MQTT_PACKET_SIZE];
+    uint8_t _rxHeader;
+    uint32_t _rxRemaining;              // Gövde uzunluğu
+    uint32_t _rxPos;
+    uint32_t _rxMultiplier;
+    uint8_t _rxStage;                   // 0: header, 1: uzunluk, 2: gövde
+
+    Subscription _subs[MQTT_MAX_SUBSCRIPTIONS];
+    uint8_t _subCount;
+    MqttMessageCallback _callback;
+    void* _callbackUser;
+
+    unsigned long _stateMs;             // Son durum değişimi / bağlantı denemesi
+    unsigned long _lastTxMs;
+    unsigned long _pingSentMs;
+    bool _pingPending;                  // PINGRESP bekleniyor
+    uint32_t _backoffMs;
+    MqttStats _stats;
+};
+
+#endif // MQTT_CLIENT_H
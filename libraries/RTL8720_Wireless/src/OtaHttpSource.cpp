@@ -0,0 +1,231 @@
+/**
+ * @file OtaHttpSource.cpp
+ * @brief HTTP OTA image source implementation
+ */
+
+#include "OtaHttpSource.h"
+#include "HttpServer.h"
+#include <SerialManager.h>
+
+namespace {
+
+bool containsIgnoreCase(const char* s, const char* token) {
+    size_t n = strlen(token);
+    for (; *s; s++) {
+        size_t i = 0;
+        while (i < n && s[i] && tolower(static_cast<unsigned char>(s[i])) == token[i]) i++;
+        if (i == n) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+OtaHttpSource::OtaHttpSource(OtaUpdater& ota)
+    : _ota(ota)
+    , _step(Idle)
+    , _txLength(0)
+    , _txOffset(0)
+    , _lineLength(0)
+    , _status(0)
+    , _contentLength(0)
+    , _hasLength(false)
+    , _chunked(false)
+    , _hasHash(false)
+    , _lastProgressMs(0)
+    , _timeoutMs(OTA_HTTP_TIMEOUT_MS)
+{
+    memset(_hash, 0, sizeof(_hash));
+}
+
+bool OtaHttpSource::begin(const IPAddress& ip, uint16_t port, const char* path,
+                          const uint8_t* expectedSha256, uint32_t timeoutMs) {
+    end();
+    if (!_ota.reset()) return false;
+
+    int n = snprintf(_tx, sizeof(_tx), "GET %s HTTP/1.1\r\nHost: %u.%u.%u.%u:%u\r\nConnection: close\r\n\r\n",
+                     path, ip[0], ip[1], ip[2], ip[3], port);
+    if (n <= 0 || n >= static_cast<int>(sizeof(_tx))) return false;
+    _txLength = static_cast<uint16_t>(n);
+    _txOffset = 0;
+
+    _lineLength = 0;
+    _status = 0;
+    _contentLength = 0;
+    _hasLength = false;
+    _chunked = false;
+    _hasHash = expectedSha256 != nullptr;
+    if (_hasHash) memcpy(_hash, expectedSha256, sizeof(_hash));
+    _timeoutMs = timeoutMs;
+    _lastProgressMs = millis();
+
+    if (!_sock.connect(ip, port)) {
+        fail(OtaError::Source);
+        return false;
+    }
+    _step = Connecting;
+    return true;
+}
+
+void OtaHttpSource::end() {
+    if (_step != Idle && _step != Closed) _ota.abort();
+    _sock.close();
+    _step = Idle;
+}
+
+OtaState OtaHttpSource::poll() {
+    _ota.poll();
+    unsigned long now = millis();
+
+    switch (_step) {
+        case Connecting: {
+            TcpState tcp = _sock.poll();
+            if (tcp == TcpState::Failed) {
+                fail(OtaError::Source);
+                break;
+            }
+            if (tcp != TcpState::Connected) break;
+            _step = Sending;
+            _lastProgressMs = now;
+        }
+        // fall through
+        case Sending: {
+            int n = _sock.write(reinterpret_cast<const uint8_t*>(_tx) + _txOffset, _txLength - _txOffset);
+            if (n < 0) {
+                fail(OtaError::Source);
+                break;
+            }
+            if (n > 0) _lastProgressMs = now;
+            _txOffset += n;
+            if (_txOffset == _txLength) _step = Headers;
+            break;
+        }
+        case Headers: {
+            int n = _sock.read(_rx, sizeof(_rx));
+            if (n < 0) {
+                fail(OtaError::Source);
+                break;
+            }
+            if (n == 0) break;
+            _lastProgressMs = now;
+
+            size_t used = 0;
+            if (!parseHeaders(_rx, n, &used)) {
+                fail(OtaError::Source);
+                break;
+            }
+            if (_step != Body) break;
+
+            // Header'larla gelen ilk body byte'ları (buffer'lar boş: hepsi sığar)
+            if (used < static_cast<size_t>(n)) _ota.write(_rx + used, n - used);
+            readBody();
+            break;
+        }
+        case Body:
+            if (_ota.isActive()) {
+                readBody();
+            } else {
+                // Done / Failed: sunucunun kapatmasını beklemeden bırak
+                _sock.close();
+                _step = Closed;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (_step >= Connecting && _step <= Body && now - _lastProgressMs > _timeoutMs) {
+        fail(OtaError::Timeout);
+    }
+    return _ota.getState();
+}
+
+bool OtaHttpSource::parseHeaders(const uint8_t* data, size_t len, size_t* used) {
+    for (size_t i = 0; i < len; i++) {
+        char c = static_cast<char>(data[i]);
+        if (c == '\r') continue;
+        if (c != '\n') {
+            if (_lineLength >= sizeof(_line) - 1) return false;
+            _line[_lineLength++] = c;
+            continue;
+        }
+
+        _line[_lineLength] = '\0';
+        bool end = _lineLength == 0 && _status != 0;
+        if (!end && !parseLine()) return false;
+        _lineLength = 0;
+        if (end) {
+            *used = i + 1;
+            return startImage();
+        }
+    }
+    *used = len;
+    return true;
+}
+
+bool OtaHttpSource::parseLine() {
+    if (_status == 0) {
+        if (_lineLength < 12 || memcmp(_line, "HTTP/1.", 7) != 0) return false;
+        _status = static_cast<int16_t>(atoi(&_line[9]));
+        return _status >= 100;
+    }
+
+    const char* colon = strchr(_line, ':');
+    if (colon == nullptr) return false;
+    HttpSlice name = {_line, static_cast<uint16_t>(colon - _line)};
+    const char* value = colon + 1;
+    while (*value == ' ' || *value == '\t') value++;
+
+    if (name.equalsIgnoreCase("Content-Length")) {
+        _contentLength = strtoul(value, nullptr, 10);
+        _hasLength = true;
+    } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+        _chunked = containsIgnoreCase(value, "chunked");
+    } else if (name.equalsIgnoreCase("X-Firmware-SHA256") && !_hasHash) {
+        size_t length = strlen(value);
+        while (length > 0 && (value[length - 1] == ' ' || value[length - 1] == '\t')) length--;
+        _hasHash = OtaUpdater::parseHash(value, length, _hash);
+    }
+    return true;
+}
+
+bool OtaHttpSource::startImage() {
+    if (_status != 200 || !_hasLength || _chunked || !_hasHash) {
+        serialManager.logPrintf("[OTA] HTTP %d, length %s, %s, hash %s\n", _status,
+                                _hasLength ? "ok" : "missing", _chunked ? "chunked" : "identity",
+                                _hasHash ? "ok" : "missing");
+        return false;
+    }
+    if (!_ota.begin(_contentLength, _hash)) {
+        _sock.close();
+        _step = Closed;
+        return true;
+    }
+    _step = Body;
+    return true;
+}
+
+void OtaHttpSource::readBody() {
+    unsigned long now = millis();
+    for (;;) {
+        size_t space;
+        uint8_t* buf = _ota.getBuffer(&space);
+        if (space == 0) return;
+
+        int n = _sock.read(buf, space);
+        if (n == 0) return;
+        if (n < 0) {
+            // Bağlantı imaj bitmeden kapandı
+            if (_ota.isActive() && _ota.getRemaining() > 0) fail(OtaError::Source);
+            return;
+        }
+        _ota.commit(n);
+        _lastProgressMs = now;
+    }
+}
+
+void OtaHttpSource::fail(OtaError error) {
+    _ota.abort(error);
+    _sock.close();
+    _step = Closed;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file OtaHttpSource.h
+ * @brief Streams an OTA image from an HTTP server into OtaUpdater
+ *
+ * Tek GET isteği ("Connection: close"), beklemeyen TcpSocket üzerinde:
+ * - Cevap 200 ve Content-Length olmalıdır (imaj boyutu bank kontrolü için
+ *   önceden bilinmeli; chunked kabul edilmez)
+ * - Beklenen SHA-256 begin()'e verilir veya sunucunun X-Firmware-SHA256
+ *   header'ından (64 hex) alınır; ikisi de yoksa güncelleme başlamaz
+ * - Body doğrudan OtaUpdater buffer'ına okunur (kopyasız). Buffer'lar
+ *   doluyken socket okunmaz: TCP penceresi kapanır, sunucu flash'ı bekler
+ *
+ * Kullanım:
+ *   OtaUpdater ota;
+ *   OtaHttpSource http(ota);
+ *   http.begin(IPAddress(192, 168, 1, 10), 8080, "/firmware.bin");
+ *   void loop() {
+ *       if (http.poll() == OtaState::Done) sys_reset();
+ *   }
+ */
+
+#ifndef OTA_HTTP_SOURCE_H
+#define OTA_HTTP_SOURCE_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "TcpSocket.h"
+#include "OtaUpdater.h"
+
+// Bağlantıda / alımda ilerleme olmadan geçen süre
+#ifndef OTA_HTTP_TIMEOUT_MS
+    #define OTA_HTTP_TIMEOUT_MS         10000
+#endif
+
+// Request line + header'lar
+#define OTA_HTTP_TX_BUFFER              192
+
+// Status / header satırı (X-Firmware-SHA256 sığmalı)
+#define OTA_HTTP_LINE_BUFFER            128
+
+// Header okuma parçası (artan body byte'ları OtaUpdater::write ile kopyalanır)
+#define OTA_HTTP_RX_BUFFER              256
+
+class OtaHttpSource {
+public:
+    explicit OtaHttpSource(OtaUpdater& ota);
+
+    /**
+     * @brief GET isteğini başlat (beklemez)
+     * @param expectedSha256 32 byte, nullptr: X-Firmware-SHA256 header'ı kullanılır
+     * @return false: path çok uzun veya socket açılamadı
+     */
+    bool begin(const IPAddress& ip, uint16_t port, const char* path,
+               const uint8_t* expectedSha256 = nullptr, uint32_t timeoutMs = OTA_HTTP_TIMEOUT_MS);
+
+    /**
+     * @brief Bağlantıyı, header'ları ve body'yi ilerlet, OtaUpdater::poll() dahil
+     */
+    OtaState poll();
+
+    /**
+     * @brief Bağlantıyı kapat (süren güncelleme Aborted)
+     */
+    void end();
+
+    /**
+     * @brief HTTP status (0: henüz yok)
+     */
+    int16_t getStatus() const { return _status; }
+    uint32_t getConnectTimeUs() const { return _sock.getConnectTimeUs(); }
+
+private:
+    enum Step : uint8_t {
+        Idle,
+        Connecting,
+        Sending,
+        Headers,
+        Body,
+        Closed
+    };
+
+    bool parseHeaders(const uint8_t* data, size_t len, size_t* used);
+    bool parseLine();
+    bool startImage();
+    void readBody();
+    void fail(OtaError error);
+
+    OtaUpdater& _ota;
+    TcpSocket _sock;
+    Step _step;
+
+    char _tx[OTA_HTTP_TX_BUFFER];
+    uint16_t _txLength;
+    uint16_t _txOffset;
+
+    char _line[OTA_HTTP_LINE_BUFFER];
+    uint16_t _lineLength;
+    uint8_t _rx[OTA_HTTP_RX_BUFFER];
+
+    int16_t _status;
+    uint32_t _contentLength;
+    bool _hasLength;
+    bool _chunked;
+    bool _hasHash;
+    uint8_t _hash[OTA_HASH_SIZE];
+
+    unsigned long _lastProgressMs;
+    uint32_t _timeoutMs;
+};
+
+#endif // OTA_HTTP_SOURCE_H
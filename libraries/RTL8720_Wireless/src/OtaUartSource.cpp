@@ -0,0 +1,259 @@
+/**
+ * @file OtaUartSource.cpp
+ * @brief LP_UART framed OTA image source implementation
+ */
+
+#include "OtaUartSource.h"
+#include <SerialManager.h>
+
+namespace {
+
+const uint8_t kStart = 'S';
+const uint8_t kData = 'D';
+const uint8_t kAck = 'A';
+const uint8_t kNak = 'N';
+const uint8_t kResult = 'F';
+
+uint32_t readLe32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void writeLe32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+} // namespace
+
+OtaUartSource::OtaUartSource(OtaUpdater& ota)
+    : _ota(ota)
+    , _rxState(WaitSof)
+    , _rxCount(0)
+    , _length(0)
+    , _lastByteMs(0)
+    , _lastFrameMs(0)
+    , _held(false)
+    , _heldOffset(0)
+    , _heldLength(0)
+    , _started(false)
+{
+    memset(_header, 0, sizeof(_header));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void OtaUartSource::begin() {
+    _rxState = WaitSof;
+    _rxCount = 0;
+    _held = false;
+    _started = false;
+    _lastByteMs = millis();
+    _lastFrameMs = _lastByteMs;
+}
+
+OtaState OtaUartSource::poll() {
+    unsigned long now = millis();
+    _ota.poll();
+
+    // Bekleyen çerçeve yazılmadan yeni byte okunmaz (gönderici Ack bekliyor)
+    if (!_held || deliverHeld()) {
+        receive(now);
+    }
+
+    if (_ota.isActive() && now - _lastFrameMs > OTA_UART_TIMEOUT_MS) {
+        _held = false;
+        _ota.abort(OtaError::Timeout);
+    }
+
+    OtaState state = _ota.poll();
+    if (_started && (state == OtaState::Done || state == OtaState::Failed)) {
+        uint8_t error = static_cast<uint8_t>(_ota.getError());
+        sendFrame(kResult, &error, 1);
+        _started = false;
+    }
+    return state;
+}
+
+void OtaUartSource::receive(unsigned long now) {
+    if (_rxState != WaitSof && now - _lastByteMs > OTA_UART_BYTE_TIMEOUT_MS) {
+        _stats.framingErrors++;
+        _rxState = WaitSof;
+    }
+
+    // Bir çerçeveden fazlasını tek poll()'da okuma
+    size_t budget = OTA_UART_MAX_PAYLOAD + 8;
+    while (budget-- > 0 && serialManager.dataAvailable()) {
+        int c = serialManager.readDataByte();
+        if (c < 0) break;
+        _lastByteMs = now;
+
+        switch (_rxState) {
+            case WaitSof:
+                if (c == OTA_UART_SOF) {
+                    _rxState = Header;
+                    _rxCount = 0;
+                }
+                break;
+            case Header:
+                _header[_rxCount++] = static_cast<uint8_t>(c);
+                if (_rxCount < sizeof(_header)) break;
+                _length = static_cast<uint16_t>(_header[1] | (_header[2] << 8));
+                _rxCount = 0;
+                if (_length > OTA_UART_MAX_PAYLOAD) {
+                    _stats.framingErrors++;
+                    _rxState = WaitSof;
+                } else {
+                    _rxState = _length > 0 ? Payload : Crc;
+                }
+                break;
+            case Payload:
+                _frame[_rxCount++] = static_cast<uint8_t>(c);
+                if (_rxCount == _length) _rxState = Crc;
+                break;
+            case Crc: {
+                _frame[_rxCount++] = static_cast<uint8_t>(c);
+                if (_rxCount < _length + 2) break;
+                _rxState = WaitSof;
+
+                uint16_t crc = crc16(_frame, _length, crc16(_header, sizeof(_header)));
+                if (crc != (_frame[_length] | (_frame[_length + 1] << 8))) {
+                    _stats.crcErrors++;
+                    sendNak(OtaError::Source);
+                    break;
+                }
+                _lastFrameMs = now;
+                handleFrame();
+                if (_held) return;
+                break;
+            }
+            default:
+                _rxState = WaitSof;
+                break;
+        }
+    }
+}
+
+void OtaUartSource::handleFrame() {
+    _stats.frames++;
+
+    switch (_header[0]) {
+        case kStart: {
+            if (_length != 4 + OTA_HASH_SIZE) {
+                sendNak(OtaError::Source);
+                return;
+            }
+            uint32_t size = readLe32(_frame);
+            if (_ota.isActive()) {
+                // Ack'i kaybolmuş Start tekrar geldi
+                if (_started && size == _ota.getImageSize()) {
+                    _stats.duplicates++;
+                    sendAck();
+                    return;
+                }
+                _ota.abort();
+                _ota.poll();
+            }
+            _ota.reset();
+            if (!_ota.begin(size, _frame + 4)) {
+                sendNak(_ota.getError() != OtaError::None ? _ota.getError() : OtaError::Aborted);
+                return;
+            }
+            _started = true;
+            sendAck();
+            return;
+        }
+        case kData: {
+            if (!_ota.isActive() || _length < 4) {
+                sendNak(OtaError::Source);
+                return;
+            }
+            uint32_t offset = readLe32(_frame);
+            uint16_t len = _length - 4;
+            if (offset + len <= _ota.getReceived()) {
+                _stats.duplicates++;
+                sendAck();
+                return;
+            }
+            if (offset != _ota.getReceived()) {
+                sendNak(OtaError::Source);
+                return;
+            }
+            _held = true;
+            _heldOffset = 4;
+            _heldLength = len;
+            if (!deliverHeld()) _stats.heldFrames++;
+            return;
+        }
+        default:
+            sendNak(OtaError::Source);
+            return;
+    }
+}
+
+bool OtaUartSource::deliverHeld() {
+    if (!_ota.isActive()) {
+        // Güncelleme bitti / bozuldu: Result gönderilecek
+        _held = false;
+        return true;
+    }
+    size_t n = _ota.write(_frame + _heldOffset, _heldLength);
+    _heldOffset += n;
+    _heldLength -= n;
+    if (_heldLength > 0) return false;
+
+    _held = false;
+    sendAck();
+    return true;
+}
+
+void OtaUartSource::sendFrame(uint8_t type, const uint8_t* payload, uint16_t len) {
+    uint8_t buf[16];
+    if (len > sizeof(buf) - 6) return;
+    buf[0] = OTA_UART_SOF;
+    buf[1] = type;
+    buf[2] = static_cast<uint8_t>(len);
+    buf[3] = static_cast<uint8_t>(len >> 8);
+    memcpy(&buf[4], payload, len);
+    uint16_t crc = crc16(&buf[1], 3 + len);
+    buf[4 + len] = static_cast<uint8_t>(crc);
+    buf[5 + len] = static_cast<uint8_t>(crc >> 8);
+    serialManager.sendData(buf, 6 + len);
+}
+
+void OtaUartSource::sendAck() {
+    uint8_t payload[4];
+    writeLe32(payload, _ota.getReceived());
+    sendFrame(kAck, payload, sizeof(payload));
+}
+
+void OtaUartSource::sendNak(OtaError error) {
+    uint8_t payload[5];
+    payload[0] = static_cast<uint8_t>(error);
+    writeLe32(&payload[1], _ota.isActive() ? _ota.getReceived() : 0);
+    sendFrame(kNak, payload, sizeof(payload));
+    _stats.naks++;
+}
+
+void OtaUartSource::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void OtaUartSource::printStatus() const {
+    serialManager.logPrintf("[OTA] UART: %lu frames, %lu CRC errors, %lu framing errors, %lu duplicates, "
+                            "%lu naks, %lu held for flash\n",
+                            (unsigned long)_stats.frames, (unsigned long)_stats.crcErrors,
+                            (unsigned long)_stats.framingErrors, (unsigned long)_stats.duplicates,
+                            (unsigned long)_stats.naks, (unsigned long)_stats.heldFrames);
+}
+
+uint16_t OtaUartSource::crc16(const uint8_t* data, size_t len, uint16_t crc) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file OtaUartSource.h
+ * @brief Receives an OTA image over LP_UART (Serial1) in CRC-checked frames
+ *
+ * Çerçeve (little-endian):
+ *   0xA5 | type | len (2) | payload (len) | CRC-16/CCITT-FALSE (2, type..payload)
+ *
+ * Gönderici -> cihaz:
+ *   'S' Start: imaj boyutu (4) + SHA-256 (32)
+ *   'D' Data:  offset (4) + en fazla OTA_UART_CHUNK_SIZE byte
+ * Cihaz -> gönderici:
+ *   'A' Ack:    sıradaki beklenen offset (4)
+ *   'N' Nak:    OtaError (1) + sıradaki beklenen offset (4); CRC hatası,
+ *               beklenmeyen offset veya başlatılamayan imaj
+ *   'F' Result: OtaError (1), 0: doğrulandı ve bank değişti
+ *
+ * Gönderici her çerçeveden sonra Ack / Nak bekler (stop-and-wait) ve Nak'taki
+ * offset'ten devam eder; kaybolan Ack yüzünden tekrar gelen çerçeve tekrar
+ * yazılmaz, sadece Ack'lenir. Data çerçevesi OtaUpdater'a sığana kadar
+ * (writer meşgulken) Ack gönderilmez: gönderici flash'ı bekler.
+ *
+ * Host'ta Serial1 bir PTY'dir: host/ota_uart_send.py imajı yazdırılan
+ * /dev/pts/N yoluna gönderir.
+ *
+ * Kullanım:
+ *   OtaUpdater ota;
+ *   OtaUartSource uart(ota);
+ *   uart.begin();
+ *   void loop() {
+ *       if (uart.poll() == OtaState::Done) sys_reset();
+ *   }
+ */
+
+#ifndef OTA_UART_SOURCE_H
+#define OTA_UART_SOURCE_H
+
+#include <Arduino.h>
+#include "OtaUpdater.h"
+
+// Data çerçevesindeki imaj byte'ı üst sınırı
+#ifndef OTA_UART_CHUNK_SIZE
+    #define OTA_UART_CHUNK_SIZE         1024
+#endif
+
+// Çerçeve ortasında byte gelmeden geçen süre (parser sıfırlanır)
+#ifndef OTA_UART_BYTE_TIMEOUT_MS
+    #define OTA_UART_BYTE_TIMEOUT_MS    200
+#endif
+
+// Güncelleme sürerken çerçeve gelmeden geçen süre
+#ifndef OTA_UART_TIMEOUT_MS
+    #define OTA_UART_TIMEOUT_MS         10000
+#endif
+
+#define OTA_UART_SOF                    0xA5
+#define OTA_UART_MAX_PAYLOAD            (OTA_UART_CHUNK_SIZE + 4)
+
+struct OtaUartStats {
+    uint32_t frames;            // CRC'si doğru çerçeve
+    uint32_t crcErrors;
+    uint32_t framingErrors;     // Uzunluk aşımı / byte zaman aşımı
+    uint32_t duplicates;        // Tekrar gelen (zaten yazılmış) Data
+    uint32_t naks;
+    uint32_t heldFrames;        // Buffer'lar dolu: Ack writer'ı bekledi
+};
+
+class OtaUartSource {
+public:
+    explicit OtaUartSource(OtaUpdater& ota);
+
+    /**
+     * @brief Çerçeve dinlemeye başla (Serial1 serialManager.begin() ile açılmış olmalı)
+     */
+    void begin();
+
+    /**
+     * @brief Gelen byte'ları çöz, Data'yı yaz, Ack / Nak / Result gönder;
+     *        OtaUpdater::poll() dahil
+     */
+    OtaState poll();
+
+    const OtaUartStats& getStats() const { return _stats; }
+    void resetStats();
+    void printStatus() const;
+
+    /**
+     * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+     */
+    static uint16_t crc16(const uint8_t* data, size_t len, uint16_t crc = 0xFFFF);
+
+private:
+    enum RxState : uint8_t {
+        WaitSof,
+        Header,             // type + len
+        Payload,
+        Crc
+    };
+
+    void receive(unsigned long now);
+    void handleFrame();
+    bool deliverHeld();
+    void sendFrame(uint8_t type, const uint8_t* payload, uint16_t len);
+    void sendAck();
+    void sendNak(OtaError error);
+
+    OtaUpdater& _ota;
+    uint8_t _rxState;
+    uint8_t _header[3];
+    uint16_t _rxCount;
+    uint16_t _length;
+    uint8_t _frame[OTA_UART_MAX_PAYLOAD + 2];   // payload + CRC
+    unsigned long _lastByteMs;
+    unsigned long _lastFrameMs;
+
+    // Writer'ı bekleyen Data çerçevesi
+    bool _held;
+    uint16_t _heldOffset;
+    uint16_t _heldLength;
+
+    bool _started;          // Start alındı, Result henüz gönderilmedi
+    OtaUartStats _stats;
+};
+
+#endif // OTA_UART_SOURCE_H
@@ -0,0 +1,503 @@
+/**
+ * @file OtaUpdater.cpp
+ * @brief Dual-bank streaming OTA implementation
+ */
+
+#include "OtaUpdater.h"
+#include "mbedtls/version.h"
+#include <SerialManager.h>
+
+extern "C" {
+#include "flash_api.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "FreeRTOS.h"
+#include "task.h"
+#include "device_lock.h"
+}
+#define OTA_FLASH_LOCK()    device_mutex_lock(RT_DEV_LOCK_FLASH)
+#define OTA_FLASH_UNLOCK()  device_mutex_unlock(RT_DEV_LOCK_FLASH)
+#else
+#define OTA_FLASH_LOCK()    do {} while (0)
+#define OTA_FLASH_UNLOCK()  do {} while (0)
+#endif
+
+// mbedTLS 2.7 - 2.28: *_ret, 3.x: aynı isimler int döner, 2.7 öncesi: void
+#if MBEDTLS_VERSION_NUMBER >= 0x02070000 && MBEDTLS_VERSION_NUMBER < 0x03000000
+#define OTA_SHA256_STARTS(ctx)          mbedtls_sha256_starts_ret(ctx, 0)
+#define OTA_SHA256_UPDATE(ctx, p, n)    mbedtls_sha256_update_ret(ctx, p, n)
+#define OTA_SHA256_FINISH(ctx, out)     mbedtls_sha256_finish_ret(ctx, out)
+#else
+#define OTA_SHA256_STARTS(ctx)          mbedtls_sha256_starts(ctx, 0)
+#define OTA_SHA256_UPDATE(ctx, p, n)    mbedtls_sha256_update(ctx, p, n)
+#define OTA_SHA256_FINISH(ctx, out)     mbedtls_sha256_finish(ctx, out)
+#endif
+
+static_assert(OTA_BUFFER_SIZE % FLASH_SECTOR_SIZE == 0, "OTA buffer must be a whole number of sectors");
+static_assert(OTA_BANK_A_ADDR % FLASH_SECTOR_SIZE == 0 && OTA_BANK_B_ADDR % FLASH_SECTOR_SIZE == 0,
+              "OTA banks must be sector aligned");
+static_assert(OTA_BANK_A_ADDR + OTA_BANK_SIZE <= OTA_BANK_B_ADDR, "OTA banks overlap");
+
+namespace {
+
+const uint8_t kSignature[OTA_SIGNATURE_SIZE] = {'8', '1', '9', '5', '8', '7', '1', '1'};
+
+bool erased(const uint8_t* p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (p[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+OtaUpdater::OtaUpdater()
+    : _fill(0)
+    , _fillLength(0)
+    , _pending(false)
+    , _flushIndex(0)
+    , _flushLength(0)
+    , _flushOffset(0)
+    , _writerBusy(false)
+    , _writerDone(false)
+    , _writerOk(false)
+    , _writerTask(nullptr)
+    , _writerExit(false)
+    , _state(OtaState::Idle)
+    , _error(OtaError::None)
+    , _target(OtaBank::B)
+    , _imageSize(0)
+    , _received(0)
+    , _queued(0)
+    , _startMs(0)
+{
+    memset(_expected, 0, sizeof(_expected));
+    memset(&_stats, 0, sizeof(_stats));
+    mbedtls_sha256_init(&_sha);
+}
+
+OtaUpdater::~OtaUpdater() {
+    stopWriter();
+#if !defined(RTL8720_HOST)
+    // Task bu nesnenin buffer'larını kullanıyor olabilir
+    while (_writerTask != nullptr) vTaskDelay(1);
+#endif
+    mbedtls_sha256_free(&_sha);
+}
+
+bool OtaUpdater::begin(uint32_t imageSize, const uint8_t* expectedSha256) {
+    // Önceki (bırakılmış) güncellemenin writer'ı hala buffer'da veya kapanıyor
+    if (isActive() || _writerBusy || _writerTask != nullptr) return false;
+
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.imageSize = imageSize;
+    _imageSize = imageSize;
+    _received = 0;
+    _queued = 0;
+    _fill = 0;
+    _fillLength = 0;
+    _pending = false;
+    _writerDone = false;
+    _error = OtaError::None;
+    _startMs = millis();
+
+    OtaBank running = getRunningBank();
+    _target = running == OtaBank::A ? OtaBank::B : OtaBank::A;
+    _state = OtaState::Receiving;
+
+    // İmzalar başka bankı gösteriyor: hedef bank yeniden başlatınca açılacak imaj
+    if (getBootBank() != running) {
+        fail(OtaError::RestartPending);
+        return false;
+    }
+    if (imageSize <= OTA_SIGNATURE_SIZE || imageSize > OTA_BANK_SIZE || expectedSha256 == nullptr) {
+        fail(OtaError::BadSize);
+        return false;
+    }
+
+    memcpy(_expected, expectedSha256, sizeof(_expected));
+    mbedtls_sha256_free(&_sha);
+    mbedtls_sha256_init(&_sha);
+    OTA_SHA256_STARTS(&_sha);
+
+    if (!startWriter()) {
+        fail(OtaError::NoWriter);
+        return false;
+    }
+
+    serialManager.logPrintf("[OTA] Update started: %lu bytes -> bank %s (running %s)\n",
+                            (unsigned long)imageSize, bankToString(_target), bankToString(running));
+    return true;
+}
+
+uint8_t* OtaUpdater::getBuffer(size_t* space) {
+    *space = 0;
+    if (_state != OtaState::Receiving) return nullptr;
+    if (_pending && !startFlush()) return nullptr;
+
+    uint32_t room = OTA_BUFFER_SIZE - _fillLength;
+    uint32_t left = _imageSize - _received;
+    *space = room < left ? room : left;
+    return _buffers[_fill] + _fillLength;
+}
+
+void OtaUpdater::commit(size_t n) {
+    if (_state != OtaState::Receiving || n == 0) return;
+
+    // İmza ilk buffer'ın başında; silme başlamadan kontrol edilir
+    if (_received < OTA_SIGNATURE_SIZE && _received + n >= OTA_SIGNATURE_SIZE &&
+        memcmp(_buffers[0], kSignature, OTA_SIGNATURE_SIZE) != 0) {
+        fail(OtaError::BadImage);
+        return;
+    }
+
+    _fillLength += n;
+    _received += n;
+    _stats.bytesReceived = _received;
+
+    if (_received == _imageSize) {
+        _state = OtaState::Finishing;
+        queueFull();
+    } else if (_fillLength == OTA_BUFFER_SIZE) {
+        queueFull();
+    }
+}
+
+size_t OtaUpdater::write(const uint8_t* data, size_t len) {
+    size_t total = 0;
+    while (total < len) {
+        size_t space;
+        uint8_t* buf = getBuffer(&space);
+        if (space == 0) break;
+        size_t n = len - total < space ? len - total : space;
+        memcpy(buf, data + total, n);
+        commit(n);
+        total += n;
+    }
+    return total;
+}
+
+OtaState OtaUpdater::poll() {
+#if defined(RTL8720_HOST)
+    // Host'ta writer task yok: sıradaki buffer burada yazılır
+    if (_writerBusy) flushBuffer();
+#endif
+    collectFlush();
+    if (!isActive()) return _state;
+
+    if (_pending) startFlush();
+    if (_state == OtaState::Finishing && !_pending && !_writerBusy && !_writerDone) {
+        finish();
+    }
+    return _state;
+}
+
+void OtaUpdater::abort(OtaError error) {
+    if (isActive() || _state == OtaState::Idle) fail(error);
+}
+
+bool OtaUpdater::reset() {
+    if (isActive() || _writerBusy || _writerTask != nullptr) return false;
+    _state = OtaState::Idle;
+    _error = OtaError::None;
+    _imageSize = 0;
+    _received = 0;
+    _startMs = millis();
+    memset(&_stats, 0, sizeof(_stats));
+    return true;
+}
+
+bool OtaUpdater::startWriter() {
+    _writerExit = false;
+#if !defined(RTL8720_HOST)
+    // Task ilk notify'a kadar bekler; handle'a sadece kapanırken dokunur
+    TaskHandle_t task = nullptr;
+    if (xTaskCreate(writerTask, "ota_write", OTA_WRITER_TASK_STACK, this,
+                    tskIDLE_PRIORITY + 1, &task) != pdPASS) {
+        serialManager.logPrintf("[OTA] Error: Writer task create failed\n");
+        return false;
+    }
+    _writerTask = task;
+    return true;
+#else
+    return true;
+#endif
+}
+
+void OtaUpdater::stopWriter() {
+#if !defined(RTL8720_HOST)
+    // Task sadece _writerExit'i gördükten sonra kapanır: ilk notify'da hala yaşıyor
+    if (_writerTask == nullptr || _writerExit) return;
+    _writerExit = true;
+    xTaskNotifyGive(static_cast<TaskHandle_t>(_writerTask));
+#endif
+}
+
+void OtaUpdater::queueFull() {
+    _pending = true;
+    if (!startFlush() && _state == OtaState::Receiving) {
+        _stats.stalls++;
+    }
+}
+
+bool OtaUpdater::startFlush() {
+    collectFlush();
+    if (!_pending) return true;
+    if (_writerBusy || _writerDone || !isActive()) return false;
+
+    _flushIndex = _fill;
+    _flushLength = _fillLength;
+    _flushOffset = _queued;
+    _queued += _fillLength;
+    _fill ^= 1;
+    _fillLength = 0;
+    _pending = false;
+    _writerBusy = true;
+
+#if !defined(RTL8720_HOST)
+    xTaskNotifyGive(static_cast<TaskHandle_t>(_writerTask));
+#endif
+    return true;
+}
+
+void OtaUpdater::writerTask(void* param) {
+#if !defined(RTL8720_HOST)
+    OtaUpdater* self = static_cast<OtaUpdater*>(param);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Bırakılan güncellemenin verilmiş buffer'ı önce bitirilir
+        if (self->_writerBusy) self->flushBuffer();
+        if (self->_writerExit) break;
+    }
+    self->_writerTask = nullptr;
+    vTaskDelete(nullptr);
+#else
+    (void)param;
+#endif
+}
+
+void OtaUpdater::flushBuffer() {
+    unsigned long startUs = micros();
+    uint8_t* data = _buffers[_flushIndex];
+    uint32_t address = bankAddress(_target) + _flushOffset;
+    bool ok = true;
+
+    // Hash imajın kendisi üzerinde; imza alanı en son (doğrulamadan sonra) yazılır
+    OTA_SHA256_UPDATE(&_sha, data, _flushLength);
+    if (_flushOffset == 0) {
+        memset(data, 0xFF, OTA_SIGNATURE_SIZE);
+    }
+
+    flash_t flash;
+    for (uint32_t s = 0; s < _flushLength; s += FLASH_SECTOR_SIZE) {
+        OTA_FLASH_LOCK();
+        flash_erase_sector(&flash, address + s);
+        OTA_FLASH_UNLOCK();
+        _stats.sectorsErased++;
+    }
+
+    for (uint32_t p = 0; ok && p < _flushLength; p += OTA_PAGE_SIZE) {
+        uint32_t len = _flushLength - p < OTA_PAGE_SIZE ? _flushLength - p : OTA_PAGE_SIZE;
+        // Silinmiş sayfa zaten 0xFF: programlama süresi harcanmaz
+        if (erased(data + p, len)) {
+            _stats.pagesSkipped++;
+            continue;
+        }
+
+        OTA_FLASH_LOCK();
+        ok = flash_stream_write(&flash, address + p, len, data + p) != 0;
+#if OTA_VERIFY_READBACK
+        uint8_t readback[OTA_PAGE_SIZE];
+        if (ok) {
+            ok = flash_stream_read(&flash, address + p, len, readback) != 0 &&
+                 memcmp(readback, data + p, len) == 0;
+        }
+#endif
+        OTA_FLASH_UNLOCK();
+        _stats.pagesProgrammed++;
+    }
+
+    uint32_t us = micros() - startUs;
+    _stats.bytesWritten += _flushLength;
+    _stats.buffersFlushed++;
+    _stats.flashBusyUs += us;
+    if (us > _stats.flashMaxUs) _stats.flashMaxUs = us;
+
+    _writerOk = ok;
+    _writerDone = true;
+    _writerBusy = false;
+}
+
+void OtaUpdater::collectFlush() {
+    if (!_writerDone) return;
+    _writerDone = false;
+    if (!_writerOk && isActive()) fail(OtaError::Flash);
+}
+
+void OtaUpdater::finish() {
+    uint8_t digest[OTA_HASH_SIZE];
+    OTA_SHA256_FINISH(&_sha, digest);
+    if (memcmp(digest, _expected, sizeof(digest)) != 0) {
+        char hex[OTA_HASH_SIZE * 2 + 1];
+        formatHash(digest, hex);
+        serialManager.logPrintf("[OTA] SHA-256 mismatch: got %s\n", hex);
+        fail(OtaError::HashMismatch);
+        return;
+    }
+
+    // Yeni bankın imzası, sonra eski bankınki sıfırlanır: bank A hedefse
+    // geçiş ilk yazımda, B hedefse ikincide olur (ikisi geçerliyse A)
+    OtaBank old = _target == OtaBank::A ? OtaBank::B : OtaBank::A;
+    bool oldValid = isBankValid(old);
+    uint8_t signature[OTA_SIGNATURE_SIZE];
+    memcpy(signature, kSignature, sizeof(signature));
+
+    flash_t flash;
+    OTA_FLASH_LOCK();
+    bool ok = flash_stream_write(&flash, bankAddress(_target), sizeof(signature), signature) != 0;
+    OTA_FLASH_UNLOCK();
+    ok = ok && isBankValid(_target);
+    if (ok && oldValid) {
+        uint8_t zero[OTA_SIGNATURE_SIZE];
+        memset(zero, 0, sizeof(zero));
+        OTA_FLASH_LOCK();
+        ok = flash_stream_write(&flash, bankAddress(old), sizeof(zero), zero) != 0;
+        OTA_FLASH_UNLOCK();
+    }
+    if (!ok || getBootBank() != _target) {
+        fail(OtaError::Flash);
+        return;
+    }
+
+    _state = OtaState::Done;
+    stopWriter();
+    _stats.totalMs = millis() - _startMs;
+    uint32_t rate = getThroughput();
+    serialManager.logPrintf("[OTA] Update done: %lu bytes in %lu ms (%lu.%lu KB/s), bank %s active after restart\n",
+                            (unsigned long)_imageSize, (unsigned long)_stats.totalMs,
+                            (unsigned long)(rate / 1024), (unsigned long)((rate % 1024) * 10 / 1024),
+                            bankToString(_target));
+}
+
+void OtaUpdater::fail(OtaError error) {
+    _error = error;
+    _state = OtaState::Failed;
+    _pending = false;
+    _stats.totalMs = millis() - _startMs;
+#if defined(RTL8720_HOST)
+    // Host writer'ı poll()'da çalışır: bekleyen iş bırakılır
+    _writerBusy = false;
+#endif
+    stopWriter();
+    serialManager.logPrintf("[OTA] Update failed: %s (%lu/%lu bytes)\n", errorToString(error),
+                            (unsigned long)_received, (unsigned long)_imageSize);
+}
+
+uint32_t OtaUpdater::getThroughput() const {
+    uint32_t ms = isActive() ? millis() - _startMs : _stats.totalMs;
+    if (ms == 0) return 0;
+    return static_cast<uint32_t>(static_cast<uint64_t>(_received) * 1000 / ms);
+}
+
+void OtaUpdater::printStatus() const {
+    const OtaStats& s = _stats;
+    uint32_t rate = getThroughput();
+    uint32_t totalMs = isActive() ? millis() - _startMs : s.totalMs;
+    uint32_t busyPercent = totalMs ? static_cast<uint32_t>(s.flashBusyUs / 10 / totalMs) : 0;
+    serialManager.logPrintf("[OTA] %s, %lu/%lu bytes -> bank %s (running %s, boot %s), error %s\n",
+                            stateToString(_state), (unsigned long)_received, (unsigned long)_imageSize,
+                            bankToString(_target), bankToString(getRunningBank()), bankToString(getBootBank()),
+                            errorToString(_error));
+    serialManager.logPrintf("[OTA] Time %lu ms, %lu.%lu KB/s; flash busy %lu ms (%lu%%), max %lu us per buffer\n",
+                            (unsigned long)totalMs, (unsigned long)(rate / 1024),
+                            (unsigned long)((rate % 1024) * 10 / 1024), (unsigned long)(s.flashBusyUs / 1000),
+                            (unsigned long)busyPercent, (unsigned long)s.flashMaxUs);
+    serialManager.logPrintf("[OTA] Flash: %lu buffers, %lu erases, %lu pages programmed, %lu skipped (0xFF), "
+                            "%lu stalls\n",
+                            (unsigned long)s.buffersFlushed, (unsigned long)s.sectorsErased,
+                            (unsigned long)s.pagesProgrammed, (unsigned long)s.pagesSkipped,
+                            (unsigned long)s.stalls);
+}
+
+OtaBank OtaUpdater::getRunningBank() {
+    // Açılıştan sonra imzalar sadece finish() ile değişir, o da begin()'den sonra
+    static const OtaBank running = getBootBank();
+    return running;
+}
+
+OtaBank OtaUpdater::getBootBank() {
+    return !isBankValid(OtaBank::A) && isBankValid(OtaBank::B) ? OtaBank::B : OtaBank::A;
+}
+
+bool OtaUpdater::isBankValid(OtaBank bank) {
+    uint8_t signature[OTA_SIGNATURE_SIZE];
+    flash_t flash;
+    OTA_FLASH_LOCK();
+    int ok = flash_stream_read(&flash, bankAddress(bank), sizeof(signature), signature);
+    OTA_FLASH_UNLOCK();
+    return ok && memcmp(signature, kSignature, sizeof(signature)) == 0;
+}
+
+uint32_t OtaUpdater::bankAddress(OtaBank bank) {
+    return bank == OtaBank::A ? OTA_BANK_A_ADDR : OTA_BANK_B_ADDR;
+}
+
+bool OtaUpdater::parseHash(const char* hex, size_t length, uint8_t* out) {
+    if (hex == nullptr || length != OTA_HASH_SIZE * 2) return false;
+    for (size_t i = 0; i < OTA_HASH_SIZE; i++) {
+        int hi = hexValue(hex[i * 2]);
+        int lo = hexValue(hex[i * 2 + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+void OtaUpdater::formatHash(const uint8_t* hash, char* out) {
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < OTA_HASH_SIZE; i++) {
+        out[i * 2] = digits[hash[i] >> 4];
+        out[i * 2 + 1] = digits[hash[i] & 0x0F];
+    }
+    out[OTA_HASH_SIZE * 2] = '\0';
+}
+
+const char* OtaUpdater::stateToString(OtaState state) {
+    switch (state) {
+        case OtaState::Idle:        return "Idle";
+        case OtaState::Receiving:   return "Receiving";
+        case OtaState::Finishing:   return "Finishing";
+        case OtaState::Done:        return "Done";
+        case OtaState::Failed:      return "Failed";
+        default:                    return "Unknown";
+    }
+}
+
+const char* OtaUpdater::errorToString(OtaError error) {
+    switch (error) {
+        case OtaError::None:            return "None";
+        case OtaError::BadSize:         return "Bad size";
+        case OtaError::BadImage:        return "Bad image (no OTA signature)";
+        case OtaError::Flash:           return "Flash";
+        case OtaError::HashMismatch:    return "Hash mismatch";
+        case OtaError::Timeout:         return "Timeout";
+        case OtaError::Source:          return "Source";
+        case OtaError::Aborted:         return "Aborted";
+        case OtaError::RestartPending:  return "Restart pending";
+        case OtaError::NoWriter:        return "No writer task";
+        default:                        return "Unknown";
+    }
+}
+
+const char* OtaUpdater::bankToString(OtaBank bank) {
+    return bank == OtaBank::A ? "A" : "B";
+}
@@ -0,0 +1,251 @@
+/**
+ * @file OtaUpdater.h
+ * @brief Dual-bank streaming OTA: double-buffered flash writes, incremental
+ *        SHA-256 and atomic bank switch
+ *
+ * İmaj RAM'de tutulmaz; kaynak (OtaHttpSource, OtaUartSource) geldikçe
+ * sektör boyutundaki iki buffer'dan birine yazar:
+ * - Dolan buffer writer'a verilir (cihazda begin()'de açılan tek FreeRTOS
+ *   task'a notify ile, host'ta poll() içinde): sektör silinir, sayfa sayfa programlanır (tamamı 0xFF
+ *   sayfalar atlanır), OTA_VERIFY_READBACK ile geri okunup karşılaştırılır
+ * - Writer çalışırken alım diğer buffer'a devam eder; iki buffer da doluysa
+ *   getBuffer() 0 byte yer verir (stall), kaynak okumayı bırakır ve TCP /
+ *   UART akış kontrolü göndereni bekletir
+ * - Writer task güncelleme boyunca bekler; Done / Failed'da kapanır
+ * - SHA-256 writer'da, flash'a giden sırayla artımlı hesaplanır; imaj
+ *   bitince beklenen hash ile karşılaştırılır
+ *
+ * Bank seçimi AmebaD OTA imza alanı ile yapılır: imajın ilk 8 byte'ı
+ * "81958711" olmalıdır. Yazım sırasında hedef bankın imzası silinmiş (0xFF)
+ * bırakılır; hash doğrulanınca önce yeni bankın imzası yazılır, sonra eski
+ * bankın imzası sıfırlanır (NOR: silmeden 1 -> 0). Hiçbir anda yarım imaj
+ * geçerli görünmez; iki imza birden geçerliyse bank A çalışır.
+ *
+ * Çalışan bank açılıştaki imzalardan bir kez okunup saklanır: Done sonrası
+ * imzalar yeni bankı gösterse de CPU eski bankta (XIP) çalışmaya devam eder.
+ * Yeniden başlatılana kadar begin() reddedilir (RestartPending); aksi halde
+ * ikinci güncelleme çalışan bankı silerdi.
+ *
+ * Cihazda flash silinirken XIP durabilir; o sırada gelen veri lwIP / UART
+ * buffer'larında birikir ve writer bitince tek seferde okunur.
+ *
+ * Kullanım:
+ *   OtaUpdater ota;
+ *   ota.begin(imageSize, expectedSha256);
+ *   size_t space;
+ *   uint8_t* buf = ota.getBuffer(&space);   // 0 ise sonra tekrar
+ *   ota.commit(sock.read(buf, space));
+ *   ota.poll();                             // Done -> yeniden başlat
+ */
+
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <Arduino.h>
+#include "mbedtls/sha256.h"
+
+// AmebaD km4 imaj bankları (flash offset). Bank sonu TLS oturum sektörünün altında.
+#ifndef OTA_BANK_A_ADDR
+    #define OTA_BANK_A_ADDR             0x006000
+#endif
+
+#ifndef OTA_BANK_B_ADDR
+    #define OTA_BANK_B_ADDR             0x106000
+#endif
+
+#ifndef OTA_BANK_SIZE
+    #define OTA_BANK_SIZE               0xF7000
+#endif
+
+// Alım / yazım buffer'ı (x2), sektör katı olmalı
+#ifndef OTA_BUFFER_SIZE
+    #define OTA_BUFFER_SIZE             0x1000
+#endif
+
+// Programlanan sayfayı geri okuyup karşılaştır
+#ifndef OTA_VERIFY_READBACK
+    #define OTA_VERIFY_READBACK         1
+#endif
+
+// Flash writer task (cihazda, güncelleme başına bir tane)
+#ifndef OTA_WRITER_TASK_STACK
+    #define OTA_WRITER_TASK_STACK       1024    // word
+#endif
+
+#define OTA_PAGE_SIZE                   256
+#define OTA_SIGNATURE_SIZE              8
+#define OTA_HASH_SIZE                   32
+
+enum class OtaBank : uint8_t {
+    A,
+    B
+};
+
+enum class OtaState : uint8_t {
+    Idle,
+    Receiving,
+    Finishing,          // Tüm byte'lar alındı, son buffer yazılıyor
+    Done,               // Hash doğru, bank değişti (yeniden başlatınca geçerli)
+    Failed
+};
+
+enum class OtaError : uint8_t {
+    None,
+    BadSize,            // 0, imza alanından küçük veya banktan büyük
+    BadImage,           // OTA imzası yok
+    Flash,              // Program / readback hatası
+    HashMismatch,
+    Timeout,            // Kaynakta ilerleme yok
+    Source,             // HTTP status / çerçeve / bağlantı hatası
+    Aborted,
+    RestartPending,     // Bank değişti, yeni imaj yeniden başlatınca çalışır
+    NoWriter            // Writer task açılamadı
+};
+
+struct OtaStats {
+    uint32_t imageSize;
+    uint32_t bytesReceived;
+    uint32_t bytesWritten;      // Writer'ın bitirdiği
+    uint32_t sectorsErased;
+    uint32_t pagesProgrammed;
+    uint32_t pagesSkipped;      // Tamamı 0xFF
+    uint32_t buffersFlushed;
+    uint32_t stalls;            // İki buffer da dolu: getBuffer() yer vermedi
+    uint32_t flashBusyUs;       // Writer toplamı (silme + programlama + readback + hash)
+    uint32_t flashMaxUs;        // En uzun buffer
+    uint32_t totalMs;           // begin() -> Done / Failed
+};
+
+class OtaUpdater {
+public:
+    OtaUpdater();
+    ~OtaUpdater();
+
+    OtaUpdater(const OtaUpdater&) = delete;
+    OtaUpdater& operator=(const OtaUpdater&) = delete;
+
+    /**
+     * @brief Pasif banka yeni güncelleme başlat
+     * @param expectedSha256 İmajın SHA-256'sı (32 byte, kopyalanır)
+     * @return false: güncelleme / writer meşgul, boyut geçersiz (Failed, BadSize),
+     *         önceki güncelleme yeniden başlatma bekliyor (Failed, RestartPending) veya
+     *         writer task açılamadı (Failed, NoWriter)
+     */
+    bool begin(uint32_t imageSize, const uint8_t* expectedSha256);
+
+    /**
+     * @brief Alım buffer'ı (kopyasız): en fazla *space byte yazılıp commit() edilir
+     * @return nullptr / *space = 0: buffer'lar dolu (writer bekleniyor) veya alım bitti
+     */
+    uint8_t* getBuffer(size_t* space);
+
+    /**
+     * @brief getBuffer()'a yazılan n byte'ı kabul et
+     */
+    void commit(size_t n);
+
+    /**
+     * @brief Kopyalayarak ekle
+     * @return Kabul edilen byte (buffer'lar doluysa len'den az)
+     */
+    size_t write(const uint8_t* data, size_t len);
+
+    /**
+     * @brief Writer'ı ilerlet (host), biten buffer'ı topla, imaj bitince doğrula ve bank değiştir
+     */
+    OtaState poll();
+
+    /**
+     * @brief Güncellemeyi bırak (hedef bankın imzası yazılmamış kalır);
+     *        Idle iken çağrılırsa kaynağın hatası olarak Failed olur
+     */
+    void abort(OtaError error = OtaError::Aborted);
+
+    /**
+     * @brief Done / Failed -> Idle (kaynak yeni imaj beklerken)
+     * @return false: güncelleme sürüyor veya writer meşgul
+     */
+    bool reset();
+
+    OtaState getState() const { return _state; }
+    OtaError getError() const { return _error; }
+    bool isActive() const { return _state == OtaState::Receiving || _state == OtaState::Finishing; }
+
+    uint32_t getImageSize() const { return _imageSize; }
+    uint32_t getReceived() const { return _received; }
+    uint32_t getRemaining() const { return _imageSize - _received; }
+    OtaBank getTargetBank() const { return _target; }
+
+    const OtaStats& getStats() const { return _stats; }
+
+    /**
+     * @brief begin() -> bitiş (veya şimdiye kadar) ortalama hız (byte/s)
+     */
+    uint32_t getThroughput() const;
+
+    void printStatus() const;
+
+    /**
+     * @brief Şu an çalışan bank: ilk çağrıda getBootBank()'tan alınır ve sabit kalır
+     *        (ilk begin()'den önce çağrılmalı, begin() zaten çağırır)
+     */
+    static OtaBank getRunningBank();
+
+    /**
+     * @brief Yeniden başlatınca açılacak bank (imzası geçerli olan; ikisi de / hiçbiri ise A)
+     */
+    static OtaBank getBootBank();
+    static bool isBankValid(OtaBank bank);
+    static uint32_t bankAddress(OtaBank bank);
+
+    /**
+     * @brief "ab12..." (64 hex) -> 32 byte
+     */
+    static bool parseHash(const char* hex, size_t length, uint8_t* out);
+    static void formatHash(const uint8_t* hash, char* out);    // 65 byte
+
+    static const char* stateToString(OtaState state);
+    static const char* errorToString(OtaError error);
+    static const char* bankToString(OtaBank bank);
+
+private:
+    static void writerTask(void* param);
+
+    bool startWriter();
+    void stopWriter();
+    void queueFull();
+    bool startFlush();
+    void flushBuffer();
+    void collectFlush();
+    void finish();
+    void fail(OtaError error);
+
+    uint8_t _buffers[2][OTA_BUFFER_SIZE];
+    uint8_t _fill;                  // Doldurulan buffer
+    uint32_t _fillLength;
+    bool _pending;                  // Doldurulan buffer dolu, writer bekleniyor
+
+    // Writer'a verilen iş (writer bitene kadar sadece writer dokunur)
+    uint8_t _flushIndex;
+    uint32_t _flushLength;
+    uint32_t _flushOffset;          // İmaj içindeki offset
+    volatile bool _writerBusy;
+    volatile bool _writerDone;      // Sonuç collectFlush()'ı bekliyor
+    volatile bool _writerOk;
+    void* volatile _writerTask;     // TaskHandle_t; task kapanırken kendisi sıfırlar
+    volatile bool _writerExit;
+
+    OtaState _state;
+    OtaError _error;
+    OtaBank _target;
+    uint32_t _imageSize;
+    uint32_t _received;
+    uint32_t _queued;               // Writer'a verilen toplam
+    unsigned long _startMs;
+
+    uint8_t _expected[OTA_HASH_SIZE];
+    mbedtls_sha256_context _sha;
+    OtaStats _stats;
+};
+
+#endif // OTA_UPDATER_H
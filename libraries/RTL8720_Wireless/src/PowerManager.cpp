@@ -0,0 +1,305 @@
+/**
+ * @file PowerManager.cpp
+ * @brief Named power profile implementation
+ */
+
+#include "PowerManager.h"
+#include "BleModule.h"
+#include <SerialManager.h>
+
+extern "C" {
+#include "wifi_conf.h"
+#include "ameba_soc.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "FreeRTOS.h"
+#include "task.h"
+
+// FreeRTOS ARM_CM33 port (port.c): SysTick'i configCPU_CLOCK_HZ'den kurar,
+// tickless idle sayaçlarını da yeniden hesaplar
+void vPortSetupTimerInterrupt(void);
+}
+#endif
+
+namespace {
+
+const PowerProfileConfig kDefaultConfigs[POWER_PROFILE_COUNT] = {
+    { false, 1, 200, 100 },     // Performance
+    { true,  1, 100, 500 },     // Balanced
+    { true,  3, 50,  2000 },    // LowPower
+};
+
+uint8_t clockType(uint8_t mhz) {
+    switch (mhz) {
+        case 100: return CLK_KM4_100M;
+        case 50:  return CLK_KM4_50M;
+        case 25:  return CLK_KM4_25M;
+        default:  return CLK_KM4_200M;      // isValidCpuMHz() ile elenir
+    }
+}
+
+} // namespace
+
+PowerManager::PowerManager()
+    : _baseProfile(PowerProfile::Balanced)
+    , _activeProfile(PowerProfile::Balanced)
+    , _ble(nullptr)
+    , _started(false)
+    , _boosted(false)
+    , _boostRefs(0)
+    , _holdUntilMs(0)
+    , _boostStartMs(0)
+    , _windowStartMs(0)
+    , _windowBytes(0)
+    , _accountedMs(0)
+{
+    memcpy(_configs, kDefaultConfigs, sizeof(_configs));
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+void PowerManager::begin(PowerProfile profile, BleModule* ble) {
+    _ble = ble;
+    _baseProfile = profile;
+    _boosted = false;
+    _boostRefs = 0;
+    memset(&_stats, 0, sizeof(_stats));
+    _accountedMs = millis();
+    _started = true;
+    apply(profile);
+}
+
+void PowerManager::setProfile(PowerProfile profile) {
+    _baseProfile = profile;
+    if (_started && !_boosted) {
+        apply(profile);
+    }
+}
+
+bool PowerManager::setProfileConfig(PowerProfile profile, const PowerProfileConfig& config) {
+    uint8_t index = static_cast<uint8_t>(profile);
+    if (index >= POWER_PROFILE_COUNT) return false;
+    if (!isValidCpuMHz(config.cpuMHz)) {
+        serialManager.logPrintf("[Power] Error: Unsupported CPU clock %u MHz\n", config.cpuMHz);
+        return false;
+    }
+    _configs[index] = config;
+    if (_configs[index].dtimInterval == 0) _configs[index].dtimInterval = 1;
+    if (_started && _activeProfile == profile) {
+        apply(profile);
+    }
+    return true;
+}
+
+const PowerProfileConfig& PowerManager::getProfileConfig(PowerProfile profile) const {
+    uint8_t index = static_cast<uint8_t>(profile);
+    return _configs[index < POWER_PROFILE_COUNT ? index : 0];
+}
+
+// ============================================================================
+// Boost
+// ============================================================================
+
+void PowerManager::beginBoost() {
+    if (!_started) return;
+    if (_boostRefs < UINT8_MAX) _boostRefs++;
+    if (!_boosted) startBoost(millis());
+}
+
+void PowerManager::endBoost(uint32_t holdMs) {
+    if (_boostRefs == 0) return;
+    _boostRefs--;
+
+    unsigned long until = millis() + holdMs;
+    if (_boostRefs == 0 && static_cast<long>(until - _holdUntilMs) > 0) {
+        _holdUntilMs = until;
+    }
+}
+
+void PowerManager::notifyTraffic(size_t bytes) {
+    if (!_started) return;
+
+    unsigned long now = millis();
+    if (now - _windowStartMs >= POWER_BOOST_WINDOW_MS) {
+        _windowStartMs = now;
+        _windowBytes = 0;
+    }
+    _windowBytes += bytes;
+    if (_windowBytes < POWER_BOOST_THRESHOLD_BYTES) return;
+
+    // Trafik sürdükçe hold uzar
+    unsigned long until = now + POWER_BOOST_HOLD_MS;
+    if (!_boosted) {
+        startBoost(until);
+    } else if (static_cast<long>(until - _holdUntilMs) > 0) {
+        _holdUntilMs = until;
+    }
+}
+
+void PowerManager::poll() {
+    if (!_boosted || _boostRefs > 0) return;
+
+    unsigned long now = millis();
+    if (static_cast<long>(now - _holdUntilMs) < 0) return;
+
+    _boosted = false;
+    _stats.boostMs += now - _boostStartMs;
+    serialManager.logPrintf("[Power] Boost end after %lu ms\n", (unsigned long)(now - _boostStartMs));
+    if (_activeProfile != _baseProfile) {
+        apply(_baseProfile);
+    }
+}
+
+void PowerManager::startBoost(unsigned long holdUntil) {
+    _boosted = true;
+    _boostStartMs = millis();
+    _holdUntilMs = holdUntil;
+    _stats.boosts++;
+    if (_activeProfile != PowerProfile::Performance) {
+        apply(PowerProfile::Performance);
+    }
+}
+
+// ============================================================================
+// Apply
+// ============================================================================
+
+void PowerManager::apply(PowerProfile profile) {
+    const PowerProfileConfig& cfg = getProfileConfig(profile);
+    unsigned long start = micros();
+
+    if (cfg.wifiPowerSave) {
+        wifi_set_lps_dtim(cfg.dtimInterval);
+        wifi_enable_powersave();
+    } else {
+        wifi_disable_powersave();
+    }
+
+#if !defined(RTL8720_HOST)
+    // SysTick KM4 clock'undan beslenir ve FreeRTOS port'unundur: clock değişimi
+    // ile tick yeniden kurulumu arasında tick kesmesi / context switch olmasın
+    vTaskSuspendAll();
+    taskENTER_CRITICAL();
+    CPU_ClkSet(clockType(cfg.cpuMHz));
+    SystemCoreClockUpdate();
+    vPortSetupTimerInterrupt();
+    taskEXIT_CRITICAL();
+    xTaskResumeAll();
+#else
+    CPU_ClkSet(clockType(cfg.cpuMHz));
+#endif
+
+    if (_ble != nullptr) {
+        _ble->setAdvertisingInterval(cfg.bleAdvIntervalMs);
+    }
+
+    uint32_t elapsed = micros() - start;
+    accumulate();
+    _activeProfile = profile;
+    _stats.switches++;
+    _stats.lastSwitchUs = elapsed;
+    if (elapsed > _stats.maxSwitchUs) _stats.maxSwitchUs = elapsed;
+
+    serialManager.logPrintf("[Power] %s: LPS %s, DTIM %u, CPU %u MHz, BLE adv %u ms\n",
+                            profileToString(profile),
+                            cfg.wifiPowerSave ? "on" : "off",
+                            cfg.dtimInterval, cfg.cpuMHz, cfg.bleAdvIntervalMs);
+    Events.post(EventSource::PowerMode, static_cast<uint8_t>(PowerEventCode::ProfileChanged),
+                static_cast<uint16_t>(profile), _boosted ? 1 : 0);
+}
+
+void PowerManager::accumulate() {
+    unsigned long now = millis();
+    _stats.profileMs[static_cast<uint8_t>(_activeProfile)] += now - _accountedMs;
+    _accountedMs = now;
+}
+
+// ============================================================================
+// Estimates
+// ============================================================================
+
+PowerEstimate PowerManager::estimate(PowerProfile profile) const {
+    const PowerProfileConfig& cfg = getProfileConfig(profile);
+    PowerEstimate e;
+    e.cpuMHz = cfg.cpuMHz;
+
+    if (!cfg.wifiPowerSave) {
+        // Radyo sürekli RX'te: frame hemen alınır
+        e.wakeLatencyMs = 0;
+        e.avgWakeLatencyMs = 0;
+        e.radioDutyPermille = 1000;
+        return e;
+    }
+
+    // AP frame'i TIM'de bildirir; istasyon her dtimInterval'inci DTIM'de uyanır
+    uint32_t periodMs = static_cast<uint32_t>(cfg.dtimInterval) * POWER_BEACON_INTERVAL_MS;
+    e.wakeLatencyMs = periodMs;
+    e.avgWakeLatencyMs = periodMs / 2;
+    uint32_t duty = static_cast<uint32_t>(POWER_BEACON_AWAKE_MS) * 1000 / periodMs;
+    e.radioDutyPermille = static_cast<uint16_t>(duty > 1000 ? 1000 : (duty == 0 ? 1 : duty));
+    return e;
+}
+
+uint16_t PowerManager::getAverageDutyPermille() const {
+    PowerStats stats = getStats();
+    uint64_t weighted = 0;
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < POWER_PROFILE_COUNT; i++) {
+        weighted += static_cast<uint64_t>(stats.profileMs[i]) *
+                    estimate(static_cast<PowerProfile>(i)).radioDutyPermille;
+        total += stats.profileMs[i];
+    }
+    if (total == 0) return estimate(_activeProfile).radioDutyPermille;
+    return static_cast<uint16_t>(weighted / total);
+}
+
+PowerStats PowerManager::getStats() const {
+    PowerStats stats = _stats;
+    if (_started) {
+        stats.profileMs[static_cast<uint8_t>(_activeProfile)] += millis() - _accountedMs;
+    }
+    if (_boosted) {
+        stats.boostMs += millis() - _boostStartMs;
+    }
+    return stats;
+}
+
+const char* PowerManager::profileToString(PowerProfile profile) {
+    switch (profile) {
+        case PowerProfile::Performance: return "Performance";
+        case PowerProfile::Balanced:    return "Balanced";
+        case PowerProfile::LowPower:    return "LowPower";
+        default:                        return "Unknown";
+    }
+}
+
+bool PowerManager::isValidCpuMHz(uint8_t mhz) {
+    return mhz == 200 || mhz == 100 || mhz == 50 || mhz == 25;
+}
+
+void PowerManager::printStatus() const {
+    PowerStats stats = getStats();
+
+    DEBUG_SERIAL.println("[Power]");
+    serialManager.logPrintf("  Profile: %s (active %s%s)\n",
+                            profileToString(_baseProfile), profileToString(_activeProfile),
+                            _boosted ? ", boosted" : "");
+    for (uint8_t i = 0; i < POWER_PROFILE_COUNT; i++) {
+        PowerProfile profile = static_cast<PowerProfile>(i);
+        PowerEstimate e = estimate(profile);
+        serialManager.logPrintf("  %-11s est. wake %4lu ms (avg %3lu), radio duty %4u permille, %lu ms\n",
+                                profileToString(profile),
+                                (unsigned long)e.wakeLatencyMs,
+                                (unsigned long)e.avgWakeLatencyMs,
+                                e.radioDutyPermille,
+                                (unsigned long)stats.profileMs[i]);
+    }
+    serialManager.logPrintf("  Est. average radio duty: %u permille, switches %lu (last %lu us), "
+                            "boosts %lu (%lu ms)\n",
+                            getAverageDutyPermille(),
+                            (unsigned long)stats.switches,
+                            (unsigned long)stats.lastSwitchUs,
+                            (unsigned long)stats.boosts,
+                            (unsigned long)stats.boostMs);
+}
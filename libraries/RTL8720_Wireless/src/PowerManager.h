@@ -0,0 +1,243 @@
+/**
+ * @file PowerManager.h
+ * @brief Named power profiles (WiFi LPS/DTIM, CPU clock, BLE advertising)
+ *
+ * Her profil radyo güç tasarrufu, LPS'te dinlenen DTIM aralığı, KM4 CPU
+ * clock'u ve BLE advertising aralığını birlikte ayarlar:
+ *
+ *   Profil       LPS  DTIM  CPU      BLE adv
+ *   Performance  off  -     200 MHz  100 ms
+ *   Balanced     on   1     100 MHz  500 ms
+ *   LowPower     on   3     50 MHz   2000 ms
+ *
+ * LPS'te AP downlink frame'lerini istasyonun uyandığı DTIM beacon'ına kadar
+ * tutar: gecikme ve radyo duty cycle'ı DTIM * beacon aralığından tahmin
+ * edilir (estimate()); ölçülmez, printStatus() da tahmin olarak yazar.
+ *
+ * CPU clock değişince SysTick yükü FreeRTOS port'unun kendi kurulumuyla,
+ * scheduler askıdayken yeniden hesaplanır; tick süresi sabit kalır.
+ * Sadece KM4'ün desteklediği 200 / 100 / 50 / 25 MHz kabul edilir.
+ *
+ * Boost: bulk transfer süresince geçici olarak Performance'a çıkılır,
+ * transfer bitip hold süresi dolunca temel profile dönülür. Elle
+ * (beginBoost/endBoost, PowerBoost guard) veya trafik hacmiyle
+ * (notifyTraffic) tetiklenir; dönüş poll() içinden yapılır.
+ *
+ * Kullanım:
+ *   Power.begin(PowerProfile::Balanced);
+ *   { PowerBoost boost; upload(); }
+ *   void loop() { Power.poll(); ... }
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <BoardConfig.h>
+#include <EventBus.h>
+
+class BleModule;
+
+// AP beacon aralığı (TU = 1.024 ms; çoğu AP 100 TU)
+#ifndef POWER_BEACON_INTERVAL_MS
+    #define POWER_BEACON_INTERVAL_MS    102
+#endif
+
+// LPS'te her DTIM uyanışında radyonun açık kaldığı süre (beacon RX + PS-Poll)
+#ifndef POWER_BEACON_AWAKE_MS
+    #define POWER_BEACON_AWAKE_MS       4
+#endif
+
+// Boost bittikten sonra Performance'ta kalma süresi (ms)
+#ifndef POWER_BOOST_HOLD_MS
+    #define POWER_BOOST_HOLD_MS         2000
+#endif
+
+// notifyTraffic: pencere içinde bu kadar byte geçerse boost
+#ifndef POWER_BOOST_THRESHOLD_BYTES
+    #define POWER_BOOST_THRESHOLD_BYTES 16384
+#endif
+#ifndef POWER_BOOST_WINDOW_MS
+    #define POWER_BOOST_WINDOW_MS       500
+#endif
+
+enum class PowerProfile : uint8_t {
+    Performance,
+    Balanced,
+    LowPower
+};
+
+#define POWER_PROFILE_COUNT     3
+
+/**
+ * @brief Güç olayı (EventSource::PowerMode): arg = uygulanan profil, value = 1 ise boost
+ */
+enum class PowerEventCode : uint8_t {
+    ProfileChanged = 1
+};
+
+/**
+ * @brief Profil ayarları
+ */
+struct PowerProfileConfig {
+    bool wifiPowerSave;         // LPS (radyo beacon'lar arasında uyur)
+    uint8_t dtimInterval;       // LPS'te dinlenen DTIM (1 = her DTIM beacon'ı)
+    uint8_t cpuMHz;             // 200 / 100 / 50 / 25 (başka değer reddedilir)
+    uint16_t bleAdvIntervalMs;
+};
+
+/**
+ * @brief Profil için gecikme / duty cycle tahmini (beacon / DTIM aralığından, ölçüm değil)
+ */
+struct PowerEstimate {
+    uint32_t wakeLatencyMs;     // Tahmini en kötü: downlink frame sonraki dinlenen DTIM'i bekler
+    uint32_t avgWakeLatencyMs;
+    uint16_t radioDutyPermille; // Radyonun uyanık olduğu oran (binde)
+    uint8_t cpuMHz;
+};
+
+/**
+ * @brief Sayaçlar (begin()'den beri)
+ */
+struct PowerStats {
+    uint32_t profileMs[POWER_PROFILE_COUNT];    // Etkin profilde geçen süre
+    uint32_t switches;
+    uint32_t lastSwitchUs;      // Son profil uygulama süresi (SDK çağrıları)
+    uint32_t maxSwitchUs;
+    uint32_t boosts;
+    uint32_t boostMs;           // Boost'ta geçen toplam süre
+};
+
+class PowerManager {
+public:
+    static PowerManager& getInstance() {
+        static PowerManager instance;
+        return instance;
+    }
+
+    /**
+     * @brief Profili uygula
+     * @param ble Advertising aralığı ayarlanacak modül (nullptr: yok)
+     */
+    void begin(PowerProfile profile = PowerProfile::Balanced, BleModule* ble = nullptr);
+
+    /**
+     * @brief Temel profili değiştir (boost sürüyorsa bitince uygulanır)
+     */
+    void setProfile(PowerProfile profile);
+
+    PowerProfile getProfile() const { return _baseProfile; }
+
+    /**
+     * @brief Şu an uygulanan profil (boost'ta Performance)
+     */
+    PowerProfile getActiveProfile() const { return _activeProfile; }
+
+    /**
+     * @brief Profil ayarlarını değiştir (aktifse hemen uygulanır)
+     * @return false: geçersiz profil veya desteklenmeyen cpuMHz (ayarlar değişmez)
+     */
+    bool setProfileConfig(PowerProfile profile, const PowerProfileConfig& config);
+    const PowerProfileConfig& getProfileConfig(PowerProfile profile) const;
+
+    // ========================================================================
+    // Boost
+    // ========================================================================
+
+    /**
+     * @brief Bulk transfer başladı: Performance'a çık (iç içe çağrılabilir)
+     */
+    void beginBoost();
+
+    /**
+     * @brief Transfer bitti: son endBoost'tan holdMs sonra temel profile dön
+     */
+    void endBoost(uint32_t holdMs = POWER_BOOST_HOLD_MS);
+
+    /**
+     * @brief Aktarılan byte'ı bildir; POWER_BOOST_WINDOW_MS içinde
+     *        POWER_BOOST_THRESHOLD_BYTES aşılırsa hold süresince boost
+     */
+    void notifyTraffic(size_t bytes);
+
+    bool isBoosted() const { return _boosted; }
+
+    /**
+     * @brief Boost bitişini kontrol et - loop() içinden çağrılır
+     */
+    void poll();
+
+    // ========================================================================
+    // Estimates
+    // ========================================================================
+
+    /**
+     * @brief Profil için wake latency ve duty cycle tahmini (ölçülmez)
+     */
+    PowerEstimate estimate(PowerProfile profile) const;
+
+    /**
+     * @brief begin()'den beri profillerde geçen süreyle ağırlıklı duty cycle (binde)
+     */
+    uint16_t getAverageDutyPermille() const;
+
+    /**
+     * @brief Sayaçlar (profileMs güncel ana kadar)
+     */
+    PowerStats getStats() const;
+
+    static const char* profileToString(PowerProfile profile);
+
+    /**
+     * @brief KM4 clock'u olarak seçilebilir mi (200 / 100 / 50 / 25 MHz)
+     */
+    static bool isValidCpuMHz(uint8_t mhz);
+
+    void printStatus() const;
+
+private:
+    PowerManager();
+    PowerManager(const PowerManager&) = delete;
+    PowerManager& operator=(const PowerManager&) = delete;
+
+    void apply(PowerProfile profile);
+    void startBoost(unsigned long holdUntil);
+    void accumulate();
+
+    PowerProfileConfig _configs[POWER_PROFILE_COUNT];
+    PowerProfile _baseProfile;
+    PowerProfile _activeProfile;
+    BleModule* _ble;
+    bool _started;
+
+    // Boost
+    bool _boosted;
+    uint8_t _boostRefs;
+    unsigned long _holdUntilMs;
+    unsigned long _boostStartMs;
+    unsigned long _windowStartMs;
+    uint32_t _windowBytes;
+
+    PowerStats _stats;
+    unsigned long _accountedMs;
+};
+
+// Global erişim için kısayol
+#define Power PowerManager::getInstance()
+
+/**
+ * @brief Scope boyunca boost (transfer fonksiyonunun başına konur)
+ */
+class PowerBoost {
+public:
+    explicit PowerBoost(uint32_t holdMs = POWER_BOOST_HOLD_MS) : _holdMs(holdMs) { Power.beginBoost(); }
+    ~PowerBoost() { Power.endBoost(_holdMs); }
+
+    PowerBoost(const PowerBoost&) = delete;
+    PowerBoost& operator=(const PowerBoost&) = delete;
+
+private:
+    uint32_t _holdMs;
+};
+
+#endif // POWER_MANAGER_H
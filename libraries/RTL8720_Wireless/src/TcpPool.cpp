@@ -0,0 +1,201 @@
+/**
+ * @file TcpPool.cpp
+ * @brief Persistent TCP connection pool implementation
+ */
+
+#include "TcpPool.h"
+#include <SerialManager.h>
+
+TcpPool::TcpPool() {
+    for (Entry& e : _entries) {
+        e.port = 0;
+        e.state = Free;
+        e.measured = false;
+        e.uses = 0;
+        e.idleSinceMs = 0;
+        e.checkedMs = 0;
+    }
+    resetStats();
+}
+
+TcpSocket* TcpPool::acquire(const IPAddress& ip, uint16_t port) {
+    unsigned long now = millis();
+
+    // Aynı endpoint: en son boşa çıkan (sunucunun kapatmış olma ihtimali en düşük)
+    while (true) {
+        Entry* best = nullptr;
+        for (Entry& e : _entries) {
+            if (e.state == Idle && e.port == port && e.ip == ip &&
+                (best == nullptr || e.idleSinceMs > best->idleSinceMs)) {
+                best = &e;
+            }
+        }
+        if (best == nullptr) break;
+        if (!best->sock.checkIdle()) {
+            _stats.deadIdle++;
+            closeEntry(*best);
+            continue;
+        }
+        best->state = Busy;
+        best->uses++;
+        _stats.acquires++;
+        _stats.reuses++;
+        return &best->sock;
+    }
+
+    // Yeni bağlantı: boş slot, yoksa en uzun süredir boşta olan
+    Entry* slot = nullptr;
+    Entry* oldest = nullptr;
+    for (Entry& e : _entries) {
+        if (e.state == Free) {
+            slot = &e;
+            break;
+        }
+        if (e.state == Idle && (oldest == nullptr || e.idleSinceMs < oldest->idleSinceMs)) {
+            oldest = &e;
+        }
+    }
+    if (slot == nullptr) {
+        if (oldest == nullptr) {
+            _stats.busy++;
+            return nullptr;
+        }
+        _stats.evictions++;
+        closeEntry(*oldest);
+        slot = oldest;
+    }
+
+    if (!slot->sock.connect(ip, port)) {
+        _stats.connectFailures++;
+        slot->sock.close();
+        return nullptr;
+    }
+    slot->ip = ip;
+    slot->port = port;
+    slot->state = Busy;
+    slot->measured = false;
+    slot->uses = 1;
+    slot->checkedMs = now;
+    _stats.acquires++;
+    _stats.connects++;
+    return &slot->sock;
+}
+
+void TcpPool::release(TcpSocket* sock, bool reusable) {
+    Entry* e = find(sock);
+    if (e == nullptr || e->state != Busy) return;
+
+    measure(*e);
+    if (!reusable || !sock->isConnected() || e->uses >= TCP_POOL_MAX_USES) {
+        if (sock->getState() == TcpState::Failed && !e->measured) _stats.connectFailures++;
+        else _stats.retired++;
+        closeEntry(*e);
+        return;
+    }
+    e->state = Idle;
+    e->idleSinceMs = millis();
+    e->checkedMs = e->idleSinceMs;
+}
+
+void TcpPool::poll() {
+    unsigned long now = millis();
+    for (Entry& e : _entries) {
+        if (e.state == Busy) {
+            measure(e);
+            continue;
+        }
+        if (e.state != Idle) continue;
+
+        if (now - e.idleSinceMs >= TCP_POOL_IDLE_TIMEOUT_MS) {
+            _stats.idleTimeouts++;
+            closeEntry(e);
+        } else if (now - e.checkedMs >= TCP_POOL_CHECK_INTERVAL_MS) {
+            e.checkedMs = now;
+            if (!e.sock.checkIdle()) {
+                _stats.deadIdle++;
+                closeEntry(e);
+            }
+        }
+    }
+}
+
+void TcpPool::closeIdle() {
+    for (Entry& e : _entries) {
+        if (e.state == Idle) closeEntry(e);
+    }
+}
+
+uint8_t TcpPool::getIdle() const {
+    uint8_t n = 0;
+    for (const Entry& e : _entries) {
+        if (e.state == Idle) n++;
+    }
+    return n;
+}
+
+uint8_t TcpPool::getBusy() const {
+    uint8_t n = 0;
+    for (const Entry& e : _entries) {
+        if (e.state == Busy) n++;
+    }
+    return n;
+}
+
+void TcpPool::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint8_t TcpPool::getReuseRate() const {
+    if (_stats.acquires == 0) return 0;
+    return static_cast<uint8_t>(static_cast<uint64_t>(_stats.reuses) * 100 / _stats.acquires);
+}
+
+uint32_t TcpPool::getAverageConnectUs() const {
+    if (_stats.connectSamples == 0) return 0;
+    return _stats.connectTimeSumUs / _stats.connectSamples;
+}
+
+uint32_t TcpPool::getTimeSavedUs() const {
+    return _stats.reuses * getAverageConnectUs();
+}
+
+uint32_t TcpPool::getTimeSavedPerRequestUs() const {
+    if (_stats.acquires == 0) return 0;
+    return getTimeSavedUs() / _stats.acquires;
+}
+
+TcpPool::Entry* TcpPool::find(const TcpSocket* sock) {
+    for (Entry& e : _entries) {
+        if (&e.sock == sock) return &e;
+    }
+    return nullptr;
+}
+
+void TcpPool::measure(Entry& e) {
+    if (e.measured || !e.sock.isConnected()) return;
+    e.measured = true;
+    uint32_t us = e.sock.getConnectTimeUs();
+    _stats.connectTimeSumUs += us;
+    _stats.connectSamples++;
+    if (us > _stats.connectTimeMaxUs) _stats.connectTimeMaxUs = us;
+}
+
+void TcpPool::closeEntry(Entry& e) {
+    e.sock.close();
+    e.state = Free;
+}
+
+void TcpPool::printStatus() const {
+    const TcpPoolStats& s = _stats;
+    serialManager.logPrintf("[TcpPool] %u busy, %u idle / %u, acquires %lu, reuse %u%%, connects %lu "
+                            "(%lu failed), busy %lu\n",
+                            getBusy(), getIdle(), TCP_POOL_SIZE, (unsigned long)s.acquires, getReuseRate(),
+                            (unsigned long)s.connects, (unsigned long)s.connectFailures,
+                            (unsigned long)s.busy);
+    serialManager.logPrintf("[TcpPool] Connect avg %lu us (max %lu), saved %lu us (%lu us/request), "
+                            "dead idle %lu, idle timeouts %lu, evicted %lu, retired %lu\n",
+                            (unsigned long)getAverageConnectUs(), (unsigned long)s.connectTimeMaxUs,
+                            (unsigned long)getTimeSavedUs(), (unsigned long)getTimeSavedPerRequestUs(),
+                            (unsigned long)s.deadIdle, (unsigned long)s.idleTimeouts,
+                            (unsigned long)s.evictions, (unsigned long)s.retired);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file TcpPool.h
+ * @brief Persistent TCP connection pool: per-endpoint keep-alive sockets,
+ *        cheap idle health checks, reuse metrics
+ *
+ * Her upload için yeni bağlantı: 3-way handshake, slow start ve (TLS'te)
+ * yeni oturum. TcpPool bitmiş bağlantıları endpoint (IP:port) başına boşta
+ * tutar ve aynı endpoint'e sonraki acquire()'da verir:
+ * - acquire(): aynı endpoint'in boştaki socket'i (önce en son kullanılan),
+ *   yoksa yeni connect(); havuz doluysa en uzun süredir boşta olan kapatılır
+ * - Boştaki socket verilmeden önce kontrol edilir (recv MSG_PEEK, veri
+ *   tüketmez): sunucu kapatmışsa (FIN / RST) veya okunmamış veri varsa atılır
+ * - poll(): TCP_POOL_IDLE_TIMEOUT_MS boşta kalanlar kapatılır (sunucunun
+ *   keep-alive süresinden kısa tutun), boştakiler periyodik kontrol edilir
+ * - TCP_POOL_MAX_USES kullanımdan sonra bağlantı yenilenir
+ *
+ * Metrikler: reuse oranı ve kazanılan süre. Yeni bağlantıların connect ->
+ * Connected süresi ölçülür; her reuse ortalama connect süresi kadar kazanç
+ * sayılır (TLS ile gerçek kazanç daha büyüktür).
+ *
+ * Kullanım:
+ *   TcpSocket* sock = pool.acquire(server, 80);
+ *   if (sock && sock->poll() == TcpState::Connected) { ...istek / cevap... }
+ *   pool.release(sock, responseKeepAlive);
+ *   void loop() { pool.poll(); ... }
+ */
+
+#ifndef TCP_POOL_H
+#define TCP_POOL_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "TcpSocket.h"
+
+#ifndef TCP_POOL_SIZE
+    #define TCP_POOL_SIZE                   4
+#endif
+
+#ifndef TCP_POOL_IDLE_TIMEOUT_MS
+    #define TCP_POOL_IDLE_TIMEOUT_MS        4000
+#endif
+
+// Boştaki socket'lerin FIN / RST kontrol aralığı
+#ifndef TCP_POOL_CHECK_INTERVAL_MS
+    #define TCP_POOL_CHECK_INTERVAL_MS      1000
+#endif
+
+#ifndef TCP_POOL_MAX_USES
+    #define TCP_POOL_MAX_USES               100
+#endif
+
+struct TcpPoolStats {
+    uint32_t acquires;          // Verilen socket
+    uint32_t reuses;            // Boştaki socket ile
+    uint32_t connects;          // Yeni connect()
+    uint32_t connectFailures;
+    uint32_t busy;              // Tüm socket'ler kullanımda: nullptr
+    uint32_t deadIdle;          // Kontrolde kapalı / bozuk bulunan boştaki socket
+    uint32_t idleTimeouts;
+    uint32_t evictions;         // Başka endpoint'e yer açmak için kapatılan
+    uint32_t retired;           // TCP_POOL_MAX_USES doldu veya reusable=false
+    uint32_t connectTimeSumUs;  // Ölçülen yeni bağlantılar
+    uint32_t connectTimeMaxUs;
+    uint32_t connectSamples;
+};
+
+class TcpPool {
+public:
+    TcpPool();
+
+    /**
+     * @brief Endpoint için socket ver (beklemez)
+     * @return Connected veya Connecting socket, nullptr: hepsi kullanımda / connect hatası
+     */
+    TcpSocket* acquire(const IPAddress& ip, uint16_t port);
+
+    /**
+     * @brief Socket'i havuza geri ver
+     * @param reusable false: kapat (cevap "Connection: close", yarım kalmış istek)
+     */
+    void release(TcpSocket* sock, bool reusable = true);
+
+    /**
+     * @brief Boşta zaman aşımı ve periyodik kontrol
+     */
+    void poll();
+
+    /**
+     * @brief Boştaki tüm socket'leri kapat (kullanımdakiler etkilenmez)
+     */
+    void closeIdle();
+
+    uint8_t getIdle() const;
+    uint8_t getBusy() const;
+
+    const TcpPoolStats& getStats() const { return _stats; }
+    void resetStats();
+
+    /**
+     * @brief Reuse oranı (%)
+     */
+    uint8_t getReuseRate() const;
+    uint32_t getAverageConnectUs() const;
+
+    /**
+     * @brief Reuse ile kazanılan tahmini süre (reuse x ortalama connect)
+     */
+    uint32_t getTimeSavedUs() const;
+
+    /**
+     * @brief Acquire başına kazanılan tahmini süre
+     */
+    uint32_t getTimeSavedPerRequestUs() const;
+
+    void printStatus() const;
+
+private:
+    enum EntryState : uint8_t {
+        Free,
+        Busy,
+        Idle
+    };
+
+    struct Entry {
+        TcpSocket sock;
+        IPAddress ip;
+        uint16_t port;
+        uint8_t state;
+        bool measured;          // Connect süresi kaydedildi
+        uint16_t uses;
+        unsigned long idleSinceMs;
+        unsigned long checkedMs;
+    };
+
+    Entry* find(const TcpSocket* sock);
+    void measure(Entry& e);
+    void closeEntry(Entry& e);
+
+    Entry _entries[TCP_POOL_SIZE];
+    TcpPoolStats _stats;
+};
+
+#endif // TCP_POOL_H
@@ -0,0 +1,187 @@
+/**
+ * @file TcpSocket.cpp
+ * @brief Non-blocking TCP client socket implementation (lwIP sockets)
+ */
+
+#include "TcpSocket.h"
+#include <SerialManager.h>
+#include <Profiler.h>
+
+extern "C" {
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+}
+
+#include <errno.h>
+
+TcpSocket::TcpSocket()
+    : _fd(-1)
+    , _state(TcpState::Closed)
+    , _error(0)
+    , _connectStartMs(0)
+    , _connectStartTicks(0)
+    , _connectTimeoutMs(TCP_CONNECT_TIMEOUT_MS)
+    , _connectTimeUs(0)
+{
+}
+
+TcpSocket::~TcpSocket() {
+    close();
+}
+
+bool TcpSocket::connect(const IPAddress& ip, uint16_t port, uint32_t timeoutMs) {
+    close();
+    _error = 0;
+    _connectTimeUs = 0;
+
+    _fd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (_fd < 0) {
+        fail(errno);
+        return false;
+    }
+
+    configure();
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl((static_cast<uint32_t>(ip[0]) << 24) | (static_cast<uint32_t>(ip[1]) << 16) |
+                                 (static_cast<uint32_t>(ip[2]) << 8) | ip[3]);
+
+    _connectStartMs = millis();
+    _connectStartTicks = Profiler::ticks();
+    _connectTimeoutMs = timeoutMs;
+    if (lwip_connect(_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0) {
+        _state = TcpState::Connected;
+        return true;
+    }
+    if (errno != EINPROGRESS) {
+        fail(errno);
+        return false;
+    }
+    _state = TcpState::Connecting;
+    return true;
+}
+
+bool TcpSocket::connect(const char* host, uint16_t port, uint32_t timeoutMs) {
+    IPAddress ip;
+    if (!ip.fromString(host)) {
+        struct hostent* he = lwip_gethostbyname(host);
+        if (he == nullptr || he->h_addrtype != AF_INET || he->h_addr_list[0] == nullptr) {
+            close();
+            fail(EHOSTUNREACH);
+            return false;
+        }
+        const uint8_t* a = reinterpret_cast<const uint8_t*>(he->h_addr_list[0]);
+        ip = IPAddress(a[0], a[1], a[2], a[3]);
+    }
+    return connect(ip, port, timeoutMs);
+}
+
+bool TcpSocket::adopt(int fd) {
+    close();
+    if (fd < 0) return false;
+    _fd = fd;
+    _error = 0;
+    _connectTimeUs = 0;
+    configure();
+    _state = TcpState::Connected;
+    return true;
+}
+
+void TcpSocket::configure() {
+    int flags = lwip_fcntl(_fd, F_GETFL, 0);
+    lwip_fcntl(_fd, F_SETFL, flags | O_NONBLOCK);
+    int one = 1;
+    lwip_setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+TcpState TcpSocket::poll() {
+    if (_state != TcpState::Connecting) return _state;
+
+    fd_set wset;
+    FD_ZERO(&wset);
+    FD_SET(_fd, &wset);
+    struct timeval tv = {0, 0};
+    if (lwip_select(_fd + 1, nullptr, &wset, nullptr, &tv) > 0) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        lwip_getsockopt(_fd, SOL_SOCKET, SO_ERROR, &err, &len);
+        if (err != 0) {
+            fail(err);
+        } else {
+            _state = TcpState::Connected;
+            _connectTimeUs = static_cast<uint32_t>(Profiler::ticksToMicros(Profiler::ticks() - _connectStartTicks));
+        }
+    } else if (millis() - _connectStartMs >= _connectTimeoutMs) {
+        fail(ETIMEDOUT);
+    }
+    return _state;
+}
+
+int TcpSocket::write(const uint8_t* data, size_t len) {
+    if (_state != TcpState::Connected) return _state == TcpState::Connecting ? 0 : -1;
+    if (len == 0) return 0;
+
+    int n = lwip_send(_fd, data, len, 0);
+    if (n >= 0) return n;
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+    fail(errno);
+    return -1;
+}
+
+int TcpSocket::read(uint8_t* buf, size_t len) {
+    if (_state != TcpState::Connected) return _state == TcpState::Connecting ? 0 : -1;
+    if (len == 0) return 0;
+
+    int n = lwip_recv(_fd, buf, len, 0);
+    if (n > 0) return n;
+    if (n == 0) {
+        // Karşı taraf kapattı (FIN)
+        fail(ECONNRESET);
+        return -1;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+    fail(errno);
+    return -1;
+}
+
+bool TcpSocket::checkIdle() {
+    if (_state != TcpState::Connected) return false;
+
+    // Boştaki bağlantıda veri beklenmez: FIN / RST recv() 0 / hata olarak görünür
+    uint8_t b;
+    int n = lwip_recv(_fd, &b, 1, MSG_PEEK);
+    if (n > 0) return false;
+    if (n == 0) {
+        fail(ECONNRESET);
+        return false;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+    fail(errno);
+    return false;
+}
+
+void TcpSocket::close() {
+    if (_fd >= 0) {
+        lwip_close(_fd);
+        _fd = -1;
+    }
+    _state = TcpState::Closed;
+}
+
+void TcpSocket::fail(int err) {
+    _error = err;
+    _state = TcpState::Failed;
+}
+
+const char* TcpSocket::stateToString(TcpState state) {
+    switch (state) {
+        case TcpState::Closed:      return "Closed";
+        case TcpState::Connecting:  return "Connecting";
+        case TcpState::Connected:   return "Connected";
+        case TcpState::Failed:      return "Failed";
+        default:                    return "Unknown";
+    }
+}
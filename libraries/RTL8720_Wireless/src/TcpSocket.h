@@ -0,0 +1,112 @@
+/**
+ * @file TcpSocket.h
+ * @brief Non-blocking TCP client socket on the lwIP BSD socket API
+ *
+ * WiFiClient bağlanırken ve gönderirken bloklar; TcpSocket hiçbir çağrıda
+ * beklemez:
+ * - connect() SYN'i gönderip döner, bağlantı poll() içinde tamamlanır
+ *   (select() ile yazılabilirlik + SO_ERROR), connectTimeoutMs dolarsa Failed
+ * - write() socket buffer'ının aldığı kadarını yazar (0: dolu, sonra tekrar)
+ * - read() hazır veri yoksa 0 döner; karşı taraf kapattıysa / hata -1
+ * TCP_NODELAY açıktır: küçük protokol paketleri (MQTT, HTTP başlıkları)
+ * Nagle ile bekletilmez.
+ *
+ * Hostname ile connect() DNS çözümlemesi için bloklar (lwip_gethostbyname);
+ * döngüde beklememek için IP ile bağlanın.
+ *
+ * Kullanım:
+ *   sock.connect(IPAddress(192, 168, 1, 10), 1883);
+ *   void loop() {
+ *       if (sock.poll() == TcpState::Connected) sock.write(data, len);
+ *   }
+ */
+
+#ifndef TCP_SOCKET_H
+#define TCP_SOCKET_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#ifndef TCP_CONNECT_TIMEOUT_MS
+    #define TCP_CONNECT_TIMEOUT_MS      5000
+#endif
+
+enum class TcpState : uint8_t {
+    Closed,
+    Connecting,
+    Connected,
+    Failed              // connect() zaman aşımı / reddedildi veya I/O hatası
+};
+
+class TcpSocket {
+public:
+    TcpSocket();
+    ~TcpSocket();
+
+    TcpSocket(const TcpSocket&) = delete;
+    TcpSocket& operator=(const TcpSocket&) = delete;
+
+    /**
+     * @brief Bağlantıyı başlat (açık socket varsa önce kapatılır)
+     * @return false: socket açılamadı veya hemen reddedildi (getError())
+     */
+    bool connect(const IPAddress& ip, uint16_t port, uint32_t timeoutMs = TCP_CONNECT_TIMEOUT_MS);
+    bool connect(const char* host, uint16_t port, uint32_t timeoutMs = TCP_CONNECT_TIMEOUT_MS);
+
+    /**
+     * @brief accept() ile gelen bağlı socket'i devral (non-blocking yapılır)
+     */
+    bool adopt(int fd);
+
+    /**
+     * @brief Bağlantı durumunu ilerlet (Connecting -> Connected / Failed)
+     */
+    TcpState poll();
+
+    /**
+     * @return Kabul edilen byte (0: gönderme buffer'ı dolu), -1: hata (Failed)
+     */
+    int write(const uint8_t* data, size_t len);
+
+    /**
+     * @return Okunan byte (0: veri yok), -1: karşı taraf kapattı / hata
+     */
+    int read(uint8_t* buf, size_t len);
+
+    void close();
+
+    TcpState getState() const { return _state; }
+    bool isConnected() const { return _state == TcpState::Connected; }
+
+    /**
+     * @brief Son hatanın errno değeri (0: yok)
+     */
+    int getError() const { return _error; }
+
+    /**
+     * @brief connect() -> Connected süresi (us, poll() aralığı dahil)
+     */
+    uint32_t getConnectTimeUs() const { return _connectTimeUs; }
+
+    /**
+     * @brief Boşta bekleyen bağlantının kontrolü (veri tüketmez, beklemez)
+     * @return false: karşı taraf kapattı / hata (Failed) veya okunmamış veri var
+     */
+    bool checkIdle();
+
+    static const char* stateToString(TcpState state);
+
+private:
+    void configure();
+    void fail(int err);
+
+    int _fd;
+    TcpState _state;
+    int _error;
+    unsigned long _connectStartMs;
+    uint32_t _connectStartTicks;
+    uint32_t _connectTimeoutMs;
+    uint32_t _connectTimeUs;
+};
+
+#endif // TCP_SOCKET_H
@@ -0,0 +1,382 @@
+/**
+ * @file TlsClient.cpp
+ * @brief Non-blocking mbedTLS client implementation
+ */
+
+#include "TlsClient.h"
+#include "WiFiCache.h"
+#include <SerialManager.h>
+#include <Profiler.h>
+
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/error.h"
+
+#include <errno.h>
+
+TlsClient::TlsClient()
+    : _cache(nullptr)
+    , _port(0)
+    , _sessionHostHash(0)
+    , _sessionPort(0)
+    , _state(TlsState::Closed)
+    , _error(0)
+    , _ready(false)
+    , _resumption(true)
+    , _sessionValid(false)
+    , _offering(false)
+    , _resumed(false)
+    , _startMs(0)
+    , _timeoutMs(TLS_HANDSHAKE_TIMEOUT_MS)
+    , _handshakeStartTicks(0)
+    , _handshakeUs(0)
+    , _handshakeBytes(0)
+{
+    _hostname[0] = '\0';
+    memset(_offeredMaster, 0, sizeof(_offeredMaster));
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+    mbedtls_x509_crt_init(&_ca);
+    mbedtls_entropy_init(&_entropy);
+    mbedtls_ctr_drbg_init(&_drbg);
+    mbedtls_ssl_session_init(&_session);
+    resetStats();
+}
+
+TlsClient::~TlsClient() {
+    end();
+}
+
+bool TlsClient::begin(const char* caPem, TlsSessionCache* cache) {
+    end();
+    _cache = cache;
+
+    static const char pers[] = "rtl8720_tls";
+    int ret = mbedtls_ctr_drbg_seed(&_drbg, mbedtls_entropy_func, &_entropy,
+                                    reinterpret_cast<const unsigned char*>(pers), sizeof(pers) - 1);
+    if (ret == 0) {
+        ret = mbedtls_ssl_config_defaults(&_conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                          MBEDTLS_SSL_PRESET_DEFAULT);
+    }
+    if (ret == 0 && caPem != nullptr) {
+        // PEM uzunluğu '\0' dahil
+        ret = mbedtls_x509_crt_parse(&_ca, reinterpret_cast<const unsigned char*>(caPem), strlen(caPem) + 1);
+    }
+    if (ret != 0) {
+        fail(ret, "setup");
+        return false;
+    }
+
+    if (caPem != nullptr) {
+        mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_ca_chain(&_conf, &_ca, nullptr);
+    } else {
+        mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_NONE);
+        static bool warned = false;
+        if (!warned) serialManager.logPrintf("[TLS] No CA: server certificate is not verified\n");
+        warned = true;
+    }
+    mbedtls_ssl_conf_rng(&_conf, mbedtls_ctr_drbg_random, &_drbg);
+    mbedtls_ssl_conf_session_tickets(&_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+
+    ret = mbedtls_ssl_setup(&_ssl, &_conf);
+    if (ret != 0) {
+        fail(ret, "setup");
+        return false;
+    }
+
+    _ready = true;
+    _state = TlsState::Closed;
+    _error = 0;
+    return true;
+}
+
+void TlsClient::end() {
+    if (_ready) close();
+    _sock.close();
+    dropSession();
+    mbedtls_ssl_free(&_ssl);
+    mbedtls_ssl_config_free(&_conf);
+    mbedtls_x509_crt_free(&_ca);
+    mbedtls_ctr_drbg_free(&_drbg);
+    mbedtls_entropy_free(&_entropy);
+
+    // Tekrar begin() için
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+    mbedtls_x509_crt_init(&_ca);
+    mbedtls_entropy_init(&_entropy);
+    mbedtls_ctr_drbg_init(&_drbg);
+    _ready = false;
+    _state = TlsState::Closed;
+}
+
+bool TlsClient::connect(const IPAddress& ip, uint16_t port, const char* hostname, uint32_t timeoutMs) {
+    if (!_ready || hostname == nullptr) return false;
+    close();
+
+    strncpy(_hostname, hostname, sizeof(_hostname) - 1);
+    _hostname[sizeof(_hostname) - 1] = '\0';
+    _port = port;
+    _error = 0;
+    _resumed = false;
+    _offering = false;
+    _handshakeUs = 0;
+    _handshakeBytes = 0;
+    _startMs = millis();
+    _timeoutMs = timeoutMs;
+    _stats.connects++;
+
+    if (!_sock.connect(ip, port, timeoutMs < TCP_CONNECT_TIMEOUT_MS ? timeoutMs : TCP_CONNECT_TIMEOUT_MS)) {
+        fail(MBEDTLS_ERR_NET_CONN_RESET, "connect");
+        return false;
+    }
+    _state = TlsState::Connecting;
+    return true;
+}
+
+TlsState TlsClient::poll() {
+    switch (_state) {
+        case TlsState::Connecting: {
+            TcpState tcp = _sock.poll();
+            if (tcp == TcpState::Connected) startHandshake();
+            else if (tcp == TcpState::Failed) fail(MBEDTLS_ERR_NET_CONN_RESET, "connect");
+            break;
+        }
+        case TlsState::Handshaking:
+            stepHandshake();
+            break;
+        default:
+            break;
+    }
+    return _state;
+}
+
+void TlsClient::startHandshake() {
+    int ret = mbedtls_ssl_session_reset(&_ssl);
+    if (ret == 0) ret = mbedtls_ssl_set_hostname(&_ssl, _hostname);
+    if (ret != 0) {
+        fail(ret, "reset");
+        return;
+    }
+    mbedtls_ssl_set_bio(&_ssl, this, bioSend, bioRecv, nullptr);
+
+    // Önce RAM'deki oturum, yoksa flash kopyası (deep sleep sonrası)
+    if (_resumption) {
+        uint32_t hostHash = WiFiCache::hash(_hostname);
+        bool have = _sessionValid && _sessionHostHash == hostHash && _sessionPort == _port;
+        if (!have && _cache != nullptr) {
+            dropSession();
+            have = _cache->restore(_hostname, _port, &_session);
+            if (have) {
+                _sessionValid = true;
+                _sessionHostHash = hostHash;
+                _sessionPort = _port;
+            }
+        }
+        if (have && mbedtls_ssl_set_session(&_ssl, &_session) == 0) {
+            memcpy(_offeredMaster, _session.master, sizeof(_offeredMaster));
+            _offering = true;
+        }
+    }
+
+    _handshakeStartTicks = Profiler::ticks();
+    _state = TlsState::Handshaking;
+    stepHandshake();
+}
+
+void TlsClient::stepHandshake() {
+    int ret = mbedtls_ssl_handshake(&_ssl);
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        if (timedOut()) {
+            _stats.timeouts++;
+            fail(MBEDTLS_ERR_SSL_TIMEOUT, "handshake");
+        }
+        return;
+    }
+    if (ret != 0) {
+        // TLS seviyesinde reddedilen oturum tekrar önerilmez
+        if (_offering && ret != MBEDTLS_ERR_NET_CONN_RESET && ret != MBEDTLS_ERR_SSL_CONN_EOF) {
+            dropSession();
+            if (_cache != nullptr) _cache->invalidate();
+        }
+        fail(ret, "handshake");
+        return;
+    }
+    finishHandshake();
+}
+
+void TlsClient::finishHandshake() {
+    _handshakeUs = static_cast<uint32_t>(Profiler::ticksToMicros(Profiler::ticks() - _handshakeStartTicks));
+    _state = TlsState::Connected;
+
+    // Oturumu al: resume ise master secret önerilenle aynıdır
+    dropSession();
+    bool haveSession = mbedtls_ssl_get_session(&_ssl, &_session) == 0;
+    _resumed = _offering && haveSession &&
+               memcmp(_session.master, _offeredMaster, sizeof(_offeredMaster)) == 0;
+
+    if (_resumed) {
+        _stats.resumedHandshakes++;
+        _stats.resumedTimeSumUs += _handshakeUs;
+        _stats.resumedBytesSum += _handshakeBytes;
+        if (_handshakeUs > _stats.resumedTimeMaxUs) _stats.resumedTimeMaxUs = _handshakeUs;
+    } else {
+        if (_offering) _stats.resumeRejected++;
+        _stats.fullHandshakes++;
+        _stats.fullTimeSumUs += _handshakeUs;
+        _stats.fullBytesSum += _handshakeBytes;
+        if (_handshakeUs > _stats.fullTimeMaxUs) _stats.fullTimeMaxUs = _handshakeUs;
+    }
+
+    if (!haveSession || !_resumption) {
+        dropSession();
+        return;
+    }
+    _sessionValid = true;
+    _sessionHostHash = WiFiCache::hash(_hostname);
+    _sessionPort = _port;
+    if (_cache != nullptr && !_cache->store(_hostname, _port, &_session)) {
+        serialManager.logPrintf("[TLS] Session not persisted (%u bytes max)\n", TLS_SESSION_MAX_SIZE);
+    }
+}
+
+int TlsClient::write(const uint8_t* data, size_t len) {
+    if (_state != TlsState::Connected) {
+        return _state == TlsState::Connecting || _state == TlsState::Handshaking ? 0 : -1;
+    }
+    if (len == 0) return 0;
+
+    int ret = mbedtls_ssl_write(&_ssl, data, len);
+    if (ret >= 0) return ret;
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) return 0;
+    fail(ret, "write");
+    return -1;
+}
+
+int TlsClient::read(uint8_t* buf, size_t len) {
+    if (_state != TlsState::Connected) {
+        return _state == TlsState::Connecting || _state == TlsState::Handshaking ? 0 : -1;
+    }
+    if (len == 0) return 0;
+
+    int ret = mbedtls_ssl_read(&_ssl, buf, len);
+    if (ret > 0) return ret;
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) return 0;
+    if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY || ret == MBEDTLS_ERR_SSL_CONN_EOF) {
+        // Karşı taraf kapattı: hata sayılmaz
+        _error = ret;
+        _state = TlsState::Failed;
+        return -1;
+    }
+    fail(ret, "read");
+    return -1;
+}
+
+void TlsClient::close() {
+    if (_state == TlsState::Connected) {
+        // Tek deneme: gönderilemezse karşı taraf TCP FIN'i görür
+        mbedtls_ssl_close_notify(&_ssl);
+    }
+    _sock.close();
+    _state = TlsState::Closed;
+}
+
+const char* TlsClient::getCiphersuite() const {
+    return _state == TlsState::Connected ? mbedtls_ssl_get_ciphersuite(&_ssl) : "none";
+}
+
+int TlsClient::bioSend(void* ctx, const unsigned char* buf, size_t len) {
+    TlsClient* self = static_cast<TlsClient*>(ctx);
+    int n = self->_sock.write(buf, len);
+    if (n > 0) {
+        if (self->_state == TlsState::Handshaking) self->_handshakeBytes += n;
+        return n;
+    }
+    if (n == 0) return MBEDTLS_ERR_SSL_WANT_WRITE;
+    return MBEDTLS_ERR_NET_CONN_RESET;
+}
+
+int TlsClient::bioRecv(void* ctx, unsigned char* buf, size_t len) {
+    TlsClient* self = static_cast<TlsClient*>(ctx);
+    int n = self->_sock.read(buf, len);
+    if (n > 0) {
+        if (self->_state == TlsState::Handshaking) self->_handshakeBytes += n;
+        return n;
+    }
+    if (n == 0) return MBEDTLS_ERR_SSL_WANT_READ;
+    // FIN: mbedTLS'e EOF olarak ver
+    return self->_sock.getError() == ECONNRESET ? 0 : MBEDTLS_ERR_NET_RECV_FAILED;
+}
+
+bool TlsClient::timedOut() {
+    return millis() - _startMs >= _timeoutMs;
+}
+
+void TlsClient::fail(int err, const char* where) {
+    _error = err;
+    _state = TlsState::Failed;
+    _stats.failures++;
+    _sock.close();
+
+    char text[64];
+    mbedtls_strerror(err, text, sizeof(text));
+    serialManager.logPrintf("[TLS] %s failed: -0x%04X %s\n", where, static_cast<unsigned>(-err), text);
+}
+
+void TlsClient::dropSession() {
+    mbedtls_ssl_session_free(&_session);
+    mbedtls_ssl_session_init(&_session);
+    _sessionValid = false;
+}
+
+void TlsClient::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+uint32_t TlsClient::getAverageFullUs() const {
+    if (_stats.fullHandshakes == 0) return 0;
+    return _stats.fullTimeSumUs / _stats.fullHandshakes;
+}
+
+uint32_t TlsClient::getAverageResumedUs() const {
+    if (_stats.resumedHandshakes == 0) return 0;
+    return _stats.resumedTimeSumUs / _stats.resumedHandshakes;
+}
+
+uint8_t TlsClient::getResumeRate() const {
+    uint32_t total = _stats.fullHandshakes + _stats.resumedHandshakes;
+    if (total == 0) return 0;
+    return static_cast<uint8_t>(static_cast<uint64_t>(_stats.resumedHandshakes) * 100 / total);
+}
+
+void TlsClient::printStatus() const {
+    const TlsStats& s = _stats;
+    uint32_t fullBytes = s.fullHandshakes ? s.fullBytesSum / s.fullHandshakes : 0;
+    uint32_t resumedBytes = s.resumedHandshakes ? s.resumedBytesSum / s.resumedHandshakes : 0;
+    serialManager.logPrintf("[TLS] %s, connects %lu, full %lu, resumed %lu (%u%%), rejected %lu, "
+                            "failures %lu (timeouts %lu)\n",
+                            stateToString(_state), (unsigned long)s.connects, (unsigned long)s.fullHandshakes,
+                            (unsigned long)s.resumedHandshakes, getResumeRate(), (unsigned long)s.resumeRejected,
+                            (unsigned long)s.failures, (unsigned long)s.timeouts);
+    serialManager.logPrintf("[TLS] Full handshake avg %lu us (max %lu), %lu bytes; "
+                            "resumed avg %lu us (max %lu), %lu bytes\n",
+                            (unsigned long)getAverageFullUs(), (unsigned long)s.fullTimeMaxUs,
+                            (unsigned long)fullBytes, (unsigned long)getAverageResumedUs(),
+                            (unsigned long)s.resumedTimeMaxUs, (unsigned long)resumedBytes);
+    if (_cache != nullptr) {
+        serialManager.logPrintf("[TLS] Session cache: %s, %u bytes, %lu flash writes\n",
+                                _cache->isValid() ? "valid" : "empty", _cache->getSessionSize(),
+                                (unsigned long)_cache->getWriteCount());
+    }
+}
+
+const char* TlsClient::stateToString(TlsState state) {
+    switch (state) {
+        case TlsState::Closed:      return "Closed";
+        case TlsState::Connecting:  return "Connecting";
+        case TlsState::Handshaking: return "Handshaking";
+        case TlsState::Connected:   return "Connected";
+        case TlsState::Failed:      return "Failed";
+        default:                    return "Unknown";
+    }
+}
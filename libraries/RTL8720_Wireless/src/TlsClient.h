@@ -0,0 +1,199 @@
+/**
+ * @file TlsClient.h
+ * @brief Non-blocking mbedTLS client on TcpSocket with session resumption
+ *
+ * WiFiSSLClient her bağlantıda bloklayarak tam handshake yapar. TlsClient:
+ * - connect() TCP bağlantısını başlatıp döner; TCP ve TLS handshake poll()
+ *   içinde ilerler (mbedTLS WANT_READ / WANT_WRITE, beklemez)
+ * - Son oturum (session ID veya ticket) RAM'de, TlsSessionCache verilirse
+ *   flash'ta da tutulur ve aynı sunucuya sonraki connect()'te önerilir:
+ *   sunucu kabul ederse ECDHE ve sertifika doğrulaması atlanır
+ * - Resume, yeni oturumun master secret'ı önerilenle aynı olmasından anlaşılır;
+ *   sunucu reddederse tam handshake yapılır ve yeni oturum kaydedilir
+ * - Handshake süresi (TCP bağlantısı sonrası, us) ve handshake'te giden +
+ *   gelen byte, tam ve resume için ayrı istatistiklerde toplanır
+ *
+ * caPem nullptr ise sunucu sertifikası doğrulanmaz (sadece test sunucusu).
+ *
+ * Kullanım:
+ *   TlsSessionCache sessions;
+ *   TlsClient tls;
+ *   tls.begin(CA_PEM, &sessions);
+ *   tls.connect(IPAddress(192, 168, 1, 10), 443, "collector.local");
+ *   void loop() {
+ *       if (tls.poll() == TlsState::Connected) tls.write(data, len);
+ *   }
+ */
+
+#ifndef TLS_CLIENT_H
+#define TLS_CLIENT_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "TcpSocket.h"
+#include "TlsSessionCache.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/x509_crt.h"
+
+// connect() -> Connected (TCP + TLS handshake)
+#ifndef TLS_HANDSHAKE_TIMEOUT_MS
+    #define TLS_HANDSHAKE_TIMEOUT_MS        15000
+#endif
+
+#define TLS_HOSTNAME_MAX                    64
+
+enum class TlsState : uint8_t {
+    Closed,
+    Connecting,         // TCP bağlantısı
+    Handshaking,
+    Connected,
+    Failed              // TCP / handshake hatası, zaman aşımı veya bağlantı koptu
+};
+
+struct TlsStats {
+    uint32_t connects;          // connect() çağrısı
+    uint32_t fullHandshakes;
+    uint32_t resumedHandshakes;
+    uint32_t resumeRejected;    // Oturum önerildi, sunucu tam handshake yaptı
+    uint32_t failures;
+    uint32_t timeouts;
+    uint32_t fullTimeSumUs;     // TCP Connected -> handshake bitti
+    uint32_t fullTimeMaxUs;
+    uint32_t resumedTimeSumUs;
+    uint32_t resumedTimeMaxUs;
+    uint32_t fullBytesSum;      // Handshake'te giden + gelen (TLS kayıtları)
+    uint32_t resumedBytesSum;
+};
+
+class TlsClient {
+public:
+    TlsClient();
+    ~TlsClient();
+
+    TlsClient(const TlsClient&) = delete;
+    TlsClient& operator=(const TlsClient&) = delete;
+
+    /**
+     * @brief mbedTLS'i kur (DRBG, CA zinciri, SSL context)
+     * @param caPem PEM CA sertifikası(ları), nullptr: doğrulama yok
+     * @param cache Oturumların flash kopyası, nullptr: sadece RAM
+     * @return false: DRBG / CA / setup hatası (getError())
+     */
+    bool begin(const char* caPem = nullptr, TlsSessionCache* cache = nullptr);
+
+    /**
+     * @brief Bağlantıyı kapat, mbedTLS kaynaklarını ve RAM'deki oturumu bırak
+     */
+    void end();
+
+    /**
+     * @brief TCP bağlantısını başlat (açık bağlantı önce kapatılır)
+     * @param hostname SNI, sertifika adı ve oturum anahtarı
+     * @return false: begin() yapılmadı veya socket açılamadı
+     */
+    bool connect(const IPAddress& ip, uint16_t port, const char* hostname,
+                 uint32_t timeoutMs = TLS_HANDSHAKE_TIMEOUT_MS);
+
+    /**
+     * @brief TCP bağlantısını ve handshake'i ilerlet
+     */
+    TlsState poll();
+
+    /**
+     * @return Şifrelenip gönderilen byte (0: tekrar dene), -1: hata (Failed)
+     */
+    int write(const uint8_t* data, size_t len);
+
+    /**
+     * @return Çözülen byte (0: veri yok), -1: karşı taraf kapattı / hata
+     */
+    int read(uint8_t* buf, size_t len);
+
+    /**
+     * @brief close_notify gönder (beklemez) ve TCP'yi kapat
+     */
+    void close();
+
+    /**
+     * @brief false: oturum önerilmez / saklanmaz (her bağlantı tam handshake)
+     */
+    void setResumption(bool enabled) { _resumption = enabled; }
+
+    TlsState getState() const { return _state; }
+    bool isConnected() const { return _state == TlsState::Connected; }
+
+    /**
+     * @brief Son handshake kısaltılmış mıydı
+     */
+    bool isResumed() const { return _resumed; }
+
+    /**
+     * @brief Son mbedTLS hata kodu (0: yok), TCP hatası için getSocket().getError()
+     */
+    int getError() const { return _error; }
+
+    uint32_t getHandshakeTimeUs() const { return _handshakeUs; }
+    uint32_t getHandshakeBytes() const { return _handshakeBytes; }
+    uint32_t getConnectTimeUs() const { return _sock.getConnectTimeUs(); }
+    const TcpSocket& getSocket() const { return _sock; }
+    const char* getCiphersuite() const;
+
+    const TlsStats& getStats() const { return _stats; }
+    void resetStats();
+    uint32_t getAverageFullUs() const;
+    uint32_t getAverageResumedUs() const;
+
+    /**
+     * @brief Resume edilen handshake oranı (%)
+     */
+    uint8_t getResumeRate() const;
+
+    void printStatus() const;
+
+    static const char* stateToString(TlsState state);
+
+private:
+    static int bioSend(void* ctx, const unsigned char* buf, size_t len);
+    static int bioRecv(void* ctx, unsigned char* buf, size_t len);
+
+    void startHandshake();
+    void stepHandshake();
+    void finishHandshake();
+    bool timedOut();
+    void fail(int err, const char* where);
+    void dropSession();
+
+    TcpSocket _sock;
+    mbedtls_ssl_context _ssl;
+    mbedtls_ssl_config _conf;
+    mbedtls_x509_crt _ca;
+    mbedtls_entropy_context _entropy;
+    mbedtls_ctr_drbg_context _drbg;
+    mbedtls_ssl_session _session;       // Son oturum (RAM)
+    TlsSessionCache* _cache;
+
+    char _hostname[TLS_HOSTNAME_MAX];
+    uint16_t _port;
+    uint32_t _sessionHostHash;
+    uint16_t _sessionPort;
+    uint8_t _offeredMaster[48];
+
+    TlsState _state;
+    int _error;
+    bool _ready;
+    bool _resumption;
+    bool _sessionValid;
+    bool _offering;
+    bool _resumed;
+
+    unsigned long _startMs;
+    uint32_t _timeoutMs;
+    uint32_t _handshakeStartTicks;
+    uint32_t _handshakeUs;
+    uint32_t _handshakeBytes;
+    TlsStats _stats;
+};
+
+#endif // TLS_CLIENT_H
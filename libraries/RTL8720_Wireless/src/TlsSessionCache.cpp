@@ -0,0 +1,157 @@
+/**
+ * @file TlsSessionCache.cpp
+ * @brief Flash-persisted TLS session cache implementation
+ */
+
+#include "TlsSessionCache.h"
+#include "WiFiCache.h"
+#include <stddef.h>
+
+extern "C" {
+#include "flash_api.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "device_lock.h"
+}
+#define TLS_SESSION_FLASH_LOCK()    device_mutex_lock(RT_DEV_LOCK_FLASH)
+#define TLS_SESSION_FLASH_UNLOCK()  device_mutex_unlock(RT_DEV_LOCK_FLASH)
+#else
+#define TLS_SESSION_FLASH_LOCK()    do {} while (0)
+#define TLS_SESSION_FLASH_UNLOCK()  do {} while (0)
+#endif
+
+static_assert(sizeof(TlsSessionRecord) + TLS_SESSION_MAX_SIZE <= 0x1000,
+              "TLS session record must fit in one flash sector");
+
+TlsSessionCache::TlsSessionCache()
+    : _valid(false)
+    , _loaded(false)
+    , _writeCount(0)
+{
+    memset(&_record, 0, sizeof(_record));
+}
+
+bool TlsSessionCache::load() {
+    if (_loaded) return _valid;
+    _loaded = true;
+    _valid = false;
+
+    flash_t flash;
+    TLS_SESSION_FLASH_LOCK();
+    flash_stream_read(&flash, TLS_SESSION_FLASH_ADDR, sizeof(_record), reinterpret_cast<uint8_t*>(&_record));
+    bool header = _record.magic == TLS_SESSION_MAGIC &&
+                  _record.version == TLS_SESSION_VERSION &&
+                  _record.length == sizeof(_record) &&
+                  _record.dataLength > 0 && _record.dataLength <= TLS_SESSION_MAX_SIZE;
+    if (header) {
+        flash_stream_read(&flash, TLS_SESSION_FLASH_ADDR + sizeof(_record), _record.dataLength, _data);
+    }
+    TLS_SESSION_FLASH_UNLOCK();
+
+    _valid = header && _record.crc == checksum();
+    if (!_valid) {
+        memset(&_record, 0, sizeof(_record));
+    }
+    return _valid;
+}
+
+bool TlsSessionCache::restore(const char* hostname, uint16_t port, mbedtls_ssl_session* session) {
+#if TLS_SESSION_PERSIST
+    if (!load() || !matches(hostname, port)) return false;
+    return mbedtls_ssl_session_load(session, _data, _record.dataLength) == 0;
+#else
+    (void)hostname;
+    (void)port;
+    (void)session;
+    return false;
+#endif
+}
+
+bool TlsSessionCache::store(const char* hostname, uint16_t port, const mbedtls_ssl_session* session) {
+#if TLS_SESSION_PERSIST
+    load();
+    TlsSessionRecord previous = _record;
+    bool wasValid = _valid;
+
+    // Doğrudan RAM kopyasına serileştir; değişiklik CRC ile anlaşılır
+    size_t length = 0;
+    if (mbedtls_ssl_session_save(session, _data, sizeof(_data), &length) != 0 || length == 0) {
+        // Eski veri bozuldu: sonraki load() flash'tan okusun
+        _valid = false;
+        _loaded = false;
+        return false;
+    }
+
+    _record.magic = TLS_SESSION_MAGIC;
+    _record.version = TLS_SESSION_VERSION;
+    _record.length = sizeof(_record);
+    _record.hostHash = WiFiCache::hash(hostname);
+    _record.port = port;
+    _record.dataLength = static_cast<uint16_t>(length);
+    _record.crc = checksum();
+    _valid = true;
+
+    // Aynı oturum (resume, yeni ticket yok) için flash'ı aşındırma
+    if (wasValid && memcmp(&previous, &_record, sizeof(_record)) == 0) {
+        return true;
+    }
+
+    // Önce veri, en son header: yarıda kesilen yazımda magic 0xFF kalır
+    flash_t flash;
+    TLS_SESSION_FLASH_LOCK();
+    flash_erase_sector(&flash, TLS_SESSION_FLASH_ADDR);
+    int ok = flash_stream_write(&flash, TLS_SESSION_FLASH_ADDR + sizeof(_record), _record.dataLength, _data);
+    if (ok) {
+        ok = flash_stream_write(&flash, TLS_SESSION_FLASH_ADDR, sizeof(_record),
+                                reinterpret_cast<uint8_t*>(&_record));
+    }
+    TLS_SESSION_FLASH_UNLOCK();
+
+    _writeCount++;
+    return ok != 0;
+#else
+    (void)hostname;
+    (void)port;
+    (void)session;
+    return false;
+#endif
+}
+
+void TlsSessionCache::invalidate() {
+    load();
+    if (!_valid) return;
+
+    // Sektör silmeden magic'i sıfırla
+    uint32_t zero = 0;
+    flash_t flash;
+    TLS_SESSION_FLASH_LOCK();
+    flash_stream_write(&flash, TLS_SESSION_FLASH_ADDR + offsetof(TlsSessionRecord, magic),
+                       sizeof(zero), reinterpret_cast<uint8_t*>(&zero));
+    TLS_SESSION_FLASH_UNLOCK();
+
+    _writeCount++;
+    _valid = false;
+    memset(&_record, 0, sizeof(_record));
+}
+
+bool TlsSessionCache::matches(const char* hostname, uint16_t port) const {
+    if (!_valid || hostname == nullptr) return false;
+    return _record.hostHash == WiFiCache::hash(hostname) && _record.port == port;
+}
+
+uint32_t TlsSessionCache::checksum() const {
+    // CRC alanı hariç header + oturum verisi üzerinde FNV-1a
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&_record);
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; i < offsetof(TlsSessionRecord, crc); i++) {
+        h ^= p[i];
+        h *= 16777619UL;
+    }
+    for (size_t i = 0; i < _record.dataLength; i++) {
+        h ^= _data[i];
+        h *= 16777619UL;
+    }
+    return h;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file TlsSessionCache.h
+ * @brief TLS session (ID / ticket) cache persisted in flash across deep sleep
+ *
+ * Tam TLS handshake (ECDHE + sertifika doğrulama) hem CPU hem radyo süresi
+ * olarak bir upload'ın en pahalı kısmıdır. Sunucunun verdiği oturum
+ * (mbedtls_ssl_session_save ile serileştirilmiş session ID / ticket) flash'ta
+ * tutulur; deep sleep'ten uyanınca RAM kaybolsa da sonraki bağlantı kısaltılmış
+ * handshake ile açılır.
+ *
+ * Tek kayıt (son kullanılan sunucu), hostname FNV-1a hash'i ve port ile
+ * eşleştirilir. Flash'a sadece oturum değiştiğinde yazılır; önce oturum
+ * verisi, en son header yazılır (yarım kalan yazım geçersiz sayılır).
+ * invalidate() WiFiCache gibi sektör silmeden magic alanını sıfırlar.
+ *
+ * Kayıt master secret içerir: flash okunabilen cihazlarda oturum ömrü kısa
+ * tutulmalıdır (sunucu ticket lifetime).
+ *
+ * mbedtls_ssl_session_save / load mbedTLS 2.19'da geldi; daha eski SDK'da
+ * TLS_SESSION_PERSIST 0 olur ve oturum sadece RAM'de kalır (TlsClient).
+ */
+
+#ifndef TLS_SESSION_CACHE_H
+#define TLS_SESSION_CACHE_H
+
+#include <Arduino.h>
+#include "mbedtls/version.h"
+#include "mbedtls/ssl.h"
+
+#if MBEDTLS_VERSION_NUMBER >= 0x02130000
+    #define TLS_SESSION_PERSIST             1
+#else
+    #define TLS_SESSION_PERSIST             0
+#endif
+
+// Oturum sektörü (4 KB), WiFi cache sektörünün altında
+#ifndef TLS_SESSION_FLASH_ADDR
+    #define TLS_SESSION_FLASH_ADDR          0x1FD000
+#endif
+
+// Serileştirilmiş oturum üst sınırı (peer sertifikası dahil olabilir)
+#ifndef TLS_SESSION_MAX_SIZE
+    #define TLS_SESSION_MAX_SIZE            2048
+#endif
+
+#define TLS_SESSION_MAGIC                   0x544C5331  // "TLS1"
+#define TLS_SESSION_VERSION                 1
+
+/**
+ * @brief Flash'taki header; ardından dataLength byte oturum verisi
+ */
+struct TlsSessionRecord {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;            // sizeof(TlsSessionRecord)
+    uint32_t hostHash;          // FNV-1a(hostname)
+    uint16_t port;
+    uint16_t dataLength;
+    uint32_t crc;               // Header (crc hariç) + veri
+};
+
+class TlsSessionCache {
+public:
+    TlsSessionCache();
+
+    /**
+     * @brief Kaydı flash'tan oku (ilk çağrıda; sonrası RAM kopyası)
+     * @return true: geçerli kayıt var
+     */
+    bool load();
+
+    /**
+     * @brief Bu sunucunun oturumunu session'a çöz
+     * @return false: kayıt yok / başka sunucu / çözülemedi
+     */
+    bool restore(const char* hostname, uint16_t port, mbedtls_ssl_session* session);
+
+    /**
+     * @brief Oturumu RAM'e ve (değiştiyse) flash'a yaz
+     * @return false: serileştirilemedi (çok büyük) veya flash yazımı başarısız
+     */
+    bool store(const char* hostname, uint16_t port, const mbedtls_ssl_session* session);
+
+    /**
+     * @brief Kaydı geçersiz kıl (sunucu oturumu reddetti / handshake hatası)
+     */
+    void invalidate();
+
+    /**
+     * @brief RAM kopyasını bırak: sonraki load() flash'tan okur (deep sleep uyanışı)
+     */
+    void forget() { _loaded = false; }
+
+    bool isValid() const { return _valid; }
+    bool matches(const char* hostname, uint16_t port) const;
+
+    const TlsSessionRecord& get() const { return _record; }
+    uint16_t getSessionSize() const { return _valid ? _record.dataLength : 0; }
+
+    /**
+     * @brief Flash'a yazma sayısı (aşınma takibi)
+     */
+    uint32_t getWriteCount() const { return _writeCount; }
+
+private:
+    uint32_t checksum() const;
+
+    TlsSessionRecord _record;
+    uint8_t _data[TLS_SESSION_MAX_SIZE];
+    bool _valid;
+    bool _loaded;
+    uint32_t _writeCount;
+};
+
+#endif // TLS_SESSION_CACHE_H
@@ -0,0 +1,258 @@
+/**
+ * @file UdpTelemetry.cpp
+ * @brief Batched UDP telemetry implementation (lwIP raw API)
+ */
+
+#include "UdpTelemetry.h"
+#include <SerialManager.h>
+
+extern "C" {
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+#include "lwip/tcpip.h"
+}
+
+UdpTelemetry::UdpTelemetry()
+    : _filling(nullptr)
+    , _pcb(nullptr)
+    , _port(0)
+    , _recordSize(0)
+    , _maxRecords(0)
+    , _deadlineMs(UDP_TELEMETRY_DEADLINE_MS)
+    , _seq(0)
+    , _lastError(ERR_OK)
+    , _active(false)
+{
+    memset(&_addr, 0, sizeof(_addr));
+    for (Slot& slot : _slots) {
+        slot.owner = this;
+        slot.state = SlotFree;
+    }
+    resetStats();
+}
+
+bool UdpTelemetry::begin(const IPAddress& ip, uint16_t port, const UdpTelemetryConfig& config) {
+    uint16_t capacity = config.recordSize == 0 ? 0 :
+        (UDP_TELEMETRY_PACKET_SIZE - UDP_TELEMETRY_HEADER_SIZE) / config.recordSize;
+    if (capacity == 0) {
+        DEBUG_SERIAL.println("[Telemetry] Record does not fit a packet");
+        return false;
+    }
+    if (_active) end();
+
+    IP_ADDR4(&_addr, ip[0], ip[1], ip[2], ip[3]);
+    _port = port;
+    _recordSize = config.recordSize;
+    _maxRecords = (config.maxRecords == 0 || config.maxRecords > capacity) ? capacity : config.maxRecords;
+    _deadlineMs = config.deadlineMs;
+    _seq = 0;
+    _active = true;
+
+    serialManager.logPrintf("[Telemetry] %u-byte records, %u per packet, deadline %u ms -> %u.%u.%u.%u:%u\n",
+                            _recordSize, _maxRecords, _deadlineMs,
+                            ip[0], ip[1], ip[2], ip[3], _port);
+    return true;
+}
+
+void UdpTelemetry::end() {
+    if (!_active) return;
+    flush();
+    _active = false;
+    // mbox FIFO: kuyruktaki gönderimlerden sonra çalışır
+    tcpip_callback(removeInTcpip, this);
+}
+
+void UdpTelemetry::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+// ============================================================================
+// Producer
+// ============================================================================
+
+UdpTelemetry::Slot* UdpTelemetry::acquire() {
+    reclaim();
+
+    Slot* found = nullptr;
+    uint8_t inUse = 0;
+    for (Slot& slot : _slots) {
+        if (__atomic_load_n(&slot.state, __ATOMIC_ACQUIRE) != SlotFree) {
+            inUse++;
+        } else if (found == nullptr) {
+            found = &slot;
+        }
+    }
+    if (found == nullptr) return nullptr;
+
+    found->count = 0;
+    found->offsetSumUs = 0;
+    found->state = SlotFilling;
+    if (inUse + 1 > _stats.buffersHighWater) _stats.buffersHighWater = inUse + 1;
+    return found;
+}
+
+uint8_t* UdpTelemetry::reserve() {
+    if (!_active) return nullptr;
+    if (_filling == nullptr) {
+        _filling = acquire();
+        if (_filling == nullptr) {
+            _stats.dropped++;
+            return nullptr;
+        }
+    }
+    return &_filling->data[UDP_TELEMETRY_HEADER_SIZE + _filling->count * _recordSize];
+}
+
+void UdpTelemetry::commit() {
+    Slot* slot = _filling;
+    if (slot == nullptr) return;
+
+    uint32_t now = micros();
+    if (slot->count == 0) {
+        slot->firstUs = now;
+    } else {
+        slot->offsetSumUs += now - slot->firstUs;
+    }
+    slot->count++;
+    _stats.records++;
+
+    if (slot->count >= _maxRecords) submit(slot);
+}
+
+bool UdpTelemetry::append(const void* record) {
+    uint8_t* dst = reserve();
+    if (dst == nullptr) return false;
+    memcpy(dst, record, _recordSize);
+    commit();
+    return true;
+}
+
+void UdpTelemetry::flush() {
+    if (_filling != nullptr && _filling->count > 0) submit(_filling);
+}
+
+void UdpTelemetry::poll() {
+    reclaim();
+
+    Slot* slot = _filling;
+    if (slot != nullptr && slot->count > 0 &&
+        micros() - slot->firstUs >= static_cast<uint32_t>(_deadlineMs) * 1000) {
+        _stats.deadlineFlushes++;
+        submit(slot);
+    }
+}
+
+void UdpTelemetry::submit(Slot* slot) {
+    UdpTelemetryHeader header = {UDP_TELEMETRY_VERSION, _recordSize, slot->count, _seq++};
+    memcpy(slot->data, &header, sizeof(header));
+    slot->length = UDP_TELEMETRY_HEADER_SIZE + slot->count * _recordSize;
+    _filling = nullptr;
+
+    __atomic_store_n(&slot->state, SlotQueued, __ATOMIC_RELEASE);
+    if (tcpip_callback(sendInTcpip, slot) != ERR_OK) {
+        // mbox dolu: paket gitmedi, buffer hemen boşa döner
+        _stats.sendErrors++;
+        _stats.lostRecords += slot->count;
+        __atomic_store_n(&slot->state, SlotFree, __ATOMIC_RELEASE);
+    }
+}
+
+void UdpTelemetry::reclaim() {
+    for (Slot& slot : _slots) {
+        if (__atomic_load_n(&slot.state, __ATOMIC_ACQUIRE) != SlotSent) continue;
+
+        if (slot.err == ERR_OK) {
+            uint32_t oldest = slot.sentUs - slot.firstUs;
+            _stats.packets++;
+            _stats.sentRecords += slot.count;
+            _stats.bytes += slot.length;
+            _stats.latencySumUs += static_cast<uint64_t>(oldest) * slot.count - slot.offsetSumUs;
+            if (oldest > _stats.latencyMaxUs) _stats.latencyMaxUs = oldest;
+        } else {
+            if (slot.err != _lastError) {
+                serialManager.logPrintf("[Telemetry] Send failed: %s\n", errorToString(slot.err));
+            }
+            _stats.sendErrors++;
+            _stats.lostRecords += slot.count;
+        }
+        _lastError = slot.err;
+        slot.state = SlotFree;
+    }
+}
+
+// ============================================================================
+// tcpip thread
+// ============================================================================
+
+void UdpTelemetry::sendInTcpip(void* ctx) {
+    Slot* slot = static_cast<Slot*>(ctx);
+    UdpTelemetry* self = slot->owner;
+
+    if (self->_pcb == nullptr) self->_pcb = udp_new();
+
+    err_t err = ERR_MEM;
+    if (self->_pcb != nullptr) {
+        // PBUF_REF: pbuf sadece slot'un verisini gösterir, kopya yok
+        struct pbuf* p = pbuf_alloc(PBUF_TRANSPORT, slot->length, PBUF_REF);
+        if (p != nullptr) {
+            p->payload = slot->data;
+            err = udp_sendto(self->_pcb, p, &self->_addr, self->_port);
+            pbuf_free(p);
+        }
+    }
+
+    slot->err = err;
+    slot->sentUs = micros();
+    __atomic_store_n(&slot->state, SlotSent, __ATOMIC_RELEASE);
+}
+
+void UdpTelemetry::removeInTcpip(void* ctx) {
+    UdpTelemetry* self = static_cast<UdpTelemetry*>(ctx);
+    if (self->_pcb == nullptr) return;
+    udp_remove(self->_pcb);
+    self->_pcb = nullptr;
+}
+
+// ============================================================================
+// Status
+// ============================================================================
+
+uint8_t UdpTelemetry::getBuffersInUse() const {
+    uint8_t inUse = 0;
+    for (const Slot& slot : _slots) {
+        if (__atomic_load_n(&slot.state, __ATOMIC_ACQUIRE) != SlotFree) inUse++;
+    }
+    return inUse;
+}
+
+uint32_t UdpTelemetry::getAverageLatencyUs() const {
+    if (_stats.sentRecords == 0) return 0;
+    return static_cast<uint32_t>(_stats.latencySumUs / _stats.sentRecords);
+}
+
+void UdpTelemetry::printStatus() const {
+    const UdpTelemetryStats& s = _stats;
+    serialManager.logPrintf("[Telemetry] Records %lu, packets %lu (%lu deadline), %lu bytes, "
+                            "%lu records/packet\n",
+                            (unsigned long)s.records, (unsigned long)s.packets,
+                            (unsigned long)s.deadlineFlushes, (unsigned long)s.bytes,
+                            (unsigned long)(s.packets ? s.sentRecords / s.packets : 0));
+    serialManager.logPrintf("[Telemetry] Dropped %lu, send errors %lu (%lu records), "
+                            "latency avg %lu us / max %lu us, buffers %u/%u (peak %u)\n",
+                            (unsigned long)s.dropped, (unsigned long)s.sendErrors,
+                            (unsigned long)s.lostRecords, (unsigned long)getAverageLatencyUs(),
+                            (unsigned long)s.latencyMaxUs, getBuffersInUse(),
+                            UDP_TELEMETRY_BUFFER_COUNT, s.buffersHighWater);
+}
+
+const char* UdpTelemetry::errorToString(int8_t err) {
+    switch (err) {
+        case ERR_OK:    return "OK";
+        case ERR_MEM:   return "Out of memory";
+        case ERR_BUF:   return "Buffer error";
+        case ERR_RTE:   return "No route";
+        case ERR_VAL:   return "Illegal value";
+        case ERR_ARG:   return "Illegal argument";
+        default:        return "Unknown";
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * @file UdpTelemetry.h
+ * @brief Batched UDP telemetry: fixed-size records packed into pre-allocated
+ *        datagrams, handed to lwIP without copying
+ *
+ * Küçük okumaları tek tek UDP paketiyle göndermek her kayıt için IP/UDP/802.11
+ * header'ı ve kanal erişim süresi öder. UdpTelemetry kayıtları sabit
+ * boyutlu paket buffer'larında toplar:
+ * - Üretici reserve() ile doğrudan paket buffer'ındaki kayıt yerine yazar,
+ *   commit() ile kaydı ekler (append() = reserve + memcpy + commit)
+ * - Buffer maxRecords'a ulaşınca (boyut) veya ilk kaydı deadlineMs'den uzun
+ *   beklediyse (poll() içinde) gönderilir
+ * - Gönderim tcpip thread'inde yapılır: buffer PBUF_REF pbuf ile sarılıp
+ *   udp_sendto()'ya verilir, ara kopya yoktur. udp_sendto() dönünce sürücü
+ *   veriyi kendi TX buffer'ına almıştır (ARP beklerken lwIP kopyalar);
+ *   buffer bir sonraki poll()'da boş havuza döner
+ * - Boş buffer yoksa kayıt reddedilir (dropped); bekleme / heap yok
+ *
+ * Datagram: [UdpTelemetryHeader (8 byte)] [count x recordSize]
+ * Alıcı seq boşluklarından kayıp paketleri görür.
+ *
+ * Kayıt ekleme (reserve / commit / append / flush / poll) tek context'ten
+ * (loop) yapılmalıdır; ISR'dan değil.
+ *
+ * Kullanım:
+ *   telemetry.begin(IPAddress(192, 168, 1, 10), 9000, config);
+ *   Reading* r = reinterpret_cast<Reading*>(telemetry.reserve());
+ *   if (r != nullptr) { r->value = ...; telemetry.commit(); }
+ *   void loop() { telemetry.poll(); ... }
+ */
+
+#ifndef UDP_TELEMETRY_H
+#define UDP_TELEMETRY_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+extern "C" {
+#include "lwip/ip_addr.h"
+}
+
+struct udp_pcb;
+
+// Datagram boyutu (header dahil, 1472 byte UDP payload sınırının altında)
+#ifndef UDP_TELEMETRY_PACKET_SIZE
+    #define UDP_TELEMETRY_PACKET_SIZE       1400
+#endif
+
+// Paket buffer sayısı (biri dolarken diğerleri tcpip thread'inde olabilir)
+#ifndef UDP_TELEMETRY_BUFFER_COUNT
+    #define UDP_TELEMETRY_BUFFER_COUNT      4
+#endif
+
+// İlk kayıttan sonra paketin en fazla bekleyeceği süre (ms)
+#ifndef UDP_TELEMETRY_DEADLINE_MS
+    #define UDP_TELEMETRY_DEADLINE_MS       100
+#endif
+
+#define UDP_TELEMETRY_VERSION               1
+#define UDP_TELEMETRY_HEADER_SIZE           8
+
+/**
+ * @brief Datagram başlığı (little-endian)
+ */
+struct UdpTelemetryHeader {
+    uint8_t version;
+    uint8_t recordSize;
+    uint16_t count;             // Paketteki kayıt sayısı
+    uint32_t seq;               // Paket sıra numarası
+};
+
+static_assert(sizeof(UdpTelemetryHeader) == UDP_TELEMETRY_HEADER_SIZE, "header must be 8 bytes");
+
+struct UdpTelemetryConfig {
+    uint8_t recordSize;         // Sabit kayıt boyutu (byte)
+    uint16_t maxRecords;        // Paket başına kayıt (0: pakete sığan kadar)
+    uint16_t deadlineMs;        // Boyut dolmasa da gönderme süresi
+};
+
+struct UdpTelemetryStats {
+    uint32_t records;           // commit() edilen kayıt
+    uint32_t packets;           // udp_sendto() kabul etti
+    uint32_t sentRecords;       // ... bu paketlerdeki kayıt
+    uint32_t bytes;             // Gönderilen UDP payload (header dahil)
+    uint32_t deadlineFlushes;   // Dolmadan deadline ile giden paket
+    uint32_t dropped;           // Boş buffer yok, reddedilen kayıt
+    uint32_t sendErrors;        // udp_sendto() / tcpip_callback() hatası (paket)
+    uint32_t lostRecords;       // Hatalı paketlerdeki kayıt
+    uint32_t latencyMaxUs;      // commit() -> udp_sendto() en uzun
+    uint64_t latencySumUs;      // ... gönderilen kayıtlar üzerinden toplam
+    uint8_t buffersHighWater;   // Aynı anda kullanımda olan en fazla buffer
+};
+
+class UdpTelemetry {
+public:
+    UdpTelemetry();
+
+    /**
+     * @brief Hedefi ve batch ayarını belirle (paket sıra numarası sıfırlanır)
+     * @return false: recordSize 0 veya pakete sığmıyor
+     */
+    bool begin(const IPAddress& ip, uint16_t port, const UdpTelemetryConfig& config);
+
+    /**
+     * @brief Dolan buffer'ı gönder, pcb'yi tcpip thread'inde kapat
+     */
+    void end();
+
+    bool isActive() const { return _active; }
+
+    /**
+     * @brief Sıradaki kaydın paket buffer'ındaki yeri
+     * @return recordSize byte'lık alan (nullptr: boş buffer yok, dropped sayılır)
+     */
+    uint8_t* reserve();
+
+    /**
+     * @brief reserve() ile yazılan kaydı ekle; paket doluysa gönderir
+     */
+    void commit();
+
+    /**
+     * @brief Kaydı kopyalayarak ekle
+     * @return false: boş buffer yok
+     */
+    bool append(const void* record);
+
+    /**
+     * @brief Dolmakta olan paketi beklemeden gönder
+     */
+    void flush();
+
+    /**
+     * @brief Gönderilen buffer'ları geri al, deadline'ı dolan paketi gönder
+     */
+    void poll();
+
+    uint16_t getMaxRecords() const { return _maxRecords; }
+    uint8_t getBuffersInUse() const;
+
+    const UdpTelemetryStats& getStats() const { return _stats; }
+    void resetStats();
+
+    /**
+     * @brief Kayıt başına ortalama commit() -> udp_sendto() gecikmesi
+     */
+    uint32_t getAverageLatencyUs() const;
+
+    void printStatus() const;
+
+    static const char* errorToString(int8_t err);
+
+private:
+    enum SlotState : uint8_t {
+        SlotFree,
+        SlotFilling,
+        SlotQueued,             // tcpip thread'inde
+        SlotSent                // poll() sayaçları işleyip boşaltır
+    };
+
+    struct Slot {
+        uint8_t data[UDP_TELEMETRY_PACKET_SIZE];
+        UdpTelemetry* owner;
+        uint16_t count;
+        uint16_t length;
+        uint32_t firstUs;       // İlk kaydın commit() zamanı
+        uint64_t offsetSumUs;   // Sonraki kayıtların firstUs'e göre toplamı
+        uint32_t sentUs;
+        int8_t err;
+        uint8_t state;
+    };
+
+    Slot* acquire();
+    void submit(Slot* slot);
+    void reclaim();
+
+    static void sendInTcpip(void* ctx);
+    static void removeInTcpip(void* ctx);
+
+    Slot _slots[UDP_TELEMETRY_BUFFER_COUNT];
+    Slot* _filling;
+    struct udp_pcb* _pcb;       // Sadece tcpip thread'inde kullanılır
+    ip_addr_t _addr;
+    uint16_t _port;
+    uint8_t _recordSize;
+    uint16_t _maxRecords;
+    uint16_t _deadlineMs;
+    uint32_t _seq;
+    int8_t _lastError;
+    bool _active;
+    UdpTelemetryStats _stats;
+};
+
+#endif // UDP_TELEMETRY_H
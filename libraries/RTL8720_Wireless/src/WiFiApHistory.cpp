@@ -0,0 +1,200 @@
+/**
+ * @file WiFiApHistory.cpp
+ * @brief BSSID-keyed AP history implementation
+ */
+
+#include "WiFiApHistory.h"
+
+namespace {
+
+int8_t clampRssi(int32_t rssi) {
+    if (rssi < -128) return -128;
+    if (rssi > 0) return 0;
+    return static_cast<int8_t>(rssi);
+}
+
+} // namespace
+
+WiFiApHistory::WiFiApHistory(uint8_t hysteresisDb, uint8_t missLimit)
+    : _hysteresis(hysteresisDb)
+    , _missLimit(missLimit ? missLimit : 1)
+    , _generation(0)
+    , _stats{0, 0, 0, 0, 0, 0, 0}
+{
+}
+
+void WiFiApHistory::clear() {
+    _table.clear();
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+WiFiApDeltaSummary WiFiApHistory::update(const WiFiScanTable& table, WiFiApDeltaCallback callback,
+                                         void* user, uint8_t scannedBands) {
+    WiFiApDeltaSummary summary = {0, 0, 0, 0, 0, 0, 0};
+    _generation++;
+    _stats.scans++;
+
+    // 1) Bilinen AP'ler: bu taramada görüldü olarak işaretlenir
+    for (const WiFiNetworkInfo& ap : table) {
+        int8_t rssi = clampRssi(ap.rssi);
+
+        WiFiApDelta full = { WiFiApDeltaType::Added, {0}, ap.channel, rssi, false, ap.ssid };
+        memcpy(full.bssid, ap.bssid, sizeof(full.bssid));
+        summary.fullBytes += encodedSize(full);
+
+        int slot = _table.find(ap.bssid);
+        if (slot < 0) continue;
+
+        Entry& e = _table[slot];
+        if (e.lastSeen == _generation) continue;    // Aynı taramada tekrar eden kayıt
+        e.lastSeen = _generation;
+        e.missed = 0;
+        e.rssi = rssi;
+
+        bool moved = e.channel != ap.channel;
+        int drift = static_cast<int>(rssi) - e.reportedRssi;
+        if (drift < 0) drift = -drift;
+
+        if (moved || drift >= _hysteresis) {
+            e.channel = ap.channel;
+            e.reportedRssi = rssi;
+            WiFiApDelta delta = { WiFiApDeltaType::Changed, {0}, ap.channel, rssi, moved, nullptr };
+            memcpy(delta.bssid, ap.bssid, sizeof(delta.bssid));
+            emit(delta, callback, user, summary);
+        } else {
+            summary.unchanged++;
+        }
+    }
+
+    // 2) Taranan bantta olup görülmeyenler
+    for (uint16_t i = 0; i < Table::kSlots; i++) {
+        if (!_table.isUsed(i)) continue;
+        Entry& e = _table[i];
+        if (e.lastSeen == _generation) continue;
+        uint8_t band = WiFiScanTable::is5GHzChannel(e.channel) ? WIFI_SCAN_BAND_5G : WIFI_SCAN_BAND_2G4;
+        if (scannedBands & band) e.missed++;
+    }
+
+    _table.eraseIf(
+        [this](const Entry& e) { return e.missed >= _missLimit; },
+        [&](const Entry& e) {
+            WiFiApDelta delta = { WiFiApDeltaType::Removed, {0}, e.channel, e.rssi, false, nullptr };
+            memcpy(delta.bssid, e.bssid, sizeof(delta.bssid));
+            emit(delta, callback, user, summary);
+        });
+
+    // 3) Yeni AP'ler: tablo doluysa sadece bu taramada görülmeyen kayıt atılır
+    //    (kMaxEntries >= WIFI_SCAN_MAX_RESULTS olduğu için hep aday vardır)
+    for (const WiFiNetworkInfo& ap : table) {
+        if (_table.find(ap.bssid) >= 0) continue;
+        if (_table.full() && !evictLru(callback, user, summary)) break;
+
+        int8_t rssi = clampRssi(ap.rssi);
+        Entry& e = _table[_table.insert(ap.bssid)];
+        e.channel = ap.channel;
+        e.rssi = rssi;
+        e.reportedRssi = rssi;
+        e.missed = 0;
+        e.lastSeen = _generation;
+
+        WiFiApDelta delta = { WiFiApDeltaType::Added, {0}, ap.channel, rssi, false, ap.ssid };
+        memcpy(delta.bssid, ap.bssid, sizeof(delta.bssid));
+        emit(delta, callback, user, summary);
+    }
+
+    _stats.fullBytes += summary.fullBytes;
+    _stats.deltaBytes += summary.deltaBytes;
+    return summary;
+}
+
+void WiFiApHistory::emit(const WiFiApDelta& delta, WiFiApDeltaCallback callback, void* user,
+                         WiFiApDeltaSummary& summary) {
+    switch (delta.type) {
+        case WiFiApDeltaType::Added:    summary.added++;   _stats.added++;   break;
+        case WiFiApDeltaType::Removed:  summary.removed++; _stats.removed++; break;
+        case WiFiApDeltaType::Changed:  summary.changed++; _stats.changed++; break;
+    }
+    summary.deltaBytes += encodedSize(delta);
+    if (callback != nullptr) callback(delta, user);
+}
+
+bool WiFiApHistory::contains(const uint8_t bssid[6], int8_t* rssi) const {
+    int slot = _table.find(bssid);
+    if (slot < 0) return false;
+    if (rssi != nullptr) *rssi = _table[slot].rssi;
+    return true;
+}
+
+// ============================================================================
+// Hash table
+// ============================================================================
+
+uint32_t WiFiApHistory::EntryTraits::hash(const uint8_t* bssid) {
+    // FNV-1a; OUI aynı olan AP'lerde farkı son byte'lar taşır
+    uint32_t h = 2166136261UL;
+    for (uint8_t i = 0; i < 6; i++) {
+        h ^= bssid[i];
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+bool WiFiApHistory::evictLru(WiFiApDeltaCallback callback, void* user,
+                             WiFiApDeltaSummary& summary) {
+    int oldest = -1;
+    for (uint16_t i = 0; i < Table::kSlots; i++) {
+        if (!_table.isUsed(i) || _table[i].lastSeen == _generation) continue;
+        if (oldest < 0 || _table[i].lastSeen < _table[oldest].lastSeen) oldest = i;
+    }
+    if (oldest < 0) return false;
+
+    // Alıcının tablosu bizimkiyle aynı kalsın: atılan kayıt da Removed
+    const Entry& e = _table[oldest];
+    WiFiApDelta delta = { WiFiApDeltaType::Removed, {0}, e.channel, e.rssi, false, nullptr };
+    memcpy(delta.bssid, e.bssid, sizeof(delta.bssid));
+    _table.erase(static_cast<uint16_t>(oldest));
+    summary.evicted++;
+    _stats.evicted++;
+    emit(delta, callback, user, summary);
+    return true;
+}
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+size_t WiFiApHistory::encodedSize(const WiFiApDelta& delta) {
+    size_t size = 9;
+    if (delta.type == WiFiApDeltaType::Added && delta.ssid != nullptr) {
+        size += 1 + strnlen(delta.ssid, 32);
+    }
+    return size;
+}
+
+size_t WiFiApHistory::encode(const WiFiApDelta& delta, uint8_t* out, size_t max) {
+    size_t size = encodedSize(delta);
+    if (out == nullptr || max < size) return 0;
+
+    out[0] = static_cast<uint8_t>(delta.type);
+    memcpy(&out[1], delta.bssid, 6);
+    out[7] = delta.channel;
+    out[8] = static_cast<uint8_t>(delta.rssi);
+    if (size > 9) {
+        uint8_t len = static_cast<uint8_t>(size - 10);
+        out[9] = len;
+        memcpy(&out[10], delta.ssid, len);
+    }
+    return size;
+}
+
+const char* WiFiApHistory::deltaTypeToString(WiFiApDeltaType type) {
+    switch (type) {
+        case WiFiApDeltaType::Added:    return "Added";
+        case WiFiApDeltaType::Removed:  return "Removed";
+        case WiFiApDeltaType::Changed:  return "Changed";
+        default:                        return "Unknown";
+    }
+}
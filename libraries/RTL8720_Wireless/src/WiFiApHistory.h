@@ -0,0 +1,177 @@
+/**
+ * @file WiFiApHistory.h
+ * @brief BSSID-keyed AP history with per-scan delta reporting
+ *
+ * Her taramayı bir öncekiyle karşılaştırıp sadece farkı üretir:
+ * - Added   : ilk kez görülen BSSID (SSID dahil)
+ * - Removed : art arda missLimit taramada görülmeyen veya tablo dolduğu
+ *             için atılan BSSID
+ * - Changed : RSSI son raporlanan değerden >= hysteresis dB saptı veya
+ *             AP kanal değiştirdi
+ *
+ * Tablo sabit kapasiteli open-addressing hash'tir (OpenHashTable).
+ * Kapasitenin %75'i dolunca bu taramada görülmeyenler arasından en uzun
+ * süredir görülmeyen kayıt (LRU) atılır ve Removed olarak raporlanır; bu
+ * kayıt tekrar görülürse yeniden Added olarak raporlanır. Deltalar sırasıyla
+ * Changed, Removed, Added olarak üretilir. Heap kullanılmaz.
+ *
+ * Kullanım:
+ *   WiFiApHistory history;
+ *   table.scan();
+ *   history.update(table, onDelta);
+ */
+
+#ifndef WIFI_AP_HISTORY_H
+#define WIFI_AP_HISTORY_H
+
+#include <Arduino.h>
+#include <OpenHashTable.h>
+#include "WiFiScanTable.h"
+
+// Hash tablosu slot sayısı (2'nin kuvveti); en fazla %75'i kullanılır ve
+// bu, tek taramanın tamamını (WIFI_SCAN_MAX_RESULTS) almalıdır
+#ifndef WIFI_AP_HISTORY_SIZE
+    #define WIFI_AP_HISTORY_SIZE        128
+#endif
+
+// Default RSSI hysteresis (dB) ve kayıp sayılma eşiği (tarama)
+#ifndef WIFI_AP_HISTORY_HYSTERESIS
+    #define WIFI_AP_HISTORY_HYSTERESIS  6
+#endif
+#ifndef WIFI_AP_HISTORY_MISS_LIMIT
+    #define WIFI_AP_HISTORY_MISS_LIMIT  2
+#endif
+
+enum class WiFiApDeltaType : uint8_t {
+    Added = 1,
+    Removed = 2,
+    Changed = 3
+};
+
+/**
+ * @brief Tek AP değişimi
+ */
+struct WiFiApDelta {
+    WiFiApDeltaType type;
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;                // Removed: son görülen değer
+    bool moved;                 // Changed: kanal değişti
+    const char* ssid;           // Sadece Added (scan tablosuna işaret eder), diğerleri nullptr
+};
+
+typedef void (*WiFiApDeltaCallback)(const WiFiApDelta& delta, void* user);
+
+/**
+ * @brief Tek update() sonucu
+ */
+struct WiFiApDeltaSummary {
+    uint8_t added;
+    uint8_t removed;
+    uint8_t changed;
+    uint8_t unchanged;
+    uint8_t evicted;            // removed'a dahil
+    uint16_t fullBytes;         // Tüm tablo encode() ile gönderilseydi
+    uint16_t deltaBytes;        // Sadece delta
+};
+
+/**
+ * @brief update() sayaçları (begin'den beri)
+ */
+struct WiFiApHistoryStats {
+    uint32_t scans;
+    uint32_t added;
+    uint32_t removed;
+    uint32_t changed;
+    uint32_t evicted;
+    uint32_t fullBytes;
+    uint32_t deltaBytes;
+};
+
+class WiFiApHistory {
+public:
+    /**
+     * @param hysteresisDb Changed için minimum RSSI farkı
+     * @param missLimit Removed için art arda kaçırılan tarama sayısı
+     */
+    explicit WiFiApHistory(uint8_t hysteresisDb = WIFI_AP_HISTORY_HYSTERESIS,
+                           uint8_t missLimit = WIFI_AP_HISTORY_MISS_LIMIT);
+
+    /**
+     * @brief Taramayı geçmişle karşılaştır, deltaları callback'e ver
+     * @param scannedBands Taranan bantlar; dışındaki AP'ler kaçırılmış sayılmaz
+     */
+    WiFiApDeltaSummary update(const WiFiScanTable& table, WiFiApDeltaCallback callback,
+                              void* user = nullptr, uint8_t scannedBands = WIFI_SCAN_BAND_ANY);
+
+    /**
+     * @brief Geçmişi sil (sonraki update her AP'yi Added raporlar)
+     */
+    void clear();
+
+    uint8_t size() const { return static_cast<uint8_t>(_table.size()); }
+    static constexpr uint8_t capacity() { return kMaxEntries; }
+
+    /**
+     * @brief BSSID geçmişte var mı?
+     * @param rssi Son görülen RSSI (output, nullptr olabilir)
+     */
+    bool contains(const uint8_t bssid[6], int8_t* rssi = nullptr) const;
+
+    const WiFiApHistoryStats& getStats() const { return _stats; }
+
+    void setHysteresis(uint8_t db) { _hysteresis = db; }
+    void setMissLimit(uint8_t scans) { _missLimit = scans ? scans : 1; }
+
+    /**
+     * @brief Deltayı kompakt ikili formata yaz (uplink için)
+     *
+     * [type:1][bssid:6][channel:1][rssi:1] + Added ise [ssidLen:1][ssid]
+     * @return Yazılan byte, out yetmezse 0
+     */
+    static size_t encode(const WiFiApDelta& delta, uint8_t* out, size_t max);
+    static size_t encodedSize(const WiFiApDelta& delta);
+
+    static const char* deltaTypeToString(WiFiApDeltaType type);
+
+private:
+    static constexpr uint8_t kMaxEntries = WIFI_AP_HISTORY_SIZE * 3 / 4;
+
+    static_assert((WIFI_AP_HISTORY_SIZE & (WIFI_AP_HISTORY_SIZE - 1)) == 0 &&
+                  WIFI_AP_HISTORY_SIZE <= 128,
+                  "WIFI_AP_HISTORY_SIZE must be a power of two <= 128");
+    static_assert(kMaxEntries >= WIFI_SCAN_MAX_RESULTS,
+                  "WIFI_AP_HISTORY_SIZE * 3 / 4 must hold a full scan (WIFI_SCAN_MAX_RESULTS)");
+
+    struct Entry {
+        uint8_t bssid[6];
+        uint8_t channel;
+        int8_t rssi;            // Son görülen
+        int8_t reportedRssi;    // Son raporlanan (hysteresis referansı)
+        uint8_t missed;
+        uint32_t lastSeen;      // Tarama numarası (LRU)
+    };
+
+    struct EntryTraits {
+        static uint32_t hash(const uint8_t* bssid);
+        static bool matches(const Entry& entry, const uint8_t* bssid) {
+            return memcmp(entry.bssid, bssid, 6) == 0;
+        }
+        static const uint8_t* keyOf(const Entry& entry) { return entry.bssid; }
+        static void setKey(Entry& entry, const uint8_t* bssid) { memcpy(entry.bssid, bssid, 6); }
+    };
+
+    typedef OpenHashTable<const uint8_t*, Entry, WIFI_AP_HISTORY_SIZE, EntryTraits> Table;
+
+    bool evictLru(WiFiApDeltaCallback callback, void* user, WiFiApDeltaSummary& summary);
+    void emit(const WiFiApDelta& delta, WiFiApDeltaCallback callback, void* user,
+              WiFiApDeltaSummary& summary);
+
+    Table _table;
+    uint8_t _hysteresis;
+    uint8_t _missLimit;
+    uint32_t _generation;
+    WiFiApHistoryStats _stats;
+};
+
+#endif // WIFI_AP_HISTORY_H
@@ -0,0 +1,120 @@
+/**
+ * @file WiFiCache.cpp
+ * @brief Last-good WiFi association cache implementation
+ */
+
+#include "WiFiCache.h"
+#include <stddef.h>
+
+extern "C" {
+#include "flash_api.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "device_lock.h"
+}
+#define WIFI_CACHE_FLASH_LOCK()     device_mutex_lock(RT_DEV_LOCK_FLASH)
+#define WIFI_CACHE_FLASH_UNLOCK()   device_mutex_unlock(RT_DEV_LOCK_FLASH)
+#else
+#define WIFI_CACHE_FLASH_LOCK()     do {} while (0)
+#define WIFI_CACHE_FLASH_UNLOCK()   do {} while (0)
+#endif
+
+WiFiCache::WiFiCache()
+    : _valid(false)
+    , _loaded(false)
+    , _writeCount(0)
+{
+    memset(&_record, 0, sizeof(_record));
+}
+
+bool WiFiCache::load() {
+    if (_loaded) return _valid;
+    _loaded = true;
+
+    flash_t flash;
+    WIFI_CACHE_FLASH_LOCK();
+    flash_stream_read(&flash, WIRELESS_CACHE_FLASH_ADDR, sizeof(_record),
+                      reinterpret_cast<uint8_t*>(&_record));
+    WIFI_CACHE_FLASH_UNLOCK();
+
+    _valid = _record.magic == WIFI_CACHE_MAGIC &&
+             _record.version == WIFI_CACHE_VERSION &&
+             _record.length == sizeof(_record) &&
+             _record.crc == checksum(_record);
+    if (!_valid) {
+        memset(&_record, 0, sizeof(_record));
+    }
+    return _valid;
+}
+
+bool WiFiCache::store(const WiFiCacheRecord& record) {
+    WiFiCacheRecord next = record;
+    next.magic = WIFI_CACHE_MAGIC;
+    next.version = WIFI_CACHE_VERSION;
+    next.length = sizeof(next);
+    next.crc = checksum(next);
+
+    // Aynı kayıt için flash'ı aşındırma
+    if (_valid && memcmp(&next, &_record, sizeof(next)) == 0) {
+        return true;
+    }
+
+    flash_t flash;
+    WIFI_CACHE_FLASH_LOCK();
+    flash_erase_sector(&flash, WIRELESS_CACHE_FLASH_ADDR);
+    int ok = flash_stream_write(&flash, WIRELESS_CACHE_FLASH_ADDR, sizeof(next),
+                                reinterpret_cast<uint8_t*>(&next));
+    WIFI_CACHE_FLASH_UNLOCK();
+
+    _writeCount++;
+    _record = next;
+    _valid = true;
+    _loaded = true;
+    return ok != 0;
+}
+
+void WiFiCache::invalidate() {
+    if (!_valid) return;
+
+    // Sektör silmeden magic'i sıfırla
+    uint32_t zero = 0;
+    flash_t flash;
+    WIFI_CACHE_FLASH_LOCK();
+    flash_stream_write(&flash, WIRELESS_CACHE_FLASH_ADDR + offsetof(WiFiCacheRecord, magic),
+                       sizeof(zero), reinterpret_cast<uint8_t*>(&zero));
+    WIFI_CACHE_FLASH_UNLOCK();
+
+    _writeCount++;
+    _valid = false;
+    memset(&_record, 0, sizeof(_record));
+}
+
+bool WiFiCache::matches(const char* ssid, const char* password) const {
+    if (!_valid || ssid == nullptr) return false;
+    return strncmp(_record.ssid, ssid, sizeof(_record.ssid)) == 0 &&
+           _record.passwordHash == hash(password);
+}
+
+uint32_t WiFiCache::hash(const char* text) {
+    // FNV-1a 32-bit; nullptr (açık ağ) için offset basis
+    uint32_t h = 2166136261UL;
+    if (text == nullptr) return h;
+    while (*text) {
+        h ^= static_cast<uint8_t>(*text++);
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+uint32_t WiFiCache::checksum(const WiFiCacheRecord& record) {
+    // CRC alanı hariç tüm kayıt üzerinde FNV-1a
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&record);
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; i < offsetof(WiFiCacheRecord, crc); i++) {
+        h ^= p[i];
+        h *= 16777619UL;
+    }
+    return h;
+}
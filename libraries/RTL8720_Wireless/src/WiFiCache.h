@@ -0,0 +1,91 @@
+/**
+ * @file WiFiCache.h
+ * @brief Last-good WiFi association cache for fast reconnect
+ *
+ * Son başarılı bağlantının BSSID, kanal, güvenlik tipi ve DHCP lease
+ * bilgisini flash'ta (ve RAM'de) tutar. Reconnect sırasında SSID için
+ * tüm kanalları taramak yerine doğrudan bu AP'ye bağlanılır.
+ *
+ * Şifre saklanmaz; sadece FNV-1a hash'i ile aynı ağ olduğu doğrulanır.
+ * Flash'a sadece kayıt değiştiğinde yazılır; invalidate() sektör silmeden
+ * magic alanını sıfırlar (NOR 1 -> 0 yazımı).
+ */
+
+#ifndef WIFI_CACHE_H
+#define WIFI_CACHE_H
+
+#include <Arduino.h>
+
+// Cache sektörü (4 KB). Partition tablosuna göre override edilebilir.
+#ifndef WIRELESS_CACHE_FLASH_ADDR
+    #define WIRELESS_CACHE_FLASH_ADDR   0x1FE000
+#endif
+
+#define WIFI_CACHE_MAGIC                0x57434331  // "WCC1"
+#define WIFI_CACHE_VERSION              1
+
+/**
+ * @brief Flash'taki kayıt (CRC ile korunur)
+ */
+struct WiFiCacheRecord {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;
+    char ssid[33];
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t security;          // rtw_security_t
+    uint32_t passwordHash;      // FNV-1a (şifre saklanmaz)
+    uint32_t ip;                // Son DHCP lease
+    uint32_t gateway;
+    uint32_t netmask;
+    uint32_t crc;
+};
+
+class WiFiCache {
+public:
+    WiFiCache();
+
+    /**
+     * @brief Kaydı flash'tan oku (ilk çağrıda; sonrası RAM kopyası)
+     * @return true: geçerli kayıt var
+     */
+    bool load();
+
+    /**
+     * @brief Kaydı RAM'e ve flash'a yaz
+     * @return false: flash yazımı başarısız
+     */
+    bool store(const WiFiCacheRecord& record);
+
+    /**
+     * @brief Kaydı geçersiz kıl (AP değişti / bağlantı başarısız)
+     */
+    void invalidate();
+
+    bool isValid() const { return _valid; }
+
+    /**
+     * @brief Kayıt bu ağ için mi?
+     */
+    bool matches(const char* ssid, const char* password) const;
+
+    const WiFiCacheRecord& get() const { return _record; }
+
+    /**
+     * @brief Flash'a yazma sayısı (aşınma takibi)
+     */
+    uint32_t getWriteCount() const { return _writeCount; }
+
+    static uint32_t hash(const char* text);
+
+private:
+    static uint32_t checksum(const WiFiCacheRecord& record);
+
+    WiFiCacheRecord _record;
+    bool _valid;
+    bool _loaded;
+    uint32_t _writeCount;
+};
+
+#endif // WIFI_CACHE_H
@@ -13,17 +13,8 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <BoardConfig.h>
-
-/**
- * @brief WiFi ağ bilgisi yapısı
- */
-struct WiFiNetworkInfo {
-    String ssid;
-    int32_t rssi;
-    uint8_t encryptionType;
-    uint8_t channel;
-    bool is5GHz;
-};
+#include "WiFiScanTable.h"
+#include "WirelessManager.h"
 
 /**
  * @brief WiFi Module sınıfı
@@ -80,36 +71,31 @@ public:
     }
 
     /**
-     * @brief Ağa bağlan
+     * @brief Ağa bağlanmayı başlat (bloklamaz)
+     *
+     * WirelessManager'ın bağlantı state machine'ini kullanır; WiFi
+     * Wireless.begin(true, ...) ile açılmış olmalıdır. İlerleme poll() ile
+     * izlenir, timeout'ta durum Failed olur.
+     * @return Deneme başladı
      */
     bool connect(const char* ssid, const char* password = nullptr,
                  unsigned long timeout = 30000) {
-        // RTL8720DN requires char* not const char*
-        char ssidBuf[33];
-        strncpy(ssidBuf, ssid, sizeof(ssidBuf) - 1);
-        ssidBuf[sizeof(ssidBuf) - 1] = '\0';
+        return Wireless.connectWiFiAsync(ssid, password, timeout);
+    }
 
-        if (password != nullptr) {
-            WiFi.begin(ssidBuf, password);
-        } else {
-            WiFi.begin(ssidBuf);
-        }
+    /**
+     * @brief Bağlantıyı ilerlet (loop()'tan çağrılır)
+     * @return Güncel durum
+     */
+    WiFiConnectState poll() { return Wireless.poll(); }
 
-        unsigned long startTime = millis();
-        while (WiFi.status() != WL_CONNECTED) {
-            if (millis() - startTime > timeout) {
-                return false;
-            }
-            delay(100);
-        }
-        return true;
-    }
+    WiFiConnectState getConnectState() const { return Wireless.getWiFiConnectState(); }
 
     /**
-     * @brief Bağlantıyı kes
+     * @brief Bağlantıyı kes (süren connect() denemesi de bırakılır)
      */
     void disconnect() {
-        WiFi.disconnect();
+        Wireless.disconnectWiFi();
     }
 
     /**
@@ -161,31 +147,36 @@ public:
     // ========================================================================
 
     /**
-     * @brief Ağ taraması yap
-     * @return Bulunan ağ sayısı
+     * @brief Ağ taraması yap (sonuçlar dahili WiFiScanTable'da)
+     * @param bands WIFI_SCAN_BAND_* maskesi; tek bant taraması daha kısa sürer
+     * @return Bulunan ağ sayısı, hata ise -1
      */
-    int scan() {
-        return WiFi.scanNetworks();
+    int scan(uint8_t bands = WIFI_SCAN_BAND_ANY) {
+        return _results.scan(bands);
     }
 
+    /**
+     * @brief Ağ taraması yap, sonuçları verilen tabloya doldur (heap kullanmaz)
+     * @return Tablodaki kayıt sayısı, hata ise -1
+     */
+    int scan(WiFiScanTable& table, uint8_t bands = WIFI_SCAN_BAND_ANY) {
+        return table.scan(bands);
+    }
+
+    /**
+     * @brief Son scan() sonuçları
+     */
+    const WiFiScanTable& getScanResults() const { return _results; }
+
     /**
      * @brief Tarama sonucu al
      * @param index Ağ indexi
      * @param info Bilgi yapısı (output)
      * @return true başarılı
      */
-    bool getNetworkInfo(int index, WiFiNetworkInfo& info) {
-        if (index < 0) return false;
-
-        info.ssid = String(WiFi.SSID(index));
-        info.rssi = WiFi.RSSI(index);
-        info.encryptionType = WiFi.encryptionType(index);
-
-        // RTL8720DN SDK doesn't expose channel directly
-        // Channel bilgisi encryptionTypeEx'ten alınabilir ama basit tutuyoruz
-        info.channel = 0;  // Not available in this SDK
-        info.is5GHz = false; // Estimate from RSSI if needed
-
+    bool getNetworkInfo(int index, WiFiNetworkInfo& info) const {
+        if (index < 0 || index >= _results.size()) return false;
+        info = _results[static_cast<uint8_t>(index)];
         return true;
     }
 
@@ -212,10 +203,15 @@ public:
 
     /**
      * @brief WiFi güç tasarrufunu devre dışı bırak
+     *
+     * LPS/DTIM, CPU clock ve BLE'yi birlikte ayarlamak için PowerManager.
      */
     void disablePowerSave() {
         WiFi.disablePowerSave();
     }
+
+private:
+    WiFiScanTable _results;
 };
 
 #endif // WIFI_MODULE_H
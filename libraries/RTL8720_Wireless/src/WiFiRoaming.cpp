@@ -0,0 +1,193 @@
+/**
+ * @file WiFiRoaming.cpp
+ * @brief RSSI-driven roaming decision implementation
+ */
+
+#include "WiFiRoaming.h"
+
+WiFiRoaming::WiFiRoaming()
+    : _policy(defaultPolicy())
+    , _smoothedQ4(0)
+    , _hasSample(false)
+    , _scannedOnce(false)
+    , _lastScanMs(0)
+    , _candidate{{0}, 0, 0, false}
+    , _targeted(false)
+    , _fullScanNext(false)
+    , _neighborCount(0)
+    , _handoffActive(false)
+    , _handoffStartMs(0)
+{
+    _ssid[0] = '\0';
+    memset(_currentBssid, 0, sizeof(_currentBssid));
+    resetStats();
+}
+
+WiFiRoamingPolicy WiFiRoaming::defaultPolicy() {
+    WiFiRoamingPolicy policy;
+    policy.triggerRssi = WIFI_ROAM_TRIGGER_RSSI;
+    policy.hysteresisDb = WIFI_ROAM_HYSTERESIS_DB;
+    policy.smoothingPercent = WIFI_ROAM_SMOOTHING;
+    policy.sampleMs = WIFI_ROAM_SAMPLE_MS;
+    policy.scanIntervalMs = WIFI_ROAM_SCAN_INTERVAL_MS;
+    policy.dwellMs = WIFI_SCANNER_FAST_DWELL_MS;
+    policy.channelGapMs = WIFI_ROAM_CHANNEL_GAP_MS;
+    return policy;
+}
+
+void WiFiRoaming::setPolicy(const WiFiRoamingPolicy& policy) {
+    _policy = policy;
+    if (_policy.smoothingPercent == 0) _policy.smoothingPercent = 1;
+    if (_policy.smoothingPercent > 100) _policy.smoothingPercent = 100;
+}
+
+void WiFiRoaming::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+    _stats.lastDecision = WiFiRoamDecision::None;
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+bool WiFiRoaming::sample(int32_t rssi, unsigned long now) {
+    if (rssi >= 0) return false;    // Sürücü değer vermedi (associated değil)
+    _stats.samples++;
+
+    int32_t q4 = rssi * 16;
+    if (!_hasSample) {
+        _smoothedQ4 = q4;
+        _hasSample = true;
+    } else {
+        _smoothedQ4 += (q4 - _smoothedQ4) * _policy.smoothingPercent / 100;
+    }
+
+    if (getSmoothedRssi() >= _policy.triggerRssi) return false;
+    return !_scannedOnce || now - _lastScanMs >= _policy.scanIntervalMs;
+}
+
+int WiFiRoaming::getSmoothedRssi() const {
+    if (!_hasSample) return 0;
+    // En yakın dB'ye yuvarla (negatif değerler)
+    return (_smoothedQ4 - 8) / 16;
+}
+
+// ============================================================================
+// Scan
+// ============================================================================
+
+void WiFiRoaming::beginScan(const char* ssid, const uint8_t currentBssid[6], unsigned long now,
+                            WiFiScanOptions& options) {
+    strncpy(_ssid, ssid, sizeof(_ssid) - 1);
+    _ssid[sizeof(_ssid) - 1] = '\0';
+    memcpy(_currentBssid, currentBssid, sizeof(_currentBssid));
+    _candidate.valid = false;
+
+    options = WiFiScanner::defaultOptions();
+    options.dwellMs = _policy.dwellMs;
+    options.channelGapMs = _policy.channelGapMs;
+
+    _targeted = _neighborCount > 0 && !_fullScanNext;
+    if (_targeted) {
+        // Scanner kanal listesini start()'ta kopyalar
+        options.channels = _neighborChannels;
+        options.channelCount = _neighborCount;
+        _stats.targetedScans++;
+    } else {
+        _neighborCount = 0;         // Full sweep listeyi yeniden kurar
+    }
+
+    _scannedOnce = true;
+    _lastScanMs = now;
+    _stats.scans++;
+}
+
+bool WiFiRoaming::scanCallback(const WiFiNetworkInfo& info, void* user) {
+    static_cast<WiFiRoaming*>(user)->consider(info);
+    return true;
+}
+
+void WiFiRoaming::consider(const WiFiNetworkInfo& info) {
+    if (strcmp(info.ssid, _ssid) != 0) return;
+    if (memcmp(info.bssid, _currentBssid, sizeof(_currentBssid)) == 0) return;
+
+    rememberChannel(info.channel);
+    if (_candidate.valid && info.rssi <= _candidate.rssi) return;
+
+    memcpy(_candidate.bssid, info.bssid, sizeof(_candidate.bssid));
+    _candidate.channel = info.channel;
+    _candidate.rssi = static_cast<int8_t>(info.rssi < -128 ? -128 : info.rssi);
+    _candidate.valid = true;
+}
+
+void WiFiRoaming::rememberChannel(uint8_t channel) {
+    for (uint8_t i = 0; i < _neighborCount; i++) {
+        if (_neighborChannels[i] == channel) return;
+    }
+    if (_neighborCount < WIFI_ROAM_MAX_NEIGHBOR_CHANNELS) {
+        _neighborChannels[_neighborCount++] = channel;
+    }
+}
+
+WiFiRoamDecision WiFiRoaming::decide(bool scanOk) {
+    WiFiRoamDecision decision;
+
+    if (!scanOk) {
+        _stats.failed++;
+        decision = WiFiRoamDecision::ScanFailed;
+    } else if (!_candidate.valid) {
+        _stats.noCandidate++;
+        decision = WiFiRoamDecision::NoCandidate;
+    } else {
+        int gain = _candidate.rssi - getSmoothedRssi();
+        _stats.lastGainDb = static_cast<int8_t>(gain);
+        if (gain >= _policy.hysteresisDb) {
+            decision = WiFiRoamDecision::Roam;
+        } else {
+            _stats.stays++;
+            decision = WiFiRoamDecision::Stay;
+        }
+    }
+
+    // Hedefli tarama boş döndüyse komşular değişmiş olabilir: sonraki full
+    _fullScanNext = _targeted && decision == WiFiRoamDecision::NoCandidate;
+    _stats.lastDecision = decision;
+    return decision;
+}
+
+// ============================================================================
+// Handoff
+// ============================================================================
+
+void WiFiRoaming::handoffStarted(unsigned long now) {
+    _handoffActive = true;
+    _handoffStartMs = now;
+}
+
+void WiFiRoaming::handoffFinished(unsigned long now, bool success) {
+    if (!_handoffActive) return;
+    _handoffActive = false;
+    _hasSample = false;
+
+    if (!success) {
+        _stats.failed++;
+        return;
+    }
+
+    uint32_t elapsed = now - _handoffStartMs;
+    _stats.roams++;
+    _stats.lastHandoffMs = elapsed;
+    _stats.totalHandoffMs += elapsed;
+    if (elapsed > _stats.maxHandoffMs) _stats.maxHandoffMs = elapsed;
+}
+
+const char* WiFiRoaming::decisionToString(WiFiRoamDecision decision) {
+    switch (decision) {
+        case WiFiRoamDecision::None:        return "None";
+        case WiFiRoamDecision::Roam:        return "Roam";
+        case WiFiRoamDecision::Stay:        return "Stay";
+        case WiFiRoamDecision::NoCandidate: return "No candidate";
+        case WiFiRoamDecision::ScanFailed:  return "Scan failed";
+        default:                            return "Unknown";
+    }
+}
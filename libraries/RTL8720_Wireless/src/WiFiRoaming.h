@@ -0,0 +1,190 @@
+/**
+ * @file WiFiRoaming.h
+ * @brief RSSI-driven roaming decisions between APs of the same SSID
+ *
+ * WirelessManager Connected iken bağlı AP'nin RSSI'ını periyodik örnekler
+ * ve EWMA ile yumuşatır. Yumuşatılmış değer triggerRssi altına inince
+ * arka planda (kanal kanal, fast survey, kanallar arası trafik boşluğu)
+ * aynı SSID'yi tarar:
+ * - Daha önce komşu AP görülen kanallar biliniyorsa sadece onlar taranır
+ *   (hedefli); sonuç çıkmazsa bir sonraki tarama tüm kanalları kapsar
+ * - En güçlü farklı BSSID, mevcut RSSI'dan en az hysteresisDb güçlüyse
+ *   o AP'ye geçilir (wifi_connect_bssid, bilinen kanal)
+ *
+ * Bu sınıf sadece karar ve sayaçları tutar; tarama ve handoff
+ * WirelessManager tarafından yapılır.
+ *
+ * Kullanım:
+ *   Wireless.enableRoaming();
+ *   const WiFiRoamingStats& s = Wireless.getRoaming().getStats();
+ */
+
+#ifndef WIFI_ROAMING_H
+#define WIFI_ROAMING_H
+
+#include <Arduino.h>
+#include "WiFiScanner.h"
+
+// Hatırlanan komşu AP kanalı sayısı (hedefli tarama)
+#ifndef WIFI_ROAM_MAX_NEIGHBOR_CHANNELS
+    #define WIFI_ROAM_MAX_NEIGHBOR_CHANNELS     4
+#endif
+
+// Default roaming politikası
+#ifndef WIFI_ROAM_TRIGGER_RSSI
+    #define WIFI_ROAM_TRIGGER_RSSI      -70
+#endif
+#ifndef WIFI_ROAM_HYSTERESIS_DB
+    #define WIFI_ROAM_HYSTERESIS_DB     8
+#endif
+#ifndef WIFI_ROAM_SMOOTHING
+    #define WIFI_ROAM_SMOOTHING         25      // Yeni örneğin ağırlığı (%)
+#endif
+#ifndef WIFI_ROAM_SAMPLE_MS
+    #define WIFI_ROAM_SAMPLE_MS         1000
+#endif
+#ifndef WIFI_ROAM_SCAN_INTERVAL_MS
+    #define WIFI_ROAM_SCAN_INTERVAL_MS  30000
+#endif
+#ifndef WIFI_ROAM_CHANNEL_GAP_MS
+    #define WIFI_ROAM_CHANNEL_GAP_MS    50
+#endif
+
+/**
+ * @brief Roaming politikası
+ */
+struct WiFiRoamingPolicy {
+    int8_t triggerRssi;         // Yumuşatılmış RSSI bunun altındaysa tara (dBm)
+    uint8_t hysteresisDb;       // Aday mevcut AP'den en az bu kadar güçlü olmalı
+    uint8_t smoothingPercent;   // EWMA: yeni örneğin ağırlığı, 1-100
+    uint16_t sampleMs;          // RSSI örnekleme aralığı
+    uint32_t scanIntervalMs;    // İki roam taraması arası minimum süre
+    uint16_t dwellMs;           // Kanal başına dwell (<= WIFI_SCANNER_FAST_DWELL_MS: fast survey)
+    uint16_t channelGapMs;      // Kanallar arası trafik penceresi
+};
+
+/**
+ * @brief Roam taraması sonrası karar
+ */
+enum class WiFiRoamDecision : uint8_t {
+    None,               // Henüz tarama yapılmadı
+    Roam,               // Aday hysteresis'i geçti, handoff başlatıldı
+    Stay,               // Aday var ama hysteresis'i geçemedi
+    NoCandidate,        // Aynı SSID'li başka BSSID görülmedi
+    ScanFailed
+};
+
+/**
+ * @brief Geçilecek AP
+ */
+struct WiFiRoamCandidate {
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;
+    bool valid;
+};
+
+/**
+ * @brief Roaming sayaçları (enableRoaming()'den beri)
+ */
+struct WiFiRoamingStats {
+    uint32_t samples;           // RSSI örneği
+    uint32_t scans;             // Başlatılan roam taraması
+    uint32_t targetedScans;     // Sadece komşu kanallar
+    uint32_t roams;             // Başarılı handoff
+    uint32_t stays;             // Aday hysteresis'i geçemedi
+    uint32_t noCandidate;
+    uint32_t failed;            // Handoff hedef AP'ye bağlanamadı / tarama başarısız
+    uint32_t lastHandoffMs;     // Roam kararı -> yeni AP'de IP
+    uint32_t maxHandoffMs;
+    uint32_t totalHandoffMs;
+    int8_t lastGainDb;          // Son kararda aday - mevcut RSSI
+    WiFiRoamDecision lastDecision;
+};
+
+class WiFiRoaming {
+public:
+    WiFiRoaming();
+
+    void setPolicy(const WiFiRoamingPolicy& policy);
+    const WiFiRoamingPolicy& getPolicy() const { return _policy; }
+
+    /**
+     * @brief Yumuşatmayı sıfırla (yeni AP'ye bağlanınca)
+     */
+    void resetSmoothing() { _hasSample = false; }
+
+    /**
+     * @brief RSSI örneği ekle
+     * @return true: roam taraması başlatılmalı (eşik altında, cooldown bitti)
+     */
+    bool sample(int32_t rssi, unsigned long now);
+
+    /**
+     * @brief Taramayı hazırla: kanal listesi ve dwell options'a yazılır
+     * @param ssid Bağlı SSID
+     * @param currentBssid Bağlı AP (aday sayılmaz)
+     */
+    void beginScan(const char* ssid, const uint8_t currentBssid[6], unsigned long now,
+                   WiFiScanOptions& options);
+
+    /**
+     * @brief Tarama kaydını değerlendir (WiFiScanCallback, user = WiFiRoaming*)
+     */
+    static bool scanCallback(const WiFiNetworkInfo& info, void* user);
+
+    /**
+     * @brief Tarama bitti: adayı hysteresis ile karşılaştır
+     * @param scanOk false: tarama başarısız oldu
+     */
+    WiFiRoamDecision decide(bool scanOk);
+
+    /**
+     * @brief Handoff başladı / bitti (WirelessManager çağırır)
+     */
+    void handoffStarted(unsigned long now);
+    void handoffFinished(unsigned long now, bool success);
+    bool isHandoffActive() const { return _handoffActive; }
+
+    const WiFiRoamCandidate& getCandidate() const { return _candidate; }
+
+    /**
+     * @brief Yumuşatılmış RSSI (dBm, örnek yoksa 0)
+     */
+    int getSmoothedRssi() const;
+
+    uint8_t getNeighborChannelCount() const { return _neighborCount; }
+    const WiFiRoamingStats& getStats() const { return _stats; }
+    void resetStats();
+
+    static WiFiRoamingPolicy defaultPolicy();
+    static const char* decisionToString(WiFiRoamDecision decision);
+
+private:
+    void consider(const WiFiNetworkInfo& info);
+    void rememberChannel(uint8_t channel);
+
+    WiFiRoamingPolicy _policy;
+    WiFiRoamingStats _stats;
+
+    // EWMA (1/16 dB çözünürlük)
+    int32_t _smoothedQ4;
+    bool _hasSample;
+    bool _scannedOnce;
+    unsigned long _lastScanMs;
+
+    // Devam eden tarama
+    char _ssid[33];
+    uint8_t _currentBssid[6];
+    WiFiRoamCandidate _candidate;
+    bool _targeted;
+    bool _fullScanNext;
+
+    uint8_t _neighborChannels[WIFI_ROAM_MAX_NEIGHBOR_CHANNELS];
+    uint8_t _neighborCount;
+
+    bool _handoffActive;
+    unsigned long _handoffStartMs;
+};
+
+#endif // WIFI_ROAMING_H
@@ -0,0 +1,289 @@
+/**
+ * @file WiFiScanTable.cpp
+ * @brief Allocation-free WiFi scan result table implementation
+ */
+
+#include "WiFiScanTable.h"
+#include <WiFi.h>
+
+extern "C" {
+#include "wifi_conf.h"
+}
+
+namespace {
+
+const uint8_t kChannels2G4[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+const uint8_t kChannels5G[] = {
+    36, 40, 44, 48, 52, 56, 60, 64,
+    100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 140,
+    149, 153, 157, 161, 165
+};
+
+} // namespace
+
+/**
+ * @brief SDK scan callback'i (cihazda WiFi task context'i)
+ *
+ * user_data tablo değil tarama numarasıdır: timeout ile bırakılmış taramanın
+ * geç gelen kayıtları yeni taramaya veya yok edilmiş tabloya yazılmaz.
+ */
+struct WiFiScanSink {
+    static WiFiScanTable* active;       // Sonucu bekleyen tablo (nullptr: yok)
+    static uint32_t generation;         // active'in taraması
+
+    static rtw_result_t handler(rtw_scan_handler_result_t* result) {
+        WiFiNetworkInfo info;
+        if (result->scan_complete != RTW_TRUE) {
+            WiFiScanTable::fromScanRecord(&result->ap_details, info);
+        }
+
+        noInterrupts();
+        WiFiScanTable* table = active;
+        if (table != nullptr && reinterpret_cast<uintptr_t>(result->user_data) == generation) {
+            if (result->scan_complete == RTW_TRUE) {
+                table->_scanDone = true;
+                active = nullptr;
+            } else {
+                table->add(info);
+            }
+        }
+        interrupts();
+        return RTW_SUCCESS;
+    }
+
+    static void detach(WiFiScanTable* table) {
+        noInterrupts();
+        if (active == table) active = nullptr;
+        interrupts();
+    }
+};
+
+WiFiScanTable* WiFiScanSink::active = nullptr;
+uint32_t WiFiScanSink::generation = 0;
+
+WiFiScanTable::WiFiScanTable()
+    : _count(0)
+    , _dropped(0)
+    , _scanDone(true)
+{
+}
+
+WiFiScanTable::~WiFiScanTable() {
+    WiFiScanSink::detach(this);
+}
+
+int WiFiScanTable::scan(uint8_t bands) {
+    if ((bands & WIFI_SCAN_BAND_ANY) == WIFI_SCAN_BAND_ANY) {
+        return runScan(nullptr, 0);
+    }
+    uint8_t channels[WIFI_SCAN_MAX_CHANNELS];
+    uint8_t count = bandChannels(bands, channels, sizeof(channels));
+    if (count == 0) {
+        clear();
+        return -1;
+    }
+    return runScan(channels, count);
+}
+
+int WiFiScanTable::scan(const uint8_t* channels, uint8_t count) {
+    if (channels == nullptr || count == 0 || count > WIFI_SCAN_MAX_CHANNELS) {
+        clear();
+        return -1;
+    }
+    return runScan(channels, count);
+}
+
+int WiFiScanTable::runScan(const uint8_t* channels, uint8_t count) {
+    clear();
+
+    if (count > 0) {
+        // SDK const olmayan dizi bekliyor
+        uint8_t list[WIFI_SCAN_MAX_CHANNELS];
+        uint8_t config[WIFI_SCAN_MAX_CHANNELS];
+        memcpy(list, channels, count);
+        memset(config, PSCAN_ENABLE, count);
+        if (wifi_set_pscan_chan(list, config, count) != RTW_SUCCESS) return -1;
+    }
+
+    // Callback'ler bu tabloya yazar, sadece bu taramanın numarasıyla
+    noInterrupts();
+    uint32_t generation = ++WiFiScanSink::generation;
+    WiFiScanSink::active = this;
+    _scanDone = false;
+    interrupts();
+    if (wifi_scan_networks(WiFiScanSink::handler, reinterpret_cast<void*>(static_cast<uintptr_t>(generation))) !=
+        RTW_SUCCESS) {
+        WiFiScanSink::detach(this);
+        _scanDone = true;
+        return -1;
+    }
+
+    unsigned long start = millis();
+    while (!_scanDone) {
+        if (millis() - start > WIFI_SCAN_TIMEOUT_MS) {
+            // Tarama SDK'da sürebilir: kalan callback'ler artık yok sayılır
+            WiFiScanSink::detach(this);
+            _scanDone = true;
+            return -1;
+        }
+        delay(10);
+    }
+    return _count;
+}
+
+int WiFiScanTable::load(int count) {
+    _count = 0;
+    _dropped = 0;
+    if (count <= 0) return 0;
+
+    for (int i = 0; i < count; i++) {
+        if (_count >= WIFI_SCAN_MAX_RESULTS) {
+            _dropped = static_cast<uint8_t>(count - i);
+            break;
+        }
+        if (readDriverRecord(static_cast<uint8_t>(i), _records[_count])) {
+            _count++;
+        }
+    }
+    return _count;
+}
+
+bool WiFiScanTable::add(const WiFiNetworkInfo& info) {
+    if (_count >= WIFI_SCAN_MAX_RESULTS) {
+        if (_dropped < UINT8_MAX) _dropped++;
+        return false;
+    }
+    _records[_count++] = info;
+    return true;
+}
+
+void WiFiScanTable::clear() {
+    _count = 0;
+    _dropped = 0;
+}
+
+// ============================================================================
+// Sort / filter
+// ============================================================================
+
+void WiFiScanTable::sortByRssi() {
+    // Insertion sort: en fazla 50 kayıt, sürücü listesi genelde zaten yarı sıralı
+    for (uint8_t i = 1; i < _count; i++) {
+        if (_records[i].rssi <= _records[i - 1].rssi) continue;
+
+        WiFiNetworkInfo moving = _records[i];
+        uint8_t j = i;
+        while (j > 0 && _records[j - 1].rssi < moving.rssi) {
+            _records[j] = _records[j - 1];
+            j--;
+        }
+        _records[j] = moving;
+    }
+}
+
+bool WiFiScanTable::matches(const WiFiNetworkInfo& info, const WiFiScanFilter& filter) {
+    uint8_t band = info.is5GHz ? WIFI_SCAN_BAND_5G : WIFI_SCAN_BAND_2G4;
+    if ((filter.bands & band) == 0) return false;
+
+    if (filter.security != WIFI_SCAN_SECURITY_ANY) {
+        if (info.encryptionType >= 8) return false;
+        if ((filter.security & WIFI_SCAN_SECURITY(info.encryptionType)) == 0) return false;
+    }
+    return info.rssi >= filter.minRssi;
+}
+
+int WiFiScanTable::next(const WiFiScanFilter& filter, int after) const {
+    for (int i = after + 1; i < _count; i++) {
+        if (matches(_records[i], filter)) return i;
+    }
+    return -1;
+}
+
+uint8_t WiFiScanTable::count(const WiFiScanFilter& filter) const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (matches(_records[i], filter)) n++;
+    }
+    return n;
+}
+
+uint8_t WiFiScanTable::retain(const WiFiScanFilter& filter) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (!matches(_records[i], filter)) continue;
+        if (kept != i) _records[kept] = _records[i];
+        kept++;
+    }
+    _count = kept;
+    return kept;
+}
+
+int WiFiScanTable::find(const char* ssid) const {
+    if (ssid == nullptr) return -1;
+    for (uint8_t i = 0; i < _count; i++) {
+        if (strcmp(_records[i].ssid, ssid) == 0) return i;
+    }
+    return -1;
+}
+
+// ============================================================================
+// Channels / driver
+// ============================================================================
+
+uint8_t WiFiScanTable::bandChannels(uint8_t bands, uint8_t* out, uint8_t max) {
+    uint8_t n = 0;
+    if (bands & WIFI_SCAN_BAND_2G4) {
+        for (uint8_t ch : kChannels2G4) {
+            if (n < max) out[n++] = ch;
+        }
+    }
+    if (bands & WIFI_SCAN_BAND_5G) {
+        for (uint8_t ch : kChannels5G) {
+            if (n < max) out[n++] = ch;
+        }
+    }
+    return n;
+}
+
+uint8_t WiFiScanTable::securityToEncryptionType(uint32_t security) {
+    if (security == static_cast<uint32_t>(RTW_SECURITY_UNKNOWN)) return 0xFF;
+    if (security & ENTERPRISE_ENABLED) return 5;
+    if (security & WPA3_SECURITY) return 6;
+    if ((security & WPA_SECURITY) && (security & WPA2_SECURITY)) return 4;
+    if (security & WPA2_SECURITY) return 3;
+    if (security & WPA_SECURITY) return 2;
+    if (security & (WEP_ENABLED | SHARED_ENABLED)) return 1;
+    return 0;
+}
+
+void WiFiScanTable::fromScanRecord(const void* record, WiFiNetworkInfo& info) {
+    const rtw_scan_result_t& ap = *static_cast<const rtw_scan_result_t*>(record);
+
+    uint8_t len = ap.SSID.len < sizeof(info.ssid) - 1 ? ap.SSID.len : sizeof(info.ssid) - 1;
+    memcpy(info.ssid, ap.SSID.val, len);
+    info.ssid[len] = '\0';
+    memcpy(info.bssid, ap.BSSID.octet, sizeof(info.bssid));
+    info.rssi = ap.signal_strength;
+    info.encryptionType = securityToEncryptionType(static_cast<uint32_t>(ap.security));
+    info.channel = static_cast<uint8_t>(ap.channel);
+    info.is5GHz = is5GHzChannel(info.channel);
+}
+
+bool WiFiScanTable::readDriverRecord(uint8_t index, WiFiNetworkInfo& info) {
+    // WiFi.SSID(i) sürücünün statik tamponunu döndürür - kopya tek memcpy
+    const char* ssid = WiFi.SSID(index);
+    if (ssid == nullptr) return false;
+
+    size_t len = strnlen(ssid, sizeof(info.ssid) - 1);
+    memcpy(info.ssid, ssid, len);
+    info.ssid[len] = '\0';
+
+    info.rssi = WiFi.RSSI(index);
+    info.encryptionType = WiFi.encryptionType(index);
+
+    // WiFiClass kayıt başına BSSID / kanal vermiyor
+    memset(info.bssid, 0, sizeof(info.bssid));
+    info.channel = 0;
+    info.is5GHz = false;
+    return true;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file WiFiScanTable.h
+ * @brief Fixed-capacity, allocation-free WiFi scan result table
+ *
+ * Tarama sonuçları sabit boyutlu POD kayıtlarda tutulur; her taramada
+ * sürücü listesinden tek seferde doldurulur. String / heap kullanılmaz,
+ * böylece periyodik taramalar (40+ AP) heap'i parçalamaz.
+ *
+ * Kayıtlar SDK scan callback'inden (wifi_scan_networks / rtw_scan_result_t)
+ * alınır: BSSID, kanal ve bant gerçek değerlerdir. Tarama banda veya kanal
+ * listesine sınırlanabilir (wifi_set_pscan_chan); sadece 5 GHz taramak
+ * full sweep süresinin ~2/3'ü kadardır.
+ *
+ * Sıralama ve filtreleme tablo üzerinde yerinde yapılır:
+ *   WiFiScanTable table;
+ *   table.scan(WIFI_SCAN_BAND_5G);
+ *   table.sortByRssi();
+ *   WiFiScanFilter wpa2 = { WIFI_SCAN_BAND_ANY, WIFI_SCAN_SECURITY(3), -80 };
+ *   for (int i = table.next(wpa2); i >= 0; i = table.next(wpa2, i)) {
+ *       const WiFiNetworkInfo& ap = table[i];
+ *   }
+ */
+
+#ifndef WIFI_SCAN_TABLE_H
+#define WIFI_SCAN_TABLE_H
+
+#include <Arduino.h>
+
+// Tablo kapasitesi (SDK WL_NETWORKS_LIST_MAXNUM ile aynı)
+#ifndef WIFI_SCAN_MAX_RESULTS
+    #define WIFI_SCAN_MAX_RESULTS       50
+#endif
+
+// Tarama tamamlanma timeout'u (ms)
+#ifndef WIFI_SCAN_TIMEOUT_MS
+    #define WIFI_SCAN_TIMEOUT_MS        15000
+#endif
+
+// Kanal listesi kapasitesi (2.4 GHz 1-13 + 5 GHz 24 kanal)
+#define WIFI_SCAN_MAX_CHANNELS          37
+
+// WiFiScanFilter::bands
+#define WIFI_SCAN_BAND_2G4              0x01
+#define WIFI_SCAN_BAND_5G               0x02
+#define WIFI_SCAN_BAND_ANY              (WIFI_SCAN_BAND_2G4 | WIFI_SCAN_BAND_5G)
+
+// WiFiScanFilter::security (bit n = encryptionType n)
+#define WIFI_SCAN_SECURITY(type)        (1u << (type))
+#define WIFI_SCAN_SECURITY_ANY          0xFF
+
+/**
+ * @brief WiFi ağ bilgisi (POD, heap kullanmaz)
+ */
+struct WiFiNetworkInfo {
+    char ssid[33];
+    uint8_t bssid[6];
+    int32_t rssi;
+    uint8_t encryptionType;     // WiFiModule::encryptionTypeToString kodları
+    uint8_t channel;            // 0: bilinmiyor
+    bool is5GHz;
+};
+
+/**
+ * @brief Kopyasız filtre (tüm alanlar AND'lenir)
+ */
+struct WiFiScanFilter {
+    uint8_t bands;              // WIFI_SCAN_BAND_* maskesi
+    uint8_t security;           // WIFI_SCAN_SECURITY(type) maskesi
+    int32_t minRssi;            // Bu değerin altındakiler elenir (dBm)
+};
+
+/**
+ * @brief Sabit kapasiteli tarama sonuç tablosu
+ */
+class WiFiScanTable {
+public:
+    WiFiScanTable();
+    ~WiFiScanTable();
+
+    /**
+     * @brief Bloklayan tarama yap ve tabloyu doldur
+     * @param bands WIFI_SCAN_BAND_* maskesi (ANY: kanal kısıtlaması yok)
+     * @return Tablodaki kayıt sayısı, hata / timeout ise -1
+     */
+    int scan(uint8_t bands = WIFI_SCAN_BAND_ANY);
+
+    /**
+     * @brief Sadece verilen kanalları tara
+     * @param channels Kanal listesi (ör. {36, 40, 44})
+     * @param count Kanal sayısı (en fazla WIFI_SCAN_MAX_CHANNELS)
+     * @return Tablodaki kayıt sayısı, hata / timeout ise -1
+     */
+    int scan(const uint8_t* channels, uint8_t count);
+
+    /**
+     * @brief Son WiFi.scanNetworks() sonucunu tabloya al
+     *
+     * WiFiClass kayıt başına BSSID / kanal vermez; bu alanlar 0 kalır.
+     * @param count scanNetworks() dönüş değeri
+     * @return Tablodaki kayıt sayısı (kapasite aşılırsa getDropped() artar)
+     */
+    int load(int count);
+
+    /**
+     * @brief Kayıt ekle
+     * @return false: tablo dolu (getDropped() artar)
+     */
+    bool add(const WiFiNetworkInfo& info);
+
+    void clear();
+
+    uint8_t size() const { return _count; }
+    uint8_t capacity() const { return WIFI_SCAN_MAX_RESULTS; }
+    bool empty() const { return _count == 0; }
+
+    const WiFiNetworkInfo& operator[](uint8_t index) const { return _records[index]; }
+    const WiFiNetworkInfo* begin() const { return _records; }
+    const WiFiNetworkInfo* end() const { return _records + _count; }
+
+    /**
+     * @brief Kayıtları güçlüden zayıfa sırala (stable, yerinde)
+     */
+    void sortByRssi();
+
+    /**
+     * @brief Filtreye uyan bir sonraki kaydın indexi
+     * @param after Önceki index (-1: baştan)
+     * @return Index, yoksa -1
+     */
+    int next(const WiFiScanFilter& filter, int after = -1) const;
+
+    /**
+     * @brief Filtreye uyan kayıt sayısı
+     */
+    uint8_t count(const WiFiScanFilter& filter) const;
+
+    /**
+     * @brief Filtreye uymayanları sil (sıra korunur, yerinde)
+     * @return Kalan kayıt sayısı
+     */
+    uint8_t retain(const WiFiScanFilter& filter);
+
+    /**
+     * @brief SSID ile ilk (sortByRssi sonrası en güçlü) kaydı bul
+     * @return Index, yoksa -1
+     */
+    int find(const char* ssid) const;
+
+    /**
+     * @brief Son taramada kapasite yüzünden alınamayan kayıt sayısı
+     */
+    uint8_t getDropped() const { return _dropped; }
+
+    static bool matches(const WiFiNetworkInfo& info, const WiFiScanFilter& filter);
+
+    /**
+     * @brief Kanal 5 GHz bandında mı? (2.4 GHz: 1-14)
+     */
+    static bool is5GHzChannel(uint8_t channel) { return channel > 14; }
+
+    /**
+     * @brief Bant maskesindeki kanalları yaz (regülasyon tablosu: 1-13, 36-165)
+     * @return Yazılan kanal sayısı
+     */
+    static uint8_t bandChannels(uint8_t bands, uint8_t* out, uint8_t max);
+
+    /**
+     * @brief rtw_security_t -> encryptionType kodu
+     */
+    static uint8_t securityToEncryptionType(uint32_t security);
+
+    /**
+     * @brief SDK scan kaydını dönüştür
+     * @param record const rtw_scan_result_t* (SDK header'ı bu dosyaya taşınmasın diye void)
+     */
+    static void fromScanRecord(const void* record, WiFiNetworkInfo& info);
+
+    /**
+     * @brief Sürücü listesindeki tek kaydı oku
+     */
+    static bool readDriverRecord(uint8_t index, WiFiNetworkInfo& info);
+
+private:
+    friend struct WiFiScanSink;
+
+    int runScan(const uint8_t* channels, uint8_t count);
+
+    WiFiNetworkInfo _records[WIFI_SCAN_MAX_RESULTS];
+    uint8_t _count;
+    uint8_t _dropped;
+    volatile bool _scanDone;
+};
+
+#endif // WIFI_SCAN_TABLE_H
@@ -0,0 +1,212 @@
+/**
+ * @file WiFiScanner.cpp
+ * @brief Non-blocking, channel-by-channel WiFi scan implementation
+ */
+
+#include "WiFiScanner.h"
+
+extern "C" {
+#include "wifi_conf.h"
+}
+
+#define WIFI_SCANNER_QUEUE_MASK     (WIFI_SCANNER_QUEUE_SIZE - 1)
+
+static_assert((WIFI_SCANNER_QUEUE_SIZE & WIFI_SCANNER_QUEUE_MASK) == 0,
+              "WIFI_SCANNER_QUEUE_SIZE must be a power of two");
+
+/**
+ * @brief SDK scan callback'i (cihazda WiFi task context'i, user_data = scanner)
+ */
+struct WiFiScannerSink {
+    static rtw_result_t handler(rtw_scan_handler_result_t* result) {
+        WiFiScanner* scanner = static_cast<WiFiScanner*>(result->user_data);
+        if (result->scan_complete == RTW_TRUE) {
+            scanner->_channelDone = true;
+            return RTW_SUCCESS;
+        }
+
+        uint8_t head = scanner->_head;
+        uint8_t next = (head + 1) & WIFI_SCANNER_QUEUE_MASK;
+        if (next == scanner->_tail) {
+            scanner->_dropped++;
+            return RTW_SUCCESS;
+        }
+        WiFiScanTable::fromScanRecord(&result->ap_details, scanner->_queue[head]);
+        scanner->_head = next;
+        return RTW_SUCCESS;
+    }
+};
+
+WiFiScanner::WiFiScanner()
+    : _state(WiFiScanState::Idle)
+    , _callback(nullptr)
+    , _user(nullptr)
+    , _table(nullptr)
+    , _channelCount(0)
+    , _channelIndex(0)
+    , _dwellMs(0)
+    , _gapMs(0)
+    , _foundTarget(false)
+    , _channelActive(false)
+    , _channelDone(false)
+    , _channelStartMs(0)
+    , _nextChannelMs(0)
+    , _startMs(0)
+    , _endMs(0)
+    , _head(0)
+    , _tail(0)
+    , _dropped(0)
+    , _delivered(0)
+{
+    _stopSsid[0] = '\0';
+}
+
+WiFiScanOptions WiFiScanner::defaultOptions() {
+    return WiFiScanOptions{ WIFI_SCAN_BAND_ANY, nullptr, 0, 0, 0, nullptr };
+}
+
+bool WiFiScanner::start(const WiFiScanOptions& options, WiFiScanCallback callback, void* user) {
+    if (_state == WiFiScanState::Scanning || _channelActive) return false;
+
+    if (options.channels != nullptr) {
+        if (options.channelCount == 0 || options.channelCount > WIFI_SCAN_MAX_CHANNELS) return false;
+        memcpy(_channels, options.channels, options.channelCount);
+        _channelCount = options.channelCount;
+    } else {
+        _channelCount = WiFiScanTable::bandChannels(options.bands, _channels, sizeof(_channels));
+        if (_channelCount == 0) return false;
+    }
+
+    _stopSsid[0] = '\0';
+    if (options.stopOnSsid != nullptr) {
+        strncpy(_stopSsid, options.stopOnSsid, sizeof(_stopSsid) - 1);
+        _stopSsid[sizeof(_stopSsid) - 1] = '\0';
+    }
+
+    _callback = callback;
+    _user = user;
+    _dwellMs = options.dwellMs;
+    _gapMs = options.channelGapMs;
+    _channelIndex = 0;
+    _foundTarget = false;
+    _head = 0;
+    _tail = 0;
+    _dropped = 0;
+    _delivered = 0;
+    if (_table != nullptr) _table->clear();
+
+    _startMs = millis();
+    _nextChannelMs = _startMs;
+    _state = WiFiScanState::Scanning;
+
+    if (!startChannel()) {
+        finish(WiFiScanState::Failed);
+        return false;
+    }
+    return true;
+}
+
+WiFiScanState WiFiScanner::poll() {
+    // done bayrağı kayıtlardan sonra yazılır: önce oku, sonra kuyruğu boşalt
+    bool channelDone = _channelDone;
+
+    while (_tail != _head) {
+        uint8_t tail = _tail;
+        if (_state == WiFiScanState::Scanning && !deliver(_queue[tail])) {
+            finish(WiFiScanState::Stopped);
+        }
+        _tail = (tail + 1) & WIFI_SCANNER_QUEUE_MASK;
+    }
+
+    if (channelDone) {
+        _channelDone = false;
+        _channelActive = false;
+        if (_state == WiFiScanState::Scanning) {
+            _channelIndex++;
+            if (_channelIndex >= _channelCount) {
+                finish(WiFiScanState::Done);
+            } else {
+                _nextChannelMs = millis() + _gapMs;
+            }
+        }
+    }
+
+    // scan_complete hiç gelmezse isBusy() takılı kalmasın (tarama durdurulmuş
+    // olsa da): SDK kanalı bırakmış sayılır
+    unsigned long now = millis();
+    if (_channelActive && now - _channelStartMs > WIFI_SCAN_TIMEOUT_MS) {
+        _channelActive = false;
+        if (_state == WiFiScanState::Scanning) finish(WiFiScanState::Failed);
+    }
+
+    if (_state != WiFiScanState::Scanning) return _state;
+
+    if (!_channelActive && static_cast<long>(now - _nextChannelMs) >= 0) {
+        if (!startChannel()) {
+            finish(WiFiScanState::Failed);
+        }
+    }
+    return _state;
+}
+
+void WiFiScanner::stop() {
+    if (_state == WiFiScanState::Scanning) {
+        finish(WiFiScanState::Stopped);
+    }
+}
+
+uint32_t WiFiScanner::getElapsedMs() const {
+    if (_state == WiFiScanState::Idle) return 0;
+    unsigned long end = _state == WiFiScanState::Scanning ? millis() : _endMs;
+    return end - _startMs;
+}
+
+const char* WiFiScanner::stateToString(WiFiScanState state) {
+    switch (state) {
+        case WiFiScanState::Idle:       return "Idle";
+        case WiFiScanState::Scanning:   return "Scanning";
+        case WiFiScanState::Done:       return "Done";
+        case WiFiScanState::Stopped:    return "Stopped";
+        case WiFiScanState::Failed:     return "Failed";
+        default:                        return "Unknown";
+    }
+}
+
+// ============================================================================
+// Private
+// ============================================================================
+
+bool WiFiScanner::startChannel() {
+    uint8_t channel = _channels[_channelIndex];
+    uint8_t config = PSCAN_ENABLE;
+    if (_dwellMs > 0 && _dwellMs <= WIFI_SCANNER_FAST_DWELL_MS) {
+        config |= PSCAN_FAST_SURVEY;
+    }
+    if (wifi_set_pscan_chan(&channel, &config, 1) != RTW_SUCCESS) return false;
+
+    _channelDone = false;
+    _channelActive = true;
+    _channelStartMs = millis();
+    if (wifi_scan_networks(WiFiScannerSink::handler, this) != RTW_SUCCESS) {
+        _channelActive = false;
+        return false;
+    }
+    return true;
+}
+
+void WiFiScanner::finish(WiFiScanState state) {
+    _state = state;
+    _endMs = millis();
+}
+
+bool WiFiScanner::deliver(const WiFiNetworkInfo& info) {
+    _delivered++;
+    if (_table != nullptr) _table->add(info);
+
+    bool keepGoing = _callback != nullptr ? _callback(info, _user) : true;
+    if (_stopSsid[0] != '\0' && strcmp(info.ssid, _stopSsid) == 0) {
+        _foundTarget = true;
+        keepGoing = false;
+    }
+    return keepGoing;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file WiFiScanner.h
+ * @brief Non-blocking, channel-by-channel WiFi scan with streaming results
+ *
+ * WiFi.scanNetworks() tüm bantları (~37 kanal) bitirene kadar bloklar.
+ * WiFiScanner taramayı kanal kanal yürütür (her kanal için ayrı
+ * wifi_scan_networks + wifi_set_pscan_chan):
+ * - Her AP kaydı bulunduğu kanal biter bitmez callback'e verilir
+ * - Hedef SSID görülünce kalan kanallar taranmaz (erken bitiş)
+ * - Kanal başına dwell (normal / fast survey) ve kanallar arası boşluk
+ *   ayarlanabilir; boşlukta radyo trafiğe / BLE'ye döner
+ *
+ * SDK callback'i WiFi task context'inde çalışır; kayıtlar sabit boyutlu
+ * bir ring buffer'a yazılır ve kullanıcı callback'i poll() içinden (loop()
+ * context'i) çağrılır.
+ *
+ * Kullanım:
+ *   WiFiScanner scanner;
+ *   WiFiScanOptions opt = WiFiScanner::defaultOptions();
+ *   opt.stopOnSsid = "Office";
+ *   scanner.start(opt, onAp);
+ *   void loop() { scanner.poll(); ... }
+ */
+
+#ifndef WIFI_SCANNER_H
+#define WIFI_SCANNER_H
+
+#include <Arduino.h>
+#include "WiFiScanTable.h"
+
+// SDK callback -> poll() kuyruğu (2'nin kuvveti)
+#ifndef WIFI_SCANNER_QUEUE_SIZE
+    #define WIFI_SCANNER_QUEUE_SIZE     16
+#endif
+
+// dwellMs bu değere eşit / küçükse kanal fast survey (kısa dwell) ile taranır
+#ifndef WIFI_SCANNER_FAST_DWELL_MS
+    #define WIFI_SCANNER_FAST_DWELL_MS  30
+#endif
+
+/**
+ * @brief Tarama seçenekleri
+ */
+struct WiFiScanOptions {
+    uint8_t bands;              // WIFI_SCAN_BAND_* (channels nullptr ise)
+    const uint8_t* channels;    // Taranacak kanallar, sırayla (nullptr: bands)
+    uint8_t channelCount;
+    uint16_t dwellMs;           // 0: SDK default, <= WIFI_SCANNER_FAST_DWELL_MS: fast survey
+    uint16_t channelGapMs;      // Kanallar arası bekleme
+    const char* stopOnSsid;     // Görülünce dur (nullptr: tüm kanallar)
+};
+
+/**
+ * @brief Her AP kaydı için callback (loop() context'i)
+ * @return false: taramayı durdur
+ */
+typedef bool (*WiFiScanCallback)(const WiFiNetworkInfo& info, void* user);
+
+enum class WiFiScanState {
+    Idle,
+    Scanning,
+    Done,           // Tüm kanallar tarandı
+    Stopped,        // Hedef SSID bulundu / callback false döndü / stop()
+    Failed          // SDK taramayı başlatmadı veya kanal timeout'u
+};
+
+class WiFiScanner {
+public:
+    WiFiScanner();
+
+    /**
+     * @brief Taramayı başlat (hemen döner)
+     * @param callback Kayıt başına callback (nullptr olabilir)
+     * @return false: tarama sürüyor / SDK meşgul / geçersiz kanal listesi
+     */
+    bool start(const WiFiScanOptions& options, WiFiScanCallback callback = nullptr,
+               void* user = nullptr);
+
+    /**
+     * @brief Kuyruğu boşalt, sıradaki kanala geç - loop() içinden çağrılır
+     * @return Güncel durum
+     */
+    WiFiScanState poll();
+
+    /**
+     * @brief Taramayı durdur (devam eden kanal SDK'da tamamlanır)
+     */
+    void stop();
+
+    /**
+     * @brief Kayıtları ayrıca bu tabloya da ekle (nullptr: kapat)
+     *
+     * Tablo start()'ta temizlenir.
+     */
+    void setTable(WiFiScanTable* table) { _table = table; }
+
+    WiFiScanState getState() const { return _state; }
+    bool isScanning() const { return _state == WiFiScanState::Scanning; }
+
+    /**
+     * @brief SDK'da tamamlanmamış kanal taraması var mı?
+     *
+     * scan_complete WIFI_SCAN_TIMEOUT_MS içinde gelmezse poll() bunu temizler.
+     */
+    bool isBusy() const { return _channelActive; }
+
+    uint8_t getChannelsScanned() const { return _channelIndex; }
+    uint8_t getChannelCount() const { return _channelCount; }
+    uint16_t getRecordsDelivered() const { return _delivered; }
+    uint16_t getDropped() const { return _dropped; }
+
+    /**
+     * @brief start() -> Done/Stopped süresi (ms; sürüyorsa şu ana kadar)
+     */
+    uint32_t getElapsedMs() const;
+
+    /**
+     * @brief stopOnSsid görüldü mü?
+     */
+    bool foundTarget() const { return _foundTarget; }
+
+    static WiFiScanOptions defaultOptions();
+    static const char* stateToString(WiFiScanState state);
+
+private:
+    friend struct WiFiScannerSink;
+
+    bool startChannel();
+    void finish(WiFiScanState state);
+    bool deliver(const WiFiNetworkInfo& info);
+
+    WiFiScanState _state;
+    WiFiScanCallback _callback;
+    void* _user;
+    WiFiScanTable* _table;
+
+    uint8_t _channels[WIFI_SCAN_MAX_CHANNELS];
+    uint8_t _channelCount;
+    uint8_t _channelIndex;          // Tamamlanan kanal sayısı
+    uint16_t _dwellMs;
+    uint16_t _gapMs;
+    char _stopSsid[33];
+    bool _foundTarget;
+
+    volatile bool _channelActive;   // SDK taraması sürüyor
+    volatile bool _channelDone;     // SDK scan_complete bildirdi
+    unsigned long _channelStartMs;
+    unsigned long _nextChannelMs;
+    unsigned long _startMs;
+    unsigned long _endMs;
+
+    // SPSC ring: WiFi task yazar, poll() okur
+    WiFiNetworkInfo _queue[WIFI_SCANNER_QUEUE_SIZE];
+    volatile uint8_t _head;
+    volatile uint8_t _tail;
+    volatile uint16_t _dropped;
+    uint16_t _delivered;
+};
+
+#endif // WIFI_SCANNER_H
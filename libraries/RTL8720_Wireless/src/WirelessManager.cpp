@@ -6,14 +6,70 @@
  */
 
 #include "WirelessManager.h"
+#include "BleModule.h"
 #include <WiFi.h>
+#include <SerialManager.h>
+
+extern "C" {
+#include "wifi_conf.h"
+}
+
+#if !defined(RTL8720_HOST)
+extern "C" {
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lwip_netconf.h"
+}
+#endif
 
 WirelessManager::WirelessManager()
     : _wifiState(WirelessState::Disconnected)
     , _bleState(WirelessState::Disconnected)
     , _wifiEnabled(false)
     , _bleEnabled(false)
+    , _connectState(WiFiConnectState::Idle)
+    , _connectError(WiFiConnectError::None)
+    , _timing{0, 0, 0, false, false}
+    , _connectStartMs(0)
+    , _stateEnteredMs(0)
+    , _connectTimeoutMs(0)
+    , _lastLinkCheckMs(0)
+    , _hasPassword(false)
+    , _workerBusy(false)
+    , _workerResult(WL_IDLE_STATUS)
+    , _abandonPending(false)
+    , _associatePending(false)
+    , _fastReconnect(true)
+    , _usingCache(false)
+    , _reconnectStats{0, 0, 0, 0, 0, 0}
+    , _roamingEnabled(false)
+    , _roamScanActive(false)
+    , _roamTargetActive(false)
+    , _lastRoamSampleMs(0)
+    , _wifiChannel(0)
+    , _coexEnabled(false)
+    , _coexBle(nullptr)
+    , _bulkRefs(0)
+    , _coexScanApplied(false)
+    , _coexAlignPending(false)
+    , _coexAdvApplied(false)
+    , _scanBaseIntervalMs(0)
+    , _scanBaseWindowMs(0)
+    , _advBaseMs(0)
+    , _coexReports(0)
+    , _coexDrops(0)
+    , _autoReconnect(false)
+    , _retryPending(false)
+    , _retryAtMs(0)
+    , _outageStartMs(0)
+    , _jitterState(1)
+    , _policy(defaultReconnectPolicy())
+    , _supervisorStats{0, 0, 0, 0, 0, 0, 0, false}
+    , _supervisorCallbackCount(0)
+    , _callbackCount(0)
 {
+    _ssid[0] = '\0';
+    _password[0] = '\0';
 }
 
 // ============================================================================
@@ -42,6 +98,8 @@ void WirelessManager::begin(bool enableWifi, bool enableBle) {
 }
 
 void WirelessManager::end() {
+    disableCoex();
+
     if (_wifiEnabled) {
         disconnectWiFi();
         // RTL8720DN doesn't have WiFi.mode(WIFI_OFF)
@@ -78,53 +136,642 @@ void WirelessManager::setWiFiMode(WiFiMode mode) {
 
 bool WirelessManager::connectWiFi(const char* ssid, const char* password,
                                    unsigned long timeout) {
+    if (!connectWiFiAsync(ssid, password, timeout)) {
+        return false;
+    }
+
+    while (true) {
+        WiFiConnectState state = poll();
+        if (state == WiFiConnectState::Connected) return true;
+        if (state == WiFiConnectState::Failed) return false;
+        delay(10);
+    }
+}
+
+bool WirelessManager::connectWiFiAsync(const char* ssid, const char* password,
+                                       unsigned long timeout) {
     if (!_wifiEnabled) {
         DEBUG_SERIAL.println("[Wireless] WiFi not enabled!");
+        _connectError = WiFiConnectError::NotEnabled;
         return false;
     }
 
-    _wifiState = WirelessState::Connecting;
+    if (_workerBusy || _connectState == WiFiConnectState::Associating ||
+        _connectState == WiFiConnectState::Dhcp) {
+        DEBUG_SERIAL.println("[Wireless] Connection already in progress");
+        _connectError = WiFiConnectError::Busy;
+        return false;
+    }
+
+    // RTL8720DN requires char* not const char*
+    strncpy(_ssid, ssid, sizeof(_ssid) - 1);
+    _ssid[sizeof(_ssid) - 1] = '\0';
+    _hasPassword = password != nullptr;
+    if (_hasPassword) {
+        strncpy(_password, password, sizeof(_password) - 1);
+        _password[sizeof(_password) - 1] = '\0';
+    }
+
+    // Kullanıcı bağlantısı bekleyen supervisor denemesinin yerine geçer
+    _retryPending = false;
+    return beginConnect(timeout);
+}
+
+bool WirelessManager::beginConnect(unsigned long timeout) {
+    // Kanal kanal tarama association ile aynı radyoyu kullanır; SDK'daki
+    // kanal taraması bitene kadar requestAssociation() bekletir
+    _scanner.stop();
+
+    _usingCache = _fastReconnect && _cache.load() &&
+                  _cache.matches(_ssid, _hasPassword ? _password : nullptr);
 
     DEBUG_SERIAL.print("[Wireless] Connecting to: ");
-    DEBUG_SERIAL.println(ssid);
+    DEBUG_SERIAL.print(_ssid);
+    if (_usingCache) {
+        serialManager.logPrintf(" (cached: ch %u, %02X:%02X:%02X:%02X:%02X:%02X)",
+                                _cache.get().channel,
+                                _cache.get().bssid[0], _cache.get().bssid[1], _cache.get().bssid[2],
+                                _cache.get().bssid[3], _cache.get().bssid[4], _cache.get().bssid[5]);
+    }
+    DEBUG_SERIAL.println();
 
-    // RTL8720DN requires char* not const char*
-    char ssidBuf[33];
-    strncpy(ssidBuf, ssid, sizeof(ssidBuf) - 1);
-    ssidBuf[sizeof(ssidBuf) - 1] = '\0';
+    _connectError = WiFiConnectError::None;
+    _timing = WiFiConnectTiming{0, 0, 0, _usingCache, false};
+    _connectTimeoutMs = timeout;
+    _connectStartMs = millis();
+    _workerResult = WL_IDLE_STATUS;
+    setConnectState(WiFiConnectState::Associating);
 
-    if (password != nullptr) {
-        WiFi.begin(ssidBuf, password);
-    } else {
-        WiFi.begin(ssidBuf);
+    if (!requestAssociation()) {
+        failConnect(WiFiConnectError::AssociationFailed);
+        return false;
     }
+    return true;
+}
+
+WiFiConnectState WirelessManager::poll() {
+    bool wasScanning = _scanner.isScanning();
+    _scanner.poll();
+    if (wasScanning && !_scanner.isScanning()) {
+        Events.post(EventSource::WiFi, static_cast<uint8_t>(WiFiEventCode::ScanDone),
+                    static_cast<uint16_t>(_scanner.getState()), _scanner.getRecordsDelivered());
+    }
+
+    unsigned long now = millis();
 
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED) {
-        if (millis() - startTime > timeout) {
-            DEBUG_SERIAL.println("\n[Wireless] Connection timeout!");
-            _wifiState = WirelessState::Error;
-            return false;
+    // Timeout sonrası geç biten worker'ın kurduğu bağlantıyı kapat
+    if (_abandonPending && !_workerBusy) {
+        _abandonPending = false;
+        WiFi.disconnect();
+    }
+
+    switch (_connectState) {
+        case WiFiConnectState::Associating: {
+            if (_associatePending) {
+                // Tarama sürerken wifi_connect reddedilir / yarışır
+                if (!_scanner.isBusy()) {
+                    _associatePending = false;
+                    if (!startAssociation()) failConnect(WiFiConnectError::AssociationFailed);
+                } else if (now - _connectStartMs > _connectTimeoutMs) {
+                    failConnect(WiFiConnectError::Timeout);
+                }
+                break;
+            }
+
+            uint8_t status = WiFi.status();
+            int result = _workerResult;
+            bool failed = status == WL_CONNECT_FAILED || status == WL_NO_SSID_AVAIL ||
+                          result == WL_CONNECT_FAILED || result == WL_NO_SSID_AVAIL;
+            if (status == WL_CONNECTED) {
+                _timing.associateMs = now - _connectStartMs;
+                setConnectState(WiFiConnectState::Dhcp);
+            } else if (_usingCache && !_workerBusy &&
+                       (failed || now - _connectStartMs > WIRELESS_FAST_CONNECT_TIMEOUT_MS)) {
+                // AP taşınmış veya kapalı: full scan ile devam et. Cache silinmez;
+                // full scan başarılı olursa updateCache() yeni AP ile üzerine yazar,
+                // AP geçici kapalıysa sonraki deneme yine hızlı yolu kullanır.
+                DEBUG_SERIAL.println("[Wireless] Cached AP failed, falling back to full scan");
+                _usingCache = false;
+                _roamTargetActive = false;
+                _timing.cached = false;
+                _timing.fallback = true;
+                _reconnectStats.fallbackCount++;
+                _workerResult = WL_IDLE_STATUS;
+                WiFi.disconnect();
+                if (!startAssociation()) {
+                    failConnect(WiFiConnectError::AssociationFailed);
+                }
+            } else if (failed) {
+                failConnect(WiFiConnectError::AssociationFailed);
+            } else if (now - _connectStartMs > _connectTimeoutMs) {
+                failConnect(WiFiConnectError::Timeout);
+            }
+            break;
         }
-        delay(500);
-        DEBUG_SERIAL.print(".");
+
+        case WiFiConnectState::Dhcp:
+            if (WiFi.status() != WL_CONNECTED) {
+                failConnect(WiFiConnectError::LinkLost);
+            } else if (static_cast<uint32_t>(WiFi.localIP()) != 0) {
+                _timing.totalMs = now - _connectStartMs;
+                _timing.dhcpMs = _timing.totalMs - _timing.associateMs;
+                _lastLinkCheckMs = now;
+
+                DEBUG_SERIAL.print("[Wireless] Connected! IP: ");
+                DEBUG_SERIAL.println(WiFi.localIP());
+                serialManager.logPrintf("[Wireless] %s: assoc %lu ms, dhcp %lu ms, total %lu ms\n",
+                                        _timing.cached ? "cached" : "full scan",
+                                        (unsigned long)_timing.associateMs,
+                                        (unsigned long)_timing.dhcpMs,
+                                        (unsigned long)_timing.totalMs);
+                if (_roaming.isHandoffActive()) {
+                    // Hedef AP'ye bağlanılamayıp full scan'e düşüldüyse başarısız roam
+                    _roaming.handoffFinished(now, !_timing.fallback);
+                    _roamTargetActive = false;
+                    if (!_timing.fallback) {
+                        Events.post(EventSource::WiFi, static_cast<uint8_t>(WiFiEventCode::Roamed),
+                                    _roaming.getCandidate().channel, _timing.totalMs);
+                    }
+                } else if (_timing.cached) {
+                    _reconnectStats.cachedCount++;
+                    _reconnectStats.cachedTotalMs += _timing.totalMs;
+                } else {
+                    _reconnectStats.fullCount++;
+                    _reconnectStats.fullTotalMs += _timing.totalMs;
+                }
+                updateCache();
+                setConnectState(WiFiConnectState::Connected);
+            } else if (now - _connectStartMs > _connectTimeoutMs) {
+                failConnect(WiFiConnectError::Timeout);
+            }
+            break;
+
+        case WiFiConnectState::Connected:
+            // WiFi.status() sürücüye gider - her poll'da değil, aralıklı kontrol
+            if (now - _lastLinkCheckMs >= WIRELESS_LINK_CHECK_MS) {
+                _lastLinkCheckMs = now;
+                if (WiFi.status() != WL_CONNECTED) {
+                    DEBUG_SERIAL.println("[Wireless] Link lost!");
+                    _connectError = WiFiConnectError::LinkLost;
+                    setConnectState(WiFiConnectState::Idle);
+                    break;
+                }
+            }
+            if (_roamingEnabled) {
+                pollRoaming(now);
+            }
+            break;
+
+        case WiFiConnectState::Idle:
+        case WiFiConnectState::Failed:
+            // Supervisor: zamanı gelen yeniden bağlanma denemesi
+            if (_retryPending && !_workerBusy &&
+                static_cast<long>(now - _retryAtMs) >= 0) {
+                _retryPending = false;
+                _supervisorStats.currentAttempt++;
+                _supervisorStats.attempts++;
+                serialManager.logPrintf("[Wireless] Reconnect attempt %lu\n",
+                                        (unsigned long)_supervisorStats.currentAttempt);
+                if (!beginConnect(_policy.connectTimeoutMs)) {
+                    scheduleRetry();
+                }
+            }
+            break;
     }
 
-    DEBUG_SERIAL.println();
-    DEBUG_SERIAL.println("[Wireless] Connected!");
-    DEBUG_SERIAL.print("[Wireless] IP: ");
-    DEBUG_SERIAL.println(WiFi.localIP());
+    if (_coexEnabled) {
+        pollCoex(now);
+    }
+
+    return _connectState;
+}
+
+bool WirelessManager::onWiFiStateChange(WiFiStateCallback callback) {
+    if (callback == nullptr || _callbackCount >= WIRELESS_MAX_CALLBACKS) return false;
+    _callbacks[_callbackCount++] = callback;
+    return true;
+}
+
+void WirelessManager::setConnectState(WiFiConnectState state) {
+    if (state == _connectState) return;
+
+    WiFiConnectState previous = _connectState;
+    _connectState = state;
+    _stateEnteredMs = millis();
+    if (state != WiFiConnectState::Associating) _associatePending = false;
 
-    _wifiState = WirelessState::Connected;
+    if (state == WiFiConnectState::Connected) {
+        // Yeni AP: RSSI geçmişi geçersiz
+        _roaming.resetSmoothing();
+        _lastRoamSampleMs = _stateEnteredMs;
+    } else if (previous == WiFiConnectState::Connected && _roamScanActive) {
+        _scanner.stop();
+        _roamScanActive = false;
+    }
+    if (state == WiFiConnectState::Idle || state == WiFiConnectState::Failed) {
+        _roaming.handoffFinished(_stateEnteredMs, false);
+        _roamTargetActive = false;
+    }
+
+    switch (state) {
+        case WiFiConnectState::Idle:        _wifiState = WirelessState::Disconnected; break;
+        case WiFiConnectState::Associating:
+        case WiFiConnectState::Dhcp:        _wifiState = WirelessState::Connecting; break;
+        case WiFiConnectState::Connected:   _wifiState = WirelessState::Connected; break;
+        case WiFiConnectState::Failed:      _wifiState = WirelessState::Error; break;
+    }
+
+    Events.post(EventSource::WiFi, static_cast<uint8_t>(WiFiEventCode::StateChanged),
+                static_cast<uint16_t>(state), static_cast<uint32_t>(previous));
+    for (uint8_t i = 0; i < _callbackCount; i++) {
+        _callbacks[i](state, previous);
+    }
+
+    if (_autoReconnect) {
+        superviseTransition(state);
+    }
+}
+
+void WirelessManager::failConnect(WiFiConnectError error) {
+    _connectError = error;
+    _timing.totalMs = millis() - _connectStartMs;
+
+    DEBUG_SERIAL.print("[Wireless] Connection failed: ");
+    DEBUG_SERIAL.println(connectErrorToString(error));
+
+    // Worker hala WiFi.begin içindeyse sürücüye dokunma, bitince kapat
+    if (_workerBusy) {
+        _abandonPending = true;
+    } else {
+        WiFi.disconnect();
+    }
+    setConnectState(WiFiConnectState::Failed);
+}
+
+bool WirelessManager::requestAssociation() {
+    if (_scanner.isBusy()) {
+        // Durdurulan taramanın son kanalı SDK'da sürüyor: poll() başlatır
+        _associatePending = true;
+        return true;
+    }
+    return startAssociation();
+}
+
+bool WirelessManager::startAssociation() {
+#if defined(RTL8720_HOST)
+    // Host bağlantı API'leri bloklamaz; ilerleme status()/localIP() ile izlenir
+    runAssociation();
     return true;
+#else
+    // AmebaD WiFi.begin() / wifi_connect_bssid() association + DHCP bitene kadar bloklar
+    _workerBusy = true;
+    if (xTaskCreate(associationTask, "wifi_conn", WIRELESS_CONNECT_TASK_STACK,
+                    this, tskIDLE_PRIORITY + 1, nullptr) != pdPASS) {
+        _workerBusy = false;
+        return false;
+    }
+    return true;
+#endif
+}
+
+void WirelessManager::runAssociation() {
+    char* password = _hasPassword ? _password : nullptr;
+
+    if (!_usingCache) {
+        _workerResult = password ? WiFi.begin(_ssid, password) : WiFi.begin(_ssid);
+        return;
+    }
+
+    // Sadece cache'teki (roam'da adayın) kanalını tara, doğrudan bilinen BSSID'ye bağlan.
+    // Aynı SSID'nin AP'leri aynı güvenlik tipini kullanır.
+    const WiFiCacheRecord& cached = _cache.get();
+    const WiFiRoamCandidate& target = _roaming.getCandidate();
+    uint8_t channel = _roamTargetActive ? target.channel : cached.channel;
+    uint8_t pscanConfig = PSCAN_ENABLE | PSCAN_FAST_SURVEY;
+    wifi_set_pscan_chan(&channel, &pscanConfig, 1);
+
+    unsigned char bssid[6];
+    memcpy(bssid, _roamTargetActive ? target.bssid : cached.bssid, sizeof(bssid));
+    int ret = wifi_connect_bssid(bssid, _ssid, static_cast<rtw_security_t>(cached.security),
+                                 password, sizeof(bssid), strlen(_ssid),
+                                 password ? strlen(password) : 0, 0, nullptr);
+    if (ret != RTW_SUCCESS) {
+        _workerResult = WL_CONNECT_FAILED;
+        return;
+    }
+
+#if !defined(RTL8720_HOST)
+    // wifi_connect_bssid DHCP yapmaz (WiFi.begin'den farklı olarak)
+    _workerResult = (LwIP_DHCP(0, DHCP_START) == DHCP_ADDRESS_ASSIGNED)
+        ? WL_CONNECTED : WL_CONNECT_FAILED;
+#endif
+}
+
+void WirelessManager::associationTask(void* param) {
+#if !defined(RTL8720_HOST)
+    WirelessManager* self = static_cast<WirelessManager*>(param);
+    self->runAssociation();
+    self->_workerBusy = false;
+    vTaskDelete(nullptr);
+#else
+    (void)param;
+#endif
+}
+
+void WirelessManager::updateCache() {
+    rtw_wifi_setting_t setting;
+    if (wifi_get_setting(WLAN0_NAME, &setting) != RTW_SUCCESS || setting.channel == 0) {
+        return;
+    }
+
+    _wifiChannel = setting.channel;
+
+    WiFiCacheRecord record;
+    memset(&record, 0, sizeof(record));
+    memcpy(record.ssid, _ssid, sizeof(record.ssid));
+    WiFi.BSSID(record.bssid);
+    record.channel = setting.channel;
+    record.security = static_cast<uint32_t>(setting.security_type);
+    record.passwordHash = WiFiCache::hash(_hasPassword ? _password : nullptr);
+    record.ip = static_cast<uint32_t>(WiFi.localIP());
+    record.gateway = static_cast<uint32_t>(WiFi.gatewayIP());
+    record.netmask = static_cast<uint32_t>(WiFi.subnetMask());
+
+    // DHCP sunucusu MAC'e göre aynı adresi verdi mi?
+    if (_cache.isValid() && _cache.get().ip == record.ip) {
+        _reconnectStats.leaseReused++;
+    }
+    _cache.store(record);
 }
 
 void WirelessManager::disconnectWiFi() {
-    WiFi.disconnect();
+    if (_workerBusy) {
+        _abandonPending = true;
+    } else {
+        WiFi.disconnect();
+    }
+    // Kullanıcı isteği ile kopma kesinti sayılmaz
+    _connectError = WiFiConnectError::None;
+    _retryPending = false;
+    _supervisorStats.down = false;
+    setConnectState(WiFiConnectState::Idle);
     _wifiState = WirelessState::Disconnected;
     DEBUG_SERIAL.println("[Wireless] WiFi disconnected");
 }
 
+// ============================================================================
+// Roaming
+// ============================================================================
+
+void WirelessManager::enableRoaming(const WiFiRoamingPolicy& policy) {
+    _roaming.setPolicy(policy);
+    _roaming.resetStats();
+    _roaming.resetSmoothing();
+    _lastRoamSampleMs = millis();
+    _roamingEnabled = true;
+}
+
+void WirelessManager::disableRoaming() {
+    _roamingEnabled = false;
+    if (_roamScanActive) {
+        _scanner.stop();
+        _roamScanActive = false;
+    }
+}
+
+void WirelessManager::pollRoaming(unsigned long now) {
+    if (_roamScanActive) {
+        if (_scanner.isScanning()) return;
+        _roamScanActive = false;
+
+        WiFiRoamDecision decision = _roaming.decide(_scanner.getState() != WiFiScanState::Failed);
+        const WiFiRoamCandidate& c = _roaming.getCandidate();
+        serialManager.logPrintf("[Wireless] Roam scan: %s (current %d dBm",
+                                WiFiRoaming::decisionToString(decision),
+                                _roaming.getSmoothedRssi());
+        if (c.valid) {
+            serialManager.logPrintf(", best %02X:%02X:%02X:%02X:%02X:%02X ch %u %d dBm",
+                                    c.bssid[0], c.bssid[1], c.bssid[2],
+                                    c.bssid[3], c.bssid[4], c.bssid[5],
+                                    c.channel, c.rssi);
+        }
+        DEBUG_SERIAL.println(")");
+
+        if (decision == WiFiRoamDecision::Roam && !beginRoam()) {
+            _roaming.handoffFinished(millis(), false);
+        }
+        return;
+    }
+
+    if (now - _lastRoamSampleMs < _roaming.getPolicy().sampleMs) return;
+    _lastRoamSampleMs = now;
+
+    if (!_roaming.sample(WiFi.RSSI(), now)) return;
+
+    // Kullanıcı taraması sürüyorsa sonraki örnekte tekrar denenir
+    if (_scanner.isScanning() || _scanner.isBusy() || !_cache.isValid()) return;
+
+    uint8_t bssid[6];
+    WiFi.BSSID(bssid);
+    WiFiScanOptions options;
+    _roaming.beginScan(_ssid, bssid, now, options);
+    if (_scanner.start(options, WiFiRoaming::scanCallback, &_roaming)) {
+        _roamScanActive = true;
+    } else {
+        _roaming.decide(false);
+    }
+}
+
+bool WirelessManager::beginRoam() {
+    const WiFiRoamCandidate& c = _roaming.getCandidate();
+    serialManager.logPrintf("[Wireless] Roaming to %02X:%02X:%02X:%02X:%02X:%02X (ch %u, +%d dB)\n",
+                            c.bssid[0], c.bssid[1], c.bssid[2], c.bssid[3], c.bssid[4], c.bssid[5],
+                            c.channel, _roaming.getStats().lastGainDb);
+
+    // Connected -> Associating: supervisor kesinti başlatmaz
+    _roaming.handoffStarted(millis());
+    _roamTargetActive = true;
+    _usingCache = true;
+    _connectError = WiFiConnectError::None;
+    _timing = WiFiConnectTiming{0, 0, 0, true, false};
+    _connectTimeoutMs = _policy.connectTimeoutMs;
+    _connectStartMs = millis();
+    _workerResult = WL_IDLE_STATUS;
+    setConnectState(WiFiConnectState::Associating);
+
+    if (!requestAssociation()) {
+        failConnect(WiFiConnectError::AssociationFailed);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Reconnect supervisor
+// ============================================================================
+
+WiFiReconnectPolicy WirelessManager::defaultReconnectPolicy() {
+    WiFiReconnectPolicy policy;
+    policy.initialDelayMs = WIRELESS_RECONNECT_INITIAL_MS;
+    policy.maxDelayMs = WIRELESS_RECONNECT_MAX_MS;
+    policy.multiplierPercent = WIRELESS_RECONNECT_MULTIPLIER;
+    policy.jitterPercent = WIRELESS_RECONNECT_JITTER;
+    policy.maxAttempts = 0;
+    policy.connectTimeoutMs = WIRELESS_RECONNECT_TIMEOUT_MS;
+    return policy;
+}
+
+void WirelessManager::enableAutoReconnect(const WiFiReconnectPolicy& policy) {
+    _policy = policy;
+    if (_policy.multiplierPercent < 100) _policy.multiplierPercent = 100;
+    if (_policy.jitterPercent > 100) _policy.jitterPercent = 100;
+    if (_policy.maxDelayMs < _policy.initialDelayMs) _policy.maxDelayMs = _policy.initialDelayMs;
+
+    // Jitter tohumu MAC'ten: aynı anda reboot eden cihazlar farklı gecikme seçer
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    uint32_t seed = WiFiCache::hash(nullptr);
+    for (uint8_t b : mac) {
+        seed = (seed ^ b) * 16777619UL;
+    }
+    seed ^= micros();
+    _jitterState = seed ? seed : 1;
+
+    _autoReconnect = true;
+}
+
+void WirelessManager::disableAutoReconnect() {
+    _autoReconnect = false;
+    _retryPending = false;
+}
+
+bool WirelessManager::onSupervisorEvent(WiFiSupervisorCallback callback) {
+    if (callback == nullptr || _supervisorCallbackCount >= WIRELESS_MAX_CALLBACKS) return false;
+    _supervisorCallbacks[_supervisorCallbackCount++] = callback;
+    return true;
+}
+
+uint32_t WirelessManager::getCurrentDowntimeMs() const {
+    return _supervisorStats.down ? millis() - _outageStartMs : 0;
+}
+
+uint32_t WirelessManager::computeBackoff(uint32_t attempt) {
+    // initial * multiplier^attempt, maxDelayMs ile sınırlı
+    uint64_t delayMs = _policy.initialDelayMs;
+    for (uint32_t i = 0; i < attempt && delayMs < _policy.maxDelayMs; i++) {
+        delayMs = delayMs * _policy.multiplierPercent / 100;
+    }
+    if (delayMs > _policy.maxDelayMs) delayMs = _policy.maxDelayMs;
+
+    // Jitter: [delay * (1 - jitter%), delay] aralığında rastgele (xorshift32)
+    uint32_t span = static_cast<uint32_t>(delayMs * _policy.jitterPercent / 100);
+    if (span > 0) {
+        _jitterState ^= _jitterState << 13;
+        _jitterState ^= _jitterState >> 17;
+        _jitterState ^= _jitterState << 5;
+        delayMs -= _jitterState % (span + 1);
+    }
+    return static_cast<uint32_t>(delayMs);
+}
+
+void WirelessManager::superviseTransition(WiFiConnectState state) {
+    unsigned long now = millis();
+
+    switch (state) {
+        case WiFiConnectState::Connected:
+            if (_supervisorStats.down) {
+                uint32_t downtime = now - _outageStartMs;
+                _supervisorStats.down = false;
+                _supervisorStats.reconnects++;
+                _supervisorStats.totalDowntimeMs += downtime;
+                if (downtime > _supervisorStats.longestDowntimeMs) {
+                    _supervisorStats.longestDowntimeMs = downtime;
+                }
+                serialManager.logPrintf("[Wireless] Reconnected after %lu ms (%lu attempts)\n",
+                                        (unsigned long)downtime,
+                                        (unsigned long)_supervisorStats.currentAttempt);
+                notifySupervisor(WiFiSupervisorEvent::Reconnected);
+            }
+            _supervisorStats.currentAttempt = 0;
+            break;
+
+        case WiFiConnectState::Idle:
+            if (_connectError == WiFiConnectError::LinkLost) {
+                startOutage();
+            }
+            break;
+
+        case WiFiConnectState::Failed:
+            if (!_supervisorStats.down) {
+                startOutage();      // İlk bağlantı da başarısız olabilir
+            } else {
+                scheduleRetry();
+            }
+            break;
+
+        case WiFiConnectState::Associating:
+        case WiFiConnectState::Dhcp:
+            break;
+    }
+}
+
+void WirelessManager::startOutage() {
+    _supervisorStats.down = true;
+    _supervisorStats.outages++;
+    _supervisorStats.currentAttempt = 0;
+    _outageStartMs = millis();
+    notifySupervisor(WiFiSupervisorEvent::LinkLost);
+    scheduleRetry();
+}
+
+void WirelessManager::scheduleRetry() {
+    if (_policy.maxAttempts != 0 && _supervisorStats.currentAttempt >= _policy.maxAttempts) {
+        _retryPending = false;
+        serialManager.logPrintf("[Wireless] Giving up after %lu attempts\n",
+                                (unsigned long)_supervisorStats.currentAttempt);
+        notifySupervisor(WiFiSupervisorEvent::GaveUp);
+        return;
+    }
+
+    uint32_t delayMs = computeBackoff(_supervisorStats.currentAttempt);
+    _supervisorStats.nextRetryMs = delayMs;
+    _retryAtMs = millis() + delayMs;
+    _retryPending = true;
+    serialManager.logPrintf("[Wireless] Retry in %lu ms\n", (unsigned long)delayMs);
+    notifySupervisor(WiFiSupervisorEvent::RetryScheduled);
+}
+
+void WirelessManager::notifySupervisor(WiFiSupervisorEvent event) {
+    Events.post(EventSource::WiFi, static_cast<uint8_t>(WiFiEventCode::Supervisor),
+                static_cast<uint16_t>(event), _supervisorStats.currentAttempt);
+    for (uint8_t i = 0; i < _supervisorCallbackCount; i++) {
+        _supervisorCallbacks[i](event, _supervisorStats);
+    }
+}
+
+const char* WirelessManager::connectStateToString(WiFiConnectState state) {
+    switch (state) {
+        case WiFiConnectState::Idle:        return "Idle";
+        case WiFiConnectState::Associating: return "Associating";
+        case WiFiConnectState::Dhcp:        return "DHCP";
+        case WiFiConnectState::Connected:   return "Connected";
+        case WiFiConnectState::Failed:      return "Failed";
+    }
+    return "Unknown";
+}
+
+const char* WirelessManager::connectErrorToString(WiFiConnectError error) {
+    switch (error) {
+        case WiFiConnectError::None:                return "None";
+        case WiFiConnectError::NotEnabled:          return "WiFi not enabled";
+        case WiFiConnectError::Busy:                return "Busy";
+        case WiFiConnectError::AssociationFailed:   return "Association failed";
+        case WiFiConnectError::Timeout:             return "Timeout";
+        case WiFiConnectError::LinkLost:            return "Link lost";
+    }
+    return "Unknown";
+}
+
 bool WirelessManager::isWiFiConnected() const {
     return WiFi.status() == WL_CONNECTED;
 }
@@ -154,6 +801,147 @@ int WirelessManager::scanNetworks() {
     return numNetworks;
 }
 
+bool WirelessManager::scanNetworksAsync(const WiFiScanOptions& options, WiFiScanCallback callback,
+                                        void* user) {
+    if (!_wifiEnabled) return false;
+    if (_workerBusy || _connectState == WiFiConnectState::Associating ||
+        _connectState == WiFiConnectState::Dhcp) {
+        DEBUG_SERIAL.println("[Wireless] Scan deferred: connection in progress");
+        return false;
+    }
+    return _scanner.start(options, callback, user);
+}
+
+// ============================================================================
+// Coexistence
+// ============================================================================
+
+void WirelessManager::enableCoex(const CoexPolicy& policy, BleModule* ble) {
+    if (_coexEnabled) disableCoex();
+
+    _coex.setPolicy(policy);
+    _coex.resetStats();
+    _coexBle = ble;
+    _coexScanApplied = false;
+    _coexAlignPending = false;
+    _coexAdvApplied = false;
+    if (_coexBle != nullptr) {
+        _coexReports = _coexBle->getScanCache().getStats().reports;
+        _coexDrops = _coexBle->getScanQueueDrops();
+    }
+    _coexEnabled = true;
+    _coex.update(0, false, millis());
+    serialManager.logPrintf("[Wireless] Coex enabled (period %u ms)\n", _coex.getPolicy().periodMs);
+}
+
+void WirelessManager::disableCoex() {
+    if (!_coexEnabled) return;
+    restoreCoexParams();
+    _coexEnabled = false;
+    _coexBle = nullptr;
+}
+
+void WirelessManager::beginWiFiBulk() {
+    if (_bulkRefs < 255) _bulkRefs++;
+}
+
+void WirelessManager::endWiFiBulk() {
+    if (_bulkRefs > 0) _bulkRefs--;
+}
+
+bool WirelessManager::grantWiFi() {
+    if (!_coexEnabled) return true;
+    return _coex.grantWiFi(millis());
+}
+
+void WirelessManager::pollCoex(unsigned long now) {
+    uint8_t activities = 0;
+
+    // Bağlantı kurma ve kanal taraması da WiFi'nin radyo talebidir
+    if (_bulkRefs > 0 || _connectState == WiFiConnectState::Associating ||
+        _connectState == WiFiConnectState::Dhcp || _scanner.isScanning()) {
+        activities |= COEX_ACTIVITY_BIT(CoexActivity::WiFiBulk);
+    }
+
+    if (_coexBle != nullptr) {
+        if (_coexBle->isScanning()) activities |= COEX_ACTIVITY_BIT(CoexActivity::BleScan);
+        if (_coexBle->isAdvertising()) activities |= COEX_ACTIVITY_BIT(CoexActivity::BleAdvertising);
+        if (_coexBle->isConnected()) activities |= COEX_ACTIVITY_BIT(CoexActivity::BleConnection);
+
+        // Uygulama (veya PowerManager) ayarı değiştirdiyse yeni temel değer
+        const BleScanConfig& scan = _coexBle->getScanConfig();
+        const CoexPlan& plan = _coex.getPlan();
+        if (!_coexScanApplied || scan.intervalMs != plan.scanIntervalMs ||
+            scan.windowMs != plan.scanWindowMs) {
+            _coexScanApplied = false;
+            _scanBaseIntervalMs = scan.intervalMs;
+            _scanBaseWindowMs = scan.windowMs;
+            _coex.setBaseScan(scan.intervalMs, scan.windowMs);
+        }
+        if (!_coexAdvApplied || _coexBle->getAdvertisingInterval() != plan.advIntervalMs) {
+            _coexAdvApplied = false;
+            _advBaseMs = _coexBle->getAdvertisingInterval();
+        }
+
+        const BleScanCacheStats& cache = _coexBle->getScanCache().getStats();
+        uint32_t drops = _coexBle->getScanQueueDrops();
+        _coex.addScanReports(cache.reports - _coexReports, drops - _coexDrops);
+        _coexReports = cache.reports;
+        _coexDrops = drops;
+    }
+
+    bool wifi5GHz = _connectState == WiFiConnectState::Connected && _wifiChannel > 14;
+    if (_coex.update(activities, wifi5GHz, now) || (!_coexScanApplied && _coex.getPlan().scanWindowMs > 0)) {
+        applyCoexPlan();
+    }
+
+    // Scan durdurma asenkron: slot, ilk window gerçekten açıldığı ana hizalanır
+    if (_coexAlignPending && _coexBle != nullptr && !_coexBle->isScanRestartPending()) {
+        _coex.alignBleSlot(_coexBle->getScanWindowOriginMs());
+        _coexAlignPending = false;
+    }
+}
+
+void WirelessManager::applyCoexPlan() {
+    const CoexPlan& plan = _coex.getPlan();
+    if (plan.sliced) {
+        serialManager.logPrintf("[Wireless] Coex plan: WiFi %u ms / BLE %u ms\n",
+                                plan.wifiMs, plan.bleMs);
+    }
+    if (_coexBle == nullptr) return;
+
+    if (plan.scanWindowMs > 0 && _coexBle->isScanning()) {
+        // Tarama scan idle'da yeniden başlar: BLE slot'u o an başlasın (pollCoex)
+        _coexBle->setScanTiming(plan.scanIntervalMs, plan.scanWindowMs);
+        _coexAlignPending = true;
+        _coexScanApplied = true;
+    } else if (_coexScanApplied) {
+        _coexBle->setScanTiming(_scanBaseIntervalMs, _scanBaseWindowMs);
+        _coexScanApplied = false;
+        _coexAlignPending = false;
+    }
+
+    if (plan.advIntervalMs > _advBaseMs && _coexBle->isAdvertising()) {
+        _coexBle->setAdvertisingInterval(plan.advIntervalMs);
+        _coexAdvApplied = true;
+    } else if (_coexAdvApplied) {
+        _coexBle->setAdvertisingInterval(_advBaseMs);
+        _coexAdvApplied = false;
+    }
+}
+
+void WirelessManager::restoreCoexParams() {
+    if (_coexBle == nullptr) return;
+    if (_coexScanApplied) {
+        _coexBle->setScanTiming(_scanBaseIntervalMs, _scanBaseWindowMs);
+        _coexScanApplied = false;
+    }
+    if (_coexAdvApplied) {
+        _coexBle->setAdvertisingInterval(_advBaseMs);
+        _coexAdvApplied = false;
+    }
+}
+
 // ============================================================================
 // BLE Operations (Placeholder)
 // ============================================================================
@@ -199,7 +987,9 @@ void WirelessManager::printStatus() const {
                 DEBUG_SERIAL.println("Disconnected");
                 break;
             case WirelessState::Connecting:
-                DEBUG_SERIAL.println("Connecting...");
+                DEBUG_SERIAL.print("Connecting... (");
+                DEBUG_SERIAL.print(connectStateToString(_connectState));
+                DEBUG_SERIAL.println(")");
                 break;
             case WirelessState::Connected:
                 DEBUG_SERIAL.println("Connected");
@@ -212,9 +1002,53 @@ void WirelessManager::printStatus() const {
                 DEBUG_SERIAL.println(" dBm");
                 break;
             case WirelessState::Error:
-                DEBUG_SERIAL.println("Error");
+                DEBUG_SERIAL.print("Error (");
+                DEBUG_SERIAL.print(connectErrorToString(_connectError));
+                DEBUG_SERIAL.println(")");
                 break;
         }
+
+        if (_timing.totalMs > 0) {
+            serialManager.logPrintf("  Last connect: %s, assoc %lu ms, dhcp %lu ms, total %lu ms\n",
+                                    _timing.cached ? "cached" : (_timing.fallback ? "fallback" : "full scan"),
+                                    (unsigned long)_timing.associateMs,
+                                    (unsigned long)_timing.dhcpMs,
+                                    (unsigned long)_timing.totalMs);
+        }
+
+        const WiFiReconnectStats& rs = _reconnectStats;
+        if (rs.cachedCount + rs.fullCount > 0) {
+            serialManager.logPrintf("  Reconnect avg: cached %lu ms (n=%lu), full %lu ms (n=%lu), fallback %lu\n",
+                                    (unsigned long)(rs.cachedCount ? rs.cachedTotalMs / rs.cachedCount : 0),
+                                    (unsigned long)rs.cachedCount,
+                                    (unsigned long)(rs.fullCount ? rs.fullTotalMs / rs.fullCount : 0),
+                                    (unsigned long)rs.fullCount,
+                                    (unsigned long)rs.fallbackCount);
+        }
+
+        if (_autoReconnect) {
+            const WiFiSupervisorStats& ss = _supervisorStats;
+            serialManager.logPrintf("  Supervisor: outages %lu, attempts %lu, downtime %lu ms (max %lu ms)%s\n",
+                                    (unsigned long)ss.outages,
+                                    (unsigned long)ss.attempts,
+                                    (unsigned long)(ss.totalDowntimeMs + getCurrentDowntimeMs()),
+                                    (unsigned long)ss.longestDowntimeMs,
+                                    ss.down ? ", DOWN" : "");
+        }
+
+        if (_roamingEnabled) {
+            const WiFiRoamingStats& ro = _roaming.getStats();
+            serialManager.logPrintf("  Roaming: %d dBm smoothed, scans %lu, roams %lu (last %lu ms, max %lu ms), "
+                                    "stay %lu, no candidate %lu, failed %lu\n",
+                                    _roaming.getSmoothedRssi(),
+                                    (unsigned long)ro.scans,
+                                    (unsigned long)ro.roams,
+                                    (unsigned long)ro.lastHandoffMs,
+                                    (unsigned long)ro.maxHandoffMs,
+                                    (unsigned long)ro.stays,
+                                    (unsigned long)ro.noCandidate,
+                                    (unsigned long)ro.failed);
+        }
     }
 
     // BLE Status
@@ -222,5 +1056,35 @@ void WirelessManager::printStatus() const {
     DEBUG_SERIAL.print("  Enabled: ");
     DEBUG_SERIAL.println(_bleEnabled ? "Yes" : "No");
 
+    if (_coexEnabled) {
+        const CoexPlan& plan = _coex.getPlan();
+        const CoexStats& cs = _coex.getStats();
+        DEBUG_SERIAL.println("[Coex]");
+        DEBUG_SERIAL.print("  Active:");
+        for (uint8_t i = 0; i < COEX_ACTIVITY_COUNT; i++) {
+            if (_coex.getActivities() & (1u << i)) {
+                DEBUG_SERIAL.print(" ");
+                DEBUG_SERIAL.print(CoexScheduler::activityToString(static_cast<CoexActivity>(i)));
+            }
+        }
+        DEBUG_SERIAL.println();
+        if (plan.sliced) {
+            serialManager.logPrintf("  Plan: WiFi %u ms / BLE %u ms (guard %u ms), scan %u/%u ms, adv %u ms\n",
+                                    plan.wifiMs, plan.bleMs, _coex.getPolicy().guardMs,
+                                    plan.scanWindowMs, plan.scanIntervalMs, plan.advIntervalMs);
+        }
+        serialManager.logPrintf("  Airtime: WiFi %lu ms, BLE %lu ms, sliced %lu ms, replans %lu\n",
+                                (unsigned long)cs.wifiAirtimeMs, (unsigned long)cs.bleAirtimeMs,
+                                (unsigned long)cs.slicedMs, (unsigned long)cs.replans);
+        serialManager.logPrintf("  WiFi: grants %lu, deferrals %lu, wait %lu ms\n",
+                                (unsigned long)cs.wifiGrants, (unsigned long)cs.wifiDeferrals,
+                                (unsigned long)cs.wifiWaitMs);
+        serialManager.logPrintf("  BLE scan: clean %lu reports / %lu ms window, shared %lu / %lu ms, "
+                                "loss %u%%, queue drops %lu\n",
+                                (unsigned long)cs.bleReportsClean, (unsigned long)cs.bleWindowClean,
+                                (unsigned long)cs.bleReportsShared, (unsigned long)cs.bleWindowShared,
+                                _coex.getBleScanLossPercent(), (unsigned long)cs.bleQueueDrops);
+    }
+
     DEBUG_SERIAL.println("================================");
 }
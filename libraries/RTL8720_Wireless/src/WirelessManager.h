@@ -8,7 +8,9 @@
  * RTL8720DN özellikleri:
  * - Dual-band WiFi (2.4GHz + 5.8GHz)
  * - Bluetooth Low Energy (BLE) 5.0
- * - Co-existence mode (WiFi + BLE aynı anda)
+ * - Co-existence mode (WiFi + BLE aynı anda): enableCoex() ile scan
+ *   window'ları, advertising ve WiFi bulk transfer öncelik sırasına göre
+ *   zaman dilimlerine bölünür (CoexScheduler.h)
  */
 
 #ifndef WIRELESS_MANAGER_H
@@ -16,6 +18,11 @@
 
 #include <Arduino.h>
 #include <BoardConfig.h>
+#include <EventBus.h>
+#include "WiFiCache.h"
+#include "WiFiScanner.h"
+#include "WiFiRoaming.h"
+#include "CoexScheduler.h"
 
 // Forward declarations
 class WiFiModule;
@@ -31,6 +38,147 @@ enum class WirelessState {
     Error
 };
 
+/**
+ * @brief Non-blocking WiFi bağlantı aşaması
+ */
+enum class WiFiConnectState {
+    Idle,           // Bağlantı yok / denenmedi
+    Associating,    // AP ile authentication + association
+    Dhcp,           // Associated, IP bekleniyor
+    Connected,      // IP alındı
+    Failed          // Timeout veya AP reddetti (getWiFiError())
+};
+
+/**
+ * @brief Son bağlantı denemesinin hata nedeni
+ */
+enum class WiFiConnectError {
+    None,
+    NotEnabled,         // begin(enableWifi=false)
+    Busy,               // Önceki deneme hala sürüyor
+    AssociationFailed,  // AP bulunamadı / şifre yanlış
+    Timeout,            // Associating + Dhcp süresi timeout'u aştı
+    LinkLost            // Connected iken bağlantı koptu
+};
+
+/**
+ * @brief Aşama süreleri (ms) - son deneme
+ */
+struct WiFiConnectTiming {
+    uint32_t associateMs;   // begin -> associated
+    uint32_t dhcpMs;        // associated -> IP
+    uint32_t totalMs;       // begin -> Connected / Failed
+    bool cached;            // Cache'teki BSSID/kanal ile bağlanıldı
+    bool fallback;          // Cache denendi, başarısız oldu, full scan yapıldı
+};
+
+/**
+ * @brief Cache'li ve cache'siz bağlantı süreleri (begin()'den beri)
+ */
+struct WiFiReconnectStats {
+    uint32_t cachedCount;
+    uint32_t cachedTotalMs;
+    uint32_t fullCount;
+    uint32_t fullTotalMs;
+    uint32_t fallbackCount;     // Cache'li deneme başarısız -> full scan
+    uint32_t leaseReused;       // DHCP aynı IP'yi verdi
+};
+
+/**
+ * @brief Otomatik yeniden bağlanma politikası
+ *
+ * Deneme n için bekleme: min(initialDelayMs * (multiplierPercent/100)^n, maxDelayMs),
+ * ardından jitterPercent kadarı rastgele kısaltılır.
+ */
+struct WiFiReconnectPolicy {
+    uint32_t initialDelayMs;
+    uint32_t maxDelayMs;
+    uint16_t multiplierPercent;     // 200 = her denemede x2
+    uint8_t jitterPercent;          // 0-100
+    uint16_t maxAttempts;           // Kesinti başına, 0 = sınırsız
+    uint32_t connectTimeoutMs;      // Tek deneme timeout'u
+};
+
+/**
+ * @brief Supervisor sayaçları
+ */
+struct WiFiSupervisorStats {
+    uint32_t outages;               // Link kaybı / başarısız ilk bağlantı sayısı
+    uint32_t attempts;              // Toplam yeniden bağlanma denemesi
+    uint32_t currentAttempt;        // Bu kesintideki deneme sayısı
+    uint32_t reconnects;            // Başarıyla kapanan kesinti sayısı
+    uint32_t totalDowntimeMs;       // Kapanmış kesintilerin toplamı
+    uint32_t longestDowntimeMs;
+    uint32_t nextRetryMs;           // Son planlanan bekleme
+    bool down;                      // Şu an kesinti var mı?
+};
+
+enum class WiFiSupervisorEvent {
+    LinkLost,           // Kesinti başladı
+    RetryScheduled,     // Sonraki deneme planlandı (stats.nextRetryMs)
+    Reconnected,        // Kesinti bitti
+    GaveUp              // maxAttempts aşıldı
+};
+
+/**
+ * @brief WiFi olayı (EventSource::WiFi)
+ *
+ * StateChanged: arg = WiFiConnectState, value = önceki durum
+ * Supervisor:   arg = WiFiSupervisorEvent, value = bu kesintideki deneme
+ * ScanDone:     arg = WiFiScanState, value = teslim edilen kayıt
+ * Roamed:       arg = yeni kanal, value = handoff süresi (ms)
+ */
+enum class WiFiEventCode : uint8_t {
+    StateChanged = 1,
+    Supervisor,
+    ScanDone,
+    Roamed
+};
+
+typedef void (*WiFiSupervisorCallback)(WiFiSupervisorEvent event, const WiFiSupervisorStats& stats);
+
+/**
+ * @brief Aşama değişimi callback'i (loop() context'inde, poll() içinden çağrılır)
+ */
+typedef void (*WiFiStateCallback)(WiFiConnectState state, WiFiConnectState previous);
+
+// Kaydedilebilecek maksimum WiFi state callback sayısı
+#ifndef WIRELESS_MAX_CALLBACKS
+    #define WIRELESS_MAX_CALLBACKS      4
+#endif
+
+// Association worker task (cihazda WiFi.begin bloklar, ayrı task'ta çalışır)
+#ifndef WIRELESS_CONNECT_TASK_STACK
+    #define WIRELESS_CONNECT_TASK_STACK 1024    // word
+#endif
+
+// Cache'li bağlantı bu süre içinde associate olmazsa full scan'e düş (ms)
+#ifndef WIRELESS_FAST_CONNECT_TIMEOUT_MS
+    #define WIRELESS_FAST_CONNECT_TIMEOUT_MS    4000
+#endif
+
+// Default reconnect politikası
+#ifndef WIRELESS_RECONNECT_INITIAL_MS
+    #define WIRELESS_RECONNECT_INITIAL_MS   1000
+#endif
+#ifndef WIRELESS_RECONNECT_MAX_MS
+    #define WIRELESS_RECONNECT_MAX_MS       60000
+#endif
+#ifndef WIRELESS_RECONNECT_MULTIPLIER
+    #define WIRELESS_RECONNECT_MULTIPLIER   200
+#endif
+#ifndef WIRELESS_RECONNECT_JITTER
+    #define WIRELESS_RECONNECT_JITTER       50
+#endif
+#ifndef WIRELESS_RECONNECT_TIMEOUT_MS
+    #define WIRELESS_RECONNECT_TIMEOUT_MS   15000
+#endif
+
+// Connected iken link kontrol aralığı (ms)
+#ifndef WIRELESS_LINK_CHECK_MS
+    #define WIRELESS_LINK_CHECK_MS      500
+#endif
+
 /**
  * @brief WiFi bağlantı modu
  */
@@ -82,7 +230,11 @@ public:
     void setWiFiMode(WiFiMode mode);
 
     /**
-     * @brief WiFi ağına bağlan
+     * @brief WiFi ağına bağlan (bloklayan)
+     *
+     * connectWiFiAsync() + poll() ile aynı state machine'i kullanır;
+     * bağlanana veya timeout olana kadar döner.
+     *
      * @param ssid Ağ adı
      * @param password Şifre (açık ağ için nullptr)
      * @param timeout Bağlantı timeout (ms)
@@ -91,6 +243,151 @@ public:
     bool connectWiFi(const char* ssid, const char* password = nullptr,
                      unsigned long timeout = 30000);
 
+    /**
+     * @brief WiFi bağlantısını başlat (hemen döner)
+     *
+     * İlerleme poll() ile takip edilir:
+     *   Idle -> Associating -> Dhcp -> Connected
+     *                      \-> Failed
+     *
+     * @param ssid Ağ adı
+     * @param password Şifre (açık ağ için nullptr)
+     * @param timeout Associating + Dhcp için toplam süre (ms)
+     * @return false: WiFi etkin değil veya önceki deneme sürüyor
+     */
+    bool connectWiFiAsync(const char* ssid, const char* password = nullptr,
+                          unsigned long timeout = 30000);
+
+    /**
+     * @brief Bağlantı state machine'ini ilerlet - loop() içinden çağrılır
+     *
+     * Bloklamaz; aşama değişiminde kayıtlı callback'leri çağırır.
+     * @return Güncel aşama
+     */
+    WiFiConnectState poll();
+
+    /**
+     * @brief Aşama değişimi callback'i ekle
+     * @return false: callback tablosu dolu
+     */
+    bool onWiFiStateChange(WiFiStateCallback callback);
+
+    WiFiConnectState getWiFiConnectState() const { return _connectState; }
+    WiFiConnectError getWiFiError() const { return _connectError; }
+    const WiFiConnectTiming& getWiFiTiming() const { return _timing; }
+
+    /**
+     * @brief Güncel aşamada geçen süre (ms)
+     */
+    uint32_t getWiFiStateAge() const { return millis() - _stateEnteredMs; }
+
+    // ========================================================================
+    // Fast reconnect
+    // ========================================================================
+
+    /**
+     * @brief Cache'li hızlı bağlantıyı aç/kapat (default: açık)
+     *
+     * Açıkken, aynı SSID/şifre için son başarılı AP'nin BSSID ve kanalına
+     * doğrudan bağlanılır; başarısız olursa cache silinir ve full scan yapılır.
+     */
+    void setFastReconnect(bool enable) { _fastReconnect = enable; }
+    bool isFastReconnectEnabled() const { return _fastReconnect; }
+
+    /**
+     * @brief Kayıtlı AP bilgisini sil
+     */
+    void clearWiFiCache() { _cache.invalidate(); }
+
+    const WiFiCache& getWiFiCache() const { return _cache; }
+    const WiFiReconnectStats& getReconnectStats() const { return _reconnectStats; }
+
+    // ========================================================================
+    // Reconnect supervisor
+    // ========================================================================
+
+    /**
+     * @brief Link kaybında / başarısız bağlantıda otomatik yeniden bağlan
+     *
+     * Son connectWiFi/connectWiFiAsync bilgileri kullanılır. Denemeler poll()
+     * içinden, exponential backoff + jitter ile yapılır. disconnectWiFi()
+     * kullanıcı isteği sayılır ve yeniden bağlanmayı tetiklemez.
+     */
+    void enableAutoReconnect(const WiFiReconnectPolicy& policy = defaultReconnectPolicy());
+    void disableAutoReconnect();
+    bool isAutoReconnectEnabled() const { return _autoReconnect; }
+
+    /**
+     * @brief Supervisor olay callback'i ekle
+     * @return false: callback tablosu dolu
+     */
+    bool onSupervisorEvent(WiFiSupervisorCallback callback);
+
+    const WiFiSupervisorStats& getSupervisorStats() const { return _supervisorStats; }
+    const WiFiReconnectPolicy& getReconnectPolicy() const { return _policy; }
+
+    /**
+     * @brief Devam eden kesintinin süresi (ms, kesinti yoksa 0)
+     */
+    uint32_t getCurrentDowntimeMs() const;
+
+    static WiFiReconnectPolicy defaultReconnectPolicy();
+
+    // ========================================================================
+    // Roaming
+    // ========================================================================
+
+    /**
+     * @brief Aynı SSID'nin daha güçlü AP'sine otomatik geçişi aç
+     *
+     * Connected iken poll() RSSI'ı policy.sampleMs aralıkla örnekler.
+     * Yumuşatılmış RSSI eşik altına inince arka planda tarar, hysteresis'i
+     * geçen BSSID'ye wifi_connect_bssid ile geçer. Handoff sırasında aşama
+     * Associating -> Dhcp -> Connected olur; supervisor bunu kesinti saymaz.
+     * Hedef AP'ye bağlanılamazsa SSID ile full scan bağlantısına düşülür.
+     */
+    void enableRoaming(const WiFiRoamingPolicy& policy = WiFiRoaming::defaultPolicy());
+    void disableRoaming();
+    bool isRoamingEnabled() const { return _roamingEnabled; }
+
+    const WiFiRoaming& getRoaming() const { return _roaming; }
+
+    // ========================================================================
+    // Coexistence
+    // ========================================================================
+
+    /**
+     * @brief WiFi / BLE zaman dilimlemesini aç
+     *
+     * poll() her çağrıda aktiviteleri toplar (WiFi bulk / bağlantı kurma /
+     * tarama, ble'nin tarama / advertising / bağlantı durumu) ve plan
+     * değişince scan window'unu BLE slot'una hizalayarak, advertising
+     * aralığını gerekirse uzatarak uygular. Kapatılınca kullanıcı ayarları
+     * geri yüklenir.
+     *
+     * @param ble Parametreleri yönetilecek modül (nullptr: sadece WiFi slot'u)
+     */
+    void enableCoex(const CoexPolicy& policy = CoexScheduler::defaultPolicy(), BleModule* ble = nullptr);
+    void disableCoex();
+    bool isCoexEnabled() const { return _coexEnabled; }
+
+    /**
+     * @brief Bulk transfer başladı / bitti (iç içe çağrılabilir)
+     */
+    void beginWiFiBulk();
+    void endWiFiBulk();
+
+    /**
+     * @brief Bulk gönderen taraf her chunk'tan önce sorar
+     * @return false: BLE slot'u, chunk ertelenmeli (coex kapalıysa hep true)
+     */
+    bool grantWiFi();
+
+    const CoexScheduler& getCoex() const { return _coex; }
+
+    static const char* connectStateToString(WiFiConnectState state);
+    static const char* connectErrorToString(WiFiConnectError error);
+
     /**
      * @brief WiFi bağlantısını kes
      */
@@ -117,11 +414,22 @@ public:
     String getLocalIP() const;
 
     /**
-     * @brief Ağ taraması yap
+     * @brief Ağ taraması yap (bloklayan, tüm bantlar)
      * @return Bulunan ağ sayısı
      */
     int scanNetworks();
 
+    /**
+     * @brief Non-blocking tarama başlat - kayıtlar poll() içinden callback'e verilir
+     *
+     * Bağlantı kurulurken (Associating / Dhcp) başlatılmaz.
+     * @return false: WiFi etkin değil, bağlantı sürüyor veya tarama zaten aktif
+     */
+    bool scanNetworksAsync(const WiFiScanOptions& options, WiFiScanCallback callback,
+                           void* user = nullptr);
+
+    WiFiScanner& getScanner() { return _scanner; }
+
     // ========================================================================
     // BLE Operations (Placeholder - sonra implement edilecek)
     // ========================================================================
@@ -169,14 +477,111 @@ private:
     WirelessManager(const WirelessManager&) = delete;
     WirelessManager& operator=(const WirelessManager&) = delete;
 
+    void setConnectState(WiFiConnectState state);
+    void failConnect(WiFiConnectError error);
+    bool beginConnect(unsigned long timeout);
+    bool requestAssociation();
+    bool startAssociation();
+    void runAssociation();
+    static void associationTask(void* param);
+    void updateCache();
+
+    void pollRoaming(unsigned long now);
+    bool beginRoam();
+
+    void pollCoex(unsigned long now);
+    void applyCoexPlan();
+    void restoreCoexParams();
+
+    void superviseTransition(WiFiConnectState state);
+    void startOutage();
+    void scheduleRetry();
+    uint32_t computeBackoff(uint32_t attempt);
+    void notifySupervisor(WiFiSupervisorEvent event);
+
     // State
     WirelessState _wifiState;
     WirelessState _bleState;
     bool _wifiEnabled;
     bool _bleEnabled;
+
+    // Non-blocking connect
+    WiFiConnectState _connectState;
+    WiFiConnectError _connectError;
+    WiFiConnectTiming _timing;
+    unsigned long _connectStartMs;
+    unsigned long _stateEnteredMs;
+    unsigned long _connectTimeoutMs;
+    unsigned long _lastLinkCheckMs;
+    char _ssid[33];
+    char _password[65];
+    bool _hasPassword;
+
+    // Association worker (cihazda ayrı FreeRTOS task)
+    volatile bool _workerBusy;
+    volatile int _workerResult;
+    bool _abandonPending;       // Timeout oldu, worker bitince disconnect et
+    bool _associatePending;     // SDK kanal taraması bitince association başlar
+
+    // Fast reconnect
+    WiFiCache _cache;
+    bool _fastReconnect;
+    bool _usingCache;
+    WiFiReconnectStats _reconnectStats;
+
+    // Async scan
+    WiFiScanner _scanner;
+
+    // Roaming
+    WiFiRoaming _roaming;
+    bool _roamingEnabled;
+    bool _roamScanActive;       // _scanner roaming için tarıyor
+    bool _roamTargetActive;     // runAssociation cache yerine roam adayına bağlanır
+    unsigned long _lastRoamSampleMs;
+    uint8_t _wifiChannel;       // Bağlı AP kanalı (updateCache)
+
+    // Coexistence
+    CoexScheduler _coex;
+    bool _coexEnabled;
+    BleModule* _coexBle;
+    uint8_t _bulkRefs;
+    bool _coexScanApplied;      // ble'de coex scan timing'i var
+    bool _coexAlignPending;     // Scan yeniden başlayınca BLE slot'u hizalanacak
+    bool _coexAdvApplied;       // ble'de coex advertising aralığı var
+    uint16_t _scanBaseIntervalMs;
+    uint16_t _scanBaseWindowMs;
+    uint16_t _advBaseMs;
+    uint32_t _coexReports;      // Son okunan scan cache rapor sayısı
+    uint32_t _coexDrops;
+
+    // Reconnect supervisor
+    bool _autoReconnect;
+    bool _retryPending;
+    unsigned long _retryAtMs;
+    unsigned long _outageStartMs;
+    uint32_t _jitterState;
+    WiFiReconnectPolicy _policy;
+    WiFiSupervisorStats _supervisorStats;
+    WiFiSupervisorCallback _supervisorCallbacks[WIRELESS_MAX_CALLBACKS];
+    uint8_t _supervisorCallbackCount;
+
+    WiFiStateCallback _callbacks[WIRELESS_MAX_CALLBACKS];
+    uint8_t _callbackCount;
 };
 
 // Global erişim için kısayol
 #define Wireless WirelessManager::getInstance()
 
+/**
+ * @brief Scope boyunca WiFi bulk talebi (transfer fonksiyonunun başına konur)
+ */
+class WiFiBulkScope {
+public:
+    WiFiBulkScope() { Wireless.beginWiFiBulk(); }
+    ~WiFiBulkScope() { Wireless.endWiFiBulk(); }
+
+    WiFiBulkScope(const WiFiBulkScope&) = delete;
+    WiFiBulkScope& operator=(const WiFiBulkScope&) = delete;
+};
+
 #endif // WIRELESS_MANAGER_H
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+RTL8720 benchmark runner
+
+lib_bench çıktısını (BENCH satırları) okur, baseline ile karşılaştırır ve
+eşik üzerindeki gerilemelerde 1 ile çıkar.
+
+Kaynaklar:
+    bench_runner.py --port /dev/ttyUSB0          # seri port (pyserial)
+    bench_runner.py --file bench_output.txt      # kaydedilmiş log
+    host/build.sh src/benchmarks/lib_bench | bench_runner.py   # stdin
+
+Baseline:
+    bench_runner.py --port /dev/ttyUSB0 --save-baseline
+    bench_runner.py --port /dev/ttyUSB0 --threshold 5
+"""
+
+import argparse
+import json
+import os
+import sys
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+BASELINE_DIR = os.path.join(SCRIPT_DIR, "baselines")
+
+
+def parse_lines(lines):
+    """BENCH satırlarını parse et; BENCH_END görülünce dur."""
+    run = {"suite": None, "board": None, "platform": None, "results": {}, "skipped": {}}
+
+    for raw in lines:
+        line = raw.strip()
+        if not line.startswith("BENCH"):
+            continue
+        fields = line.split(",")
+        tag = fields[0]
+
+        if tag == "BENCH_BEGIN" and len(fields) >= 4:
+            run["suite"], run["board"], run["platform"] = fields[1], fields[2], fields[3]
+            run["results"].clear()
+            run["skipped"].clear()
+        elif tag == "BENCH" and len(fields) >= 6:
+            try:
+                value = float(fields[2])
+                samples = int(fields[5])
+            except ValueError:
+                continue
+            run["results"][fields[1]] = {
+                "value": value,
+                "unit": fields[3],
+                "better": fields[4],
+                "samples": samples,
+            }
+        elif tag == "BENCH_SKIP" and len(fields) >= 3:
+            run["skipped"][fields[1]] = ",".join(fields[2:])
+        elif tag == "BENCH_END":
+            return run
+
+    if run["suite"] is None:
+        return None
+    print("warning: BENCH_END not seen, results may be incomplete", file=sys.stderr)
+    return run
+
+
+def serial_lines(port, baud, timeout):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("error: pyserial gerekli (pip install pyserial)")
+
+    deadline = time.time() + timeout
+    with serial.Serial(port, baud, timeout=1) as ser:
+        while time.time() < deadline:
+            raw = ser.readline()
+            if not raw:
+                continue
+            line = raw.decode("utf-8", errors="replace")
+            sys.stdout.write(line)
+            yield line
+    print("warning: timeout waiting for BENCH_END", file=sys.stderr)
+
+
+def compare(run, baseline, threshold):
+    """Baseline'a göre değişimleri yazdır, gerileme sayısını döndür."""
+    regressions = 0
+    print()
+    print(f"{'benchmark':<24} {'baseline':>14} {'current':>14} {'change':>9}  unit")
+    print("-" * 72)
+
+    for name, cur in run["results"].items():
+        base = baseline.get("results", {}).get(name)
+        if base is None:
+            print(f"{name:<24} {'-':>14} {cur['value']:>14.3f} {'new':>9}  {cur['unit']}")
+            continue
+
+        if base["value"] == 0:
+            change = 0.0 if cur["value"] == 0 else float("inf")
+        else:
+            change = (cur["value"] - base["value"]) / abs(base["value"]) * 100.0
+
+        # hi: düşüş kötü, lo: artış kötü
+        worse = -change if cur["better"] == "hi" else change
+        status = ""
+        if worse > threshold:
+            status = "  REGRESSION"
+            regressions += 1
+        elif worse < -threshold:
+            status = "  improved"
+
+        print(f"{name:<24} {base['value']:>14.3f} {cur['value']:>14.3f} "
+              f"{change:>+8.1f}%  {cur['unit']}{status}")
+
+    for name in baseline.get("results", {}):
+        if name not in run["results"]:
+            reason = run["skipped"].get(name, "missing")
+            print(f"{name:<24} {'':>14} {'skipped':>14} {'':>9}  ({reason})")
+
+    print("-" * 72)
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="RTL8720 benchmark runner")
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument("--port", help="Seri port (LOG_UART)")
+    source.add_argument("--file", help="Kaydedilmiş log dosyası")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--timeout", type=float, default=120.0,
+                        help="Seri port için maksimum bekleme (s)")
+    parser.add_argument("--baseline", help="Baseline JSON (default: baselines/<board>-<platform>.json)")
+    parser.add_argument("--save-baseline", action="store_true",
+                        help="Sonuçları baseline olarak kaydet")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Gerileme eşiği (%%, default: 10)")
+    args = parser.parse_args()
+
+    if args.port:
+        run = parse_lines(serial_lines(args.port, args.baud, args.timeout))
+    elif args.file:
+        with open(args.file, encoding="utf-8", errors="replace") as f:
+            run = parse_lines(f)
+    else:
+        run = parse_lines(sys.stdin)
+
+    if run is None:
+        sys.exit("error: BENCH_BEGIN bulunamadı")
+
+    baseline_path = args.baseline or os.path.join(
+        BASELINE_DIR, f"{run['board']}-{run['platform']}.json".replace(" ", "_"))
+
+    if args.save_baseline:
+        os.makedirs(os.path.dirname(baseline_path), exist_ok=True)
+        with open(baseline_path, "w", encoding="utf-8") as f:
+            json.dump(run, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"Baseline kaydedildi: {baseline_path} ({len(run['results'])} sonuç)")
+        return 0
+
+    if not os.path.exists(baseline_path):
+        print(f"Baseline yok: {baseline_path} (--save-baseline ile oluşturun)")
+        for name, cur in run["results"].items():
+            print(f"  {name:<24} {cur['value']:>14.3f} {cur['unit']}")
+        return 0
+
+    with open(baseline_path, encoding="utf-8") as f:
+        baseline = json.load(f)
+
+    regressions = compare(run, baseline, args.threshold)
+    if regressions:
+        print(f"{regressions} gerileme (eşik {args.threshold:.1f}%)")
+        return 1
+    print(f"Gerileme yok (eşik {args.threshold:.1f}%)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
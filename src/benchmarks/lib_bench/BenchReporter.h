@@ -0,0 +1,69 @@
+/**
+ * @file BenchReporter.h
+ * @brief Machine-readable benchmark output over LOG_UART
+ *
+ * Satır formatı (bench_runner.py tarafından parse edilir):
+ *
+ *   BENCH_BEGIN,<suite>,<board>,<platform>
+ *   BENCH,<name>,<value>,<unit>,<hi|lo>,<samples>
+ *   BENCH_SKIP,<name>,<reason>
+ *   BENCH_END,<suite>
+ *
+ * hi: büyük değer daha iyi (throughput), lo: küçük değer daha iyi (latency).
+ * '#' ile başlayan ve diğer tüm satırlar runner tarafından yok sayılır.
+ */
+
+#ifndef BENCH_REPORTER_H
+#define BENCH_REPORTER_H
+
+#include <Arduino.h>
+#include <BoardConfig.h>
+#include <SerialManager.h>
+
+/**
+ * @brief Sonucun yönü
+ */
+enum class BenchBetter {
+    Higher,     // throughput, ops/s
+    Lower       // latency, süre
+};
+
+class BenchReporter {
+public:
+    void begin(const char* suite) {
+        _suite = suite;
+        serialManager.logPrintf("BENCH_BEGIN,%s,%s,%s\n", suite, BOARD_NAME, platform());
+    }
+
+    void result(const char* name, float value, const char* unit,
+                BenchBetter better, uint32_t samples) {
+        serialManager.logPrint("BENCH,");
+        serialManager.logPrint(name);
+        serialManager.logPrint(",");
+        serialManager.logPrint(value, 3);
+        serialManager.logPrintf(",%s,%s,%lu\n", unit,
+                                better == BenchBetter::Higher ? "hi" : "lo",
+                                (unsigned long)samples);
+    }
+
+    void skip(const char* name, const char* reason) {
+        serialManager.logPrintf("BENCH_SKIP,%s,%s\n", name, reason);
+    }
+
+    void end() {
+        serialManager.logPrintf("BENCH_END,%s\n", _suite);
+    }
+
+    static const char* platform() {
+#if defined(RTL8720_HOST)
+        return "host";
+#else
+        return "device";
+#endif
+    }
+
+private:
+    const char* _suite = "";
+};
+
+#endif // BENCH_REPORTER_H
@@ -0,0 +1,1171 @@
+/**
+ * @file lib_bench.ino
+ * @brief Library hot-path benchmark suite
+ *
+ * Tüm kütüphanelerin sıcak yollarını ölçer ve sonuçları LOG_UART üzerinden
+ * makine-okunur formatta yazar (bkz: BenchReporter.h). Çıktı
+ * src/benchmarks/bench_runner.py ile baseline'a karşı karşılaştırılır.
+ *
+ * Ölçülenler:
+ * - SerialManager LP_UART TX/RX throughput (RX için TX-RX jumper gerekir)
+ * - logPrintf latency
+ * - Hardware.readAdc samples/s
+ * - Led / RgbLed toggle rate
+ * - WiFi scan süresi (full / sadece 5 GHz / async / hedefli), scan ->
+ *   WiFiScanTable süresi / allocation sayısı, AP history delta süresi / byte,
+ *   connect süresi, cache'li/cache'siz reconnect
+ *   (BENCH_WIFI_SSID tanımlıysa)
+ * - BLE advertising payload encode / rotation, scan cache rapor işleme
+ *   süresi ve allocation sayısı, stream frame'leme süresi
+ * - WiFi/BLE coexistence plan güncelleme ve grant süresi
+ * - UDP telemetry kayıt ekleme süresi ve allocation sayısı
+ * - MQTT publish kodlama süresi, QoS0 / QoS1 (window 1 ve 8) msg/s
+ *   (BENCH_MQTT_BROKER tanımlıysa)
+ * - HTTP route eşleme süresi, loopback istemciyle keep-alive / bağlantı
+ *   başına istek/s ve chunked stream throughput'u (WiFi bağlıyken)
+ * - HttpClient + TcpPool: yeni bağlantı / keep-alive / pipelined istek/s,
+ *   reuse oranı ve istek başına kazanılan süre (WiFi bağlıyken)
+ * - TlsClient: tam ve flash'taki oturumla resume edilen handshake süresi /
+ *   byte'ı (BENCH_TLS_SERVER tanımlıysa)
+ * - OtaUpdater: pasif banka akışla yazma hızı, toplam süre ve buffer başına
+ *   flash süresi (hash kasıtlı yanlış: bank değişmez)
+ * - Heap / stack kullanımı
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ *
+ * WiFi connect için:
+ *   --build-property "build.extra_flags=... -DBENCH_WIFI_SSID=\"ssid\" -DBENCH_WIFI_PASS=\"pass\""
+ * MQTT için ayrıca: -DBENCH_MQTT_BROKER=\"192.168.1.10\" (port 1883)
+ * TLS için: -DBENCH_TLS_SERVER=\"192.168.1.10\" (port 8443, host/tls_server.py)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <Profiler.h>
+#include <Led.h>
+#include <RgbLed.h>
+#include <WiFiModule.h>
+#include <WiFiScanTable.h>
+#include <WiFiScanner.h>
+#include <WiFiApHistory.h>
+#include <WirelessManager.h>
+#include <BleAdvertising.h>
+#include <BleScanCache.h>
+#include <BleStream.h>
+#include <CoexScheduler.h>
+#include <UdpTelemetry.h>
+#include <MqttClient.h>
+#include <HttpServer.h>
+#include <TcpPool.h>
+#include <HttpClient.h>
+#include <TlsClient.h>
+#include <OtaUpdater.h>
+#include "BenchReporter.h"
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+
+// Host'ta scripted ağa bağlan
+#ifndef BENCH_WIFI_SSID
+    #define BENCH_WIFI_SSID     "BenchNet"
+#endif
+
+// Host'ta yerel broker (yoksa MQTT throughput ölçümleri atlanır)
+#ifndef BENCH_MQTT_BROKER
+    #define BENCH_MQTT_BROKER   "127.0.0.1"
+#endif
+
+// Host'ta host/tls_server.py (yoksa TLS handshake ölçümleri atlanır)
+#ifndef BENCH_TLS_SERVER
+    #define BENCH_TLS_SERVER    "127.0.0.1"
+#endif
+#endif
+
+#ifndef BENCH_WIFI_SSID
+    #define BENCH_WIFI_SSID     ""
+#endif
+
+#ifndef BENCH_WIFI_PASS
+    #define BENCH_WIFI_PASS     ""
+#endif
+
+#ifndef BENCH_MQTT_BROKER
+    #define BENCH_MQTT_BROKER   ""
+#endif
+
+#ifndef BENCH_TLS_SERVER
+    #define BENCH_TLS_SERVER    ""
+#endif
+
+// Sertifika doğrulanmaz: hostname sadece SNI ve oturum anahtarı
+#ifndef BENCH_TLS_NAME
+    #define BENCH_TLS_NAME      "localhost"
+#endif
+
+// Iterasyon sayıları
+const uint32_t SERIAL_TX_BYTES = 1024;
+const uint32_t SERIAL_RX_BYTES = 64;
+const uint32_t LOG_PRINTF_CALLS = 100;
+const uint32_t ADC_SAMPLES = 1000;
+const uint32_t LED_TOGGLES = 10000;
+const uint32_t WIFI_SCAN_RUNS = 3;
+const unsigned long WIFI_CONNECT_TIMEOUT = 30000;
+
+BenchReporter bench;
+WiFiModule wifi;
+
+float ticksToSeconds(uint32_t ticks) {
+    return static_cast<float>(ticks) / Profiler::ticksPerSecond();
+}
+
+// ============================================================================
+// SerialManager
+// ============================================================================
+
+void benchSerialTx() {
+    static uint8_t buffer[SERIAL_TX_BYTES];
+    for (uint32_t i = 0; i < SERIAL_TX_BYTES; i++) {
+        buffer[i] = static_cast<uint8_t>('A' + (i % 26));
+    }
+
+    uint32_t start = Profiler::ticks();
+    serialManager.sendData(buffer, SERIAL_TX_BYTES);
+    DATA_SERIAL.flush();
+    uint32_t elapsed = Profiler::ticks() - start;
+
+    bench.result("serial_tx", SERIAL_TX_BYTES / ticksToSeconds(elapsed), "B/s",
+                 BenchBetter::Higher, SERIAL_TX_BYTES);
+}
+
+void benchSerialRx() {
+    uint8_t tx[SERIAL_RX_BYTES];
+    uint8_t rx[SERIAL_RX_BYTES];
+    for (uint32_t i = 0; i < SERIAL_RX_BYTES; i++) {
+        tx[i] = static_cast<uint8_t>(i);
+    }
+
+    serialManager.flushDataBuffer();
+    uint32_t start = Profiler::ticks();
+    serialManager.sendData(tx, SERIAL_RX_BYTES);
+    size_t received = serialManager.readDataBytes(rx, SERIAL_RX_BYTES, 500);
+    uint32_t elapsed = Profiler::ticks() - start;
+
+    if (received == 0) {
+        bench.skip("serial_rx", "no loopback (LP_UART TX-RX jumper)");
+        return;
+    }
+    bench.result("serial_rx", received / ticksToSeconds(elapsed), "B/s",
+                 BenchBetter::Higher, received);
+}
+
+void benchLogPrintf() {
+    // Probe Profiler tablosuna kaydolur: fonksiyondan sonra da yaşamalı
+    static PROFILE_PROBE(probe, "logPrintf");
+    probe.reset();
+
+    for (uint32_t i = 0; i < LOG_PRINTF_CALLS; i++) {
+        PROFILE_START(t0);
+        serialManager.logPrintf("# logPrintf %lu %d\n", (unsigned long)i, -12345);
+        PROFILE_STOP(probe, t0);
+    }
+
+    bench.result("logprintf_mean", Profiler::ticksToMicros(probe.getMean()), "us",
+                 BenchBetter::Lower, probe.getCount());
+    bench.result("logprintf_max", Profiler::ticksToMicros(probe.getMax()), "us",
+                 BenchBetter::Lower, probe.getCount());
+}
+
+// ============================================================================
+// ADC
+// ============================================================================
+
+void benchAdc() {
+    volatile int sink = 0;
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < ADC_SAMPLES; i++) {
+        sink = Hardware.readAdc(0);
+    }
+    uint32_t elapsed = Profiler::ticks() - start;
+    (void)sink;
+
+    bench.result("adc_read", ADC_SAMPLES / ticksToSeconds(elapsed), "S/s",
+                 BenchBetter::Higher, ADC_SAMPLES);
+}
+
+// ============================================================================
+// LED
+// ============================================================================
+
+void benchLed() {
+    Led led(PIN_LED_RED, LED_ACTIVE_LOW);
+    led.begin();
+
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < LED_TOGGLES; i++) {
+        led.toggle();
+    }
+    uint32_t elapsed = Profiler::ticks() - start;
+    led.off();
+
+    bench.result("led_toggle", LED_TOGGLES / ticksToSeconds(elapsed), "op/s",
+                 BenchBetter::Higher, LED_TOGGLES);
+}
+
+void benchRgbLed() {
+    RgbLed rgb(PIN_LED_RED, PIN_LED_GREEN, PIN_LED_BLUE, LED_ACTIVE_LOW);
+    rgb.begin();
+
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < LED_TOGGLES; i++) {
+        rgb.setColor(static_cast<Color>(i & 0b111));
+    }
+    uint32_t elapsed = Profiler::ticks() - start;
+    rgb.off();
+
+    bench.result("rgb_setcolor", LED_TOGGLES / ticksToSeconds(elapsed), "op/s",
+                 BenchBetter::Higher, LED_TOGGLES);
+}
+
+// ============================================================================
+// WiFi
+// ============================================================================
+
+void benchWiFiScan() {
+    static WiFiScanTable table;
+    unsigned long totalMs = 0;
+    uint32_t loadTicks = 0;
+    int networks = 0;
+    int32_t heapDelta = 0;
+#if defined(RTL8720_HOST)
+    uint64_t allocs = 0;
+#endif
+
+    for (uint32_t run = 0; run < WIFI_SCAN_RUNS; run++) {
+        // Sürücü listesi (WiFiClass) -> load(); SDK callback yolu benchWiFiScanBand'de
+        unsigned long start = millis();
+        networks = WiFi.scanNetworks();
+        totalMs += millis() - start;
+
+        // Scan -> tablo: sürücü listesinden kopya + RSSI sıralaması
+        uint32_t heapBefore = Hardware.getFreeHeap();
+#if defined(RTL8720_HOST)
+        uint64_t allocBefore = hostsim::heapAllocCount();
+#endif
+        uint32_t t0 = Profiler::ticks();
+        table.load(networks);
+        table.sortByRssi();
+        loadTicks += Profiler::ticks() - t0;
+#if defined(RTL8720_HOST)
+        allocs += hostsim::heapAllocCount() - allocBefore;
+#endif
+        heapDelta = static_cast<int32_t>(heapBefore) - static_cast<int32_t>(Hardware.getFreeHeap());
+    }
+
+    bench.result("wifi_scan", static_cast<float>(totalMs) / WIFI_SCAN_RUNS, "ms",
+                 BenchBetter::Lower, WIFI_SCAN_RUNS);
+    bench.result("wifi_scan_networks", networks, "count", BenchBetter::Higher, WIFI_SCAN_RUNS);
+    bench.result("wifi_scan_table", Profiler::ticksToMicros(loadTicks / WIFI_SCAN_RUNS), "us",
+                 BenchBetter::Lower, WIFI_SCAN_RUNS);
+    bench.result("wifi_scan_heap_delta", heapDelta, "B", BenchBetter::Lower, 1);
+#if defined(RTL8720_HOST)
+    bench.result("wifi_scan_allocs", static_cast<float>(allocs) / WIFI_SCAN_RUNS, "count",
+                 BenchBetter::Lower, WIFI_SCAN_RUNS);
+#else
+    bench.skip("wifi_scan_allocs", "host only (see wifi_scan_heap_delta)");
+#endif
+}
+
+void benchWiFiScanBand() {
+    static WiFiScanTable table;
+
+    unsigned long start = millis();
+    int all = table.scan(WIFI_SCAN_BAND_ANY);
+    unsigned long fullMs = millis() - start;
+
+    start = millis();
+    int only5g = table.scan(WIFI_SCAN_BAND_5G);
+    unsigned long bandMs = millis() - start;
+
+    if (all < 0 || only5g < 0) {
+        bench.skip("wifi_scan_full", "scan failed");
+        bench.skip("wifi_scan_5g", "scan failed");
+        return;
+    }
+    bench.result("wifi_scan_full", fullMs, "ms", BenchBetter::Lower, 1);
+    bench.result("wifi_scan_5g", bandMs, "ms", BenchBetter::Lower, 1);
+    bench.result("wifi_scan_5g_networks", only5g, "count", BenchBetter::Higher, 1);
+}
+
+uint32_t runAsyncScan(WiFiScanner& scanner, const WiFiScanOptions& options, uint32_t& maxGapMs) {
+    maxGapMs = 0;
+    if (!scanner.start(options)) return 0;
+
+    unsigned long last = millis();
+    while (scanner.poll() == WiFiScanState::Scanning) {
+        unsigned long now = millis();
+        if (now - last > maxGapMs) maxGapMs = now - last;
+        last = now;
+        delay(1);
+    }
+    return scanner.getElapsedMs();
+}
+
+void benchWiFiScanAsync() {
+    static WiFiScanner scanner;
+    uint32_t gapFull = 0;
+    uint32_t gapTarget = 0;
+
+    uint32_t fullMs = runAsyncScan(scanner, WiFiScanner::defaultOptions(), gapFull);
+    if (scanner.getState() != WiFiScanState::Done) {
+        bench.skip("wifi_scan_async", "scan failed");
+        return;
+    }
+    bench.result("wifi_scan_async", fullMs, "ms", BenchBetter::Lower, 1);
+    bench.result("wifi_scan_async_gap", gapFull, "ms", BenchBetter::Lower, 1);
+
+    if (strlen(BENCH_WIFI_SSID) == 0) {
+        bench.skip("wifi_scan_targeted", "BENCH_WIFI_SSID not set");
+        return;
+    }
+    WiFiScanOptions targeted = WiFiScanner::defaultOptions();
+    targeted.dwellMs = WIFI_SCANNER_FAST_DWELL_MS;
+    targeted.stopOnSsid = BENCH_WIFI_SSID;
+    uint32_t targetMs = runAsyncScan(scanner, targeted, gapTarget);
+    if (!scanner.foundTarget()) {
+        bench.skip("wifi_scan_targeted", "target not seen");
+        return;
+    }
+    bench.result("wifi_scan_targeted", targetMs, "ms", BenchBetter::Lower, 1);
+}
+
+void benchApHistory() {
+    static WiFiScanTable table;
+    static WiFiApHistory history;
+    const uint8_t APS = 40;
+
+    // Sentetik depo taraması: 40 AP, her taramada 4'ünün RSSI'ı değişir
+    auto fill = [&](uint8_t round) {
+        table.clear();
+        for (uint8_t i = 0; i < APS; i++) {
+            WiFiNetworkInfo ap = {};
+            snprintf(ap.ssid, sizeof(ap.ssid), "wh-ap-%02u", i);
+            const uint8_t bssid[6] = {0x00, 0xE0, 0x4C, 0x10, 0x00, i};
+            memcpy(ap.bssid, bssid, sizeof(bssid));
+            ap.rssi = -50 - i;
+            if (i % 10 == round % 10) ap.rssi -= 10;
+            ap.channel = (i & 1) ? 36 + (i % 4) * 4 : 1 + (i % 3) * 5;
+            ap.is5GHz = WiFiScanTable::is5GHzChannel(ap.channel);
+            table.add(ap);
+        }
+    };
+
+    fill(0);
+    history.clear();
+    history.update(table, nullptr);
+
+    const uint32_t ROUNDS = 20;
+    uint32_t ticks = 0;
+    uint32_t deltaBytes = 0;
+    uint32_t fullBytes = 0;
+    for (uint32_t r = 1; r <= ROUNDS; r++) {
+        fill(r);
+        uint32_t t0 = Profiler::ticks();
+        WiFiApDeltaSummary summary = history.update(table, nullptr);
+        ticks += Profiler::ticks() - t0;
+        deltaBytes += summary.deltaBytes;
+        fullBytes += summary.fullBytes;
+    }
+
+    bench.result("ap_history_update", Profiler::ticksToMicros(ticks / ROUNDS), "us",
+                 BenchBetter::Lower, ROUNDS);
+    bench.result("ap_history_delta_bytes", static_cast<float>(deltaBytes) / ROUNDS, "B",
+                 BenchBetter::Lower, ROUNDS);
+    bench.result("ap_history_full_bytes", static_cast<float>(fullBytes) / ROUNDS, "B",
+                 BenchBetter::Lower, ROUNDS);
+}
+
+// ============================================================================
+// BLE
+// ============================================================================
+
+bool benchEncodeTlm(BleAdvPayload& payload, void* user) {
+    uint32_t* counter = static_cast<uint32_t*>(user);
+    return payload.setEddystoneTlm(3000, 0x1780, (*counter)++, millis() / 100);
+}
+
+void benchBleAdvertising() {
+    const uint32_t ENCODES = 1000;
+    const uint8_t instance[6] = {0x87, 0x20, 0x00, 0x00, 0x00, 0x01};
+    const uint8_t ns[10] = {0};
+    BleAdvPayload payload;
+#if defined(RTL8720_HOST)
+    uint64_t allocBefore = hostsim::heapAllocCount();
+#endif
+
+    // UID + TLM encode (sensör payload'ı her rotation'da yeniden kurulur)
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < ENCODES; i++) {
+        payload.setEddystoneUid(ns, instance, -18);
+        payload.setEddystoneTlm(3000, 0x1780, i, i);
+    }
+    uint32_t encodeTicks = Profiler::ticks() - start;
+
+    // Rotation: her poll()'da slot değişir (dwell 1 ms, sanal saat ilerler)
+    static BleAdvRotation rotation;
+    uint32_t counter = 0;
+    rotation.clear();
+    rotation.add(payload, 1);
+    rotation.add(benchEncodeTlm, &counter, 1);
+    uint32_t pollTicks = 0;
+    for (uint32_t i = 0; i < ENCODES; i++) {
+        delay(1);
+        uint32_t t0 = Profiler::ticks();
+        rotation.poll(millis());
+        pollTicks += Profiler::ticks() - t0;
+    }
+
+    bench.result("ble_adv_encode", Profiler::ticksToMicros(encodeTicks / ENCODES), "us",
+                 BenchBetter::Lower, ENCODES);
+    bench.result("ble_adv_rotate", Profiler::ticksToMicros(pollTicks / ENCODES), "us",
+                 BenchBetter::Lower, ENCODES);
+#if defined(RTL8720_HOST)
+    bench.result("ble_adv_allocs", static_cast<float>(hostsim::heapAllocCount() - allocBefore),
+                 "count", BenchBetter::Lower, ENCODES);
+#else
+    bench.skip("ble_adv_allocs", "host only");
+#endif
+}
+
+void benchBleScan() {
+    const uint32_t REPORTS = 2000;
+    const uint8_t TAGS = 64;
+    const uint8_t instance[6] = {0x87, 0x20, 0x00, 0x00, 0x00, 0x01};
+    const uint8_t ns[10] = {0};
+    const uint8_t uuid[16] = {0};
+
+    // Yarısı Eddystone (filtreden geçer), yarısı iBeacon (filtrelenir)
+    BleAdvPayload eddystone;
+    BleAdvPayload ibeacon;
+    eddystone.setEddystoneUid(ns, instance, -18);
+    ibeacon.setIBeacon(uuid, 1, 2, -59);
+
+    static BleScanReport reports[TAGS];
+    for (uint8_t i = 0; i < TAGS; i++) {
+        const BleAdvPayload& payload = (i & 1) ? ibeacon : eddystone;
+        memset(&reports[i], 0, sizeof(BleScanReport));
+        reports[i].addr[0] = i;
+        reports[i].addr[1] = static_cast<uint8_t>(i * 37);
+        reports[i].addr[5] = 0xC0;
+        reports[i].addrType = 1;
+        reports[i].rssi = static_cast<int8_t>(-40 - i);
+        reports[i].length = payload.length();
+        memcpy(reports[i].data, payload.data(), payload.length());
+    }
+
+    static BleScanCache cache;
+    cache.clear();
+    cache.setFilter({BLE_UUID16_EDDYSTONE, BLE_SCAN_ANY_COMPANY, -128});
+#if defined(RTL8720_HOST)
+    uint64_t allocBefore = hostsim::heapAllocCount();
+#endif
+
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < REPORTS; i++) {
+        cache.process(reports[(i * 7) % TAGS], i);
+    }
+    uint32_t ticks = Profiler::ticks() - start;
+
+    bench.result("ble_scan_process", Profiler::ticksToMicros(ticks) / REPORTS, "us",
+                 BenchBetter::Lower, REPORTS);
+#if defined(RTL8720_HOST)
+    bench.result("ble_scan_allocs", static_cast<float>(hostsim::heapAllocCount() - allocBefore),
+                 "count", BenchBetter::Lower, REPORTS);
+#else
+    bench.skip("ble_scan_allocs", "host only");
+#endif
+}
+
+bool discardFrame(const uint8_t* frame, uint16_t length, void* user) {
+    (void)frame;
+    *static_cast<uint32_t*>(user) += length;
+    return true;
+}
+
+void benchBleStream() {
+    const uint32_t FRAMES = 4000;
+    const uint8_t CREDITS = 10;
+    uint8_t record[32];
+    for (uint8_t i = 0; i < sizeof(record); i++) record[i] = i;
+
+    static BleStreamTx stream;
+    stream.reset();
+    stream.setMtu(BLE_STREAM_MAX_MTU);
+    uint32_t sentBytes = 0;
+#if defined(RTL8720_HOST)
+    uint64_t allocBefore = hostsim::heapAllocCount();
+#endif
+
+    // Her turda ring'i 32 byte'lık kayıtlarla doldur, credit kadar frame gönder
+    uint32_t frames = 0;
+    uint32_t start = Profiler::ticks();
+    while (frames < FRAMES) {
+        while (stream.space() >= sizeof(record)) {
+            stream.write(record, sizeof(record));
+        }
+        frames += stream.pump(0, CREDITS, discardFrame, &sentBytes);
+    }
+    uint32_t ticks = Profiler::ticks() - start;
+
+    bench.result("ble_stream_pump", Profiler::ticksToMicros(ticks) / frames, "us",
+                 BenchBetter::Lower, frames);
+#if defined(RTL8720_HOST)
+    bench.result("ble_stream_allocs", static_cast<float>(hostsim::heapAllocCount() - allocBefore),
+                 "count", BenchBetter::Lower, frames);
+#else
+    bench.skip("ble_stream_allocs", "host only");
+#endif
+
+    // 2M PHY + DLE + 247 MTU, 15 ms interval, 10 credit
+    BleLinkParams link = {BLE_STREAM_MAX_MTU, 251, 2, 15000, CREDITS};
+    bench.result("ble_stream_estimate", static_cast<float>(BleStreamTx::estimateThroughput(link)),
+                 "B/s", BenchBetter::Higher, 1);
+}
+
+void benchCoex() {
+    const uint32_t CALLS = 10000;
+    const uint8_t wifiOnly = COEX_ACTIVITY_BIT(CoexActivity::WiFiBulk);
+    const uint8_t shared = wifiOnly | COEX_ACTIVITY_BIT(CoexActivity::BleScan);
+
+    static CoexScheduler coex;
+    coex.resetStats();
+
+    // Her poll'de aktivite değişir: plan her seferinde yeniden hesaplanır
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        coex.update((i & 1) ? shared : wifiOnly, false, i);
+    }
+    uint32_t ticks = Profiler::ticks() - start;
+    bench.result("coex_update", Profiler::ticksToMicros(ticks) / CALLS, "us",
+                 BenchBetter::Lower, CALLS);
+
+    // Chunk başına grant, zaman WiFi ve BLE slot'larını süpürür
+    coex.update(shared, false, 0);
+    uint32_t granted = 0;
+    start = Profiler::ticks();
+    for (uint32_t i = 0; i < CALLS; i++) {
+        if (coex.grantWiFi(i)) granted++;
+    }
+    ticks = Profiler::ticks() - start;
+    bench.result("coex_grant", Profiler::ticksToMicros(ticks) / CALLS, "us",
+                 BenchBetter::Lower, granted);
+}
+
+void benchUdpTelemetry() {
+    const uint8_t ROUNDS = 20;
+    uint8_t record[16];
+    for (uint8_t i = 0; i < sizeof(record); i++) record[i] = i;
+
+    static UdpTelemetry telemetry;
+    UdpTelemetryConfig config = {sizeof(record), 0, 1000};
+    telemetry.begin(IPAddress(192, 168, 1, 10), 9000, config);
+#if defined(RTL8720_HOST)
+    uint64_t allocBefore = hostsim::heapAllocCount();
+#endif
+
+    // Her turda tüm buffer'ları doldur; gönderimin bitmesi ve geri alma ölçüm dışında
+    const uint32_t perRound = static_cast<uint32_t>(telemetry.getMaxRecords()) * UDP_TELEMETRY_BUFFER_COUNT;
+    uint32_t records = 0;
+    uint32_t ticks = 0;
+    for (uint8_t round = 0; round < ROUNDS; round++) {
+        uint32_t start = Profiler::ticks();
+        for (uint32_t i = 0; i < perRound && telemetry.append(record); i++) {
+            records++;
+        }
+        ticks += Profiler::ticks() - start;
+        delay(2);
+        telemetry.poll();
+    }
+
+#if defined(RTL8720_HOST)
+    bench.result("udp_telemetry_allocs", static_cast<float>(hostsim::heapAllocCount() - allocBefore),
+                 "count", BenchBetter::Lower, records);
+#else
+    bench.skip("udp_telemetry_allocs", "host only");
+#endif
+    bench.result("udp_telemetry_append", Profiler::ticksToMicros(ticks) / records, "us",
+                 BenchBetter::Lower, records);
+    telemetry.end();
+}
+
+void benchWiFiConnect() {
+    if (strlen(BENCH_WIFI_SSID) == 0) {
+        bench.skip("wifi_connect", "BENCH_WIFI_SSID not set");
+        return;
+    }
+
+    Wireless.begin(true, false);
+
+    unsigned long start = millis();
+    bool ok = wifi.connect(BENCH_WIFI_SSID,
+                           strlen(BENCH_WIFI_PASS) > 0 ? BENCH_WIFI_PASS : nullptr,
+                           WIFI_CONNECT_TIMEOUT);
+    while (ok && wifi.getConnectState() != WiFiConnectState::Connected) {
+        ok = wifi.poll() != WiFiConnectState::Failed;
+        delay(10);
+    }
+    unsigned long elapsed = millis() - start;
+
+    if (!ok) {
+        bench.skip("wifi_connect", "connect failed");
+        return;
+    }
+    bench.result("wifi_connect", elapsed, "ms", BenchBetter::Lower, 1);
+    wifi.disconnect();
+}
+
+void benchWiFiReconnect() {
+    if (strlen(BENCH_WIFI_SSID) == 0) {
+        bench.skip("wifi_reconnect_full", "BENCH_WIFI_SSID not set");
+        bench.skip("wifi_reconnect_cached", "BENCH_WIFI_SSID not set");
+        return;
+    }
+
+    const char* pass = strlen(BENCH_WIFI_PASS) > 0 ? BENCH_WIFI_PASS : nullptr;
+    Wireless.begin(true, false);
+
+    // Cache'siz: full scan + associate + DHCP (cache'i doldurur)
+    Wireless.clearWiFiCache();
+    if (!Wireless.connectWiFi(BENCH_WIFI_SSID, pass, WIFI_CONNECT_TIMEOUT)) {
+        bench.skip("wifi_reconnect_full", "connect failed");
+        bench.skip("wifi_reconnect_cached", "connect failed");
+        return;
+    }
+    bench.result("wifi_reconnect_full", Wireless.getWiFiTiming().totalMs, "ms",
+                 BenchBetter::Lower, 1);
+    Wireless.disconnectWiFi();
+
+    // Cache'li: bilinen BSSID + tek kanal
+    if (!Wireless.connectWiFi(BENCH_WIFI_SSID, pass, WIFI_CONNECT_TIMEOUT) ||
+        !Wireless.getWiFiTiming().cached) {
+        bench.skip("wifi_reconnect_cached", "cached connect not used");
+    } else {
+        bench.result("wifi_reconnect_cached", Wireless.getWiFiTiming().totalMs, "ms",
+                     BenchBetter::Lower, 1);
+    }
+    Wireless.disconnectWiFi();
+}
+
+// ============================================================================
+// MQTT
+// ============================================================================
+
+/**
+ * @brief count mesajı gönder (QoS1: hepsi ack'lenene kadar), msg/s (0: bağlantı koptu)
+ */
+float mqttThroughput(MqttClient& mqtt, uint8_t qos, uint32_t count) {
+    uint8_t payload[32] = {0};
+    uint32_t published = 0;
+    unsigned long startMs = millis();
+    uint32_t start = Profiler::ticks();
+
+    while (published < count || !mqtt.isIdle()) {
+        while (published < count && mqtt.getFree() > 0 && mqtt.publish("bench/mqtt", payload, sizeof(payload), qos)) {
+            published++;
+        }
+        if (mqtt.poll() != MqttState::Connected || millis() - startMs > 10000) return 0;
+    }
+    return count / ticksToSeconds(Profiler::ticks() - start);
+}
+
+void benchMqtt() {
+    const uint32_t ENCODE_CALLS = 1000;
+    const uint32_t MESSAGES = 1000;
+    uint8_t payload[32] = {0};
+
+    static MqttClient mqtt;
+    mqtt.begin(IPAddress(), 1883, MqttClient::defaultConfig("lib_bench"));
+
+    // Bağlantı yokken: publish() kodlayıp offline kuyruğa ekler
+    uint32_t ticks = 0;
+    for (uint32_t i = 0; i < ENCODE_CALLS; i += MQTT_POOL_SIZE) {
+        uint32_t start = Profiler::ticks();
+        for (uint8_t j = 0; j < MQTT_POOL_SIZE; j++) {
+            mqtt.publish("bench/mqtt", payload, sizeof(payload), 1);
+        }
+        ticks += Profiler::ticks() - start;
+        mqtt.discardQueued();
+    }
+    bench.result("mqtt_publish_encode", Profiler::ticksToMicros(ticks) / ENCODE_CALLS, "us",
+                 BenchBetter::Lower, ENCODE_CALLS);
+    mqtt.end();
+
+    IPAddress broker;
+    if (strlen(BENCH_MQTT_BROKER) == 0 || strlen(BENCH_WIFI_SSID) == 0 || !broker.fromString(BENCH_MQTT_BROKER)) {
+        bench.skip("mqtt_publish_qos0", "BENCH_MQTT_BROKER not set");
+        bench.skip("mqtt_publish_qos1_w1", "BENCH_MQTT_BROKER not set");
+        bench.skip("mqtt_publish_qos1", "BENCH_MQTT_BROKER not set");
+        return;
+    }
+
+    const char* pass = strlen(BENCH_WIFI_PASS) > 0 ? BENCH_WIFI_PASS : nullptr;
+    bool connected = Wireless.connectWiFi(BENCH_WIFI_SSID, pass, WIFI_CONNECT_TIMEOUT);
+    if (connected) {
+        mqtt.begin(broker, 1883, MqttClient::defaultConfig("lib_bench"));
+        unsigned long start = millis();
+        while (mqtt.poll() != MqttState::Connected && millis() - start < MQTT_CONNECT_TIMEOUT_MS) {
+            delay(1);
+        }
+        connected = mqtt.isConnected();
+    }
+    if (!connected) {
+        bench.skip("mqtt_publish_qos0", "broker connect failed");
+        bench.skip("mqtt_publish_qos1_w1", "broker connect failed");
+        bench.skip("mqtt_publish_qos1", "broker connect failed");
+        mqtt.end();
+        Wireless.disconnectWiFi();
+        return;
+    }
+
+    const char* names[] = {"mqtt_publish_qos0", "mqtt_publish_qos1_w1", "mqtt_publish_qos1"};
+    const uint8_t qos[] = {0, 1, 1};
+    const uint8_t window[] = {MQTT_MAX_INFLIGHT, 1, MQTT_MAX_INFLIGHT};
+    for (uint8_t i = 0; i < 3; i++) {
+        mqtt.setInflightWindow(window[i]);
+        float rate = mqttThroughput(mqtt, qos[i], MESSAGES);
+        if (rate > 0) {
+            bench.result(names[i], rate, "msg/s", BenchBetter::Higher, MESSAGES);
+        } else {
+            bench.skip(names[i], "broker connection lost");
+        }
+    }
+
+    mqtt.end();
+    Wireless.disconnectWiFi();
+}
+
+// ============================================================================
+// HTTP
+// ============================================================================
+
+const uint16_t BENCH_HTTP_PORT = 8081;
+const uint32_t BENCH_HTTP_STREAM_BYTES = 64 * 1024;
+
+void httpBenchOk(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.send(200, "text/plain", "ok\n");
+}
+
+size_t httpBenchSource(uint8_t* buf, size_t max, HttpStreamState& state) {
+    size_t n = BENCH_HTTP_STREAM_BYTES - state.cursor;
+    if (n > max) n = max;
+    memset(buf, 'x', n);
+    state.cursor += n;
+    return n;
+}
+
+void httpBenchStream(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.stream(200, "application/octet-stream", httpBenchSource);
+}
+
+// 16 route; "/bench" en sonda (en kötü eşleme)
+constexpr HttpRoute BENCH_HTTP_ROUTES[] = {
+    {HttpMethod::Get,  "/api/v1/status",    httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/config",    httpBenchOk},
+    {HttpMethod::Post, "/api/v1/config",    httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/scan",      httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/log",       httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/sensors",   httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/wifi",      httpBenchOk},
+    {HttpMethod::Post, "/api/v1/wifi",      httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/ble",       httpBenchOk},
+    {HttpMethod::Post, "/api/v1/reboot",    httpBenchOk},
+    {HttpMethod::Get,  "/api/v1/ota",       httpBenchOk},
+    {HttpMethod::Post, "/api/v1/ota",       httpBenchOk},
+    {HttpMethod::Get,  "/static/*",         httpBenchOk},
+    {HttpMethod::Get,  "/index.html",       httpBenchOk},
+    {HttpMethod::Get,  "/bench/stream",     httpBenchStream},
+    {HttpMethod::Get,  "/bench",            httpBenchOk},
+};
+
+static_assert(httpRoutesValid(BENCH_HTTP_ROUTES), "invalid bench route table");
+
+/**
+ * @brief İsteği yaz, cevabı al (keep-alive: "ok\n" body'si, close: FIN)
+ * @return Alınan byte (0: hata / zaman aşımı)
+ */
+uint32_t httpExchange(HttpServer& server, TcpSocket& client, const char* request, bool untilClose) {
+    unsigned long startMs = millis();
+    while (client.poll() == TcpState::Connecting) {
+        server.poll();
+    }
+    if (!client.isConnected() || client.write(reinterpret_cast<const uint8_t*>(request), strlen(request)) <= 0) {
+        return 0;
+    }
+
+    uint32_t received = 0;
+    char last = 0;
+    uint8_t buf[1024];
+    while (millis() - startMs < 5000) {
+        server.poll();
+        int n = client.read(buf, sizeof(buf));
+        if (n < 0) return untilClose ? received : 0;
+        if (n == 0) continue;
+        received += n;
+        // "k\n" sadece body sonunda geçer
+        if (!untilClose && buf[n - 1] == '\n' && (n > 1 ? buf[n - 2] : last) == 'k') return received;
+        last = static_cast<char>(buf[n - 1]);
+    }
+    return 0;
+}
+
+uint32_t httpClientDone = 0;
+
+void httpClientCount(const HttpClientResponse& res, void* user) {
+    (void)user;
+    if (res.done && res.status == 200) httpClientDone++;
+}
+
+/**
+ * @brief count GET isteği (tablo doldukça), req/s (0: hata / zaman aşımı)
+ */
+float httpClientRate(HttpServer& server, HttpClient& http, uint32_t count) {
+    const IPAddress loopback(127, 0, 0, 1);
+    uint32_t issued = 0;
+    httpClientDone = 0;
+    http.resetStats();
+    unsigned long startMs = millis();
+    uint32_t start = Profiler::ticks();
+
+    while (issued < count || !http.isIdle()) {
+        while (issued < count && http.get(loopback, BENCH_HTTP_PORT, "/bench", httpClientCount)) {
+            issued++;
+        }
+        http.poll();
+        server.poll();
+        if (millis() - startMs > 10000) return 0;
+    }
+    uint32_t ticks = Profiler::ticks() - start;
+    return httpClientDone == count ? count / ticksToSeconds(ticks) : 0;
+}
+
+void benchHttpClient(HttpServer& server) {
+    const uint32_t REQUESTS = 500;
+    static TcpPool pool;
+    static HttpClient http(pool);
+
+    const char* names[] = {"http_client_fresh", "http_client_keepalive", "http_client_pipelined"};
+    const bool keepAlive[] = {false, true, true};
+    const uint8_t depth[] = {1, 1, HTTP_CLIENT_PIPELINE_DEPTH};
+    for (uint8_t i = 0; i < 3; i++) {
+        http.setKeepAlive(keepAlive[i]);
+        http.setPipelineDepth(depth[i]);
+        float rate = httpClientRate(server, http, REQUESTS);
+        if (rate > 0) {
+            bench.result(names[i], rate, "req/s", BenchBetter::Higher, REQUESTS);
+        } else {
+            bench.skip(names[i], "request failed");
+        }
+    }
+
+    // Son faz (pipelined): handshake'siz giden istekler ve kazanılan süre
+    bench.result("http_client_reuse", http.getReuseRate(), "%", BenchBetter::Higher, REQUESTS);
+    bench.result("tcp_pool_connect", pool.getAverageConnectUs(), "us", BenchBetter::Lower,
+                 pool.getStats().connectSamples);
+    bench.result("tcp_pool_saved", http.getTimeSavedPerRequestUs(), "us/req", BenchBetter::Higher, REQUESTS);
+    pool.closeIdle();
+}
+
+void benchHttp() {
+    const uint32_t MATCH_CALLS = 10000;
+    const uint32_t KEEPALIVE_REQUESTS = 1000;
+    const uint32_t CLOSE_REQUESTS = 200;
+    const size_t routeCount = sizeof(BENCH_HTTP_ROUTES) / sizeof(BENCH_HTTP_ROUTES[0]);
+
+    volatile const HttpRoute* route = nullptr;
+    uint32_t start = Profiler::ticks();
+    for (uint32_t i = 0; i < MATCH_CALLS; i++) {
+        route = HttpServer::match(BENCH_HTTP_ROUTES, routeCount, HttpMethod::Get, "/bench", 6);
+    }
+    uint32_t ticks = Profiler::ticks() - start;
+    (void)route;
+    bench.result("http_route_match", Profiler::ticksToMicros(ticks) / MATCH_CALLS, "us",
+                 BenchBetter::Lower, MATCH_CALLS);
+
+    const char* names[] = {"http_requests_keepalive", "http_requests_close", "http_stream",
+                           "http_client_fresh", "http_client_keepalive", "http_client_pipelined",
+                           "http_client_reuse", "tcp_pool_connect", "tcp_pool_saved"};
+    if (strlen(BENCH_WIFI_SSID) == 0) {
+        for (const char* name : names) bench.skip(name, "BENCH_WIFI_SSID not set");
+        return;
+    }
+
+    static HttpServer server;
+    const char* pass = strlen(BENCH_WIFI_PASS) > 0 ? BENCH_WIFI_PASS : nullptr;
+    if (!Wireless.connectWiFi(BENCH_WIFI_SSID, pass, WIFI_CONNECT_TIMEOUT) ||
+        !server.begin(BENCH_HTTP_PORT, BENCH_HTTP_ROUTES)) {
+        for (const char* name : names) bench.skip(name, "server start failed");
+        Wireless.disconnectWiFi();
+        return;
+    }
+
+    const IPAddress loopback(127, 0, 0, 1);
+    TcpSocket client;
+
+    // Ardışık istekler; sunucu HTTP_MAX_KEEPALIVE_REQUESTS'te kapatınca yeni bağlantı
+    uint32_t done = 0;
+    start = Profiler::ticks();
+    while (done < KEEPALIVE_REQUESTS) {
+        if (done % HTTP_MAX_KEEPALIVE_REQUESTS == 0) {
+            client.close();
+            if (!client.connect(loopback, BENCH_HTTP_PORT)) break;
+        }
+        if (httpExchange(server, client, "GET /bench HTTP/1.1\r\nHost: bench\r\n\r\n", false) == 0) break;
+        done++;
+    }
+    ticks = Profiler::ticks() - start;
+    client.close();
+    if (done == KEEPALIVE_REQUESTS) {
+        bench.result(names[0], done / ticksToSeconds(ticks), "req/s", BenchBetter::Higher, done);
+    } else {
+        bench.skip(names[0], "request failed");
+    }
+
+    // İstek başına yeni bağlantı
+    done = 0;
+    start = Profiler::ticks();
+    while (done < CLOSE_REQUESTS && client.connect(loopback, BENCH_HTTP_PORT) &&
+           httpExchange(server, client, "GET /bench HTTP/1.1\r\nHost: bench\r\nConnection: close\r\n\r\n", true) > 0) {
+        client.close();
+        done++;
+    }
+    ticks = Profiler::ticks() - start;
+    client.close();
+    if (done == CLOSE_REQUESTS) {
+        bench.result(names[1], done / ticksToSeconds(ticks), "req/s", BenchBetter::Higher, done);
+    } else {
+        bench.skip(names[1], "request failed");
+    }
+
+    // Chunked body
+    uint32_t received = 0;
+    start = Profiler::ticks();
+    if (client.connect(loopback, BENCH_HTTP_PORT)) {
+        received = httpExchange(server, client, "GET /bench/stream HTTP/1.1\r\nHost: bench\r\nConnection: close\r\n\r\n", true);
+    }
+    ticks = Profiler::ticks() - start;
+    client.close();
+    if (received > BENCH_HTTP_STREAM_BYTES) {
+        bench.result(names[2], BENCH_HTTP_STREAM_BYTES / 1024.0f / ticksToSeconds(ticks), "KiB/s",
+                     BenchBetter::Higher, server.getStats().chunks);
+    } else {
+        bench.skip(names[2], "stream incomplete");
+    }
+
+    benchHttpClient(server);
+    server.end();
+    Wireless.disconnectWiFi();
+}
+
+// ============================================================================
+// TLS
+// ============================================================================
+
+const uint16_t BENCH_TLS_PORT = 8443;
+
+/**
+ * @brief Bağlan, handshake'i bitir, kapat
+ */
+bool tlsHandshake(TlsClient& tls, const IPAddress& server) {
+    if (!tls.connect(server, BENCH_TLS_PORT, BENCH_TLS_NAME)) return false;
+    TlsState state;
+    while ((state = tls.poll()) == TlsState::Connecting || state == TlsState::Handshaking) {
+    }
+    tls.close();
+    return state == TlsState::Connected;
+}
+
+void benchTls() {
+    const uint32_t HANDSHAKES = 20;
+    const char* names[] = {"tls_handshake_full", "tls_handshake_resumed",
+                           "tls_handshake_bytes_full", "tls_handshake_bytes_resumed"};
+
+    IPAddress server;
+    if (strlen(BENCH_TLS_SERVER) == 0 || strlen(BENCH_WIFI_SSID) == 0 || !server.fromString(BENCH_TLS_SERVER)) {
+        for (const char* name : names) bench.skip(name, "BENCH_TLS_SERVER not set");
+        return;
+    }
+
+    const char* pass = strlen(BENCH_WIFI_PASS) > 0 ? BENCH_WIFI_PASS : nullptr;
+    static TlsSessionCache sessions;
+    static TlsClient tls;
+    if (!Wireless.connectWiFi(BENCH_WIFI_SSID, pass, WIFI_CONNECT_TIMEOUT) || !tls.begin(nullptr, &sessions)) {
+        for (const char* name : names) bench.skip(name, "setup failed");
+        Wireless.disconnectWiFi();
+        return;
+    }
+
+    // Resumption kapalı: her bağlantı tam handshake
+    tls.setResumption(false);
+    uint32_t done = 0;
+    while (done < HANDSHAKES && tlsHandshake(tls, server)) done++;
+    if (done < HANDSHAKES) {
+        for (const char* name : names) bench.skip(name, "server handshake failed");
+        tls.end();
+        Wireless.disconnectWiFi();
+        return;
+    }
+    const TlsStats& s = tls.getStats();
+    bench.result(names[0], tls.getAverageFullUs(), "us", BenchBetter::Lower, s.fullHandshakes);
+    bench.result(names[2], s.fullBytesSum / s.fullHandshakes, "B", BenchBetter::Lower, s.fullHandshakes);
+
+    // Her handshake'ten önce uyanış: oturum flash'tan okunur
+    tls.setResumption(true);
+    tlsHandshake(tls, server);
+    tls.resetStats();
+    done = 0;
+    while (done < HANDSHAKES) {
+        tls.end();
+        sessions.forget();
+        if (!tls.begin(nullptr, &sessions) || !tlsHandshake(tls, server)) break;
+        done++;
+    }
+    if (done == HANDSHAKES && s.resumedHandshakes > 0) {
+        bench.result(names[1], tls.getAverageResumedUs(), "us", BenchBetter::Lower, s.resumedHandshakes);
+        bench.result(names[3], s.resumedBytesSum / s.resumedHandshakes, "B", BenchBetter::Lower,
+                     s.resumedHandshakes);
+    } else {
+        bench.skip(names[1], "session not resumed");
+        bench.skip(names[3], "session not resumed");
+    }
+
+    tls.end();
+    Wireless.disconnectWiFi();
+}
+
+// ============================================================================
+// OTA
+// ============================================================================
+
+void benchOta() {
+    const uint32_t IMAGE_SIZE = 128 * 1024;
+    const size_t CHUNK = 1460;     // TCP segmenti gibi
+    static OtaUpdater ota;
+
+    // Hash bilerek yanlış: tüm yol (silme, programlama, readback, SHA-256)
+    // çalışır ama doğrulama başarısız olur, çalışan bank değişmez
+    uint8_t wrong[OTA_HASH_SIZE];
+    memset(wrong, 0, sizeof(wrong));
+    if (!ota.begin(IMAGE_SIZE, wrong)) {
+        bench.skip("ota_stream", "begin failed");
+        bench.skip("ota_stream_total", "begin failed");
+        bench.skip("ota_buffer_flush", "begin failed");
+        return;
+    }
+
+    uint8_t chunk[CHUNK];
+    uint32_t offset = 0;
+    uint32_t x = 0x12345678;
+    while (ota.isActive()) {
+        if (offset < IMAGE_SIZE) {
+            size_t len = IMAGE_SIZE - offset < CHUNK ? IMAGE_SIZE - offset : CHUNK;
+            for (size_t i = 0; i < len; i++) {
+                uint32_t at = offset + i;
+                x = x * 1664525UL + 1013904223UL;
+                chunk[i] = at < OTA_SIGNATURE_SIZE ? "81958711"[at] :
+                           at < IMAGE_SIZE * 3 / 4 ? static_cast<uint8_t>(x >> 24) : 0xFF;
+            }
+            // Buffer'lar doluysa kalan byte'lar writer'ı bekler
+            size_t done = 0;
+            while (done < len && ota.isActive()) {
+                done += ota.write(chunk + done, len - done);
+                if (done < len) ota.poll();
+            }
+            offset += len;
+        }
+        ota.poll();
+    }
+
+    const OtaStats& s = ota.getStats();
+    if (ota.getError() != OtaError::HashMismatch || s.bytesWritten != IMAGE_SIZE) {
+        bench.skip("ota_stream", OtaUpdater::errorToString(ota.getError()));
+        bench.skip("ota_stream_total", OtaUpdater::errorToString(ota.getError()));
+        bench.skip("ota_buffer_flush", OtaUpdater::errorToString(ota.getError()));
+        return;
+    }
+    bench.result("ota_stream", ota.getThroughput() / 1024.0f, "KiB/s", BenchBetter::Higher, IMAGE_SIZE / CHUNK);
+    bench.result("ota_stream_total", s.totalMs, "ms", BenchBetter::Lower, 1);
+    bench.result("ota_buffer_flush", s.flashBusyUs / s.buffersFlushed, "us", BenchBetter::Lower, s.buffersFlushed);
+}
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+void benchMemory() {
+#if defined(RTL8720_HOST)
+    bench.skip("heap_free", "not measured on host");
+    bench.skip("stack_free", "not measured on host");
+#else
+    bench.result("heap_free", Hardware.getFreeHeap(), "B", BenchBetter::Higher, 1);
+    bench.result("heap_min_free", Hardware.getMinFreeHeap(), "B", BenchBetter::Higher, 1);
+    bench.result("stack_free", Hardware.getStackHighWaterMark(), "B", BenchBetter::Higher, 1);
+#endif
+}
+
+// ============================================================================
+// Sketch
+// ============================================================================
+
+#if defined(RTL8720_HOST)
+void setupHostScenario() {
+    hostsim::wifiAddNetwork({"BenchNet", {0x02, 0x00, 0x00, 0x00, 0x00, 0x01}, -48, 36, 3});
+    hostsim::wifiAddNetwork({"Neighbor-2G", {0x02, 0x00, 0x00, 0x00, 0x00, 0x02}, -71, 6, 4});
+    hostsim::wifiAddNetwork({"Guest", {0x02, 0x00, 0x00, 0x00, 0x00, 0x03}, -83, 11, 0});
+    hostsim::wifiSetConnectScript("BenchNet", {1200, 300, true, {192, 168, 1, 100}});
+}
+#endif
+
+void setup() {
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
+    Profiler::getInstance().begin();
+    wifi.beginStation();
+
+    bench.begin("lib_bench");
+    benchSerialTx();
+    benchSerialRx();
+    benchLogPrintf();
+    benchAdc();
+    benchLed();
+    benchRgbLed();
+    benchWiFiScan();
+    benchWiFiScanBand();
+    benchWiFiScanAsync();
+    benchApHistory();
+    benchBleAdvertising();
+    benchBleScan();
+    benchBleStream();
+    benchCoex();
+    benchUdpTelemetry();
+    benchWiFiConnect();
+    benchWiFiReconnect();
+    benchMqtt();
+    benchHttp();
+    benchTls();
+    benchOta();
+    benchMemory();
+    bench.end();
+}
+
+void loop() {
+    delay(1000);
+}
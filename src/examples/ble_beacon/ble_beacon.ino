@@ -0,0 +1,150 @@
+/**
+ * @file ble_beacon.ino
+ * @brief Rotating iBeacon / Eddystone beacon with live sensor telemetry
+ *
+ * Non-connectable advertising ile üç payload sırayla yayınlanır:
+ * - Eddystone-UID (sabit kimlik)
+ * - Eddystone-TLM (ADC'den okunan sensör, her sırasında yeniden encode)
+ * - iBeacon (minor = buton basma sayısı, updateRotatingPayload ile)
+ *
+ * Payload'lar advertising durdurulmadan değiştirilir (le_adv_update_param).
+ * 60. saniyede aralık 100 ms'den 1000 ms'ye çıkarılır: keşif gecikmesi
+ * artar, radyo duty cycle'ı düşer.
+ *
+ * Her STATUS_MS'de aralık, duty cycle tahmini ve rotation sayaçları yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <BleModule.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const uint8_t BEACON_NAMESPACE[10] = {0xED, 0xD1, 0xEB, 0xEA, 0xC0, 0x4E, 0x5D, 0xEF, 0xA0, 0x17};
+const uint8_t BEACON_INSTANCE[6] = {0x87, 0x20, 0x00, 0x00, 0x00, 0x01};
+const uint8_t IBEACON_UUID[16] = {
+    0xE2, 0xC5, 0x6D, 0xB5, 0xDF, 0xFB, 0x48, 0xD2,
+    0xB0, 0x60, 0xD0, 0xF5, 0xA7, 0x10, 0x96, 0xE0
+};
+
+// 1 m'de ölçülen RSSI; Eddystone 0 m değeri = +41 dB
+const int8_t MEASURED_POWER = -59;
+
+const uint16_t DWELL_MS = 1000;
+const unsigned long STATUS_MS = 20000;
+const unsigned long SLOW_AT = 60000;
+
+BleModule ble;
+
+int ibeaconSlot = -1;
+uint16_t eventsSeen = 0;
+unsigned long lastStatus = 0;
+bool slow = false;
+
+// TLM: ADC ham değerinden örnek sıcaklık (8.8 fixed point) ve pil gerilimi
+bool encodeTelemetry(BleAdvPayload& payload, void* user) {
+    BleModule* module = static_cast<BleModule*>(user);
+    int raw = Hardware.readAdc(0);
+    int16_t temperatureQ8 = static_cast<int16_t>((200 + raw / 32) * 256 / 10);
+    return payload.setEddystoneTlm(3000, temperatureQ8,
+                                   module->getAdvertisingEventCount(),
+                                   millis() / 100);
+}
+
+void updateIBeacon() {
+    BleAdvPayload payload;
+    payload.setIBeacon(IBEACON_UUID, 1, eventsSeen, MEASURED_POWER);
+    ble.updateRotatingPayload(ibeaconSlot, payload);
+}
+
+void printHex(const char* label, const uint8_t* data, uint8_t length) {
+    serialManager.logPrintf("[App] %s (%u):", label, length);
+    for (uint8_t i = 0; i < length; i++) {
+        serialManager.logPrintf(" %02X", data[i]);
+    }
+    DEBUG_SERIAL.println();
+}
+
+void printStatus() {
+    ble.printStatus();
+#if defined(RTL8720_HOST)
+    uint8_t data[BLE_ADV_MAX_LEN];
+    uint8_t length = hostsim::bleAdvData(data);
+    printHex("controller", data, length);
+    serialManager.logPrintf("[App] le_adv_start %lu, le_adv_update_param %lu\n",
+                            (unsigned long)hostsim::bleAdvStartCount(),
+                            (unsigned long)hostsim::bleAdvUpdateCount());
+#endif
+}
+
+#if defined(RTL8720_HOST)
+int sensorWave(uint8_t pin, uint64_t timeUs) {
+    // Yavaş değişen sensör: 0..1023 arası 40 s periyot
+    uint64_t phase = (timeUs / 1000) % 40000;
+    return static_cast<int>(phase < 20000 ? phase * 1023 / 20000 : (40000 - phase) * 1023 / 20000);
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::setAdcSource(PIN_ADC0, sensorWave);
+    // Buton yerine: her 15 s'de bir "olay"
+    hostsim::scheduleEvery(15ULL * 1000000, [] {
+        eventsSeen++;
+        updateIBeacon();
+    }, "ibeacon_minor");
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    ble.begin("RTL8720-Beacon");
+    ble.setAdvertisingMode(BleAdvMode::NonConnectable);
+    ble.setAdvertisingInterval(100);
+
+    BleAdvPayload uid;
+    uid.setEddystoneUid(BEACON_NAMESPACE, BEACON_INSTANCE, MEASURED_POWER + 41);
+    printHex("Eddystone-UID", uid.data(), uid.length());
+    ble.addRotatingPayload(uid, DWELL_MS);
+
+    ble.addRotatingPayload(encodeTelemetry, &ble, DWELL_MS);
+
+    BleAdvPayload ibeacon;
+    ibeacon.setIBeacon(IBEACON_UUID, 1, eventsSeen, MEASURED_POWER);
+    printHex("iBeacon", ibeacon.data(), ibeacon.length());
+    ibeaconSlot = ble.addRotatingPayload(ibeacon, DWELL_MS);
+
+    BleAdvPayload url;
+    if (url.setEddystoneUrl("https://www.example.com/b", MEASURED_POWER + 41)) {
+        printHex("Eddystone-URL", url.data(), url.length());
+    }
+
+    ble.startAdvertising();
+}
+
+void loop() {
+    ble.poll();
+
+    unsigned long now = millis();
+    if (!slow && now >= SLOW_AT) {
+        slow = true;
+        ble.setAdvertisingInterval(1000);
+        serialManager.logPrintf("[App] Interval -> %u ms, duty %lu ppm\n",
+                                ble.getAdvertisingInterval(),
+                                (unsigned long)ble.getAdvertisingDutyPpm());
+    }
+
+    if (now - lastStatus >= STATUS_MS) {
+        lastStatus = now;
+        printStatus();
+    }
+
+    delay(10);
+}
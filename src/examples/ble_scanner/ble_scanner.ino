@@ -0,0 +1,166 @@
+/**
+ * @file ble_scanner.ino
+ * @brief BLE gateway: continuous scan with bounded result cache
+ *
+ * Central rolünde sürekli (window = interval) active tarama yapılır. Raporlar
+ * BleScanCache'te adres bazında toplanır:
+ * - Sadece Eddystone (UUID 0xFEAA) ve -90 dBm üstü raporlar kabul edilir
+ * - Bilinen tag'in tekrar raporları sadece RSSI'ı yumuşatır (log yok)
+ * - Yeni tag: Found, LOST_AFTER_MS boyunca duyulmayan tag: Lost
+ *
+ * Host senaryosu: ~200 advertiser (80 Eddystone tag + iBeacon'lar + telefonlar).
+ * 20. saniyede 20 tag kapsama dışına çıkar; ~LOST_AFTER_MS sonra Lost olur.
+ *
+ * Her STATUS_MS'de cache doluluğu, filtre / duplicate sayaçları ve en güçlü
+ * tag yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <BleModule.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#include <gap_scan.h>
+#endif
+
+const uint32_t LOST_AFTER_MS = 10000;
+const unsigned long STATUS_MS = 15000;
+
+BleModule ble;
+
+unsigned long lastStatus = 0;
+
+void printAddr(const uint8_t addr[6]) {
+    // bd_addr LSB first; MSB first yazdırılır
+    serialManager.logPrintf("%02X:%02X:%02X:%02X:%02X:%02X",
+                            addr[5], addr[4], addr[3], addr[2], addr[1], addr[0]);
+}
+
+void onTag(const BleScanDevice& device, BleScanEvent event, void* user) {
+    (void)user;
+    serialManager.logPrintf("[App] %s ", BleScanCache::eventToString(event));
+    printAddr(device.addr);
+    if (event == BleScanEvent::Found) {
+        serialManager.logPrintf(" %d dBm\n", device.rssi);
+    } else {
+        serialManager.logPrintf(" after %lu ms, %lu reports\n",
+                                (unsigned long)(device.lastSeenMs - device.firstSeenMs),
+                                (unsigned long)device.reports);
+    }
+}
+
+void findStrongest(const BleScanDevice& device, void* user) {
+    const BleScanDevice** best = static_cast<const BleScanDevice**>(user);
+    if (*best == nullptr || device.rssi > (*best)->rssi) *best = &device;
+}
+
+void printStatus() {
+    ble.printStatus();
+
+    const BleScanDevice* best = nullptr;
+    ble.getScanCache().forEach(findStrongest, &best);
+    if (best != nullptr) {
+        serialManager.logPrintf("[App] Strongest: ");
+        printAddr(best->addr);
+        serialManager.logPrintf(" \"%s\" %d dBm (last %d), %lu reports\n",
+                                best->name, best->rssi, best->lastRssi,
+                                (unsigned long)best->reports);
+    }
+#if defined(RTL8720_HOST)
+    serialManager.logPrintf("[App] Controller reports: %lu\n",
+                            (unsigned long)hostsim::bleScanReportCount());
+#endif
+}
+
+#if defined(RTL8720_HOST)
+void addScriptedDevices() {
+    const uint8_t ns[10] = {0xED, 0xD1, 0xEB, 0xEA, 0xC0, 0x4E, 0x5D, 0xEF, 0xA0, 0x17};
+    const uint8_t uuid[16] = {0};
+
+    for (uint8_t i = 0; i < 200; i++) {
+        hostsim::ScriptedBleDevice d = {};
+        d.addr[0] = i;
+        d.addr[1] = static_cast<uint8_t>(i * 37);
+        d.addr[5] = 0xC0;
+        d.addrType = GAP_REMOTE_ADDR_LE_RANDOM;
+        d.rssi = static_cast<int8_t>(-50 - (i * 7) % 50);
+
+        BleAdvPayload payload;
+        if (i < 80) {
+            // Eddystone-UID tag, scan response'ta ad
+            uint8_t instance[6] = {0, 0, 0, 0, 0, i};
+            payload.setEddystoneUid(ns, instance, -18);
+            d.advType = GAP_ADV_EVT_TYPE_SCANNABLE;
+            d.intervalMs = static_cast<uint16_t>(100 + (i % 10) * 100);
+
+            BleAdvPayload rsp;
+            char name[12];
+            snprintf(name, sizeof(name), "tag-%02u", i);
+            rsp.addName(name);
+            memcpy(d.scanRsp, rsp.data(), rsp.length());
+            d.scanRspLen = rsp.length();
+        } else if (i < 150) {
+            payload.setIBeacon(uuid, 1, i, -59);
+            d.advType = GAP_ADV_EVT_TYPE_NON_CONNECTABLE;
+            d.intervalMs = 200;
+        } else {
+            // Telefon / bilgisayar: Microsoft CDP benzeri manufacturer data
+            const uint8_t cdp[4] = {0x01, 0x09, 0x20, 0x02};
+            payload.addFlags();
+            payload.addManufacturerData(0x0006, cdp, sizeof(cdp));
+            d.advType = GAP_ADV_EVT_TYPE_UNDIRECTED;
+            d.intervalMs = 250;
+        }
+        memcpy(d.data, payload.data(), payload.length());
+        d.dataLen = payload.length();
+        hostsim::bleAddDevice(d);
+    }
+
+    // 20 tag kapsama dışına çıkar
+    hostsim::scheduleAfter(20ULL * 1000000, [] {
+        for (uint8_t i = 0; i < 20; i++) {
+            uint8_t addr[6] = {i, static_cast<uint8_t>(i * 37), 0, 0, 0, 0xC0};
+            hostsim::bleRemoveDevice(addr);
+        }
+        DEBUG_SERIAL.println("[Sim] 20 tags out of range");
+    }, "tags_leave");
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    addScriptedDevices();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    ble.begin("RTL8720-Gateway", BleRole::Central);
+
+    BleScanCache& cache = ble.getScanCache();
+    cache.setFilter({BLE_UUID16_EDDYSTONE, BLE_SCAN_ANY_COMPANY, -90});
+    cache.setMaxAge(LOST_AFTER_MS);
+    cache.onDevice(onTag);
+
+    BleScanConfig config = BleModule::defaultScanConfig();
+    config.mode = BleScanMode::Active;
+    ble.beginScan(config);
+}
+
+void loop() {
+    ble.poll();
+
+    unsigned long now = millis();
+    if (now - lastStatus >= STATUS_MS) {
+        lastStatus = now;
+        printStatus();
+    }
+
+    delay(10);
+}
@@ -0,0 +1,192 @@
+/**
+ * @file ble_stream.ino
+ * @brief Bulk sensor log streaming over GATT notifications (DLE + 2M PHY)
+ *
+ * Peripheral, bağlanılabilir advertising yapar; bağlantı kurulunca DLE
+ * (251 byte LL payload) ve 2M PHY ister. Karşı taraf stream
+ * characteristic'ine abone olunca 32 byte'lık sensör kayıtları stream'e
+ * yazılır ve poll() içinde MTU boyutunda frame'ler halinde, controller'ın
+ * boş buffer'ı (credit) kadar gönderilir.
+ *
+ * Her STATUS_MS'de link parametreleri, ölçülen throughput ve link
+ * parametrelerinden hesaplanan teorik tahmin yazdırılır.
+ *
+ * Host senaryosu:
+ * - 2. s: modern telefon bağlanır (MTU 247, DLE 251, 2M, 15 ms interval)
+ * - 10. s: telefon RX characteristic'ine komut yazar
+ * - 20. s: bağlantı kesilir, advertising yeniden başlar
+ * - 22. s: eski telefon bağlanır (MTU 23, DLE yok, 1M, 30 ms interval)
+ * Telefon tarafı notification'ları BleStreamRx ile açar, kayıt sıra
+ * numaralarını doğrular.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <EventBus.h>
+#include <BleModule.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const unsigned long STATUS_MS = 5000;
+const uint8_t SAMPLES_PER_RECORD = 13;
+
+// 32 byte: sıra numarası + zaman + 13 örnek
+struct SensorRecord {
+    uint32_t seq;
+    uint16_t timeMs;
+    int16_t samples[SAMPLES_PER_RECORD];
+};
+
+static_assert(sizeof(SensorRecord) == 32, "record must be 32 bytes");
+
+BleModule ble;
+
+uint32_t recordSeq = 0;
+unsigned long lastStatus = 0;
+
+void fillRecord(SensorRecord& record) {
+    record.seq = recordSeq++;
+    record.timeMs = static_cast<uint16_t>(millis());
+    int raw = Hardware.readAdc(0);
+    for (uint8_t i = 0; i < SAMPLES_PER_RECORD; i++) {
+        record.samples[i] = static_cast<int16_t>(raw + i);
+    }
+}
+
+void onBleEvent(const Event& event, void* user) {
+    (void)user;
+    switch (static_cast<BleEventCode>(event.code)) {
+        case BleEventCode::LinkUpdated:
+            serialManager.logPrintf("[App] Link: MTU %lu, LL %lu bytes, %luM PHY, estimate %lu B/s\n",
+                                    (unsigned long)event.arg, (unsigned long)(event.value & 0xFFFF),
+                                    (unsigned long)(event.value >> 16),
+                                    (unsigned long)ble.getStreamEstimate());
+            break;
+        case BleEventCode::StreamSubscribed:
+            serialManager.logPrintf("[App] Stream %s\n", event.arg ? "subscribed" : "unsubscribed");
+            break;
+        default:
+            break;
+    }
+}
+
+#if defined(RTL8720_HOST)
+// Telefon tarafı: notification'ları açıp kayıtları doğrular
+BleStreamRx phoneRx;
+uint32_t phoneRecords = 0;
+uint32_t phoneSeqErrors = 0;
+uint32_t phoneExpected = 0;
+bool phoneSynced = false;
+uint64_t phoneBytesAtStatus = 0;
+
+void phoneDrain() {
+    uint8_t frame[BLE_STREAM_MAX_FRAME];
+    uint16_t length;
+    while (hostsim::blePeerPopNotification(frame, &length)) {
+        phoneRx.onFrame(frame, length);
+    }
+
+    SensorRecord record;
+    while (phoneRx.available() >= sizeof(record)) {
+        phoneRx.read(reinterpret_cast<uint8_t*>(&record), sizeof(record));
+        if (phoneSynced && record.seq != phoneExpected) phoneSeqErrors++;
+        phoneSynced = true;
+        phoneExpected = record.seq + 1;
+        phoneRecords++;
+    }
+}
+
+int sensorWave(uint8_t pin, uint64_t timeUs) {
+    (void)pin;
+    return static_cast<int>((timeUs / 1000) % 1024);
+}
+#endif
+
+void printStatus() {
+    ble.printStatus();
+#if defined(RTL8720_HOST)
+    uint64_t bytes = hostsim::blePeerNotificationBytes();
+    serialManager.logPrintf("[App] Phone: %lu B/s, %lu notifications, %lu records, "
+                            "%lu seq errors, %lu lost frames\n",
+                            (unsigned long)((bytes - phoneBytesAtStatus) * 1000 / STATUS_MS),
+                            (unsigned long)hostsim::blePeerNotificationCount(),
+                            (unsigned long)phoneRecords, (unsigned long)phoneSeqErrors,
+                            (unsigned long)phoneRx.getStats().lostFrames);
+    phoneBytesAtStatus = bytes;
+#endif
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::setAdcSource(PIN_ADC0, sensorWave);
+    hostsim::scheduleEvery(5000, phoneDrain, "phone_drain");
+
+    hostsim::scheduleAfter(2ULL * 1000000, [] {
+        hostsim::BlePeerScript phone = {247, 251, true, 15000, 0, 500};
+        hostsim::blePeerConnect(phone);
+    }, "phone_connect");
+    hostsim::scheduleAfter(10ULL * 1000000, [] {
+        const char command[] = "MARK";
+        // Komut frame'i: [seq][payload]
+        uint8_t frame[1 + sizeof(command) - 1];
+        frame[0] = 0;
+        memcpy(&frame[1], command, sizeof(command) - 1);
+        hostsim::blePeerWrite(frame, sizeof(frame));
+    }, "phone_command");
+    hostsim::scheduleAfter(20ULL * 1000000, [] {
+        phoneDrain();
+        hostsim::blePeerDisconnect();
+        phoneRx.reset();
+        phoneSynced = false;
+    }, "phone_disconnect");
+    hostsim::scheduleAfter(22ULL * 1000000, [] {
+        hostsim::BlePeerScript legacy = {23, 27, false, 30000, 0, 500};
+        hostsim::blePeerConnect(legacy);
+    }, "legacy_connect");
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Events.subscribe(EVENT_SOURCE_MASK(EventSource::Ble), onBleEvent);
+
+    ble.begin("RTL8720-Stream");
+    ble.setAdvertisingMode(BleAdvMode::Connectable);
+    ble.startAdvertising();
+}
+
+void loop() {
+    ble.poll();
+    Events.dispatch();
+
+    // Abone varken ring'i kayıtlarla dolu tut
+    if (ble.isStreamReady()) {
+        SensorRecord record;
+        while (ble.getStream().space() >= sizeof(record)) {
+            fillRecord(record);
+            ble.streamWrite(reinterpret_cast<const uint8_t*>(&record), sizeof(record));
+        }
+    }
+
+    if (ble.streamAvailable() > 0) {
+        char command[32];
+        size_t length = ble.streamRead(reinterpret_cast<uint8_t*>(command), sizeof(command) - 1);
+        command[length] = '\0';
+        serialManager.logPrintf("[App] Command: %s\n", command);
+    }
+
+    unsigned long now = millis();
+    if (now - lastStatus >= STATUS_MS) {
+        lastStatus = now;
+        printStatus();
+    }
+
+    delay(1);
+}
@@ -0,0 +1,268 @@
+/**
+ * @file ble_stream_frames.ino
+ * @brief BleStream framing self-check: fragmentation, reassembly and credits
+ *
+ * Radyo kullanılmaz: BleStreamTx'in frame'leri send callback'inde doğrudan
+ * BleStreamRx'e verilir. Her senaryo sonunda PASS / FAIL yazdırılır:
+ * - Fragmentation : MTU 23 / 185 / 247 ile tek sayılı kayıtlar; her frame
+ *                   tam boy veya kısa frame olarak sayılmış olmalı, karşı
+ *                   tarafta birleştirilen byte'lar yazılanla aynı olmalı
+ * - Credits       : pump() credit'ten fazla frame göndermemeli, credit
+ *                   yokken veri ring'de kalıp stall sayılmalı
+ * - Rejects       : controller'ın reddettiği frame kaybolmamalı, sıra
+ *                   numarası atlamamalı (sendErrors sayılır)
+ * - Lost frames   : link'te düşürülen frame'ler RX'te lostFrames olmalı
+ * - Flush         : kısa kuyruk BLE_STREAM_FLUSH_MS dolmadan gönderilmemeli
+ * - Ring / restart: dolu ring kısmi kabul etmeli, restart() bekleyeni atıp
+ *                   sıra numarasını sıfırlamalı
+ *
+ * SDK'dan bağımsızdır; cihazda ve host build'de aynı çıktıyı verir.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <SerialManager.h>
+#include <BleStream.h>
+
+const size_t RECORD_SIZE = 37;          // Frame payload'ına tam bölünmesin
+const uint32_t STREAM_BYTES = 20000;    // Ring'den büyük: sarma da test edilir
+
+// Link: TX frame'lerini RX'e taşır, reddedip düşürebilir
+struct Link {
+    BleStreamRx* rx;
+    uint16_t maxFrame;          // Header dahil
+    uint8_t rejectEvery;        // N. çağrıyı reddet (0: hiç)
+    uint8_t dropEvery;          // N. kabul edilen frame'i RX'e verme (0: hiç)
+    uint32_t calls;
+    uint32_t accepted;
+    uint32_t rejected;
+    uint32_t dropped;
+    uint32_t oversize;          // maxFrame'den büyük frame
+    uint32_t overCredit;        // Credit'ten fazla frame gönderen pump()
+    uint32_t bytes;             // RX'e verilen payload
+};
+
+BleStreamTx tx;
+BleStreamRx rx;
+uint8_t failures = 0;
+
+uint8_t patternAt(uint32_t position) {
+    return static_cast<uint8_t>(position * 31 + (position >> 8));
+}
+
+bool linkSend(const uint8_t* frame, uint16_t length, void* user) {
+    Link* link = static_cast<Link*>(user);
+    link->calls++;
+    if (link->rejectEvery && link->calls % link->rejectEvery == 0) {
+        link->rejected++;
+        return false;
+    }
+    link->accepted++;
+    if (length > link->maxFrame) link->oversize++;
+    if (link->dropEvery && link->accepted % link->dropEvery == 0) {
+        link->dropped++;
+        return true;
+    }
+    link->bytes += length - BLE_STREAM_FRAME_HEADER;
+    link->rx->onFrame(frame, length);
+    return true;
+}
+
+void check(const char* name, bool ok) {
+    if (!ok) failures++;
+    serialManager.logPrintf("[Check] %-34s %s\n", name, ok ? "PASS" : "FAIL");
+}
+
+void resetLink(Link& link, uint16_t mtu) {
+    memset(&link, 0, sizeof(link));
+    link.rx = &rx;
+    link.maxFrame = mtu - BLE_STREAM_ATT_HEADER;
+    tx.reset();
+    tx.setMtu(mtu);
+    rx.reset();
+}
+
+/**
+ * @brief STREAM_BYTES'ı RECORD_SIZE'lık yazmalarla gönder, RX'i doğrulayarak boşalt
+ * @param credits pump() başına credit
+ * @param mismatches RX'te beklenen desenden farklı byte (output)
+ * @return RX'ten okunan byte
+ */
+uint32_t runStream(Link& link, uint16_t credits, uint32_t& mismatches) {
+    uint8_t record[RECORD_SIZE];
+    uint8_t out[256];
+    uint32_t written = 0;
+    uint32_t received = 0;
+    mismatches = 0;
+
+    for (uint32_t round = 0; round < 100000; round++) {
+        while (written < STREAM_BYTES && tx.space() >= RECORD_SIZE) {
+            size_t len = STREAM_BYTES - written < RECORD_SIZE ? STREAM_BYTES - written : RECORD_SIZE;
+            for (size_t i = 0; i < len; i++) record[i] = patternAt(written + i);
+            written += tx.write(record, len);
+        }
+        // Yazılan bitince son kısa frame'in gitmesi için flush süresi geçirilir
+        unsigned long now = millis();
+        if (written == STREAM_BYTES) now += BLE_STREAM_FLUSH_MS;
+
+        if (tx.pump(now, credits, linkSend, &link) > credits) link.overCredit++;
+
+        size_t n;
+        while ((n = rx.read(out, sizeof(out))) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (out[i] != patternAt(received + i)) mismatches++;
+            }
+            received += n;
+        }
+        if (written == STREAM_BYTES && tx.pending() == 0 && rx.available() == 0) break;
+    }
+    return received;
+}
+
+void checkFragmentation(uint16_t mtu) {
+    Link link;
+    resetLink(link, mtu);
+    uint32_t mismatches;
+    uint32_t received = runStream(link, 4, mismatches);
+
+    const BleStreamStats& s = tx.getStats();
+    uint32_t payload = tx.getFramePayload();
+    uint32_t fullFrames = STREAM_BYTES / payload;
+
+    serialManager.logPrintf("[Check] MTU %u: %lu frames (%lu short) of %lu bytes, %lu received\n",
+                            mtu, (unsigned long)s.frames, (unsigned long)s.shortFrames,
+                            (unsigned long)payload, (unsigned long)received);
+
+    char name[40];
+    snprintf(name, sizeof(name), "fragment MTU %u frame size", mtu);
+    check(name, link.oversize == 0 && link.overCredit == 0 &&
+                payload + BLE_STREAM_FRAME_HEADER == link.maxFrame);
+    snprintf(name, sizeof(name), "fragment MTU %u full frames", mtu);
+    check(name, s.frames - s.shortFrames == fullFrames && s.shortFrames == (STREAM_BYTES % payload ? 1u : 0u) &&
+                s.bytes == STREAM_BYTES);
+    snprintf(name, sizeof(name), "reassemble MTU %u", mtu);
+    check(name, received == STREAM_BYTES && mismatches == 0 && rx.getStats().lostFrames == 0 &&
+                rx.getStats().bytes == STREAM_BYTES);
+}
+
+void checkCredits() {
+    Link link;
+    resetLink(link, BLE_STREAM_MAX_MTU);
+    uint8_t data[1000];
+    for (size_t i = 0; i < sizeof(data); i++) data[i] = patternAt(i);
+    tx.write(data, sizeof(data));
+
+    // 1000 byte = 4 tam frame (243) + 28 byte kısa frame
+    unsigned long now = millis();
+    uint16_t first = tx.pump(now, 3, linkSend, &link);
+    uint32_t acceptedFirst = link.accepted;
+    uint32_t stallsBefore = tx.getStats().creditStalls;
+    uint16_t none = tx.pump(now, 0, linkSend, &link);
+    uint32_t stallsAfter = tx.getStats().creditStalls;
+    size_t pendingNoCredit = tx.pending();
+    // Her gönderilen frame flush süresini yeniden başlatır: kısa frame sonraki turda
+    uint16_t full = tx.pump(now + BLE_STREAM_FLUSH_MS, 10, linkSend, &link);
+    uint16_t tail = tx.pump(now + 2 * BLE_STREAM_FLUSH_MS, 10, linkSend, &link);
+
+    serialManager.logPrintf("[Check] Credits: %u + %u + %u + %u frames, %lu stalls\n",
+                            first, none, full, tail, (unsigned long)tx.getStats().creditStalls);
+    check("credits limit frames per pump", first == 3 && acceptedFirst == 3);
+    check("no credit keeps data, counts stall",
+          none == 0 && stallsAfter == stallsBefore + 1 && pendingNoCredit == sizeof(data) - 3 * 243);
+    check("credits drain the rest",
+          full == 1 && tail == 1 && tx.pending() == 0 && tx.getStats().shortFrames == 1 &&
+          link.accepted == 5 && rx.available() == sizeof(data));
+}
+
+void checkRejects() {
+    Link link;
+    resetLink(link, 185);
+    link.rejectEvery = 5;
+    uint32_t mismatches;
+    uint32_t received = runStream(link, 6, mismatches);
+
+    serialManager.logPrintf("[Check] Rejects: %lu rejected, %lu send errors\n",
+                            (unsigned long)link.rejected, (unsigned long)tx.getStats().sendErrors);
+    check("rejected frames are retried", received == STREAM_BYTES && mismatches == 0);
+    check("rejects counted, no seq gap",
+          link.rejected > 0 && tx.getStats().sendErrors == link.rejected && rx.getStats().lostFrames == 0);
+}
+
+void checkLostFrames() {
+    Link link;
+    resetLink(link, 185);
+    link.dropEvery = 7;
+    uint32_t mismatches;
+    uint32_t received = runStream(link, 6, mismatches);
+
+    serialManager.logPrintf("[Check] Lost: %lu dropped, %lu detected, %lu bytes missing\n",
+                            (unsigned long)link.dropped, (unsigned long)rx.getStats().lostFrames,
+                            (unsigned long)(STREAM_BYTES - received));
+    check("dropped frames detected by seq",
+          link.dropped > 0 && rx.getStats().lostFrames == link.dropped && received == link.bytes);
+}
+
+void checkFlush() {
+    Link link;
+    resetLink(link, BLE_STREAM_MAX_MTU);
+    uint8_t data[10] = {0};
+    tx.write(data, sizeof(data));
+
+    unsigned long now = millis();
+    uint16_t early = tx.pump(now, 10, linkSend, &link);
+    uint16_t late = tx.pump(now + BLE_STREAM_FLUSH_MS, 10, linkSend, &link);
+    check("short frame waits for flush time",
+          early == 0 && late == 1 && tx.getStats().shortFrames == 1 && rx.available() == sizeof(data));
+}
+
+void checkRingAndRestart() {
+    Link link;
+    resetLink(link, BLE_STREAM_MAX_MTU);
+    static uint8_t data[BLE_STREAM_BUFFER_SIZE + 100];
+    memset(data, 0xA5, sizeof(data));
+    size_t accepted = tx.write(data, sizeof(data));
+    check("full ring accepts partially",
+          accepted == BLE_STREAM_BUFFER_SIZE && tx.getStats().rejected == 100 && tx.space() == 0);
+
+    tx.pump(millis(), 2, linkSend, &link);
+    size_t left = tx.pending();
+    tx.restart();
+
+    // Yeni abone: RX sıfırdan, ilk frame'in sırası 0 olmalı
+    uint8_t firstSeq = 0xFF;
+    struct Capture {
+        static bool send(const uint8_t* frame, uint16_t length, void* user) {
+            (void)length;
+            *static_cast<uint8_t*>(user) = frame[0];
+            return true;
+        }
+    };
+    tx.write(data, 300);
+    tx.pump(millis(), 1, Capture::send, &firstSeq);
+    check("restart discards and resets seq",
+          tx.getStats().discarded == left && firstSeq == 0);
+}
+
+void setup() {
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    serialManager.logPrintf("[Check] BleStream frames: ring %u bytes, flush %u ms\n",
+                            BLE_STREAM_BUFFER_SIZE, BLE_STREAM_FLUSH_MS);
+    checkFragmentation(BLE_STREAM_DEFAULT_MTU);
+    checkFragmentation(185);
+    checkFragmentation(BLE_STREAM_MAX_MTU);
+    checkCredits();
+    checkRejects();
+    checkLostFrames();
+    checkFlush();
+    checkRingAndRestart();
+    serialManager.logPrintf("[Check] %s (%u failed)\n", failures ? "FAIL" : "PASS", failures);
+}
+
+void loop() {
+    delay(1000);
+}
@@ -0,0 +1,147 @@
+/**
+ * @file event_bus.ino
+ * @brief Event-driven WiFi / BLE / GPIO / power handling with EventBus
+ *
+ * Bileşenler durumlarını loop'ta sorgulamak yerine EventBus'a abone olur:
+ * - WiFi  : LED rengi bağlantı durumunu izler
+ * - GPIO  : Buton (kesme -> post, ISR-safe) güç profilini değiştirir
+ * - Serial: LP_UART'a veri gelince satır okunur
+ * - Tümü  : Logger aboneliği her olayı kaynak/kod/arg ile yazar
+ *
+ * loop() yalnızca poll() ve Events.dispatch() çağırır; abone callback'leri
+ * dispatch() içinden, loop() context'inde çalışır.
+ *
+ * Her STATUS_MS'de bus sayaçları (posted / dispatched / dropped / high water)
+ * yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <EventBus.h>
+#include <RgbLed.h>
+#include <WirelessManager.h>
+#include <BleModule.h>
+#include <PowerManager.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+// Ağ bilgileri
+const char* WIFI_SSID = "MyNetwork";
+const char* WIFI_PASS = "password";
+
+// Buton (aktif LOW)
+const uint8_t PIN_BUTTON = PIN_ADC0;
+
+const unsigned long STATUS_MS = 15000;
+
+RgbLed rgbLed(PIN_LED_RED, PIN_LED_GREEN, PIN_LED_BLUE, LED_ACTIVE_LOW);
+BleModule ble;
+
+unsigned long lastStatus = 0;
+
+void onAnyEvent(const Event& event, void*) {
+    serialManager.logPrintf("[Event] %6lu ms %-6s code %u arg %u value %lu\n",
+                            (unsigned long)event.timeMs,
+                            EventBus::sourceToString(event.source),
+                            event.code, event.arg, (unsigned long)event.value);
+}
+
+void onWiFiEvent(const Event& event, void*) {
+    if (event.code != static_cast<uint8_t>(WiFiEventCode::StateChanged)) return;
+
+    WiFiConnectState state = static_cast<WiFiConnectState>(event.arg);
+    if (state == WiFiConnectState::Connected) {
+        rgbLed.setColor(Color::Green);
+    } else if (state == WiFiConnectState::Failed || state == WiFiConnectState::Idle) {
+        rgbLed.setColor(Color::Red);
+    } else {
+        rgbLed.setColor(Color::Blue);
+    }
+}
+
+void onButtonEvent(const Event& event, void*) {
+    if (event.arg != PIN_BUTTON || event.code != static_cast<uint8_t>(GpioEventCode::Low)) return;
+
+    PowerProfile next = Power.getProfile() == PowerProfile::LowPower
+                        ? PowerProfile::Balanced : PowerProfile::LowPower;
+    serialManager.logPrintf("[App] Button: %s\n", PowerManager::profileToString(next));
+    Power.setProfile(next);
+}
+
+void onSerialEvent(const Event&, void*) {
+    String line = serialManager.readDataLine(100);
+    serialManager.logPrintf("[App] UART: %s\n", line.c_str());
+}
+
+void printStatus() {
+    EventBusStats stats = Events.getStats();
+    serialManager.logPrintf("[App] bus: %u subscribers, posted %lu, dispatched %lu, delivered %lu, "
+                            "dropped %lu, high water %u\n",
+                            Events.getSubscriberCount(),
+                            (unsigned long)stats.posted, (unsigned long)stats.dispatched,
+                            (unsigned long)stats.delivered, (unsigned long)stats.dropped,
+                            stats.highWater);
+}
+
+#if defined(RTL8720_HOST)
+void pressButton(uint64_t atUs) {
+    hostsim::scheduleAfter(atUs, [] { hostsim::driveInput(PIN_BUTTON, LOW); }, "button_down");
+    hostsim::scheduleAfter(atUs + 80000, [] { hostsim::driveInput(PIN_BUTTON, HIGH); }, "button_up");
+}
+
+void setupHostScenario() {
+    hostsim::wifiAddNetwork({"MyNetwork", {0x02, 0x00, 0x00, 0x00, 0x04, 0x01}, -55, 6, 3});
+    hostsim::driveInput(PIN_BUTTON, HIGH);
+
+    pressButton(8ULL * 1000000);
+    pressButton(20ULL * 1000000);
+
+    // 25. saniyede 3 saniyelik link kaybı: supervisor olayları
+    hostsim::scheduleAfter(25ULL * 1000000, [] { hostsim::wifiDropLink(3000); }, "link_drop");
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Events.subscribe(EVENT_SOURCE_ALL, onAnyEvent);
+    Events.subscribe(EVENT_SOURCE_MASK(EventSource::WiFi), onWiFiEvent);
+    Events.subscribe(EVENT_SOURCE_MASK(EventSource::Gpio), onButtonEvent);
+    Events.subscribe(EVENT_SOURCE_MASK(EventSource::Uart), onSerialEvent);
+    Events.watchPin(PIN_BUTTON, CHANGE);
+    serialManager.enableEvents();
+
+    rgbLed.begin();
+    ble.begin("RTL8720-Events");
+    ble.startAdvertising();
+    Power.begin(PowerProfile::Balanced, &ble);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS);
+}
+
+void loop() {
+    Wireless.poll();
+    Power.poll();
+    Events.dispatch();
+
+    if (millis() - lastStatus >= STATUS_MS) {
+        lastStatus = millis();
+        printStatus();
+    }
+
+    delay(10);
+}
@@ -0,0 +1,242 @@
+/**
+ * @file http_server.ino
+ * @brief Non-blocking HTTP/1.1 server with a constexpr route table, keep-alive
+ *        and a chunked log stream
+ *
+ * HttpServer loop() içinde poll() ile çalışır; handler'lar beklemez.
+ *
+ * Route'lar:
+ * - GET /            Sabit sayfa (sendStatic, kopyasız)
+ * - GET /status      JSON durum (send)
+ * - GET /log         LOG_LINES satır, chunked (stream): RAM'de tutulmaz
+ * - GET /files/...   Önek route'u ("/files/" + '*'), wildcard() dosya adı
+ * - POST /config     ?interval=N query parametresi + body
+ *
+ * Host'ta port 8080 dinlenir ve sketch kendi istemcisini çalıştırır: tek
+ * keep-alive bağlantısında pipelined istekler gönderir, cevap durumlarını ve
+ * byte sayısını yazdırır. curl ile de denenebilir:
+ *   host/build.sh src/examples/http_server -- --run-ms 60000 &
+ *   curl -v http://127.0.0.1:8080/status
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <WirelessManager.h>
+#include <HttpServer.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+#if defined(RTL8720_HOST)
+const uint16_t HTTP_PORT = 8080;
+#else
+const uint16_t HTTP_PORT = 80;
+#endif
+
+const uint32_t LOG_LINES = 500;
+const unsigned long STATUS_INTERVAL_MS = 10000;
+
+const char INDEX_HTML[] =
+    "<!DOCTYPE html><html><head><title>RTL8720</title></head><body>"
+    "<h1>RTL8720 HTTP server</h1>"
+    "<ul><li><a href=\"/status\">/status</a></li>"
+    "<li><a href=\"/log\">/log</a></li></ul>"
+    "</body></html>\n";
+
+HttpServer server;
+uint32_t sampleInterval = 1000;
+unsigned long lastStatusMs = 0;
+
+// ============================================================================
+// Handlers
+// ============================================================================
+
+void handleIndex(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.addHeader("Cache-Control", "max-age=3600");
+    res.sendStatic(200, "text/html", reinterpret_cast<const uint8_t*>(INDEX_HTML), sizeof(INDEX_HTML) - 1);
+}
+
+void handleStatus(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    const HttpServerStats& s = server.getStats();
+    char json[160];
+    snprintf(json, sizeof(json),
+             "{\"uptimeMs\":%lu,\"interval\":%lu,\"connections\":%u,\"requests\":%lu,\"keepAlive\":%lu}\n",
+             millis(), (unsigned long)sampleInterval, server.getActiveConnections(),
+             (unsigned long)s.requests, (unsigned long)s.keepAliveReuses);
+    res.send(200, "application/json", json);
+}
+
+/**
+ * @brief Bir seferde sığdığı kadar log satırı üret
+ */
+size_t logSource(uint8_t* buf, size_t max, HttpStreamState& state) {
+    size_t length = 0;
+    while (state.cursor < LOG_LINES) {
+        char line[48];
+        int n = snprintf(line, sizeof(line), "%06lu sample=%lu adc=%u\n",
+                         (unsigned long)state.cursor, (unsigned long)(state.cursor * sampleInterval),
+                         (unsigned)((state.cursor * 37) % 4096));
+        if (length + n > max) break;
+        memcpy(&buf[length], line, n);
+        length += n;
+        state.cursor++;
+    }
+    return length;
+}
+
+void handleLog(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.stream(200, "text/plain", logSource);
+}
+
+void handleFile(const HttpRequest& req, HttpResponse& res) {
+    char name[32];
+    req.wildcard().copyTo(name, sizeof(name));
+    char body[64];
+    snprintf(body, sizeof(body), "file '%s' not stored\n", name);
+    res.send(404, "text/plain", body);
+}
+
+void handleConfig(const HttpRequest& req, HttpResponse& res) {
+    HttpSlice interval = req.param("interval");
+    if (interval.empty() || interval.toInt() <= 0) {
+        res.send(400, "text/plain", "interval required\n");
+        return;
+    }
+    sampleInterval = static_cast<uint32_t>(interval.toInt());
+    serialManager.logPrintf("[App] Interval %lu ms (body %u bytes)\n",
+                            (unsigned long)sampleInterval, req.body().length);
+    res.send(204, "text/plain", "");
+}
+
+constexpr HttpRoute ROUTES[] = {
+    {HttpMethod::Get,  "/",         handleIndex},
+    {HttpMethod::Get,  "/status",   handleStatus},
+    {HttpMethod::Get,  "/log",      handleLog},
+    {HttpMethod::Get,  "/files/*",  handleFile},
+    {HttpMethod::Post, "/config",   handleConfig},
+};
+
+static_assert(httpRoutesValid(ROUTES), "invalid route table");
+
+// ============================================================================
+// Host istemcisi
+// ============================================================================
+
+#if defined(RTL8720_HOST)
+// Tek bağlantıda pipelined istekler; sonuncusu bağlantıyı kapatır
+const char CLIENT_REQUESTS[] =
+    "GET / HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "GET /status HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "POST /config?interval=250 HTTP/1.1\r\nHost: rtl8720\r\nContent-Length: 5\r\n\r\nhello"
+    "GET /log HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "HEAD /status HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "GET /files/readme.txt HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "DELETE /status HTTP/1.1\r\nHost: rtl8720\r\n\r\n"
+    "GET /missing HTTP/1.1\r\nHost: rtl8720\r\nConnection: close\r\n\r\n";
+
+TcpSocket client;
+bool clientStarted = false;
+bool clientDone = false;
+size_t clientSent = 0;
+uint32_t clientBytes = 0;
+char clientWindow[16];          // Bölünmüş status satırları için son byte'lar
+uint8_t clientWindowLength = 0;
+
+/**
+ * @brief Gelen byte'larda "HTTP/1.1 NNN" status satırlarını yazdır
+ */
+void clientScan(const uint8_t* data, int len) {
+    for (int i = 0; i < len; i++) {
+        if (clientWindowLength == sizeof(clientWindow)) {
+            memmove(clientWindow, clientWindow + 1, sizeof(clientWindow) - 1);
+            clientWindowLength--;
+        }
+        clientWindow[clientWindowLength++] = static_cast<char>(data[i]);
+        if (clientWindowLength >= 12 &&
+            memcmp(&clientWindow[clientWindowLength - 12], "HTTP/1.1 ", 9) == 0) {
+            serialManager.logPrintf("[Client] Status %.3s\n", &clientWindow[clientWindowLength - 3]);
+        }
+    }
+}
+
+void clientPoll() {
+    if (clientDone || !server.isListening()) return;
+
+    if (!clientStarted) {
+        clientStarted = client.connect(IPAddress(127, 0, 0, 1), HTTP_PORT);
+        return;
+    }
+    if (client.poll() != TcpState::Connected) {
+        if (client.getState() == TcpState::Failed) {
+            serialManager.logPrintf("[Client] Failed: %s\n", strerror(client.getError()));
+            clientDone = true;
+        }
+        return;
+    }
+
+    if (clientSent < sizeof(CLIENT_REQUESTS) - 1) {
+        int n = client.write(reinterpret_cast<const uint8_t*>(&CLIENT_REQUESTS[clientSent]),
+                             sizeof(CLIENT_REQUESTS) - 1 - clientSent);
+        if (n > 0) clientSent += n;
+    }
+
+    uint8_t buf[512];
+    int n;
+    while ((n = client.read(buf, sizeof(buf))) > 0) {
+        clientBytes += n;
+        clientScan(buf, n);
+    }
+    if (n < 0) {
+        serialManager.logPrintf("[Client] Closed by server after %lu bytes\n", (unsigned long)clientBytes);
+        client.close();
+        clientDone = true;
+        server.printStatus();
+    }
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x06, 0x01}, -55, 6, 3});
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    Wireless.poll();
+
+    if (!server.isListening() && Wireless.getWiFiConnectState() == WiFiConnectState::Connected) {
+        server.begin(HTTP_PORT, ROUTES);
+    }
+    server.poll();
+
+#if defined(RTL8720_HOST)
+    clientPoll();
+#endif
+
+    unsigned long now = millis();
+    if (server.isListening() && now - lastStatusMs >= STATUS_INTERVAL_MS) {
+        lastStatusMs = now;
+        server.printStatus();
+    }
+    delay(1);
+}
@@ -0,0 +1,224 @@
+/**
+ * @file http_upload.ino
+ * @brief HTTP uploads over fresh vs. pooled keep-alive connections, and
+ *        pipelined GETs
+ *
+ * HttpClient bağlantıları TcpPool'dan alır. Fazlar (her biri REQUESTS istek):
+ * - Fresh: her upload yeni bağlantıda ("Connection: close", eski davranış)
+ * - Keep-alive: POST /upload, bağlantı havuzda kalır ve tekrar kullanılır
+ * - Pipelined: GET /config, bağlantı başına HTTP_CLIENT_PIPELINE_DEPTH istek
+ *   cevap beklenmeden gönderilir
+ *
+ * Her faz sonunda istek/s, ortalama gecikme, handshake'siz giden isteklerin
+ * oranı, ortalama connect süresi ve istek başına kazanılan süre yazdırılır.
+ *
+ * Host'ta collector aynı sketch'teki HttpServer'dır (127.0.0.1:8080).
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <Profiler.h>
+#include <WirelessManager.h>
+#include <TcpPool.h>
+#include <HttpClient.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#include <HttpServer.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+#if defined(RTL8720_HOST)
+const IPAddress COLLECTOR_IP(127, 0, 0, 1);
+#else
+const IPAddress COLLECTOR_IP(192, 168, 1, 10);
+#endif
+const uint16_t COLLECTOR_PORT = 8080;
+
+const uint32_t REQUESTS = 300;
+
+enum class Phase : uint8_t {
+    Connecting,
+    Fresh,
+    KeepAlive,
+    Pipelined,
+    Done
+};
+
+TcpPool pool;
+HttpClient http(pool);
+
+Phase phase = Phase::Connecting;
+uint32_t phaseStartTicks = 0;
+uint32_t issued = 0;
+uint32_t responses = 0;
+uint32_t errors = 0;
+uint8_t reading[64];
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting:     return "Connecting";
+        case Phase::Fresh:          return "Fresh";
+        case Phase::KeepAlive:      return "Keep-alive";
+        case Phase::Pipelined:      return "Pipelined";
+        case Phase::Done:           return "Done";
+        default:                    return "Unknown";
+    }
+}
+
+// ============================================================================
+// Host collector
+// ============================================================================
+
+#if defined(RTL8720_HOST)
+HttpServer collector;
+uint32_t uploadedBytes = 0;
+
+void handleUpload(const HttpRequest& req, HttpResponse& res) {
+    uploadedBytes += req.body().length;
+    res.send(201, "text/plain", "stored\n");
+}
+
+void handleConfig(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.send(200, "application/json", "{\"interval\":1000}\n");
+}
+
+constexpr HttpRoute COLLECTOR_ROUTES[] = {
+    {HttpMethod::Post, "/upload",   handleUpload},
+    {HttpMethod::Get,  "/config",   handleConfig},
+};
+
+static_assert(httpRoutesValid(COLLECTOR_ROUTES), "invalid route table");
+#endif
+
+// ============================================================================
+// Client
+// ============================================================================
+
+void onResponse(const HttpClientResponse& res, void* user) {
+    (void)user;
+    if (!res.done) return;
+    if (res.status >= 200 && res.status < 300) responses++;
+    else errors++;
+}
+
+void enterPhase(Phase next) {
+    if (phase != Phase::Connecting) {
+        uint32_t ticks = Profiler::ticks() - phaseStartTicks;
+        float seconds = static_cast<float>(ticks) / Profiler::ticksPerSecond();
+        serialManager.logPrintf("[App] %s: %lu ok, %lu errors, %lu req/s, latency avg %lu ms, "
+                                "reuse %u%%, connect avg %lu us, saved %lu us/request\n",
+                                phaseToString(phase), (unsigned long)responses, (unsigned long)errors,
+                                (unsigned long)(seconds > 0 ? responses / seconds : 0),
+                                (unsigned long)http.getAverageLatencyMs(), http.getReuseRate(),
+                                (unsigned long)pool.getAverageConnectUs(),
+                                (unsigned long)http.getTimeSavedPerRequestUs());
+        http.printStatus();
+        pool.printStatus();
+    }
+
+    switch (next) {
+        case Phase::Fresh:
+            http.setKeepAlive(false);
+            http.setPipelineDepth(1);
+            break;
+        case Phase::KeepAlive:
+            http.setKeepAlive(true);
+            http.setPipelineDepth(1);
+            break;
+        case Phase::Pipelined:
+            http.setKeepAlive(true);
+            http.setPipelineDepth(HTTP_CLIENT_PIPELINE_DEPTH);
+            break;
+        default:
+            break;
+    }
+
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    phaseStartTicks = Profiler::ticks();
+    issued = 0;
+    responses = 0;
+    errors = 0;
+    http.resetStats();
+    pool.resetStats();
+}
+
+/**
+ * @brief Tablo doldukça istek ekle; hepsi cevaplanınca true
+ */
+bool pumpRequests() {
+    while (issued < REQUESTS && http.getFree() > 0) {
+        bool ok;
+        if (phase == Phase::Pipelined) {
+            ok = http.get(COLLECTOR_IP, COLLECTOR_PORT, "/config", onResponse);
+        } else {
+            memcpy(reading, &issued, sizeof(issued));
+            ok = http.request(HttpMethod::Post, COLLECTOR_IP, COLLECTOR_PORT, "/upload", onResponse, nullptr,
+                              reading, sizeof(reading), "application/octet-stream");
+        }
+        if (!ok) break;
+        issued++;
+    }
+    return issued == REQUESTS && http.isIdle();
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x07, 0x01}, -55, 6, 3});
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    Wireless.poll();
+    http.poll();
+
+#if defined(RTL8720_HOST)
+    collector.poll();
+#endif
+
+    switch (phase) {
+        case Phase::Connecting:
+            if (Wireless.getWiFiConnectState() == WiFiConnectState::Connected) {
+#if defined(RTL8720_HOST)
+                collector.begin(COLLECTOR_PORT, COLLECTOR_ROUTES);
+#endif
+                enterPhase(Phase::Fresh);
+            }
+            break;
+        case Phase::Fresh:
+            // Fazlarda beklenmez: istekler duvar saatiyle ölçülür
+            if (pumpRequests()) enterPhase(Phase::KeepAlive);
+            return;
+        case Phase::KeepAlive:
+            if (pumpRequests()) enterPhase(Phase::Pipelined);
+            return;
+        case Phase::Pipelined:
+            if (pumpRequests()) {
+                enterPhase(Phase::Done);
+#if defined(RTL8720_HOST)
+                collector.printStatus();
+#endif
+            }
+            return;
+        case Phase::Done:
+            break;
+    }
+    delay(1);
+}
@@ -0,0 +1,222 @@
+/**
+ * @file mqtt_publish.ino
+ * @brief MQTT publish throughput with a QoS1 in-flight window and an offline
+ *        queue drained in order after an AP outage
+ *
+ * MqttClient publish() çağrısında beklemez; poll() kuyruğu gönderir.
+ *
+ * Fazlar:
+ * - Stop-and-wait: QoS1, window 1 (her mesaj PUBACK bekler, PubSubClient gibi)
+ * - Windowed: QoS1, window MQTT_MAX_INFLIGHT
+ * - Outage: 500 ms'de bir QoS1 mesaj; 2 sn sonra AP düşer (host'ta), bu
+ *   sürede mesajlar kuyrukta bekler, yeniden bağlanınca sırayla gönderilir
+ *
+ * Burst fazlarında BURST_MESSAGES mesaj gönderilir ve msg/s yazdırılır (duvar
+ * saati, Profiler). Outage fazında istemci kendi topic'ine abonedir: broker'dan
+ * dönen mesajların sıra numaraları kayıp / sıra dışı / tekrar için kontrol edilir.
+ *
+ * Broker gerekir (ör. mosquitto). Host'ta 127.0.0.1:1883:
+ *   mosquitto -p 1883 &
+ *   host/build.sh src/examples/mqtt_publish -- --run-ms 30000
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <Profiler.h>
+#include <WirelessManager.h>
+#include <MqttClient.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+#if defined(RTL8720_HOST)
+const IPAddress BROKER_IP(127, 0, 0, 1);
+#else
+const IPAddress BROKER_IP(192, 168, 1, 10);
+#endif
+const uint16_t BROKER_PORT = 1883;
+
+const char* BURST_TOPIC = "rtl8720/demo/burst";
+const char* OUTAGE_TOPIC = "rtl8720/demo/outage";
+
+const uint32_t BURST_MESSAGES = 500;
+const unsigned long OUTAGE_PERIOD_MS = 500;
+const unsigned long OUTAGE_PHASE_MS = 12000;
+const unsigned long OUTAGE_DROP_AT_MS = 2000;
+const uint32_t OUTAGE_MS = 5000;
+
+enum class Phase : uint8_t {
+    Connecting,
+    StopAndWait,
+    Windowed,
+    Outage,
+    Done
+};
+
+MqttClient mqtt;
+
+Phase phase = Phase::Connecting;
+unsigned long phaseStartMs = 0;
+uint32_t phaseStartTicks = 0;
+uint32_t seq = 0;
+unsigned long lastPublishMs = 0;
+bool outageTriggered = false;
+
+// Broker'dan dönen outage mesajları
+uint32_t echoReceived = 0;
+uint32_t echoGaps = 0;
+uint32_t echoOutOfOrder = 0;
+uint32_t echoDuplicates = 0;
+int32_t echoLast = -1;
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting:     return "Connecting";
+        case Phase::StopAndWait:    return "Stop-and-wait";
+        case Phase::Windowed:       return "Windowed";
+        case Phase::Outage:         return "Outage";
+        case Phase::Done:           return "Done";
+        default:                    return "Unknown";
+    }
+}
+
+void onMessage(const char* topic, const uint8_t* payload, size_t len, void* user) {
+    (void)topic;
+    (void)user;
+    uint32_t n;
+    if (len != sizeof(n)) return;
+    memcpy(&n, payload, sizeof(n));
+
+    echoReceived++;
+    int32_t value = static_cast<int32_t>(n);
+    if (value == echoLast) {
+        echoDuplicates++;
+    } else if (value < echoLast) {
+        echoOutOfOrder++;
+    } else {
+        if (value > echoLast + 1) echoGaps += value - echoLast - 1;
+        echoLast = value;
+    }
+}
+
+void enterPhase(Phase next) {
+    if (phase == Phase::StopAndWait || phase == Phase::Windowed) {
+        uint32_t ticks = Profiler::ticks() - phaseStartTicks;
+        float seconds = static_cast<float>(ticks) / Profiler::ticksPerSecond();
+        serialManager.logPrintf("[App] %s: %lu messages in %lu ms, %lu msg/s\n",
+                                phaseToString(phase), (unsigned long)BURST_MESSAGES,
+                                (unsigned long)(seconds * 1000),
+                                (unsigned long)(seconds > 0 ? BURST_MESSAGES / seconds : 0));
+    } else if (phase == Phase::Outage) {
+        serialManager.logPrintf("[App] Outage: %lu published, %lu echoed, %lu gaps, "
+                                "%lu out of order, %lu duplicates\n",
+                                (unsigned long)seq, (unsigned long)echoReceived,
+                                (unsigned long)echoGaps, (unsigned long)echoOutOfOrder,
+                                (unsigned long)echoDuplicates);
+    }
+    if (phase != Phase::Connecting) mqtt.printStatus();
+
+    switch (next) {
+        case Phase::StopAndWait:
+            mqtt.setInflightWindow(1);
+            break;
+        case Phase::Windowed:
+            mqtt.setInflightWindow(MQTT_MAX_INFLIGHT);
+            break;
+        case Phase::Outage:
+            mqtt.subscribe(OUTAGE_TOPIC, 1);
+            break;
+        default:
+            break;
+    }
+
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    phaseStartMs = millis();
+    phaseStartTicks = Profiler::ticks();
+    seq = 0;
+    mqtt.resetStats();
+}
+
+/**
+ * @brief Havuz doldukça publish et; hepsi ack'lenince true
+ */
+bool pumpBurst() {
+    uint8_t payload[32];
+    while (seq < BURST_MESSAGES && mqtt.getFree() > 0) {
+        memset(payload, 0, sizeof(payload));
+        memcpy(payload, &seq, sizeof(seq));
+        if (!mqtt.publish(BURST_TOPIC, payload, sizeof(payload), 1)) break;
+        seq++;
+    }
+    return seq == BURST_MESSAGES && mqtt.isIdle();
+}
+
+void pumpOutage(unsigned long now) {
+    if (now - lastPublishMs >= OUTAGE_PERIOD_MS) {
+        lastPublishMs = now;
+        // Reddedilen mesajın numarası atlanır: alıcı onu gap olarak görür
+        mqtt.publish(OUTAGE_TOPIC, reinterpret_cast<const uint8_t*>(&seq), sizeof(seq), 1);
+        seq++;
+    }
+
+#if defined(RTL8720_HOST)
+    if (!outageTriggered && now - phaseStartMs >= OUTAGE_DROP_AT_MS) {
+        outageTriggered = true;
+        serialManager.logPrintf("[App] AP down for %lu ms\n", (unsigned long)OUTAGE_MS);
+        hostsim::wifiDropLink(OUTAGE_MS);
+    }
+#endif
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x05, 0x01}, -57, 6, 3});
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+
+    mqtt.onMessage(onMessage);
+    mqtt.begin(BROKER_IP, BROKER_PORT, MqttClient::defaultConfig("rtl8720-demo"));
+}
+
+void loop() {
+    Wireless.poll();
+    mqtt.poll();
+
+    unsigned long now = millis();
+    switch (phase) {
+        case Phase::Connecting:
+            if (mqtt.isConnected()) enterPhase(Phase::StopAndWait);
+            break;
+        case Phase::StopAndWait:
+            // Burst fazında beklenmez: mesajlar duvar saatiyle ölçülür
+            if (pumpBurst()) enterPhase(Phase::Windowed);
+            return;
+        case Phase::Windowed:
+            if (pumpBurst()) enterPhase(Phase::Outage);
+            return;
+        case Phase::Outage:
+            pumpOutage(now);
+            if (now - phaseStartMs >= OUTAGE_PHASE_MS && mqtt.isIdle()) enterPhase(Phase::Done);
+            break;
+        case Phase::Done:
+            break;
+    }
+    delay(1);
+}
@@ -0,0 +1,252 @@
+/**
+ * @file ota_update.ino
+ * @brief Dual-bank OTA update streamed over HTTP (or LP_UART) straight into
+ *        the inactive flash bank
+ *
+ * İmaj RAM'de toplanmaz: OtaHttpSource body'yi OtaUpdater'ın iki sektör
+ * buffer'ına okur, biri flash'a yazılırken diğeri dolar. Fazlar:
+ * - Corrupted: beklenen hash kasıtlı olarak yanlış verilir; imaj yazılır ama
+ *   doğrulama başarısız olur, çalışan bank değişmez
+ * - Update: hash sunucunun X-Firmware-SHA256 header'ından alınır; doğrulama
+ *   sonrası bank değişir (cihazda yeniden başlatılır)
+ *
+ * Her fazda toplam süre, hız (KB/s), flash meşguliyeti ve alımın writer'ı
+ * beklediği (stall) sayısı yazdırılır.
+ *
+ * Host'ta firmware sunucusu aynı sketch'teki HttpServer'dır (127.0.0.1:8080,
+ * üretilmiş IMAGE_SIZE byte'lık imaj). Flash simülasyonu sanal saatle
+ * çalışır; aynı HOST_FLASH ile ikinci çalıştırma yeni bankdan "açılır" ve
+ * diğer banka yazar:
+ *   HOST_FLASH=/tmp/ota.bin host/build.sh src/examples/ota_update -- --run-ms 60000
+ *
+ * LP_UART ile (OTA_FROM_UART=1): Serial1 OTA_UART_BAUD'da çerçeve bekler,
+ * gönderici host/ota_uart_send.py (protokol OtaUartSource.h'de):
+ *   CXXFLAGS="-O2 -DOTA_FROM_UART=1" host/build.sh src/examples/ota_update -- --run-ms 60000
+ *   host/ota_uart_send.py /dev/pts/N --generate 262144
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <WirelessManager.h>
+#include <OtaUpdater.h>
+#include <OtaHttpSource.h>
+#include <OtaUartSource.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#include <HttpServer.h>
+#endif
+
+#ifndef OTA_FROM_UART
+    #define OTA_FROM_UART   0
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+#if defined(RTL8720_HOST)
+const IPAddress SERVER_IP(127, 0, 0, 1);
+#else
+const IPAddress SERVER_IP(192, 168, 1, 10);
+#endif
+const uint16_t SERVER_PORT = 8080;
+const char* FIRMWARE_PATH = "/firmware.bin";
+
+const unsigned long OTA_UART_BAUD = 921600;
+
+enum class Phase : uint8_t {
+    Connecting,
+    Corrupted,
+    Update,
+    Done
+};
+
+OtaUpdater ota;
+OtaHttpSource httpSource(ota);
+OtaUartSource uartSource(ota);
+
+Phase phase = Phase::Connecting;
+OtaBank bootBefore = OtaBank::A;
+OtaState lastState = OtaState::Idle;
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting:     return "Connecting";
+        case Phase::Corrupted:      return "Corrupted (wrong expected hash)";
+        case Phase::Update:         return "Update";
+        case Phase::Done:           return "Done";
+        default:                    return "Unknown";
+    }
+}
+
+// ============================================================================
+// Host firmware server
+// ============================================================================
+
+#if defined(RTL8720_HOST)
+const uint32_t IMAGE_SIZE = 256 * 1024;
+
+HttpServer server;
+uint8_t image[IMAGE_SIZE];
+char imageHash[OTA_HASH_SIZE * 2 + 1];
+
+/**
+ * @brief OTA imzası + sözde rastgele kod, son çeyrek 0xFF dolgu (silinmiş flash gibi)
+ */
+void buildImage() {
+    memcpy(image, "81958711", OTA_SIGNATURE_SIZE);
+    uint32_t x = 0x12345678;
+    for (uint32_t i = OTA_SIGNATURE_SIZE; i < IMAGE_SIZE; i++) {
+        x = x * 1664525UL + 1013904223UL;
+        image[i] = i < IMAGE_SIZE * 3 / 4 ? static_cast<uint8_t>(x >> 24) : 0xFF;
+    }
+    uint8_t hash[OTA_HASH_SIZE];
+    mbedtls_sha256_ret(image, IMAGE_SIZE, hash, 0);
+    OtaUpdater::formatHash(hash, imageHash);
+}
+
+void handleFirmware(const HttpRequest& req, HttpResponse& res) {
+    (void)req;
+    res.addHeader("X-Firmware-SHA256", imageHash);
+    res.sendStatic(200, "application/octet-stream", image, IMAGE_SIZE);
+}
+
+constexpr HttpRoute SERVER_ROUTES[] = {
+    {HttpMethod::Get, "/firmware.bin", handleFirmware},
+};
+
+static_assert(httpRoutesValid(SERVER_ROUTES), "invalid route table");
+#endif
+
+// ============================================================================
+// Update
+// ============================================================================
+
+void report() {
+    const OtaStats& s = ota.getStats();
+    serialManager.logPrintf("[App] %s: %s (%s), %lu bytes in %lu ms, %lu B/s, %lu stalls, boot bank %s -> %s\n",
+                            phaseToString(phase), OtaUpdater::stateToString(ota.getState()),
+                            OtaUpdater::errorToString(ota.getError()), (unsigned long)s.bytesReceived,
+                            (unsigned long)s.totalMs, (unsigned long)ota.getThroughput(),
+                            (unsigned long)s.stalls, OtaUpdater::bankToString(bootBefore),
+                            OtaUpdater::bankToString(OtaUpdater::getBootBank()));
+    ota.printStatus();
+}
+
+void enterPhase(Phase next) {
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    bootBefore = OtaUpdater::getBootBank();
+
+    if (next == Phase::Corrupted) {
+        uint8_t wrong[OTA_HASH_SIZE];
+        memset(wrong, 0x5A, sizeof(wrong));
+        httpSource.begin(SERVER_IP, SERVER_PORT, FIRMWARE_PATH, wrong);
+    } else if (next == Phase::Update) {
+        httpSource.begin(SERVER_IP, SERVER_PORT, FIRMWARE_PATH);
+    }
+}
+
+#if OTA_FROM_UART
+void setup() {
+    serialManager.begin(DEBUG_BAUD_RATE, OTA_UART_BAUD);
+    delay(1000);
+
+    serialManager.logPrintf("[App] Running bank %s, waiting for OTA frames on LP_UART (%lu baud)\n",
+                            OtaUpdater::bankToString(OtaUpdater::getRunningBank()), OTA_UART_BAUD);
+    phase = Phase::Update;
+    bootBefore = OtaUpdater::getBootBank();
+    uartSource.begin();
+}
+
+void loop() {
+    OtaState state = uartSource.poll();
+    if (state != lastState) {
+        lastState = state;
+        if (state == OtaState::Done || state == OtaState::Failed) {
+            report();
+            uartSource.printStatus();
+            uartSource.resetStats();
+#if !defined(RTL8720_HOST)
+            if (state == OtaState::Done) {
+                // Result çerçevesi gitsin; sonraki Start yeniden başlatmaya kadar reddedilir
+                serialManager.logPrintf("[App] Restarting into bank %s\n",
+                                        OtaUpdater::bankToString(OtaUpdater::getBootBank()));
+                delay(100);
+                NVIC_SystemReset();
+            }
+#endif
+            bootBefore = OtaUpdater::getBootBank();
+        }
+    }
+    // Çerçeve beklenirken uyu, güncelleme sürerken beklenmez
+    if (!ota.isActive()) delay(1);
+}
+#else
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x07, 0x01}, -55, 6, 3});
+    buildImage();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    serialManager.logPrintf("[App] Running bank %s\n", OtaUpdater::bankToString(OtaUpdater::getRunningBank()));
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    Wireless.poll();
+
+#if defined(RTL8720_HOST)
+    server.poll();
+#endif
+
+    switch (phase) {
+        case Phase::Connecting:
+            if (Wireless.getWiFiConnectState() == WiFiConnectState::Connected) {
+#if defined(RTL8720_HOST)
+                server.begin(SERVER_PORT, SERVER_ROUTES);
+#endif
+                enterPhase(Phase::Corrupted);
+            }
+            break;
+        case Phase::Corrupted:
+        case Phase::Update: {
+            OtaState state = httpSource.poll();
+            if (state != OtaState::Done && state != OtaState::Failed) {
+                // Güncelleme sırasında beklenmez: alım flash ile örtüşsün
+                return;
+            }
+            report();
+            if (phase == Phase::Corrupted) {
+                enterPhase(Phase::Update);
+                return;
+            }
+            enterPhase(Phase::Done);
+#if !defined(RTL8720_HOST)
+            if (state == OtaState::Done) {
+                serialManager.logPrintf("[App] Restarting into bank %s\n",
+                                        OtaUpdater::bankToString(OtaUpdater::getBootBank()));
+                delay(100);
+                NVIC_SystemReset();
+            }
+#endif
+            break;
+        }
+        case Phase::Done:
+            break;
+    }
+    delay(1);
+}
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @file power_profiles.ino
+ * @brief Power profile and transfer boost example
+ *
+ * PowerManager profilleri WiFi LPS/DTIM, CPU clock ve BLE advertising
+ * aralığını birlikte ayarlar. Sketch Balanced ile başlar, 60. saniyede
+ * LowPower'a geçer. Her UPLOAD_INTERVAL'de bir bulk upload yapılır:
+ * - Tek seferlik upload PowerBoost guard'ı ile Performance'a çıkar
+ * - Parça parça gelen trafik notifyTraffic() ile otomatik boost tetikler
+ * Transfer bitip hold süresi dolunca temel profile dönülür.
+ *
+ * Her STATUS_MS'de profil başına wake latency / duty cycle tahmini ve
+ * zaman ağırlıklı ortalama duty cycle yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <WirelessManager.h>
+#include <BleModule.h>
+#include <PowerManager.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+// Ağ bilgileri
+const char* WIFI_SSID = "MyNetwork";
+const char* WIFI_PASS = "password";
+
+const unsigned long UPLOAD_INTERVAL = 20000;
+const unsigned long STATUS_MS = 30000;
+const unsigned long LOW_POWER_AT = 60000;
+
+const size_t CHUNK_SIZE = 4096;
+const uint8_t CHUNKS = 16;
+
+BleModule ble;
+
+unsigned long nextUpload = 5000;
+unsigned long lastStatus = 0;
+bool guarded = true;
+bool lowPower = false;
+
+// Uygulamada socket yazımı; burada her parça ~50 ms sürer
+void sendChunk(size_t bytes) {
+    delay(50);
+    Power.notifyTraffic(bytes);
+}
+
+void upload() {
+    unsigned long start = millis();
+    if (guarded) {
+        PowerBoost boost;
+        for (uint8_t i = 0; i < CHUNKS; i++) sendChunk(CHUNK_SIZE);
+    } else {
+        for (uint8_t i = 0; i < CHUNKS; i++) sendChunk(CHUNK_SIZE);
+    }
+    serialManager.logPrintf("[App] Upload %u KB (%s) in %lu ms, active %s\n",
+                            (unsigned)(CHUNKS * CHUNK_SIZE / 1024),
+                            guarded ? "PowerBoost" : "notifyTraffic",
+                            millis() - start,
+                            PowerManager::profileToString(Power.getActiveProfile()));
+    guarded = !guarded;
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"MyNetwork", {0x02, 0x00, 0x00, 0x00, 0x03, 0x01}, -58, 36, 3});
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    ble.begin("RTL8720-Power");
+    ble.startAdvertising();
+    Power.begin(PowerProfile::Balanced, &ble);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS);
+}
+
+void loop() {
+    Wireless.poll();
+    Power.poll();
+
+    unsigned long now = millis();
+    if (!lowPower && now >= LOW_POWER_AT) {
+        lowPower = true;
+        Power.setProfile(PowerProfile::LowPower);
+    }
+
+    if (Wireless.getWiFiConnectState() == WiFiConnectState::Connected &&
+        static_cast<long>(now - nextUpload) >= 0) {
+        nextUpload = now + UPLOAD_INTERVAL;
+        upload();
+    }
+
+    if (now - lastStatus >= STATUS_MS) {
+        lastStatus = now;
+        Power.printStatus();
+    }
+
+    delay(10);
+}
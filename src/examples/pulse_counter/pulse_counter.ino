@@ -0,0 +1,89 @@
+/**
+ * @file pulse_counter.ino
+ * @brief Flow meter / fan tachometer example
+ *
+ * PulseCounter ile iki kanal ölçümü:
+ * - Fan tacho  : PIN_PWM4 üzerinde Capture (timer) modu
+ * - Flow meter : PIN_ADC0 (düz GPIO) üzerinde Interrupt modu
+ *
+ * Her gate sonunda frekans, toplam pulse ve tahmini CPU yükü yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <PulseCounter.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+// Gate süreleri
+const uint32_t FAN_GATE_MS = 500;       // Yüksek frekans - kısa gate yeterli
+const uint32_t FLOW_GATE_MS = 2000;     // Düşük frekans - reciprocal ölçüm
+
+// Flow meter kalibrasyonu (pulse / litre, sensör datasheet'inden)
+const float FLOW_PULSES_PER_LITRE = 450.0f;
+
+// Fan: 2 pulse / devir (standart 4-pin PC fanı)
+const float FAN_PULSES_PER_REV = 2.0f;
+
+PulseCounter fanTacho(PIN_PWM4, PulseEdge::Falling);
+PulseCounter flowMeter(PIN_ADC0, PulseEdge::Rising);
+
+void printMeasurement(const char* label, const PulseCounter& counter) {
+    const PulseMeasurement& m = counter.getMeasurement();
+    DEBUG_SERIAL.print(label);
+    DEBUG_SERIAL.print(counter.isCapture() ? " [CAP] " : " [IRQ] ");
+    DEBUG_SERIAL.print(m.frequencyHz, 2);
+    DEBUG_SERIAL.print(" Hz, count=");
+    DEBUG_SERIAL.print(m.count);
+    DEBUG_SERIAL.print(", total=");
+    DEBUG_SERIAL.print(counter.getTotalCount());
+    DEBUG_SERIAL.print(", cpu=");
+    DEBUG_SERIAL.print(counter.getCpuLoad() * 100.0f, 3);
+    DEBUG_SERIAL.println("%");
+}
+
+void setup() {
+    DEBUG_SERIAL.begin(DEBUG_BAUD_RATE);
+    delay(1000);
+
+    DEBUG_SERIAL.println();
+    Hardware.printInfo();
+
+    if (!fanTacho.begin(FAN_GATE_MS, PulseCounterMode::Auto)) {
+        DEBUG_SERIAL.println("Fan tacho baslatilamadi!");
+    }
+    if (!flowMeter.begin(FLOW_GATE_MS, PulseCounterMode::Interrupt)) {
+        DEBUG_SERIAL.println("Flow meter baslatilamadi!");
+    }
+
+#if defined(RTL8720_HOST)
+    // Host: 1800 RPM fan ve 5 L/min akış simülasyonu
+    hostsim::driveSquareWave(PIN_PWM4, 60.0f);
+    hostsim::driveSquareWave(PIN_ADC0, 37.5f);
+#endif
+
+    DEBUG_SERIAL.println("Pulse counter ready");
+    DEBUG_SERIAL.println();
+}
+
+void loop() {
+    if (fanTacho.poll()) {
+        printMeasurement("Fan ", fanTacho);
+        DEBUG_SERIAL.print("  RPM: ");
+        DEBUG_SERIAL.println(fanTacho.getFrequency() * 60.0f / FAN_PULSES_PER_REV, 0);
+    }
+
+    if (flowMeter.poll()) {
+        printMeasurement("Flow", flowMeter);
+        DEBUG_SERIAL.print("  L/min: ");
+        DEBUG_SERIAL.print(flowMeter.getFrequency() * 60.0f / FLOW_PULSES_PER_LITRE, 3);
+        DEBUG_SERIAL.print(", total L: ");
+        DEBUG_SERIAL.println(flowMeter.getTotalCount() / FLOW_PULSES_PER_LITRE, 3);
+    }
+}
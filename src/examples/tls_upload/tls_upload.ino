@@ -0,0 +1,257 @@
+/**
+ * @file tls_upload.ino
+ * @brief Periodic HTTPS uploads with a full vs. resumed TLS handshake, the
+ *        session kept in flash across (simulated) deep sleep
+ *
+ * Her upload: TLS bağlantısı, tek POST, cevap, kapat, uyku. Fazlar (her biri
+ * UPLOADS upload):
+ * - Full: resumption kapalı, her bağlantı tam handshake (ECDHE + sertifika)
+ * - Resumed: oturum TlsSessionCache ile flash'ta; her upload'dan önce deep
+ *   sleep uyanışı taklit edilir (TlsClient end() / begin(), cache RAM kopyası
+ *   bırakılır), oturum flash'tan okunup sunucuya önerilir
+ *
+ * Her upload'da handshake süresi ve byte'ı, faz sonunda ortalamalar ve resume
+ * oranı yazdırılır. Handshake'in kısalması radyonun açık kaldığı süreyi
+ * (uyanık kalma enerjisini) doğrudan azaltır.
+ *
+ * Host'ta localhost TLS sunucusu gerekir:
+ *   host/tls_server.py &
+ *   HOST_FLASH=/tmp/tls.bin host/build.sh src/examples/tls_upload -- --run-ms 60000
+ * Aynı HOST_FLASH ile ikinci çalıştırma gerçek bir uyanışı (reset) taklit
+ * eder: Resumed fazının ilk upload'ı da flash'taki oturumla resume edilir.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <Profiler.h>
+#include <WirelessManager.h>
+#include <TlsClient.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+#if defined(RTL8720_HOST)
+const IPAddress SERVER_IP(127, 0, 0, 1);
+const char* SERVER_NAME = "localhost";
+#else
+const IPAddress SERVER_IP(192, 168, 1, 10);
+const char* SERVER_NAME = "collector.local";
+#endif
+const uint16_t SERVER_PORT = 8443;
+
+// Collector'ın CA sertifikası (PEM); nullptr: sertifika doğrulanmaz (test sunucusu)
+const char* CA_PEM = nullptr;
+
+const uint32_t UPLOADS = 10;
+const uint32_t SLEEP_MS = 5000;
+
+enum class Phase : uint8_t {
+    Connecting,
+    Full,
+    Resumed,
+    Done
+};
+
+enum class Step : uint8_t {
+    Sleeping,
+    Handshake,
+    Sending,
+    Receiving
+};
+
+TlsSessionCache sessions;
+TlsClient tls;
+
+Phase phase = Phase::Connecting;
+Step step = Step::Sleeping;
+uint32_t uploads = 0;
+uint32_t errors = 0;
+unsigned long sleepStartMs = 0;
+uint32_t uploadStartTicks = 0;
+
+char request[192];
+size_t requestLength = 0;
+size_t requestOffset = 0;
+uint8_t reading[64];
+uint8_t response[128];
+size_t responseLength = 0;
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting:     return "Connecting";
+        case Phase::Full:           return "Full handshake";
+        case Phase::Resumed:        return "Resumed (flash session)";
+        case Phase::Done:           return "Done";
+        default:                    return "Unknown";
+    }
+}
+
+void enterPhase(Phase next) {
+    if (phase != Phase::Connecting) {
+        const TlsStats& s = tls.getStats();
+        serialManager.logPrintf("[App] %s: %lu uploads, %lu errors, resume %u%%, "
+                                "full avg %lu us (%lu bytes), resumed avg %lu us (%lu bytes)\n",
+                                phaseToString(phase), (unsigned long)uploads, (unsigned long)errors,
+                                tls.getResumeRate(), (unsigned long)tls.getAverageFullUs(),
+                                (unsigned long)(s.fullHandshakes ? s.fullBytesSum / s.fullHandshakes : 0),
+                                (unsigned long)tls.getAverageResumedUs(),
+                                (unsigned long)(s.resumedHandshakes ? s.resumedBytesSum / s.resumedHandshakes : 0));
+        tls.printStatus();
+    }
+
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    uploads = 0;
+    errors = 0;
+    step = Step::Sleeping;
+    sleepStartMs = millis() - SLEEP_MS;
+    tls.resetStats();
+}
+
+/**
+ * @brief Deep sleep uyanışı: RAM'deki TLS durumu kaybolur, flash kalır
+ */
+void wakeUp() {
+    tls.end();
+    sessions.forget();
+    tls.begin(CA_PEM, &sessions);
+    tls.setResumption(phase == Phase::Resumed);
+}
+
+void finishUpload(bool ok) {
+    uint32_t totalUs = static_cast<uint32_t>(Profiler::ticksToMicros(Profiler::ticks() - uploadStartTicks));
+    if (ok) {
+        serialManager.logPrintf("[App] Upload %lu: %s handshake %lu us, %lu bytes (tcp %lu us, total %lu us)\n",
+                                (unsigned long)uploads, tls.isResumed() ? "resumed" : "full",
+                                (unsigned long)tls.getHandshakeTimeUs(), (unsigned long)tls.getHandshakeBytes(),
+                                (unsigned long)tls.getConnectTimeUs(), (unsigned long)totalUs);
+    } else {
+        errors++;
+        serialManager.logPrintf("[App] Upload %lu failed (error -0x%04X)\n", (unsigned long)uploads,
+                                static_cast<unsigned>(-tls.getError()));
+    }
+    tls.close();
+    uploads++;
+    step = Step::Sleeping;
+    sleepStartMs = millis();
+}
+
+void startUpload() {
+    wakeUp();
+
+    memcpy(reading, &uploads, sizeof(uploads));
+    requestLength = snprintf(request, sizeof(request),
+                             "POST /upload HTTP/1.1\r\nHost: %s\r\n"
+                             "Content-Type: application/octet-stream\r\n"
+                             "Content-Length: %u\r\nConnection: close\r\n\r\n",
+                             SERVER_NAME, (unsigned)sizeof(reading));
+    requestOffset = 0;
+    responseLength = 0;
+    uploadStartTicks = Profiler::ticks();
+
+    if (!tls.connect(SERVER_IP, SERVER_PORT, SERVER_NAME)) {
+        finishUpload(false);
+        return;
+    }
+    step = Step::Handshake;
+}
+
+void serviceUpload() {
+    switch (step) {
+        case Step::Handshake: {
+            TlsState state = tls.poll();
+            if (state == TlsState::Connected) step = Step::Sending;
+            else if (state == TlsState::Failed) finishUpload(false);
+            break;
+        }
+        case Step::Sending: {
+            // Header, sonra body
+            const uint8_t* data;
+            size_t remaining;
+            if (requestOffset < requestLength) {
+                data = reinterpret_cast<const uint8_t*>(request) + requestOffset;
+                remaining = requestLength - requestOffset;
+            } else {
+                data = reading + (requestOffset - requestLength);
+                remaining = requestLength + sizeof(reading) - requestOffset;
+            }
+            int n = tls.write(data, remaining);
+            if (n < 0) {
+                finishUpload(false);
+                break;
+            }
+            requestOffset += n;
+            if (requestOffset == requestLength + sizeof(reading)) step = Step::Receiving;
+            break;
+        }
+        case Step::Receiving: {
+            // "Connection: close": cevap bağlantı kapanınca biter
+            int n = tls.read(response + responseLength, sizeof(response) - 1 - responseLength);
+            if (n > 0) {
+                responseLength += n;
+                if (responseLength < sizeof(response) - 1) break;
+            } else if (n == 0) {
+                break;
+            }
+            response[responseLength] = '\0';
+            finishUpload(strncmp(reinterpret_cast<char*>(response), "HTTP/1.1 2", 10) == 0);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x07, 0x01}, -55, 6, 3});
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Wireless.begin(true, false);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+
+    if (sessions.load()) {
+        serialManager.logPrintf("[App] Flash session: %u bytes\n", sessions.getSessionSize());
+    }
+}
+
+void loop() {
+    Wireless.poll();
+
+    switch (phase) {
+        case Phase::Connecting:
+            if (Wireless.getWiFiConnectState() == WiFiConnectState::Connected) enterPhase(Phase::Full);
+            break;
+        case Phase::Full:
+        case Phase::Resumed:
+            if (step != Step::Sleeping) {
+                // Upload sırasında beklenmez: handshake duvar saatiyle ölçülür
+                serviceUpload();
+                return;
+            }
+            if (uploads == UPLOADS) {
+                enterPhase(phase == Phase::Full ? Phase::Resumed : Phase::Done);
+            } else if (millis() - sleepStartMs >= SLEEP_MS) {
+                startUpload();
+                return;
+            }
+            break;
+        case Phase::Done:
+            break;
+    }
+    delay(1);
+}
@@ -0,0 +1,221 @@
+/**
+ * @file udp_telemetry.ino
+ * @brief Sensor readings over UDP: one packet per reading vs. batched packets
+ *
+ * 200 Hz ADC okumaları 12 byte'lık kayıtlar halinde UdpTelemetry ile
+ * collector'a gönderilir. Kayıt doğrudan paket buffer'ına yazılır
+ * (reserve / commit), paket lwIP'ye kopyalanmadan verilir.
+ *
+ * Fazlar (her biri PHASE_MS):
+ * - Unbatched: paket başına 1 kayıt (eski davranış)
+ * - Batched: paket dolana (116 kayıt) veya DEADLINE_MS dolana kadar toplanır
+ *
+ * Her faz sonunda paket sayısı, ortalama / en kötü gecikme ve (host'ta)
+ * kayıt başına WiFi airtime'ı yazdırılır. Host'ta collector datagram'ları
+ * loopback'ten okuyup paket ve kayıt sıra numaralarını doğrular.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <WirelessManager.h>
+#include <UdpTelemetry.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+const IPAddress COLLECTOR_IP(192, 168, 1, 10);
+const uint16_t COLLECTOR_PORT = 9000;
+
+const uint32_t SAMPLE_US = 5000;
+const uint16_t DEADLINE_MS = 250;
+const unsigned long PHASE_MS = 10000;
+
+// 12 byte kayıt
+struct Reading {
+    uint32_t seq;
+    uint32_t timeMs;
+    int16_t adc;
+    uint16_t flags;
+};
+
+static_assert(sizeof(Reading) == 12, "reading must be 12 bytes");
+
+enum class Phase : uint8_t {
+    Connecting,
+    Unbatched,
+    Batched,
+    Done
+};
+
+UdpTelemetry telemetry;
+
+Phase phase = Phase::Connecting;
+unsigned long phaseStartMs = 0;
+uint32_t lastSampleUs = 0;
+uint32_t readingSeq = 0;
+uint64_t airtimeAtPhase = 0;
+
+#if defined(RTL8720_HOST)
+// Collector tarafı
+uint32_t collectorPackets = 0;
+uint32_t collectorRecords = 0;
+uint32_t collectorPacketGaps = 0;
+uint32_t collectorRecordGaps = 0;
+uint32_t collectorNextPacket = 0;
+uint32_t collectorNextRecord = 0;
+bool collectorSynced = false;
+
+void collectorDrain() {
+    uint8_t datagram[UDP_TELEMETRY_PACKET_SIZE];
+    size_t length;
+    while ((length = hostsim::udpLoopbackPop(datagram, sizeof(datagram))) > 0) {
+        UdpTelemetryHeader header;
+        if (length < sizeof(header)) continue;
+        memcpy(&header, datagram, sizeof(header));
+        if (header.version != UDP_TELEMETRY_VERSION || header.recordSize != sizeof(Reading)) continue;
+
+        // Faz değişiminde seq sıfırlanır (begin): yeniden senkronize ol
+        if (header.seq == 0) collectorSynced = false;
+        if (collectorSynced && header.seq != collectorNextPacket) collectorPacketGaps++;
+        collectorNextPacket = header.seq + 1;
+        collectorPackets++;
+
+        for (uint16_t i = 0; i < header.count; i++) {
+            Reading r;
+            memcpy(&r, &datagram[sizeof(header) + i * sizeof(r)], sizeof(r));
+            if (collectorSynced && r.seq != collectorNextRecord) collectorRecordGaps++;
+            collectorSynced = true;
+            collectorNextRecord = r.seq + 1;
+            collectorRecords++;
+        }
+    }
+}
+
+int sensorWave(uint8_t pin, uint64_t timeUs) {
+    (void)pin;
+    return static_cast<int>((timeUs / 5000) % 1024);
+}
+#endif
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting: return "Connecting";
+        case Phase::Unbatched:  return "Unbatched";
+        case Phase::Batched:    return "Batched";
+        case Phase::Done:       return "Done";
+        default:                return "Unknown";
+    }
+}
+
+void printPhaseSummary() {
+    // Son paket tcpip thread'inde gönderilsin, sayaçlara girsin
+    telemetry.flush();
+    delay(5);
+    telemetry.poll();
+    telemetry.printStatus();
+
+    const UdpTelemetryStats& s = telemetry.getStats();
+    unsigned long elapsed = millis() - phaseStartMs;
+    serialManager.logPrintf("[App] %s: %lu packets/s, latency avg %lu ms / max %lu ms\n",
+                            phaseToString(phase),
+                            (unsigned long)(s.packets * 1000UL / elapsed),
+                            (unsigned long)(telemetry.getAverageLatencyUs() / 1000),
+                            (unsigned long)(s.latencyMaxUs / 1000));
+#if defined(RTL8720_HOST)
+    collectorDrain();
+    uint64_t airtime = hostsim::wifiTxAirtimeUs() - airtimeAtPhase;
+    serialManager.logPrintf("[App] %s: WiFi airtime %lu us/s, %lu us per reading\n",
+                            phaseToString(phase),
+                            (unsigned long)(airtime * 1000 / elapsed),
+                            (unsigned long)(s.sentRecords ? airtime / s.sentRecords : 0));
+    serialManager.logPrintf("[App] Collector: %lu packets, %lu readings, %lu packet gaps, %lu reading gaps\n",
+                            (unsigned long)collectorPackets, (unsigned long)collectorRecords,
+                            (unsigned long)collectorPacketGaps, (unsigned long)collectorRecordGaps);
+#endif
+}
+
+void enterPhase(Phase next) {
+    if (phase != Phase::Connecting) printPhaseSummary();
+
+    telemetry.end();
+    if (next == Phase::Unbatched || next == Phase::Batched) {
+        UdpTelemetryConfig config;
+        config.recordSize = sizeof(Reading);
+        config.maxRecords = next == Phase::Unbatched ? 1 : 0;
+        config.deadlineMs = DEADLINE_MS;
+        telemetry.begin(COLLECTOR_IP, COLLECTOR_PORT, config);
+        telemetry.resetStats();
+    }
+
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    phaseStartMs = millis();
+#if defined(RTL8720_HOST)
+    airtimeAtPhase = hostsim::wifiTxAirtimeUs();
+#endif
+}
+
+void sample() {
+    uint32_t now = micros();
+    if (now - lastSampleUs < SAMPLE_US) return;
+    lastSampleUs += SAMPLE_US;
+
+    // Kayıt doğrudan paket buffer'ına yazılır
+    Reading* r = reinterpret_cast<Reading*>(telemetry.reserve());
+    if (r == nullptr) return;
+    r->seq = readingSeq++;
+    r->timeMs = millis();
+    r->adc = static_cast<int16_t>(Hardware.readAdc(0));
+    r->flags = 0;
+    telemetry.commit();
+}
+
+void setup() {
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x04, 0x01}, -58, 6, 3});
+    hostsim::setAdcSource(PIN_ADC0, sensorWave);
+    hostsim::scheduleEvery(20000, collectorDrain, "collector");
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    Wireless.begin(true, false);
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    Wireless.poll();
+    telemetry.poll();
+
+    unsigned long now = millis();
+    switch (phase) {
+        case Phase::Connecting:
+            if (Wireless.getWiFiConnectState() == WiFiConnectState::Connected) {
+                enterPhase(Phase::Unbatched);
+                lastSampleUs = micros();
+            }
+            break;
+        case Phase::Unbatched:
+            if (now - phaseStartMs >= PHASE_MS) enterPhase(Phase::Batched);
+            break;
+        case Phase::Batched:
+            if (now - phaseStartMs >= PHASE_MS) enterPhase(Phase::Done);
+            break;
+        case Phase::Done:
+            break;
+    }
+
+    if (telemetry.isActive()) sample();
+    delay(1);
+}
@@ -0,0 +1,202 @@
+/**
+ * @file wifi_ble_coex.ino
+ * @brief WiFi bulk upload and BLE gateway scanning on the shared 2.4 GHz radio
+ *
+ * Cihaz aynı anda BLE tag'lerini tarar ve WiFi üzerinden bulk veri gönderir.
+ * Wireless.enableCoex() ile zaman periyotlara bölünür: scan window'u BLE
+ * slot'una daraltılır, gönderen taraf her chunk'tan önce grantWiFi() sorar.
+ *
+ * Fazlar:
+ * - Scan only: WiFi bulk yok, referans rapor oranı
+ * - Uncoordinated: bulk gönderim grantWiFi()'yi yok sayar (coex öncesi durum)
+ * - Coordinated: bulk gönderim sadece WiFi slot'unda
+ * - Idle: bulk biter, tarama ayarı geri gelir
+ *
+ * Her faz sonunda rapor oranı, WiFi throughput'u ve (host'ta) WiFi TX ile
+ * çakışıp kaybolan advertising event sayısı yazdırılır.
+ *
+ * Host senaryosu: kanal 6'da AP, 100 ms aralıklı 40 tag.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <WirelessManager.h>
+#include <BleModule.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#include <gap_scan.h>
+#else
+#include <WiFiUdp.h>
+#endif
+
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+const uint32_t CONNECT_TIMEOUT = 15000;
+
+const unsigned long PHASE_MS = 15000;
+const size_t CHUNK_SIZE = 1460;
+const uint8_t CHUNKS_PER_LOOP = 8;
+
+#if !defined(RTL8720_HOST)
+const IPAddress SINK_IP(192, 168, 1, 10);
+const uint16_t SINK_PORT = 9000;
+WiFiUDP udp;
+#endif
+
+enum class Phase : uint8_t {
+    Connecting,
+    ScanOnly,
+    Uncoordinated,
+    Coordinated,
+    Idle
+};
+
+BleModule ble;
+
+Phase phase = Phase::Connecting;
+unsigned long phaseStartMs = 0;
+uint32_t phaseBytes = 0;
+uint32_t phaseReports = 0;
+uint32_t phaseCollisions = 0;
+uint8_t chunk[CHUNK_SIZE];
+
+const char* phaseToString(Phase p) {
+    switch (p) {
+        case Phase::Connecting:     return "Connecting";
+        case Phase::ScanOnly:       return "Scan only";
+        case Phase::Uncoordinated:  return "Uncoordinated";
+        case Phase::Coordinated:    return "Coordinated";
+        case Phase::Idle:           return "Idle";
+        default:                    return "Unknown";
+    }
+}
+
+uint32_t collisionCount() {
+#if defined(RTL8720_HOST)
+    return hostsim::bleScanCollisionCount();
+#else
+    return 0;
+#endif
+}
+
+bool sendChunk(const uint8_t* data, size_t len) {
+#if defined(RTL8720_HOST)
+    (void)data;
+    return hostsim::wifiTransmit(len);
+#else
+    if (!udp.beginPacket(SINK_IP, SINK_PORT)) return false;
+    udp.write(data, len);
+    return udp.endPacket() == 1;
+#endif
+}
+
+void enterPhase(Phase next) {
+    unsigned long now = millis();
+    uint32_t reports = ble.getScanCache().getStats().reports;
+
+    if (phase != Phase::Connecting) {
+        unsigned long elapsed = now - phaseStartMs;
+        serialManager.logPrintf("[App] %s: %lu reports/s, WiFi %lu kB/s, %lu collisions\n",
+                                phaseToString(phase),
+                                (unsigned long)((reports - phaseReports) * 1000UL / elapsed),
+                                (unsigned long)(phaseBytes / elapsed),
+                                (unsigned long)(collisionCount() - phaseCollisions));
+    }
+
+    if (next == Phase::Uncoordinated) Wireless.beginWiFiBulk();
+    if (next == Phase::Idle) {
+        Wireless.endWiFiBulk();
+        Wireless.printStatus();
+    }
+
+    serialManager.logPrintf("[App] Phase: %s\n", phaseToString(next));
+    phase = next;
+    phaseStartMs = now;
+    phaseBytes = 0;
+    phaseReports = reports;
+    phaseCollisions = collisionCount();
+}
+
+void pumpUpload() {
+    if (phase != Phase::Uncoordinated && phase != Phase::Coordinated) return;
+    for (uint8_t i = 0; i < CHUNKS_PER_LOOP; i++) {
+        if (phase == Phase::Coordinated && !Wireless.grantWiFi()) break;
+        if (!sendChunk(chunk, sizeof(chunk))) break;
+        phaseBytes += sizeof(chunk);
+    }
+}
+
+#if defined(RTL8720_HOST)
+void setupHostScenario() {
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x03, 0x01}, -55, 6, 3});
+
+    for (uint8_t i = 0; i < 40; i++) {
+        hostsim::ScriptedBleDevice d = {};
+        d.addr[0] = i;
+        d.addr[5] = 0xC1;
+        d.addrType = GAP_REMOTE_ADDR_LE_RANDOM;
+        d.rssi = static_cast<int8_t>(-55 - i);
+        d.advType = GAP_ADV_EVT_TYPE_NON_CONNECTABLE;
+        d.intervalMs = 100;
+
+        BleAdvPayload payload;
+        payload.addFlags();
+        payload.addManufacturerData(0x0059, &i, 1);
+        memcpy(d.data, payload.data(), payload.length());
+        d.dataLen = payload.length();
+        hostsim::bleAddDevice(d);
+    }
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    for (size_t i = 0; i < sizeof(chunk); i++) {
+        chunk[i] = static_cast<uint8_t>(i);
+    }
+
+    ble.begin("RTL8720-Coex", BleRole::Central);
+    ble.beginScan(BleModule::defaultScanConfig());
+
+    Wireless.begin(true, false);
+    Wireless.enableCoex(CoexScheduler::defaultPolicy(), &ble);
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    ble.poll();
+    Wireless.poll();
+
+    unsigned long now = millis();
+    switch (phase) {
+        case Phase::Connecting:
+            if (Wireless.isWiFiConnected()) enterPhase(Phase::ScanOnly);
+            break;
+        case Phase::ScanOnly:
+            if (now - phaseStartMs >= PHASE_MS) enterPhase(Phase::Uncoordinated);
+            break;
+        case Phase::Uncoordinated:
+            if (now - phaseStartMs >= PHASE_MS) enterPhase(Phase::Coordinated);
+            break;
+        case Phase::Coordinated:
+            if (now - phaseStartMs >= PHASE_MS) enterPhase(Phase::Idle);
+            break;
+        case Phase::Idle:
+            break;
+    }
+
+    pumpUpload();
+    delay(1);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file wifi_connect.ino
+ * @brief Non-blocking WiFi connect example
+ *
+ * WirelessManager::connectWiFiAsync() hemen döner; bağlantı poll() ile
+ * ilerlerken loop() ADC örneklemeye ve LED desenine devam eder.
+ *
+ * LED:
+ * - Mavi yanıp söner : Associating
+ * - Sarı yanıp söner : DHCP
+ * - Yeşil            : Connected
+ * - Kırmızı          : Failed / link kaybı
+ *
+ * Bağlantı koparsa supervisor exponential backoff + jitter ile yeniden bağlanır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <RgbLed.h>
+#include <WirelessManager.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+// Ağ bilgileri
+const char* WIFI_SSID = "MyNetwork";
+const char* WIFI_PASS = "password";
+
+const unsigned long CONNECT_TIMEOUT = 20000;
+const unsigned long BLINK_MS = 250;
+const unsigned long SAMPLE_MS = 100;
+
+RgbLed rgbLed(PIN_LED_RED, PIN_LED_GREEN, PIN_LED_BLUE, LED_ACTIVE_LOW);
+
+unsigned long lastBlink = 0;
+unsigned long lastSample = 0;
+uint32_t sampleCount = 0;
+bool blinkOn = false;
+
+void onWiFiState(WiFiConnectState state, WiFiConnectState previous) {
+    DEBUG_SERIAL.print("[App] ");
+    DEBUG_SERIAL.print(WirelessManager::connectStateToString(previous));
+    DEBUG_SERIAL.print(" -> ");
+    DEBUG_SERIAL.print(WirelessManager::connectStateToString(state));
+    DEBUG_SERIAL.print(" (samples so far: ");
+    DEBUG_SERIAL.print(sampleCount);
+    DEBUG_SERIAL.println(")");
+}
+
+void onSupervisor(WiFiSupervisorEvent event, const WiFiSupervisorStats& stats) {
+    switch (event) {
+        case WiFiSupervisorEvent::LinkLost:
+            DEBUG_SERIAL.println("[App] Link down");
+            break;
+        case WiFiSupervisorEvent::RetryScheduled:
+            break;
+        case WiFiSupervisorEvent::Reconnected:
+            DEBUG_SERIAL.print("[App] Back online, total downtime ");
+            DEBUG_SERIAL.print(stats.totalDowntimeMs);
+            DEBUG_SERIAL.println(" ms");
+            break;
+        case WiFiSupervisorEvent::GaveUp:
+            DEBUG_SERIAL.println("[App] Giving up");
+            break;
+    }
+}
+
+void updateLed(WiFiConnectState state) {
+    if (state == WiFiConnectState::Connected) {
+        rgbLed.setColor(Color::Green);
+        return;
+    }
+    if (state == WiFiConnectState::Failed || state == WiFiConnectState::Idle) {
+        rgbLed.setColor(Color::Red);
+        return;
+    }
+
+    if (millis() - lastBlink < BLINK_MS) return;
+    lastBlink = millis();
+    blinkOn = !blinkOn;
+    Color color = (state == WiFiConnectState::Dhcp) ? Color::Yellow : Color::Blue;
+    rgbLed.setColor(blinkOn ? color : Color::None);
+}
+
+void setup() {
+    DEBUG_SERIAL.begin(DEBUG_BAUD_RATE);
+    delay(1000);
+
+    DEBUG_SERIAL.println();
+    Hardware.printInfo();
+
+#if defined(RTL8720_HOST)
+    hostsim::wifiAddNetwork({"MyNetwork", {0x02, 0x00, 0x00, 0x00, 0x00, 0x01}, -55, 36, 3});
+    hostsim::wifiSetConnectScript("MyNetwork", {1800, 700, true, {192, 168, 1, 42}});
+
+    // 1. dakikada 20 s, 5. dakikada 3 dk AP kesintisi
+    hostsim::scheduleAfter(60ULL * 1000000, [] { hostsim::wifiDropLink(20000); }, "ap_blip");
+    hostsim::scheduleAfter(300ULL * 1000000, [] { hostsim::wifiDropLink(180000); }, "ap_reboot");
+#endif
+
+    rgbLed.begin();
+    Wireless.begin(true, false);
+    Wireless.onWiFiStateChange(onWiFiState);
+    Wireless.onSupervisorEvent(onSupervisor);
+    Wireless.enableAutoReconnect();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    WiFiConnectState state = Wireless.poll();
+
+    // Bağlantı sürerken sensör örneklemesi devam eder
+    if (millis() - lastSample >= SAMPLE_MS) {
+        lastSample = millis();
+        Hardware.readAdc(0);
+        sampleCount++;
+    }
+
+    updateLed(state);
+}
@@ -0,0 +1,142 @@
+/**
+ * @file wifi_roaming.ino
+ * @brief RSSI-driven roaming between APs of the same SSID
+ *
+ * WirelessManager::enableRoaming() bağlı AP'nin RSSI'ını yumuşatarak izler.
+ * Eşik altına inince arka planda aynı SSID'yi tarar ve sadece hysteresis'i
+ * geçen daha güçlü BSSID'ye geçer. Tek seferlik RSSI düşüşleri yumuşatma
+ * sayesinde tarama tetiklemez.
+ *
+ * Her STATUS_MS'de ham / yumuşatılmış RSSI, bağlı BSSID ve roaming
+ * sayaçları (karar, handoff süresi) yazdırılır.
+ *
+ * LED:
+ * - Yeşil  : Connected
+ * - Mavi   : Associating / DHCP (handoff dahil)
+ * - Kırmızı: Failed / link kaybı
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <RgbLed.h>
+#include <WirelessManager.h>
+#include <WiFi.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+// Ağ bilgileri
+const char* WIFI_SSID = "Office";
+const char* WIFI_PASS = "password";
+
+const unsigned long CONNECT_TIMEOUT = 20000;
+const unsigned long STATUS_MS = 10000;
+
+RgbLed rgbLed(PIN_LED_RED, PIN_LED_GREEN, PIN_LED_BLUE, LED_ACTIVE_LOW);
+
+unsigned long lastStatus = 0;
+
+void onWiFiState(WiFiConnectState state, WiFiConnectState previous) {
+    serialManager.logPrintf("[App] %s -> %s\n",
+                            WirelessManager::connectStateToString(previous),
+                            WirelessManager::connectStateToString(state));
+
+    if (state == WiFiConnectState::Connected) {
+        rgbLed.setColor(Color::Green);
+    } else if (state == WiFiConnectState::Failed || state == WiFiConnectState::Idle) {
+        rgbLed.setColor(Color::Red);
+    } else {
+        rgbLed.setColor(Color::Blue);
+    }
+}
+
+void printStatus() {
+    const WiFiRoaming& roaming = Wireless.getRoaming();
+    const WiFiRoamingStats& stats = roaming.getStats();
+
+    uint8_t bssid[6];
+    WiFi.BSSID(bssid);
+    serialManager.logPrintf("[App] %lu s: %02X:%02X:%02X:%02X:%02X:%02X RSSI %d dBm (smoothed %d)\n",
+                            millis() / 1000,
+                            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5],
+                            Wireless.getWiFiRSSI(), roaming.getSmoothedRssi());
+    serialManager.logPrintf("[App] roam scans %lu (targeted %lu), roams %lu, stay %lu, "
+                            "no candidate %lu, failed %lu, last %s\n",
+                            (unsigned long)stats.scans, (unsigned long)stats.targetedScans,
+                            (unsigned long)stats.roams, (unsigned long)stats.stays,
+                            (unsigned long)stats.noCandidate, (unsigned long)stats.failed,
+                            WiFiRoaming::decisionToString(stats.lastDecision));
+    if (stats.roams > 0) {
+        serialManager.logPrintf("[App] handoff last %lu ms, avg %lu ms, max %lu ms\n",
+                                (unsigned long)stats.lastHandoffMs,
+                                (unsigned long)(stats.totalHandoffMs / stats.roams),
+                                (unsigned long)stats.maxHandoffMs);
+    }
+}
+
+#if defined(RTL8720_HOST)
+const hostsim::ScriptedNetwork AP_LOBBY = {"Office", {0x02, 0x00, 0x00, 0x00, 0x02, 0x01}, -52, 6, 3};
+const hostsim::ScriptedNetwork AP_LAB   = {"Office", {0x02, 0x00, 0x00, 0x00, 0x02, 0x02}, -90, 44, 3};
+
+void setupHostScenario() {
+    hostsim::wifiAddNetwork(AP_LOBBY);
+    hostsim::wifiAddNetwork(AP_LAB);
+    hostsim::wifiAddNetwork({"Guest", {0x02, 0x00, 0x00, 0x00, 0x02, 0x03}, -60, 11, 0});
+
+    // 15. saniyede tek örneklik düşüş: yumuşatma tarama tetiklememeli
+    hostsim::scheduleAfter(15ULL * 1000000, [] {
+        hostsim::ScriptedNetwork ap = AP_LOBBY;
+        ap.rssi = -85;
+        hostsim::wifiUpdateNetwork(ap);
+    }, "rssi_spike");
+    hostsim::scheduleAfter(16ULL * 1000000, [] { hostsim::wifiUpdateNetwork(AP_LOBBY); }, "rssi_spike_end");
+
+    // 30. saniyeden itibaren lobiden laba yürüme: her saniye 1 dB
+    static int step = 0;
+    hostsim::scheduleAfter(30ULL * 1000000, [] {
+        hostsim::scheduleEvery(1000000, [] {
+            if (step >= 36) return;
+            step++;
+            hostsim::ScriptedNetwork lobby = AP_LOBBY;
+            hostsim::ScriptedNetwork lab = AP_LAB;
+            lobby.rssi -= step;
+            lab.rssi += step;
+            hostsim::wifiUpdateNetwork(lobby);
+            hostsim::wifiUpdateNetwork(lab);
+        }, "walk");
+    }, "walk_start");
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    rgbLed.begin();
+    Wireless.begin(true, false);
+    Wireless.onWiFiStateChange(onWiFiState);
+    Wireless.enableAutoReconnect();
+    Wireless.enableRoaming();
+    Wireless.connectWiFiAsync(WIFI_SSID, WIFI_PASS, CONNECT_TIMEOUT);
+}
+
+void loop() {
+    Wireless.poll();
+
+    if (millis() - lastStatus >= STATUS_MS) {
+        lastStatus = millis();
+        printStatus();
+    }
+
+    delay(1);
+}
@@ -5,11 +5,15 @@
  * RTL8720DN dual-band WiFi ile ağ tarama örneği.
  * 2.4GHz ve 5.8GHz bantlarında erişilebilir ağları listeler.
  *
+ * Sonuçlar WiFiScanTable'a alınır ve RSSI'ya göre sıralanır. İlk taramada
+ * tüm tablo, sonraki taramalarda sadece WiFiApHistory deltası (yeni /
+ * kaybolan / RSSI'ı değişen / kanal değiştiren AP'ler) yazdırılır.
+ *
  * Çıktı:
  * - SSID (ağ adı)
  * - RSSI (sinyal gücü dBm)
+ * - Kanal ve bant (2.4G / 5G)
  * - Şifreleme tipi
- * - Kanal
  *
  * Desteklenen kartlar:
  * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
@@ -18,7 +22,14 @@
 
 #include <BoardConfig.h>
 #include <HardwareAbstraction.h>
+#include <SerialManager.h>
 #include <WiFiModule.h>
+#include <WiFiScanTable.h>
+#include <WiFiApHistory.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
 
 // Tarama aralığı
 const unsigned long SCAN_INTERVAL = 10000;  // 10 saniye
@@ -29,7 +40,39 @@ const uint8_t LED_PIN = PIN_LED_BLUE;
 // WiFi Module instance
 WiFiModule wifi;
 
+// Tarama sonuçları (sabit kapasite, heap kullanmaz)
+WiFiScanTable table;
+
+// BSSID geçmişi - taramalar arası fark
+WiFiApHistory history;
+bool firstScan = true;
+
+#if defined(RTL8720_HOST)
+void setupHostScenario() {
+    hostsim::wifiAddNetwork({"Office-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x01}, -54, 44, 3});
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x01, 0x02}, -61, 6, 4});
+    hostsim::wifiAddNetwork({"Warehouse-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x03}, -77, 149, 6});
+    hostsim::wifiAddNetwork({"Guest", {0x02, 0x00, 0x00, 0x00, 0x01, 0x04}, -83, 11, 0});
+
+    // 2. taramadan sonra: Guest kapanır, Office zayıflar, Warehouse kanal değiştirir
+    hostsim::scheduleAfter(20ULL * 1000000, [] {
+        const uint8_t guest[6] = {0x02, 0x00, 0x00, 0x00, 0x01, 0x04};
+        hostsim::wifiRemoveNetwork(guest);
+        hostsim::wifiUpdateNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x01, 0x02}, -72, 6, 4});
+        hostsim::wifiUpdateNetwork({"Warehouse-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x03}, -76, 157, 6});
+        hostsim::wifiUpdateNetwork({"Office-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x01}, -57, 44, 3});
+    }, "ap_changes");
+    hostsim::scheduleAfter(40ULL * 1000000, [] {
+        hostsim::wifiAddNetwork({"Lab", {0x02, 0x00, 0x00, 0x00, 0x01, 0x05}, -66, 1, 3});
+    }, "ap_new");
+}
+#endif
+
 void setup() {
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
     // Serial başlat
     DEBUG_SERIAL.begin(DEBUG_BAUD_RATE);
     delay(1000);
@@ -58,56 +101,97 @@ void setup() {
     DEBUG_SERIAL.println();
 }
 
-void scanNetworks() {
-    // LED'i aç (tarama başladı)
-    digitalWrite(LED_PIN, LOW);
+void printDelta(const WiFiApDelta& delta, void* user) {
+    DEBUG_SERIAL.print("  ");
+    DEBUG_SERIAL.print(WiFiApHistory::deltaTypeToString(delta.type));
+    serialManager.logPrintf(" %02X:%02X:%02X:%02X:%02X:%02X ch %u %d dBm",
+                            delta.bssid[0], delta.bssid[1], delta.bssid[2],
+                            delta.bssid[3], delta.bssid[4], delta.bssid[5],
+                            delta.channel, delta.rssi);
+    if (delta.ssid != nullptr) {
+        DEBUG_SERIAL.print(" ");
+        DEBUG_SERIAL.print(delta.ssid);
+    }
+    if (delta.moved) DEBUG_SERIAL.print(" (moved)");
+    DEBUG_SERIAL.println();
+}
 
-    DEBUG_SERIAL.println("Scanning networks...");
+void printTable(int numNetworks) {
+    if (numNetworks <= 0) {
+        DEBUG_SERIAL.println("No networks found!");
+        return;
+    }
+
+    DEBUG_SERIAL.print("Found ");
+    DEBUG_SERIAL.print(numNetworks);
+    DEBUG_SERIAL.println(" network(s):");
     DEBUG_SERIAL.println();
 
-    int numNetworks = wifi.scan();
+    // Tablo başlığı
+    DEBUG_SERIAL.println("  #  | RSSI  | Ch  | Band  | Encryption  | SSID");
+    DEBUG_SERIAL.println("-----|-------|-----|-------|-------------|------------------------");
+
+    for (int i = 0; i < numNetworks; i++) {
+        const WiFiNetworkInfo& info = table[i];
+
+        // Satır numarası
+        DEBUG_SERIAL.print(" ");
+        if (i < 9) DEBUG_SERIAL.print(" ");
+        DEBUG_SERIAL.print(i + 1);
+        DEBUG_SERIAL.print(" | ");
+
+        // RSSI
+        if (info.rssi > -100) DEBUG_SERIAL.print(" ");
+        DEBUG_SERIAL.print(info.rssi);
+        DEBUG_SERIAL.print(" | ");
+
+        // Kanal / bant
+        if (info.channel < 100) DEBUG_SERIAL.print(" ");
+        if (info.channel < 10) DEBUG_SERIAL.print(" ");
+        DEBUG_SERIAL.print(info.channel);
+        DEBUG_SERIAL.print(" | ");
+        DEBUG_SERIAL.print(info.is5GHz ? "5G   " : "2.4G ");
+        DEBUG_SERIAL.print(" | ");
+
+        // Şifreleme
+        const char* enc = WiFiModule::encryptionTypeToString(info.encryptionType);
+        DEBUG_SERIAL.print(enc);
+        // Padding
+        for (size_t j = strlen(enc); j < 11; j++) {
+            DEBUG_SERIAL.print(" ");
+        }
+        DEBUG_SERIAL.print(" | ");
 
-    if (numNetworks == 0) {
-        DEBUG_SERIAL.println("No networks found!");
-    } else {
-        DEBUG_SERIAL.print("Found ");
-        DEBUG_SERIAL.print(numNetworks);
-        DEBUG_SERIAL.println(" network(s):");
-        DEBUG_SERIAL.println();
+        // SSID
+        DEBUG_SERIAL.println(info.ssid);
 
-        // Tablo başlığı
-        DEBUG_SERIAL.println("  #  | RSSI  | Encryption  | SSID");
-        DEBUG_SERIAL.println("-----|-------|-------------|------------------------");
+        delay(10);  // Serial buffer için
+    }
+}
 
-        for (int i = 0; i < numNetworks; i++) {
-            WiFiNetworkInfo info;
-            if (!wifi.getNetworkInfo(i, info)) continue;
+void scanNetworks() {
+    // LED'i aç (tarama başladı)
+    digitalWrite(LED_PIN, LOW);
 
-            // Satır numarası
-            DEBUG_SERIAL.print(" ");
-            if (i < 9) DEBUG_SERIAL.print(" ");
-            DEBUG_SERIAL.print(i + 1);
-            DEBUG_SERIAL.print(" | ");
-
-            // RSSI
-            if (info.rssi > -100) DEBUG_SERIAL.print(" ");
-            DEBUG_SERIAL.print(info.rssi);
-            DEBUG_SERIAL.print(" | ");
-
-            // Şifreleme
-            const char* enc = WiFiModule::encryptionTypeToString(info.encryptionType);
-            DEBUG_SERIAL.print(enc);
-            // Padding
-            for (size_t j = strlen(enc); j < 11; j++) {
-                DEBUG_SERIAL.print(" ");
-            }
-            DEBUG_SERIAL.print(" | ");
-
-            // SSID
-            DEBUG_SERIAL.println(info.ssid);
-
-            delay(10);  // Serial buffer için
+    DEBUG_SERIAL.println("Scanning networks...");
+    DEBUG_SERIAL.println();
+
+    int numNetworks = wifi.scan(table);
+    table.sortByRssi();
+
+    if (firstScan) {
+        // Geçmişi doldur, tabloyu bir kez yazdır
+        history.update(table, nullptr);
+        printTable(numNetworks);
+        firstScan = false;
+    } else if (numNetworks >= 0) {
+        WiFiApDeltaSummary summary = history.update(table, printDelta);
+        if (summary.added + summary.removed + summary.changed == 0) {
+            DEBUG_SERIAL.println("  No changes");
         }
+        serialManager.logPrintf("Delta: +%u -%u ~%u, %u bytes (full table %u bytes)\n",
+                                summary.added, summary.removed, summary.changed,
+                                summary.deltaBytes, summary.fullBytes);
     }
 
     // LED'i kapat
@@ -0,0 +1,132 @@
+/**
+ * @file wifi_scan_async.ino
+ * @brief Non-blocking, streaming WiFi scan example
+ *
+ * WirelessManager::scanNetworksAsync() kanal kanal tarar; her AP kaydı
+ * bulunduğu kanal biter bitmez callback'e gelir. loop() tarama boyunca
+ * LED'i yakıp söndürmeye devam eder.
+ *
+ * Sırayla iki tarama yapılır:
+ * - Full sweep   : tüm kanallar, default dwell
+ * - Hedefli      : sadece 5 GHz, fast survey, TARGET_SSID görülünce durur
+ *
+ * Her tarama sonunda süre, kanal sayısı ve loop() içindeki en uzun
+ * boşluk yazdırılır.
+ *
+ * Desteklenen kartlar:
+ * - NICEMCU_8720_v1 (-DBOARD_NICEMCU)
+ * - BW16-Kit v1.2 (-DBOARD_BW16KIT)
+ */
+
+#include <BoardConfig.h>
+#include <HardwareAbstraction.h>
+#include <SerialManager.h>
+#include <Led.h>
+#include <WirelessManager.h>
+
+#if defined(RTL8720_HOST)
+#include <HostSim.h>
+#endif
+
+const char* TARGET_SSID = "Office-5G";
+
+const unsigned long SCAN_INTERVAL = 15000;
+const unsigned long BLINK_MS = 100;
+
+Led led(PIN_LED_BLUE, LED_ACTIVE_LOW);
+
+bool targeted = false;
+unsigned long nextScan = 0;
+unsigned long lastBlink = 0;
+unsigned long lastLoop = 0;
+unsigned long maxLoopGap = 0;
+
+bool onAp(const WiFiNetworkInfo& info, void* user) {
+    serialManager.logPrintf("  ch %3u %s %4ld dBm  %02X:%02X:%02X:%02X:%02X:%02X  %s\n",
+                            info.channel, info.is5GHz ? "5G " : "2.4",
+                            (long)info.rssi,
+                            info.bssid[0], info.bssid[1], info.bssid[2],
+                            info.bssid[3], info.bssid[4], info.bssid[5],
+                            info.ssid);
+    return true;
+}
+
+void startScan() {
+    WiFiScanOptions options = WiFiScanner::defaultOptions();
+    if (targeted) {
+        options.bands = WIFI_SCAN_BAND_5G;
+        options.dwellMs = WIFI_SCANNER_FAST_DWELL_MS;
+        options.stopOnSsid = TARGET_SSID;
+        serialManager.logPrintf("Targeted scan for %s (5 GHz, fast survey)\n", TARGET_SSID);
+    } else {
+        DEBUG_SERIAL.println("Full sweep");
+    }
+
+    maxLoopGap = 0;
+    if (!Wireless.scanNetworksAsync(options, onAp)) {
+        DEBUG_SERIAL.println("Scan not started");
+        nextScan = millis() + SCAN_INTERVAL;
+    }
+}
+
+void reportScan() {
+    const WiFiScanner& scanner = Wireless.getScanner();
+    serialManager.logPrintf("%s: %u APs, %u/%u channels, %lu ms, max loop gap %lu ms%s\n",
+                            WiFiScanner::stateToString(scanner.getState()),
+                            scanner.getRecordsDelivered(),
+                            scanner.getChannelsScanned(), scanner.getChannelCount(),
+                            (unsigned long)scanner.getElapsedMs(),
+                            maxLoopGap,
+                            scanner.foundTarget() ? " (target found)" : "");
+    DEBUG_SERIAL.println();
+}
+
+#if defined(RTL8720_HOST)
+void setupHostScenario() {
+    hostsim::wifiAddNetwork({"Office-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x01}, -54, 44, 3});
+    hostsim::wifiAddNetwork({"Office", {0x02, 0x00, 0x00, 0x00, 0x01, 0x02}, -61, 6, 4});
+    hostsim::wifiAddNetwork({"Warehouse-5G", {0x02, 0x00, 0x00, 0x00, 0x01, 0x03}, -77, 149, 6});
+    hostsim::wifiAddNetwork({"Guest", {0x02, 0x00, 0x00, 0x00, 0x01, 0x04}, -83, 11, 0});
+}
+#endif
+
+void setup() {
+#if defined(RTL8720_HOST)
+    setupHostScenario();
+#endif
+
+    serialManager.begin(DEBUG_BAUD_RATE, DATA_BAUD_RATE);
+    delay(1000);
+
+    led.begin();
+    Wireless.begin(true, false);
+    lastLoop = millis();
+}
+
+void loop() {
+    unsigned long now = millis();
+    if (now - lastLoop > maxLoopGap) maxLoopGap = now - lastLoop;
+    lastLoop = now;
+
+    WiFiScanner& scanner = Wireless.getScanner();
+    bool wasScanning = scanner.isScanning();
+    Wireless.poll();
+
+    if (wasScanning && !scanner.isScanning()) {
+        reportScan();
+        targeted = !targeted;
+        nextScan = millis() + SCAN_INTERVAL;
+    } else if (!scanner.isScanning() && static_cast<long>(now - nextScan) >= 0) {
+        startScan();
+    }
+
+    // Tarama sürerken LED yanıp söner
+    if (scanner.isScanning() && now - lastBlink >= BLINK_MS) {
+        lastBlink = now;
+        led.toggle();
+    } else if (!scanner.isScanning()) {
+        led.off();
+    }
+
+    delay(1);
+}